@@ -1,7 +1,7 @@
 /////////////////////////////////////////////////////////////////////////////
 // NxWidgets/UnitTests/CListBox/clistbox_main.cxx
 //
-//   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+//   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
 //   Author: Gregory Nutt <gnutt@nuttx.org>
 //
 // Redistribution and use in source and binary forms, with or without
@@ -247,6 +247,12 @@ int clistbox_main(int argc, char *argv[])
   updateMemoryUsage(g_mmPrevious, "clistbox_main: After sorting the listbox");
   sleep(1);
 
+  // Time redraws of the full listbox
+
+  message("clistbox_main: Time ListBox redraws\n");
+  test->timeRedraw(listbox);
+  updateMemoryUsage(g_mmPrevious, "clistbox_main: After timing redraws");
+
   // Select and remove items from the listbox
 
   srand(1978);
@@ -1,7 +1,7 @@
 /////////////////////////////////////////////////////////////////////////////
 // NxWidgets/UnitTests/CListBox/clistboxtest.cxx
 //
-//   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+//   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
 //   Author: Gregory Nutt <gnutt@nuttx.org>
 //
 // Redistribution and use in source and binary forms, with or without
@@ -42,6 +42,7 @@
 #include <nuttx/init.h>
 #include <cstdio>
 #include <cerrno>
+#include <ctime>
 #include <debug.h>
 
 #include <nuttx/nx/nx.h>
@@ -222,3 +223,26 @@ void CListBoxTest::showListBox(CListBox *listbox)
   listbox->enableDrawing();
   listbox->redraw();
 }
+
+// Redraw the listbox repeatedly and report the average time for one redraw.
+// Nearly all of the time is spent drawing text.
+
+void CListBoxTest::timeRedraw(CListBox *listbox)
+{
+  struct timespec start;
+  struct timespec end;
+
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (int i = 0; i < CONFIG_CLISTBOXTEST_NREDRAWS; i++)
+    {
+      listbox->redraw();
+    }
+  (void)clock_gettime(CLOCK_REALTIME, &end);
+
+  unsigned long elapsed = (end.tv_sec - start.tv_sec) * 1000000 +
+                          (end.tv_nsec - start.tv_nsec) / 1000;
+
+  message("CListBoxTest::timeRedraw: %d redraws in %lu usec (%lu usec each)\n",
+          CONFIG_CLISTBOXTEST_NREDRAWS, elapsed,
+          elapsed / CONFIG_CLISTBOXTEST_NREDRAWS);
+}
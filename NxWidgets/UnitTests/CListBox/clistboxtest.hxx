@@ -1,7 +1,7 @@
 /////////////////////////////////////////////////////////////////////////////
 // NxWidgets/UnitTests/CListBox/clistboxtest.hxx
 //
-//   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+//   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
 //   Author: Gregory Nutt <gnutt@nuttx.org>
 //
 // Redistribution and use in source and binary forms, with or without
@@ -65,6 +65,12 @@
 #  error "CONFIG_HAVE_CXX must be defined"
 #endif
 
+// The number of times that the widget is redrawn when timing redraws
+
+#ifndef CONFIG_CLISTBOXTEST_NREDRAWS
+#  define CONFIG_CLISTBOXTEST_NREDRAWS 20
+#endif
+
 #ifndef CONFIG_CLISTBOXTEST_BGCOLOR
 #  define CONFIG_CLISTBOXTEST_BGCOLOR CONFIG_NXWIDGETS_DEFAULT_BACKGROUNDCOLOR
 #endif
@@ -124,6 +130,10 @@ public:
   // (Re-)draw the listbox.
 
   void showListBox(CListBox *listbox);
+
+  // Redraw the listbox repeatedly and report the average time for one redraw
+
+  void timeRedraw(CListBox *listbox);
 };
 
 /////////////////////////////////////////////////////////////////////////////
@@ -1,7 +1,7 @@
 /////////////////////////////////////////////////////////////////////////////
 // NxWidgets/UnitTests/CTextBox/ctextbox_main.cxx
 //
-//   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+//   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
 //   Author: Gregory Nutt <gnutt@nuttx.org>
 //
 // Redistribution and use in source and binary forms, with or without
@@ -129,6 +129,12 @@ int ctextbox_main(int argc, char *argv[])
 
   usleep(500*1000);
   test->injectChars(textbox, sizeof(string2), (FAR const uint8_t*)string2);
+
+  // Time redraws of the completed text box
+
+  sleep(1);
+  printf("ctextbox_main: Time TextBox redraws\n");
+  test->timeRedraw(textbox);
   
   // Clean up and exit
 
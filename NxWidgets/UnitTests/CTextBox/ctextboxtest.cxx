@@ -1,7 +1,7 @@
 /////////////////////////////////////////////////////////////////////////////
 // NxWidgets/UnitTests/CTextBox/ctextboxtest.cxx
 //
-//   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+//   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
 //   Author: Gregory Nutt <gnutt@nuttx.org>
 //
 // Redistribution and use in source and binary forms, with or without
@@ -42,6 +42,7 @@
 #include <nuttx/init.h>
 #include <cstdio>
 #include <cerrno>
+#include <ctime>
 #include <unistd.h>
 #include <debug.h>
 
@@ -245,6 +246,29 @@ void CTextBoxTest::showTextBox(CTextBox *label)
   label->redraw();
 }
 
+// Redraw the textbox repeatedly and report the average time for one redraw.
+// Nearly all of the time is spent drawing text.
+
+void CTextBoxTest::timeRedraw(CTextBox *textbox)
+{
+  struct timespec start;
+  struct timespec end;
+
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (int i = 0; i < CONFIG_CTEXTBOXTEST_NREDRAWS; i++)
+    {
+      textbox->redraw();
+    }
+  (void)clock_gettime(CLOCK_REALTIME, &end);
+
+  unsigned long elapsed = (end.tv_sec - start.tv_sec) * 1000000 +
+                          (end.tv_nsec - start.tv_nsec) / 1000;
+
+  printf("CTextBoxTest::timeRedraw: %d redraws in %lu usec (%lu usec each)\n",
+         CONFIG_CTEXTBOXTEST_NREDRAWS, elapsed,
+         elapsed / CONFIG_CTEXTBOXTEST_NREDRAWS);
+}
+
 // Inject simulated keyboard characters into NX.
 
 void CTextBoxTest::injectChars(CTextBox *textbox, int nCh, FAR const uint8_t *string)
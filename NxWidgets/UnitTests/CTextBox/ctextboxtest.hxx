@@ -1,7 +1,7 @@
 /////////////////////////////////////////////////////////////////////////////
 // NxWidgets/UnitTests/CTextBox/ctextboxtest.hxx
 //
-//   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+//   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
 //   Author: Gregory Nutt <gnutt@nuttx.org>
 //
 // Redistribution and use in source and binary forms, with or without
@@ -67,6 +67,12 @@
 #  error "CONFIG_HAVE_CXX must be defined"
 #endif
 
+// The number of times that the widget is redrawn when timing redraws
+
+#ifndef CONFIG_CTEXTBOXTEST_NREDRAWS
+#  define CONFIG_CTEXTBOXTEST_NREDRAWS 20
+#endif
+
 #ifndef CONFIG_CTEXTBOXTEST_BGCOLOR
 #  define CONFIG_CTEXTBOXTEST_BGCOLOR CONFIG_NXWIDGETS_DEFAULT_BACKGROUNDCOLOR
 #endif
@@ -125,6 +131,10 @@ public:
 
   void showTextBox(CTextBox *label);
 
+  // Redraw the textbox repeatedly and report the average time for one redraw
+
+  void timeRedraw(CTextBox *textbox);
+
   // Inject simulated keyboard characters into NX.
 
   void injectChars(CTextBox *textbox, int nCh, FAR const uint8_t *string);
@@ -1,7 +1,7 @@
 /****************************************************************************
  * NxWidgets/libnxwidgets/include/cgraphicsport.hxx
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -76,6 +76,7 @@
  
 #include <nuttx/config.h>
 
+#include <sys/types.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -110,6 +111,8 @@ namespace NXWidgets
 #ifdef CONFIG_NX_WRITEONLY
     nxgl_mxpixel_t m_backColor;  /**< The background color to use */
 #endif
+    FAR uint8_t   *m_runBuffer;  /**< Scratch memory for text runs */
+    size_t         m_runSize;    /**< Size of the scratch memory */
 
     /**
      * The underlying implementation for drawText functions
@@ -128,6 +131,16 @@ namespace NXWidgets
                    const CNxString &string, int startIndex, int length,
                    nxgl_mxpixel_t background, bool transparent);
 
+    /**
+     * Get scratch memory for composing a text run.  The memory is kept
+     * between calls and is only reallocated when a larger run is drawn.
+     *
+     * @param size The number of bytes needed.
+     * @return The scratch memory or NULL if it could not be allocated.
+     */
+
+    FAR uint8_t *getRunBuffer(size_t size);
+
   public:
     /**
      * Constructor.
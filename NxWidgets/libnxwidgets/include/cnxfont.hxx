@@ -1,7 +1,7 @@
 /****************************************************************************
  * NxWidgets/libnxwidgets/include/cnxfont.hxx
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -48,6 +48,8 @@
 #include <nuttx/nx/nxglib.h>
 #include <nuttx/nx/nxfonts.h>
 
+#include "nxconfig.hxx"
+
 /****************************************************************************
  * Pre-Processor Definitions
  ****************************************************************************/
@@ -75,6 +77,20 @@ namespace NXWidgets
     FAR const struct nx_font_s *m_pFontSet; /** < The font set metrics */
     nxgl_mxpixel_t m_fontColor;             /**< Color to draw the font with when rendering. */
     nxgl_mxpixel_t m_transparentColor;      /**< Background color that should not be rendered. */
+#if CONFIG_NXWIDGETS_GLYPHCACHE > 0
+    /**
+     * Glyphs rendered for one pair of font and background colors.
+     */
+
+    struct SGlyphCache
+    {
+      FCACHE handle;                        /**< Cache of glyphs rendered on a background */
+      nxgl_mxpixel_t color;                 /**< Font color of the cached glyphs */
+      nxgl_mxpixel_t background;            /**< Background color of the cached glyphs */
+    };
+
+    struct SGlyphCache m_glyphCache[CONFIG_NXWIDGETS_GLYPHCOLORS]; /**< Glyph caches, most recently used first */
+#endif
 
   public:
 
@@ -94,7 +110,7 @@ namespace NXWidgets
      * CNxFont Destructor.
      */
 
-    ~CNxFont() { }
+    ~CNxFont();
 
     /**
      * Checks if supplied character is blank in the current font.
@@ -151,12 +167,51 @@ namespace NXWidgets
 
     /**
      * Draw an individual character of the font to the specified bitmap.
+     * The character is drawn at the top-left of the bitmap using the
+     * bitmap stride, so the bitmap may be part of a wider image.
      *
      * @param bitmap The bitmap to draw to.
      * @param letter The character to output.
      */
 
     void drawChar(FAR SBitmap *bitmap, nxwidget_char_t letter);
+
+#if CONFIG_NXWIDGETS_GLYPHCACHE > 0
+    /**
+     * Get an individual character of the font rendered in the current
+     * drawing color on an opaque background.  Glyphs are retained in a
+     * small cache so that repeated characters are rendered only once.  The
+     * returned glyph is as tall as the font and remains valid until the
+     * next call to getGlyph().
+     *
+     * @param letter The character to get.
+     * @param background The background color of the glyph.
+     * @return The rendered glyph or NULL if the character has no glyph
+     * (or if memory could not be allocated).
+     */
+
+    FAR const struct nxfonts_glyph_s *getGlyph(nxwidget_char_t letter,
+                                               nxgl_mxpixel_t background);
+#endif
+
+#ifdef CONFIG_NX_BLEND
+    /**
+     * Render the coverage of an individual character of the font into an
+     * 8-bit per pixel alpha map (0=transparent, 255=opaque).  The alpha map
+     * must be cleared by the caller.  Anti-aliased fonts keep their partial
+     * coverage.
+     *
+     * @param alpha The alpha map to draw to.
+     * @param width The width of the alpha map in pixels.
+     * @param height The height of the alpha map in rows.
+     * @param stride The width of one row of the alpha map in bytes.
+     * @param letter The character to output.
+     */
+
+    void drawCharAlpha(FAR uint8_t *alpha, nxgl_coord_t width,
+                       nxgl_coord_t height, unsigned int stride,
+                       nxwidget_char_t letter);
+#endif
     
     /**
      * Get the width of a string in pixels when drawn with this font.
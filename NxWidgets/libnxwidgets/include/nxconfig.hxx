@@ -96,6 +96,15 @@
  *   The smallest BPP configuration supported by NX.
  * CONFIG_NXWIDGETS_SIZEOFCHAR - Size of character {1 or 2 bytes}.  Default
  *   Determined by CONFIG_NXWIDGETS_SIZEOFCHAR
+ * CONFIG_NXWIDGETS_GLYPHCACHE - The maximum number of rendered glyphs
+ *   retained in the glyph cache of each font.  Opaque text is drawn from
+ *   the cache.  Zero disables the cache (it is always disabled at 24 BPP).
+ *   Default: 16
+ * CONFIG_NXWIDGETS_GLYPHCOLORS - The number of glyph caches kept by each
+ *   font.  Each cache holds glyphs rendered for one pair of font and
+ *   background colors so that a font shared by widgets with different
+ *   colors does not have to re-render its glyphs each time the colors
+ *   change.  Default: 4
  *
  * NXWidget Default Values
  *
@@ -336,6 +345,25 @@
 #  error "Unsupported character width (CONFIG_NXWIDGETS_SIZEOFCHAR)"
 #endif
 
+/* Rendered glyph cache.  The NX font cache does not support 24 BPP */
+
+#ifndef CONFIG_NXWIDGETS_GLYPHCACHE
+#  define CONFIG_NXWIDGETS_GLYPHCACHE 16
+#endif
+
+#if CONFIG_NXWIDGETS_BPP == 24
+#  undef CONFIG_NXWIDGETS_GLYPHCACHE
+#  define CONFIG_NXWIDGETS_GLYPHCACHE 0
+#endif
+
+#ifndef CONFIG_NXWIDGETS_GLYPHCOLORS
+#  define CONFIG_NXWIDGETS_GLYPHCOLORS 4
+#endif
+
+#if CONFIG_NXWIDGETS_GLYPHCOLORS < 1
+#  error "At least one glyph cache is required (CONFIG_NXWIDGETS_GLYPHCOLORS)"
+#endif
+
 /* NXWidget Default Values **************************************************/
 /**
  * Default font ID
@@ -375,3 +375,28 @@ bool CBgWindow::bitmap(FAR const struct nxgl_rect_s *pDest,
 
   return nx_bitmap(m_hWindow, pDest, &pSrc, pOrigin, stride) == OK;
 }
+
+#ifdef CONFIG_NX_BLEND
+/**
+ * Alpha-blend a rectangular region of a larger image, or a solid color,
+ * into the rectangle in the specified window.
+ *
+ * @param pDest Describes the rectangular on the display that will receive
+ * the blended image.
+ * @param pBlend The source image or color, alpha map, and opacity.
+ * @param pOrigin the pOrigin of the upper, left-most corner of the full
+ * image and alpha map. Both pDest and pOrigin are in window coordinates,
+ * however, pOrigin may lie outside of the display.
+ *
+ * @return True on success; false on failure.
+ */
+
+bool CBgWindow::blend(FAR const struct nxgl_rect_s *pDest,
+                      FAR const struct nxgl_blend_s *pBlend,
+                      FAR const struct nxgl_point_s *pOrigin)
+{
+  // Blend the image or color into a region on the display
+
+  return nx_blendbitmap(m_hWindow, pDest, pBlend, pOrigin) == OK;
+}
+#endif
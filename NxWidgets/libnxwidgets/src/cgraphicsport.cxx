@@ -1,7 +1,7 @@
 /****************************************************************************
  * NxWidgets/libnxwidgets/src/cgraphicsport.cxx
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -77,6 +77,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <cerrno>
+#include <cstring>
 #include <debug.h>
 
 #include <nuttx/nx/nxglib.h>
@@ -96,6 +97,14 @@
  * Pre-Processor Definitions
  ****************************************************************************/
 
+// Transparent text is blended by the NX server using an 8-bit per pixel
+// alpha map (no read-back of the background) if blending is available at
+// this pixel depth.
+
+#if defined(CONFIG_NX_BLEND) && CONFIG_NXWIDGETS_BPP >= 8
+#  define NXWIDGETS_BLENDTEXT 1
+#endif
+
 /****************************************************************************
  * Method Implementations
  ****************************************************************************/
@@ -115,11 +124,15 @@ CGraphicsPort::CGraphicsPort(INxWindow *pNxWnd, nxgl_mxpixel_t backColor)
 {
   m_pNxWnd    = pNxWnd;
   m_backColor = backColor;
+  m_runBuffer = (FAR uint8_t *)0;
+  m_runSize   = 0;
 }
 #else
 CGraphicsPort::CGraphicsPort(INxWindow *pNxWnd)
 {
-  m_pNxWnd = pNxWnd;
+  m_pNxWnd    = pNxWnd;
+  m_runBuffer = (FAR uint8_t *)0;
+  m_runSize   = 0;
 }
 #endif
 
@@ -132,6 +145,11 @@ CGraphicsPort::~CGraphicsPort(void)
   // m_pNxWnd is not deleted.  This is an abstract base class and
   // the caller of the CGraphicsPort instance is responsible for
   // the window destruction.
+
+  if (m_runBuffer)
+    {
+      delete[] m_runBuffer;
+    }
 };
 
 /**
@@ -718,7 +736,7 @@ void CGraphicsPort::_drawText(struct nxgl_point_s *pos, CRect *bound,
       endIndex = stringLength;
     }
 
-#ifdef CONFIG_NX_WRITEONLY
+#if defined(CONFIG_NX_WRITEONLY) && !defined(NXWIDGETS_BLENDTEXT)
   if (transparent)
     {
       // Can't render transparently without reading memory.
@@ -727,114 +745,260 @@ void CGraphicsPort::_drawText(struct nxgl_point_s *pos, CRect *bound,
       background = m_backColor;
     }
 #endif
-    
-  // Allocate a bit of memory to hold the largest rendered font
-
-  unsigned int bmWidth   = ((unsigned int)font->getMaxWidth() * CONFIG_NXWIDGETS_BPP + 7) >> 3;
-  unsigned int bmHeight  = (unsigned int)font->getHeight();
-
-  unsigned int glyphSize =  bmWidth * bmHeight;
-  FAR uint8_t  *glyph    =  new uint8_t[glyphSize];
 
   // Get the bounding rectangle in NX form
 
   struct nxgl_rect_s boundingBox;
   bound->getNxRect(&boundingBox);
-  
-  // Loop setup
 
-  struct SBitmap bitmap;
-  bitmap.bpp    = CONFIG_NXWIDGETS_BPP;
-  bitmap.fmt    = CONFIG_NXWIDGETS_FMT;
-  bitmap.data   = (FAR const nxgl_mxpixel_t*)glyph;
+  // Find the run of characters that lie at least partly within the bounding
+  // box.  The position is advanced past the whole sub-string, including any
+  // characters that are clipped.
 
-  // Loop for each letter in the sub-string
+  nxgl_coord_t fontHeight = (nxgl_coord_t)font->getHeight();
+  nxgl_coord_t runStart   = pos->x;
+  nxgl_coord_t runEnd     = pos->x - 1;
+  int          first      = endIndex;
+  int          last       = startIndex - 1;
 
   for (int i = startIndex; i < endIndex; i++)
     {
-      // Get the next letter in the string
+      struct nx_fontmetric_s metrics;
+      font->getCharMetrics(string.getCharAt(i), &metrics);
+      nxgl_coord_t fontWidth = (nxgl_coord_t)(metrics.width + metrics.xoffset);
 
-      const nxwidget_char_t letter = string.getCharAt(i);
+      if (pos->x + fontWidth > boundingBox.pt1.x && pos->x <= boundingBox.pt2.x)
+        {
+          if (first > i)
+            {
+              first    = i;
+              runStart = pos->x;
+            }
 
-      // Get the font metrics for this letter
+          last   = i;
+          runEnd = pos->x + fontWidth - 1;
+        }
 
-      struct nx_fontmetric_s metrics;
-      font->getCharMetrics(letter, &metrics);
+      pos->x += fontWidth;
+    }
 
-      // Get the width of the font (in pixels)
+  // Describe the destination of the run and get its intersection with the
+  // bounding box.  Nothing is drawn if the run is completely clipped.
 
-      nxgl_coord_t fontWidth  = (nxgl_coord_t)(metrics.width + metrics.xoffset);
+  struct nxgl_rect_s runRect;
+  runRect.pt1.x = runStart;
+  runRect.pt1.y = pos->y;
+  runRect.pt2.x = runEnd;
+  runRect.pt2.y = pos->y + fontHeight - 1;
 
-      // Does the letter have height?  Spaces have width, but no height
+  struct nxgl_rect_s intersection;
+  nxgl_rectintersect(&intersection, &runRect, &boundingBox);
 
-      if (metrics.height > 0 || !transparent)
-        {
-          // Set the current, effective size of the bitmap
+  if (first > last || nxgl_nullrect(&intersection))
+    {
+      return;
+    }
 
-          bitmap.width  = fontWidth;
-          bitmap.height = bmHeight;
-          bitmap.stride = (fontWidth * bitmap.bpp + 7) >> 3;
+  struct nxgl_point_s origin;
+  origin.x = runStart;
+  origin.y = pos->y;
+
+  nxgl_coord_t runWidth = runEnd - runStart + 1;
 
-          // Describe the destination of the font as a bounding box
+#ifdef NXWIDGETS_BLENDTEXT
+  if (transparent)
+    {
+      // Render the coverage of the whole run into one cleared alpha map and
+      // let NX blend the font color into the display
+
+      unsigned int astride = (unsigned int)runWidth;
+      FAR uint8_t *alpha   = getRunBuffer(astride * fontHeight);
+      if (!alpha)
+        {
+          return;
+        }
 
-          struct nxgl_rect_s dest;
-          dest.pt1.x = pos->x;
-          dest.pt1.y = pos->y;
-          dest.pt2.x = pos->x + fontWidth - 1;
-          dest.pt2.y = pos->y + bmHeight - 1;
+      memset(alpha, 0, astride * fontHeight);
 
-          // Get the interection of the font box and the bounding box
+      nxgl_coord_t x = 0;
+      for (int i = first; i <= last; i++)
+        {
+          const nxwidget_char_t letter = string.getCharAt(i);
 
-          struct nxgl_rect_s intersection;
-          nxgl_rectintersect(&intersection, &dest, &boundingBox);
+          struct nx_fontmetric_s metrics;
+          font->getCharMetrics(letter, &metrics);
+          nxgl_coord_t fontWidth = (nxgl_coord_t)(metrics.width + metrics.xoffset);
 
-          // Skip to the next character if this one is completely outside
-          // the bounding box.
+          // Spaces have width, but no height
 
-          if (!nxgl_nullrect(&intersection))
+          if (metrics.height > 0)
             {
-              // If we have been given a background color, use it to fill the array.
-              // Otherwise initialize the bitmap memory by reading from the display.
-              // The font renderer always renders the fonts on a transparent background.
-              
-              if (!transparent)
-                {
-                  // Set the glyph memory to the background color
-
-                  nxwidget_pixel_t *bmPtr   = (nxwidget_pixel_t *)bitmap.data;
-                  unsigned int      npixels = fontWidth * bmHeight;
-                  for (unsigned int j = 0; j < npixels; j++)
-                    {
-                      *bmPtr++ = background;
-                    }
-                }
-              else
-                {
-                  // Read the current contents of the destination into the glyph memory
+              font->drawCharAlpha(&alpha[x], fontWidth, fontHeight, astride,
+                                  letter);
+            }
 
-                  m_pNxWnd->getRectangle(&dest, &bitmap);
-                }
+          x += fontWidth;
+        }
 
-              // Render the font into the initialized bitmap
+      struct nxgl_blend_s blend;
+      blend.image   = NULL;
+      blend.stride  = 0;
+      blend.alpha   = alpha;
+      blend.astride = astride;
+      blend.color   = font->getColor();
+      blend.opacity = 255;
 
-              font->drawChar(&bitmap, letter);
+      if (!m_pNxWnd->blend(&intersection, &blend, &origin))
+        {
+          gvdbg("nx_blendbitmap failed: %d\n", errno);
+        }
+
+      return;
+    }
+#endif
+
+  // Get the scratch memory for the whole run
 
-              // Then put the font on the display
+  unsigned int stride = ((unsigned int)runWidth * CONFIG_NXWIDGETS_BPP + 7) >> 3;
+  FAR uint8_t *run    = getRunBuffer(stride * fontHeight);
+  if (!run)
+    {
+      return;
+    }
+
+  struct SBitmap bitmap;
+  bitmap.bpp    = CONFIG_NXWIDGETS_BPP;
+  bitmap.fmt    = CONFIG_NXWIDGETS_FMT;
+  bitmap.width  = runWidth;
+  bitmap.height = fontHeight;
+  bitmap.stride = stride;
+  bitmap.data   = (FAR const nxgl_mxpixel_t *)run;
 
-              if (!m_pNxWnd->bitmap(&intersection, (FAR const void *)bitmap.data,
-                                   pos, bitmap.stride))
+  // If we have been given a background color, use it to fill the run.
+  // Otherwise initialize the run by reading from the display.  The font
+  // renderer always renders the fonts on a transparent background.
+
+  if (!transparent)
+    {
+      // Fill the first row with the background color, then copy it
+
+#if CONFIG_NXWIDGETS_BPP == 24
+      FAR uint8_t *bmPtr = run;
+      for (nxgl_coord_t col = 0; col < runWidth; col++)
+        {
+          *bmPtr++ = (uint8_t)background;
+          *bmPtr++ = (uint8_t)(background >> 8);
+          *bmPtr++ = (uint8_t)(background >> 16);
+        }
+#else
+      FAR nxwidget_pixel_t *bmPtr = (FAR nxwidget_pixel_t *)run;
+      for (nxgl_coord_t col = 0; col < runWidth; col++)
+        {
+          *bmPtr++ = (nxwidget_pixel_t)background;
+        }
+#endif
+
+      for (nxgl_coord_t row = 1; row < fontHeight; row++)
+        {
+          memcpy(&run[row * stride], run, stride);
+        }
+    }
+  else
+    {
+      // Read the current contents of the destination into the run
+
+      m_pNxWnd->getRectangle(&runRect, &bitmap);
+    }
+
+  // Render each character into its part of the run
+
+  nxgl_coord_t x = 0;
+  for (int i = first; i <= last; i++)
+    {
+      const nxwidget_char_t letter = string.getCharAt(i);
+
+      struct nx_fontmetric_s metrics;
+      font->getCharMetrics(letter, &metrics);
+      nxgl_coord_t fontWidth = (nxgl_coord_t)(metrics.width + metrics.xoffset);
+
+      // Spaces have width, but no height
+
+      if (metrics.height > 0)
+        {
+          FAR uint8_t *dest = &run[((unsigned int)x * CONFIG_NXWIDGETS_BPP) >> 3];
+
+#if CONFIG_NXWIDGETS_GLYPHCACHE > 0
+          // Opaque text is copied from glyphs that the font has already
+          // rendered on the background color.
+
+          FAR const struct nxfonts_glyph_s *cached = (FAR const struct nxfonts_glyph_s *)0;
+          if (!transparent)
+            {
+              cached = font->getGlyph(letter, background);
+            }
+
+          if (cached)
+            {
+              FAR const uint8_t *src = cached->bitmap;
+              unsigned int nbytes = ((unsigned int)cached->width * CONFIG_NXWIDGETS_BPP + 7) >> 3;
+
+              for (int row = 0; row < cached->height && row < fontHeight; row++)
                 {
-                  gvdbg("nx_bitmapwindow failed: %d\n", errno);
+                  memcpy(dest, src, nbytes);
+                  dest += stride;
+                  src  += cached->stride;
                 }
             }
+          else
+#endif
+            {
+              // Render the font into its place in the run
+
+              struct SBitmap glyph;
+              glyph.bpp    = CONFIG_NXWIDGETS_BPP;
+              glyph.fmt    = CONFIG_NXWIDGETS_FMT;
+              glyph.width  = fontWidth;
+              glyph.height = fontHeight;
+              glyph.stride = stride;
+              glyph.data   = (FAR const nxgl_mxpixel_t *)dest;
+
+              font->drawChar(&glyph, letter);
+            }
         }
 
-      // Adjust the X position for the next character in the string        
+      x += fontWidth;
+    }
 
-      pos->x += fontWidth;
+  // Then put the whole run on the display
+
+  if (!m_pNxWnd->bitmap(&intersection, (FAR const void *)run, &origin, stride))
+    {
+      gvdbg("nx_bitmapwindow failed: %d\n", errno);
+    }
+}
+
+/**
+ * Get scratch memory for composing a text run.  The memory is kept
+ * between calls and is only reallocated when a larger run is drawn.
+ *
+ * @param size The number of bytes needed.
+ * @return The scratch memory or NULL if it could not be allocated.
+ */
+
+FAR uint8_t *CGraphicsPort::getRunBuffer(size_t size)
+{
+  if (size > m_runSize)
+    {
+      if (m_runBuffer)
+        {
+          delete[] m_runBuffer;
+        }
+
+      m_runBuffer = new uint8_t[size];
+      m_runSize   = m_runBuffer ? size : 0;
     }
 
-  delete glyph;
+  return m_runBuffer;
 }
 
 /**
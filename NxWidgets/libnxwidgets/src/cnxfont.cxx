@@ -1,7 +1,7 @@
 /****************************************************************************
  * NxWidgets/libnxwidgets/src/cnxfont.cxx
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -80,6 +80,29 @@ CNxFont::CNxFont(enum nx_fontid_e fontid, nxgl_mxpixel_t fontColor,
   m_pFontSet         = nxf_getfontset(m_fontHandle);
   m_fontColor        = fontColor;
   m_transparentColor = transparentColor;
+#if CONFIG_NXWIDGETS_GLYPHCACHE > 0
+  for (int i = 0; i < CONFIG_NXWIDGETS_GLYPHCOLORS; i++)
+    {
+      m_glyphCache[i].handle = (FCACHE)0;
+    }
+#endif
+}
+
+/**
+ * CNxFont Destructor.
+ */
+
+CNxFont::~CNxFont()
+{
+#if CONFIG_NXWIDGETS_GLYPHCACHE > 0
+  for (int i = 0; i < CONFIG_NXWIDGETS_GLYPHCOLORS; i++)
+    {
+      if (m_glyphCache[i].handle)
+        {
+          nxf_cache_disconnect(m_glyphCache[i].handle);
+        }
+    }
+#endif
 }
 
 /**
@@ -123,14 +146,119 @@ void CNxFont::drawChar(FAR SBitmap *bitmap, nxwidget_char_t letter)
 
       uint8_t fwidth  = fbm->metric.width + fbm->metric.xoffset;
       uint8_t fheight = fbm->metric.height + fbm->metric.yoffset;
-      uint8_t fstride = (fwidth * bitmap->bpp + 7) >> 3;
 
-      // Then render the glyph into the bitmap memory
+      // Then render the glyph into the bitmap memory.  The bitmap stride is
+      // used so that the glyph may be drawn into part of a wider bitmap.
 
       (void)FONT_RENDERER((FAR nxgl_mxpixel_t*)bitmap->data, fheight,
-                          fwidth, fstride, fbm, m_fontColor);
+                          fwidth, bitmap->stride, fbm, m_fontColor);
+    }
+}
+
+#if CONFIG_NXWIDGETS_GLYPHCACHE > 0
+/**
+ * Get an individual character of the font rendered in the current drawing
+ * color on an opaque background.
+ *
+ * @param letter The character to get.
+ * @param background The background color of the glyph.
+ * @return The rendered glyph or NULL if the character has no glyph.
+ */
+
+FAR const struct nxfonts_glyph_s *
+  CNxFont::getGlyph(nxwidget_char_t letter, nxgl_mxpixel_t background)
+{
+  // The cached glyphs are only good for one pair of colors.  Look for the
+  // cache of this pair.  Fonts (the system font in particular) are shared
+  // by widgets with different backgrounds, so a few caches are kept.
+
+  int index;
+  for (index = 0; index < CONFIG_NXWIDGETS_GLYPHCOLORS - 1; index++)
+    {
+      if (!m_glyphCache[index].handle ||
+          (m_glyphCache[index].color == m_fontColor &&
+           m_glyphCache[index].background == background))
+        {
+          break;
+        }
+    }
+
+  // If no cache matches, then 'index' refers to an unused entry or to the
+  // least recently used cache.  Replace it with a cache for this pair.
+
+  struct SGlyphCache cache = m_glyphCache[index];
+  if (cache.handle &&
+      (cache.color != m_fontColor || cache.background != background))
+    {
+      nxf_cache_disconnect(cache.handle);
+      cache.handle = (FCACHE)0;
+    }
+
+  if (!cache.handle)
+    {
+      cache.handle = nxf_cache_connect(m_fontHandle, m_fontColor, background,
+                                       CONFIG_NXWIDGETS_BPP,
+                                       CONFIG_NXWIDGETS_GLYPHCACHE);
+      cache.color      = m_fontColor;
+      cache.background = background;
+    }
+
+  // If the cache could not be created, move the unused entry to the end of
+  // the list so that the caches in use stay ahead of it.
+
+  if (!cache.handle)
+    {
+      for (; index < CONFIG_NXWIDGETS_GLYPHCOLORS - 1; index++)
+        {
+          m_glyphCache[index] = m_glyphCache[index + 1];
+        }
+
+      m_glyphCache[index] = cache;
+      return (FAR const struct nxfonts_glyph_s *)0;
+    }
+
+  // Move the cache to the front of the list so that the least recently
+  // used cache is always the last one.
+
+  for (; index > 0; index--)
+    {
+      m_glyphCache[index] = m_glyphCache[index - 1];
+    }
+
+  m_glyphCache[0] = cache;
+
+  return nxf_cache_getglyph(cache.handle, (uint16_t)letter);
+}
+#endif
+
+#ifdef CONFIG_NX_BLEND
+/**
+ * Render the coverage of an individual character of the font into an
+ * 8-bit per pixel alpha map.
+ *
+ * @param alpha The alpha map to draw to.
+ * @param width The width of the alpha map in pixels.
+ * @param height The height of the alpha map in rows.
+ * @param stride The width of one row of the alpha map in bytes.
+ * @param letter The character to output.
+ */
+
+void CNxFont::drawCharAlpha(FAR uint8_t *alpha, nxgl_coord_t width,
+                            nxgl_coord_t height, unsigned int stride,
+                            nxwidget_char_t letter)
+{
+  // Get the NX bitmap associated with the font
+
+  FAR const struct nx_fontbitmap_s *fbm;
+  fbm = nxf_getbitmap(m_fontHandle, letter);
+  if (fbm)
+    {
+      // Then render the glyph coverage into the alpha map
+
+      (void)nxf_convertalpha(alpha, height, width, stride, fbm);
     }
 }
+#endif
 
 /**
  * Get the width of a string in pixels when drawn with this font.
@@ -0,0 +1,440 @@
+/****************************************************************************
+ * examples/ftltest/ftltest_main.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <nuttx/fs/fs.h>
+#include <nuttx/fs/ioctl.h>
+#include <nuttx/mtd.h>
+
+/****************************************************************************
+ * Definitions
+ ****************************************************************************/
+/* Configuration ************************************************************/
+
+/* This must exactly match the default configuration in drivers/mtd/rammtd.c */
+
+#ifndef CONFIG_RAMMTD_ERASESIZE
+#  define CONFIG_RAMMTD_ERASESIZE 4096
+#endif
+
+#ifndef CONFIG_EXAMPLES_FTLTEST_NEBLOCKS
+#  define CONFIG_EXAMPLES_FTLTEST_NEBLOCKS 64
+#endif
+
+#ifndef CONFIG_EXAMPLES_FTLTEST_NWRITES
+#  define CONFIG_EXAMPLES_FTLTEST_NWRITES 5000
+#endif
+
+#ifndef CONFIG_EXAMPLES_FTLTEST_MAXSECTORS
+#  define CONFIG_EXAMPLES_FTLTEST_MAXSECTORS 4
+#endif
+
+#define FTLTEST_BUFSIZE \
+  (CONFIG_RAMMTD_ERASESIZE * CONFIG_EXAMPLES_FTLTEST_NEBLOCKS)
+
+/* The FTL is bound twice to the same FLASH:  Once to write the data and
+ * once more to check that everything can be found again.
+ */
+
+#define FTLTEST_MINOR1    6
+#define FTLTEST_DEVNAME1  "/dev/mtdblock6"
+#define FTLTEST_MINOR2    7
+#define FTLTEST_DEVNAME2  "/dev/mtdblock7"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The RAM MTD device is wrapped so that every program and erase operation
+ * performed by the FTL can be counted.
+ */
+
+struct ftltest_mtd_s
+{
+  struct mtd_dev_s mtd;           /* Must be first */
+  FAR struct mtd_dev_s *lower;    /* The RAM MTD device */
+  uint32_t nprogrammed;           /* Number of blocks programmed */
+  uint32_t nerased;               /* Number of erase blocks erased */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static uint8_t g_simflash[FTLTEST_BUFSIZE];
+static struct ftltest_mtd_s g_wrapper;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: ftltest_erase, ftltest_bread, ftltest_bwrite, ftltest_read,
+ *       ftltest_ioctl
+ *
+ * Description:
+ *   Counting wrappers around the RAM MTD device methods
+ *
+ ****************************************************************************/
+
+static int ftltest_erase(FAR struct mtd_dev_s *dev, off_t startblock,
+                         size_t nblocks)
+{
+  FAR struct ftltest_mtd_s *priv = (FAR struct ftltest_mtd_s *)dev;
+
+  priv->nerased += nblocks;
+  return MTD_ERASE(priv->lower, startblock, nblocks);
+}
+
+static ssize_t ftltest_bread(FAR struct mtd_dev_s *dev, off_t startblock,
+                             size_t nblocks, FAR uint8_t *buffer)
+{
+  FAR struct ftltest_mtd_s *priv = (FAR struct ftltest_mtd_s *)dev;
+  return MTD_BREAD(priv->lower, startblock, nblocks, buffer);
+}
+
+static ssize_t ftltest_bwrite(FAR struct mtd_dev_s *dev, off_t startblock,
+                              size_t nblocks, FAR const uint8_t *buffer)
+{
+  FAR struct ftltest_mtd_s *priv = (FAR struct ftltest_mtd_s *)dev;
+
+  priv->nprogrammed += nblocks;
+  return MTD_BWRITE(priv->lower, startblock, nblocks, buffer);
+}
+
+static ssize_t ftltest_read(FAR struct mtd_dev_s *dev, off_t offset,
+                            size_t nbytes, FAR uint8_t *buffer)
+{
+  FAR struct ftltest_mtd_s *priv = (FAR struct ftltest_mtd_s *)dev;
+  return MTD_READ(priv->lower, offset, nbytes, buffer);
+}
+
+static int ftltest_ioctl(FAR struct mtd_dev_s *dev, int cmd,
+                         unsigned long arg)
+{
+  FAR struct ftltest_mtd_s *priv = (FAR struct ftltest_mtd_s *)dev;
+
+  if (cmd == MTDIOC_BULKERASE)
+    {
+      priv->nerased += CONFIG_EXAMPLES_FTLTEST_NEBLOCKS;
+    }
+
+  return MTD_IOCTL(priv->lower, cmd, arg);
+}
+
+/****************************************************************************
+ * Name: ftltest_fill
+ *
+ * Description:
+ *   Fill a sector buffer with a pattern that depends on the logical sector
+ *   number and its version.
+ *
+ ****************************************************************************/
+
+static void ftltest_fill(FAR uint8_t *buffer, size_t size, size_t sector,
+                         uint16_t version)
+{
+  size_t i;
+
+  for (i = 0; i < size; i++)
+    {
+      buffer[i] = (uint8_t)(sector * 7 + version * 13 + i);
+    }
+}
+
+/****************************************************************************
+ * Name: ftltest_open
+ *
+ * Description:
+ *   Bind a new FTL instance to the wrapped RAM MTD device and open it.
+ *
+ ****************************************************************************/
+
+static int ftltest_open(int minor, FAR const char *devname,
+                        FAR struct inode **inode, FAR struct geometry *geo)
+{
+  int ret;
+
+  ret = ftl_initialize(minor, &g_wrapper.mtd);
+  if (ret < 0)
+    {
+      printf("ERROR: FTL initialization failed: %d\n", -ret);
+      return ret;
+    }
+
+  ret = open_blockdriver(devname, 0, inode);
+  if (ret < 0)
+    {
+      printf("ERROR: Failed to open %s: %d\n", devname, -ret);
+      return ret;
+    }
+
+  ret = (*inode)->u.i_bops->geometry(*inode, geo);
+  if (ret < 0)
+    {
+      printf("ERROR: Failed to get the geometry of %s: %d\n", devname, -ret);
+      close_blockdriver(*inode);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: ftltest_verify
+ ****************************************************************************/
+
+static int ftltest_verify(FAR struct inode *inode, FAR uint16_t *versions,
+                          size_t nsectors, FAR uint8_t *buffer,
+                          FAR uint8_t *expected, size_t size)
+{
+  ssize_t nread;
+  size_t sector;
+  int errors = 0;
+
+  for (sector = 0; sector < nsectors; sector++)
+    {
+      ftltest_fill(expected, size, sector, versions[sector]);
+
+      nread = inode->u.i_bops->read(inode, buffer, sector, 1);
+      if (nread != 1 || memcmp(buffer, expected, size) != 0)
+        {
+          printf("ERROR: Sector %lu is corrupted: %ld\n",
+                 (unsigned long)sector, (long)nread);
+          errors++;
+        }
+    }
+
+  return errors;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * ftltest_main
+ ****************************************************************************/
+
+int ftltest_main(int argc, char *argv[])
+{
+  FAR struct inode *inode;
+  FAR uint16_t *versions;
+  FAR uint8_t *buffer;
+  FAR uint8_t *expected;
+  struct geometry geo;
+  uint32_t nhostwrites;
+  uint32_t wa;
+  size_t nsectors;
+  size_t sector;
+  size_t count;
+  size_t size;
+  size_t j;
+  ssize_t nxfrd;
+  int errors;
+  int ret;
+  int i;
+
+  /* Create and wrap the RAM MTD device and start with erased FLASH */
+
+  memset(&g_wrapper, 0, sizeof(struct ftltest_mtd_s));
+  g_wrapper.lower = rammtd_initialize(g_simflash, FTLTEST_BUFSIZE);
+  if (!g_wrapper.lower)
+    {
+      printf("ERROR: Failed to create the RAM MTD instance\n");
+      return 1;
+    }
+
+  g_wrapper.mtd.erase  = ftltest_erase;
+  g_wrapper.mtd.bread  = ftltest_bread;
+  g_wrapper.mtd.bwrite = ftltest_bwrite;
+  g_wrapper.mtd.read   = ftltest_read;
+  g_wrapper.mtd.ioctl  = ftltest_ioctl;
+
+  ret = MTD_IOCTL(g_wrapper.lower, MTDIOC_BULKERASE, 0);
+  if (ret < 0)
+    {
+      printf("ERROR: Failed to erase the RAM MTD device: %d\n", -ret);
+      return 1;
+    }
+
+  ret = ftltest_open(FTLTEST_MINOR1, FTLTEST_DEVNAME1, &inode, &geo);
+  if (ret < 0)
+    {
+      return 1;
+    }
+
+  nsectors = geo.geo_nsectors;
+  size     = geo.geo_sectorsize;
+
+  versions = (FAR uint16_t *)malloc(nsectors * sizeof(uint16_t));
+  buffer   = (FAR uint8_t *)
+    malloc((CONFIG_EXAMPLES_FTLTEST_MAXSECTORS + 1) * size);
+  if (!versions || !buffer)
+    {
+      printf("ERROR: Failed to allocate buffers\n");
+      ret = -ENOMEM;
+      goto errout_with_buffers;
+    }
+
+  expected = buffer + CONFIG_EXAMPLES_FTLTEST_MAXSECTORS * size;
+
+  printf("FTL write test:\n");
+  printf("  Erase blocks:    %d\n", CONFIG_EXAMPLES_FTLTEST_NEBLOCKS);
+  printf("  Sector size:     %lu\n", (unsigned long)size);
+  printf("  Sectors:         %lu\n", (unsigned long)nsectors);
+  printf("  Writes:          %d\n", CONFIG_EXAMPLES_FTLTEST_NWRITES);
+
+  /* Write every sector once */
+
+  memset(versions, 0, nsectors * sizeof(uint16_t));
+  for (sector = 0; sector < nsectors; sector++)
+    {
+      ftltest_fill(buffer, size, sector, 0);
+      nxfrd = inode->u.i_bops->write(inode, buffer, sector, 1);
+      if (nxfrd != 1)
+        {
+          printf("ERROR: Failed to write sector %lu: %ld\n",
+                 (unsigned long)sector, (long)nxfrd);
+          ret = -EIO;
+          goto errout_with_buffers;
+        }
+    }
+
+  /* Then perform short writes at random locations.  Only these are
+   * counted.
+   */
+
+  g_wrapper.nprogrammed = 0;
+  g_wrapper.nerased     = 0;
+  nhostwrites           = 0;
+
+  srand(1);
+  for (i = 0; i < CONFIG_EXAMPLES_FTLTEST_NWRITES; i++)
+    {
+      count  = 1 + rand() % CONFIG_EXAMPLES_FTLTEST_MAXSECTORS;
+      sector = rand() % (nsectors - count + 1);
+
+      for (j = 0; j < count; j++)
+        {
+          versions[sector + j]++;
+          ftltest_fill(&buffer[j * size], size, sector + j,
+                       versions[sector + j]);
+        }
+
+      nxfrd = inode->u.i_bops->write(inode, buffer, sector, count);
+      if (nxfrd != (ssize_t)count)
+        {
+          printf("ERROR: Failed to write sectors %lu-%lu: %ld\n",
+                 (unsigned long)sector, (unsigned long)(sector + count - 1),
+                 (long)nxfrd);
+          ret = -EIO;
+          goto errout_with_buffers;
+        }
+
+      nhostwrites += count;
+    }
+
+  /* Verify every sector, then write any buffered data to FLASH and close
+   * the device.
+   */
+
+  errors = ftltest_verify(inode, versions, nsectors, buffer, expected, size);
+
+  ret = inode->u.i_bops->ioctl(inode, BIOC_FLUSH, 0);
+  if (ret < 0)
+    {
+      printf("ERROR: Failed to flush %s: %d\n", FTLTEST_DEVNAME1, -ret);
+      errors++;
+    }
+
+  close_blockdriver(inode);
+  (void)unregister_blockdriver(FTLTEST_DEVNAME1);
+
+  /* Report the write amplification (blocks programmed per sector written)
+   * and the number of erasures.
+   */
+
+  wa = (100 * g_wrapper.nprogrammed) / nhostwrites;
+  printf("\nResults:\n");
+  printf("  Sectors written:     %lu\n", (unsigned long)nhostwrites);
+  printf("  Blocks programmed:   %lu\n", (unsigned long)g_wrapper.nprogrammed);
+  printf("  Write amplification: %lu.%02lu\n",
+         (unsigned long)(wa / 100), (unsigned long)(wa % 100));
+  printf("  Erasures:            %lu\n", (unsigned long)g_wrapper.nerased);
+
+  /* Bind a new FTL instance to the same FLASH and verify again */
+
+  ret = ftltest_open(FTLTEST_MINOR2, FTLTEST_DEVNAME2, &inode, &geo);
+  if (ret < 0)
+    {
+      goto errout_with_buffers;
+    }
+
+  if (geo.geo_nsectors != nsectors)
+    {
+      printf("ERROR: Sector count changed from %lu to %lu\n",
+             (unsigned long)nsectors, (unsigned long)geo.geo_nsectors);
+      errors++;
+    }
+  else
+    {
+      errors += ftltest_verify(inode, versions, nsectors, buffer, expected,
+                               size);
+    }
+
+  close_blockdriver(inode);
+  (void)unregister_blockdriver(FTLTEST_DEVNAME2);
+
+  printf("\n%s: %d errors\n", errors ? "FAILED" : "PASSED", errors);
+  ret = errors ? -EIO : OK;
+
+errout_with_buffers:
+  free(versions);
+  free(buffer);
+  return ret < 0 ? 1 : 0;
+}
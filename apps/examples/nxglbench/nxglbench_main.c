@@ -0,0 +1,429 @@
+/****************************************************************************
+ * examples/nxglbench/nxglbench_main.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <nuttx/fb.h>
+#include <nuttx/nx/nxglib.h>
+
+/****************************************************************************
+ * Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_NXGLBENCH_VPLANE
+#  define CONFIG_EXAMPLES_NXGLBENCH_VPLANE 0
+#endif
+
+#ifndef CONFIG_EXAMPLES_NXGLBENCH_NLOOPS
+#  define CONFIG_EXAMPLES_NXGLBENCH_NLOOPS 32
+#endif
+
+#define NLOOPS CONFIG_EXAMPLES_NXGLBENCH_NLOOPS
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+typedef void (*fill_t)(FAR struct fb_planeinfo_s *pinfo,
+                       FAR const struct nxgl_rect_s *rect, uint32_t color);
+typedef void (*move_t)(FAR struct fb_planeinfo_s *pinfo,
+                       FAR const struct nxgl_rect_s *rect,
+                       FAR struct nxgl_point_s *offset);
+typedef void (*copy_t)(FAR struct fb_planeinfo_s *pinfo,
+                       FAR const struct nxgl_rect_s *dest,
+                       FAR const void *src,
+                       FAR const struct nxgl_point_s *origin,
+                       unsigned int srcstride);
+
+struct nxglbench_ops_s
+{
+  uint8_t bpp;    /* Bits per pixel */
+  fill_t  fill;   /* nxgl_fillrectangle_*bpp() */
+  move_t  move;   /* nxgl_moverectangle_*bpp() */
+  copy_t  copy;   /* nxgl_copyrectangle_*bpp() */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+#ifndef CONFIG_NX_DISABLE_8BPP
+static void fill_8bpp(FAR struct fb_planeinfo_s *pinfo,
+                      FAR const struct nxgl_rect_s *rect, uint32_t color);
+#endif
+#ifndef CONFIG_NX_DISABLE_16BPP
+static void fill_16bpp(FAR struct fb_planeinfo_s *pinfo,
+                       FAR const struct nxgl_rect_s *rect, uint32_t color);
+#endif
+#ifndef CONFIG_NX_DISABLE_24BPP
+static void fill_24bpp(FAR struct fb_planeinfo_s *pinfo,
+                       FAR const struct nxgl_rect_s *rect, uint32_t color);
+#endif
+#ifndef CONFIG_NX_DISABLE_32BPP
+static void fill_32bpp(FAR struct fb_planeinfo_s *pinfo,
+                       FAR const struct nxgl_rect_s *rect, uint32_t color);
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct nxglbench_ops_s g_ops[] =
+{
+#ifndef CONFIG_NX_DISABLE_8BPP
+  { 8,  fill_8bpp,  nxgl_moverectangle_8bpp,  nxgl_copyrectangle_8bpp  },
+#endif
+#ifndef CONFIG_NX_DISABLE_16BPP
+  { 16, fill_16bpp, nxgl_moverectangle_16bpp, nxgl_copyrectangle_16bpp },
+#endif
+#ifndef CONFIG_NX_DISABLE_24BPP
+  { 24, fill_24bpp, nxgl_moverectangle_24bpp, nxgl_copyrectangle_24bpp },
+#endif
+#ifndef CONFIG_NX_DISABLE_32BPP
+  { 32, fill_32bpp, nxgl_moverectangle_32bpp, nxgl_copyrectangle_32bpp },
+#endif
+};
+
+#define NOPS (sizeof(g_ops) / sizeof(struct nxglbench_ops_s))
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: fill_*bpp
+ *
+ * Description:
+ *   The fill functions differ only in the type of the color argument.
+ *
+ ****************************************************************************/
+
+#ifndef CONFIG_NX_DISABLE_8BPP
+static void fill_8bpp(FAR struct fb_planeinfo_s *pinfo,
+                      FAR const struct nxgl_rect_s *rect, uint32_t color)
+{
+  nxgl_fillrectangle_8bpp(pinfo, rect, (uint8_t)color);
+}
+#endif
+
+#ifndef CONFIG_NX_DISABLE_16BPP
+static void fill_16bpp(FAR struct fb_planeinfo_s *pinfo,
+                       FAR const struct nxgl_rect_s *rect, uint32_t color)
+{
+  nxgl_fillrectangle_16bpp(pinfo, rect, (uint16_t)color);
+}
+#endif
+
+#ifndef CONFIG_NX_DISABLE_24BPP
+static void fill_24bpp(FAR struct fb_planeinfo_s *pinfo,
+                       FAR const struct nxgl_rect_s *rect, uint32_t color)
+{
+  nxgl_fillrectangle_24bpp(pinfo, rect, color & 0x00ffffff);
+}
+#endif
+
+#ifndef CONFIG_NX_DISABLE_32BPP
+static void fill_32bpp(FAR struct fb_planeinfo_s *pinfo,
+                       FAR const struct nxgl_rect_s *rect, uint32_t color)
+{
+  nxgl_fillrectangle_32bpp(pinfo, rect, color);
+}
+#endif
+
+/****************************************************************************
+ * Name: elapsed_usec
+ ****************************************************************************/
+
+static uint32_t elapsed_usec(FAR const struct timespec *start)
+{
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_REALTIME, &now);
+  return (uint32_t)((now.tv_sec - start->tv_sec) * 1000000 +
+                    (now.tv_nsec - start->tv_nsec) / 1000);
+}
+
+/****************************************************************************
+ * Name: report
+ *
+ * Description:
+ *   Show the throughput of one test in megapixels per second (with one
+ *   decimal place).
+ *
+ ****************************************************************************/
+
+static void report(FAR const char *name, FAR const struct nxgl_rect_s *rect,
+                   uint32_t usec)
+{
+  uint32_t npixels;
+  uint32_t mpps10;
+
+  npixels = (uint32_t)(rect->pt2.x - rect->pt1.x + 1) *
+            (uint32_t)(rect->pt2.y - rect->pt1.y + 1) * NLOOPS;
+
+  if (usec == 0)
+    {
+      usec = 1;
+    }
+
+  mpps10 = (uint32_t)(((uint64_t)npixels * 10) / usec);
+  printf("  %-16s %8lu pixels %10lu usec %6lu.%lu Mpixels/sec\n",
+         name, (unsigned long)(npixels / NLOOPS), (unsigned long)usec,
+         (unsigned long)(mpps10 / 10), (unsigned long)(mpps10 % 10));
+}
+
+/****************************************************************************
+ * Name: bench_plane
+ *
+ * Description:
+ *   Run each raster operation NLOOPS times at one pixel depth.  The
+ *   framebuffer memory is re-used for each pixel depth:  The number of rows
+ *   is reduced if the memory is not large enough for the deeper pixels.
+ *
+ ****************************************************************************/
+
+static int bench_plane(FAR const struct nxglbench_ops_s *ops,
+                       FAR const struct fb_videoinfo_s *vinfo,
+                       FAR const struct fb_planeinfo_s *fbinfo)
+{
+  struct fb_planeinfo_s pinfo;
+  struct timespec start;
+  struct nxgl_rect_s rect;
+  struct nxgl_point_s pos;
+  FAR uint8_t *image;
+  unsigned int stride;
+  nxgl_coord_t xres;
+  nxgl_coord_t yres;
+  int i;
+
+  xres   = vinfo->xres;
+  stride = ((unsigned int)xres * ops->bpp + 7) >> 3;
+  yres   = vinfo->yres;
+  if ((uint32_t)stride * yres > fbinfo->fblen)
+    {
+      yres = fbinfo->fblen / stride;
+    }
+
+  if (xres < 16 || yres < 16)
+    {
+      printf("ERROR: Framebuffer too small at %d bpp\n", ops->bpp);
+      return 1;
+    }
+
+  pinfo.fbmem  = fbinfo->fbmem;
+  pinfo.fblen  = fbinfo->fblen;
+  pinfo.stride = stride;
+  pinfo.bpp    = ops->bpp;
+
+  printf("\n%d bpp, %dx%d pixels, %d loops:\n", ops->bpp, xres, yres, NLOOPS);
+
+  /* Fill the entire plane */
+
+  rect.pt1.x = 0;
+  rect.pt1.y = 0;
+  rect.pt2.x = xres - 1;
+  rect.pt2.y = yres - 1;
+
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (i = 0; i < NLOOPS; i++)
+    {
+      ops->fill(&pinfo, &rect, 0x5a5a5a5a + i);
+    }
+
+  report("fill", &rect, elapsed_usec(&start));
+
+  /* Fill narrow, unaligned rectangles to show the per-row overhead */
+
+  rect.pt1.x = 3;
+  rect.pt2.x = 3 + 12;
+
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (i = 0; i < NLOOPS; i++)
+    {
+      ops->fill(&pinfo, &rect, 0xa5a5a5a5 + i);
+    }
+
+  report("fill (narrow)", &rect, elapsed_usec(&start));
+
+  /* Copy an image into the plane */
+
+  image = (FAR uint8_t *)malloc(stride * (yres >> 1));
+  if (!image)
+    {
+      printf("ERROR: Failed to allocate the source image\n");
+      return 1;
+    }
+
+  memset(image, 0x3c, stride * (yres >> 1));
+
+  rect.pt1.x = 0;
+  rect.pt1.y = yres >> 2;
+  rect.pt2.x = xres - 1;
+  rect.pt2.y = rect.pt1.y + (yres >> 1) - 1;
+  pos.x      = rect.pt1.x;
+  pos.y      = rect.pt1.y;
+
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (i = 0; i < NLOOPS; i++)
+    {
+      ops->copy(&pinfo, &rect, image, &pos, stride);
+    }
+
+  report("copy", &rect, elapsed_usec(&start));
+  free(image);
+
+  /* Move (scroll) the plane up by 8 rows */
+
+  rect.pt1.x = 0;
+  rect.pt1.y = 8;
+  rect.pt2.x = xres - 1;
+  rect.pt2.y = yres - 1;
+  pos.x      = 0;
+  pos.y      = 0;
+
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (i = 0; i < NLOOPS; i++)
+    {
+      ops->move(&pinfo, &rect, &pos);
+    }
+
+  report("move (up)", &rect, elapsed_usec(&start));
+
+  /* Move the plane down by 8 rows */
+
+  rect.pt1.y = 0;
+  rect.pt2.y = yres - 9;
+  pos.y      = 8;
+
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (i = 0; i < NLOOPS; i++)
+    {
+      ops->move(&pinfo, &rect, &pos);
+    }
+
+  report("move (down)", &rect, elapsed_usec(&start));
+
+  /* Move the plane right by 8 columns.  The source and destination rows
+   * overlap.
+   */
+
+  rect.pt2.x = xres - 9;
+  rect.pt2.y = yres - 1;
+  pos.x      = 8;
+  pos.y      = 0;
+
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (i = 0; i < NLOOPS; i++)
+    {
+      ops->move(&pinfo, &rect, &pos);
+    }
+
+  report("move (right)", &rect, elapsed_usec(&start));
+  return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * nxglbench_main
+ ****************************************************************************/
+
+int nxglbench_main(int argc, char *argv[])
+{
+  FAR struct fb_vtable_s *vtable;
+  struct fb_videoinfo_s vinfo;
+  struct fb_planeinfo_s pinfo;
+  int errors = 0;
+  int ret;
+  int i;
+
+  /* Initialize the framebuffer and get the plane to use */
+
+  ret = up_fbinitialize();
+  if (ret < 0)
+    {
+      printf("ERROR: up_fbinitialize failed: %d\n", -ret);
+      return 1;
+    }
+
+  vtable = up_fbgetvplane(CONFIG_EXAMPLES_NXGLBENCH_VPLANE);
+  if (!vtable)
+    {
+      printf("ERROR: up_fbgetvplane failed, vplane=%d\n",
+             CONFIG_EXAMPLES_NXGLBENCH_VPLANE);
+      return 1;
+    }
+
+  ret = vtable->getvideoinfo(vtable, &vinfo);
+  if (ret < 0)
+    {
+      printf("ERROR: getvideoinfo failed: %d\n", -ret);
+      return 1;
+    }
+
+  ret = vtable->getplaneinfo(vtable, CONFIG_EXAMPLES_NXGLBENCH_VPLANE,
+                             &pinfo);
+  if (ret < 0)
+    {
+      printf("ERROR: getplaneinfo failed: %d\n", -ret);
+      return 1;
+    }
+
+  printf("Framebuffer: %dx%d, %d bpp, stride %d, %lu bytes\n",
+         vinfo.xres, vinfo.yres, pinfo.bpp, pinfo.stride,
+         (unsigned long)pinfo.fblen);
+
+  /* Then run the benchmark at each supported pixel depth */
+
+  for (i = 0; i < NOPS; i++)
+    {
+      errors += bench_plane(&g_ops[i], &vinfo, &pinfo);
+    }
+
+  printf("\n%s: %d errors\n", errors ? "FAILED" : "PASSED", errors);
+  return errors ? 1 : 0;
+}
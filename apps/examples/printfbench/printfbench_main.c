@@ -0,0 +1,247 @@
+/****************************************************************************
+ * examples/printfbench/printfbench_main.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+
+/****************************************************************************
+ * Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_PRINTFBENCH_NLOOPS
+#  define CONFIG_EXAMPLES_PRINTFBENCH_NLOOPS 10000
+#endif
+
+#ifndef CONFIG_EXAMPLES_PRINTFBENCH_DEVPATH
+#  define CONFIG_EXAMPLES_PRINTFBENCH_DEVPATH "/dev/null"
+#endif
+
+#define NLOOPS CONFIG_EXAMPLES_PRINTFBENCH_NLOOPS
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static char g_buffer[128];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: elapsed_msec
+ ****************************************************************************/
+
+static uint32_t elapsed_msec(FAR const struct timespec *start)
+{
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_REALTIME, &now);
+  return (uint32_t)((now.tv_sec - start->tv_sec) * 1000 +
+                    (now.tv_nsec - start->tv_nsec) / 1000000);
+}
+
+/****************************************************************************
+ * Name: show_result
+ ****************************************************************************/
+
+static void show_result(FAR const char *name, uint32_t nchars,
+                        uint32_t msec)
+{
+  uint32_t kcps = msec > 0 ? nchars / msec : 0;
+
+  printf("%-12s %8lu chars %8lu msec %8lu Kchars/sec\n",
+         name, (unsigned long)nchars, (unsigned long)msec,
+         (unsigned long)kcps);
+}
+
+/****************************************************************************
+ * Name: bench_sprintf
+ ****************************************************************************/
+
+static void bench_sprintf(void)
+{
+  struct timespec start;
+  uint32_t nchars;
+  int i;
+
+  /* Mostly literal text */
+
+  nchars = 0;
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (i = 0; i < NLOOPS; i++)
+    {
+      nchars += sprintf(g_buffer, "The quick brown fox jumps over the lazy dog\n");
+    }
+
+  show_result("literal", nchars, elapsed_msec(&start));
+
+  /* Decimal integers, the common case for telemetry */
+
+  nchars = 0;
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (i = 0; i < NLOOPS; i++)
+    {
+      nchars += sprintf(g_buffer, "%d %u %d %u\n",
+                        i, (unsigned int)i * 7919, -i, (unsigned int)-i);
+    }
+
+  show_result("decimal", nchars, elapsed_msec(&start));
+
+  /* Field widths and padding, as in nsh ls/ps output */
+
+  nchars = 0;
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (i = 0; i < NLOOPS; i++)
+    {
+      nchars += sprintf(g_buffer, "%5d %-8s %08x %10lu\n",
+                        i, "name", (unsigned int)i, (unsigned long)i * 3);
+    }
+
+  show_result("fieldwidth", nchars, elapsed_msec(&start));
+
+  /* Long long conversions */
+
+#ifdef CONFIG_HAVE_LONG_LONG
+  nchars = 0;
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (i = 0; i < NLOOPS; i++)
+    {
+      nchars += sprintf(g_buffer, "%llu %llx\n",
+                        (unsigned long long)i * 1000000007ull,
+                        (unsigned long long)i << 32);
+    }
+
+  show_result("longlong", nchars, elapsed_msec(&start));
+#endif
+}
+
+/****************************************************************************
+ * Name: bench_fprintf
+ ****************************************************************************/
+
+#if CONFIG_NFILE_STREAMS > 0
+static void bench_fprintf(void)
+{
+  struct timespec start;
+  uint32_t nchars;
+  FILE *stream;
+  int i;
+
+  stream = fopen(CONFIG_EXAMPLES_PRINTFBENCH_DEVPATH, "w");
+  if (!stream)
+    {
+      printf("ERROR: Failed to open %s\n", CONFIG_EXAMPLES_PRINTFBENCH_DEVPATH);
+      return;
+    }
+
+  nchars = 0;
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (i = 0; i < NLOOPS; i++)
+    {
+      nchars += fprintf(stream, "sample %d: value=%u status=%s\n",
+                        i, (unsigned int)i * 7919, "ok");
+    }
+
+  (void)fflush(stream);
+  show_result("fprintf", nchars, elapsed_msec(&start));
+  (void)fclose(stream);
+}
+#endif
+
+/****************************************************************************
+ * Name: bench_dprintf
+ ****************************************************************************/
+
+#if CONFIG_NFILE_DESCRIPTORS > 0
+static void bench_dprintf(void)
+{
+  struct timespec start;
+  uint32_t nchars;
+  int fd;
+  int i;
+
+  fd = open(CONFIG_EXAMPLES_PRINTFBENCH_DEVPATH, O_WRONLY);
+  if (fd < 0)
+    {
+      printf("ERROR: Failed to open %s\n", CONFIG_EXAMPLES_PRINTFBENCH_DEVPATH);
+      return;
+    }
+
+  nchars = 0;
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (i = 0; i < NLOOPS; i++)
+    {
+      nchars += dprintf(fd, "sample %d: value=%u status=%s\n",
+                        i, (unsigned int)i * 7919, "ok");
+    }
+
+  show_result("dprintf", nchars, elapsed_msec(&start));
+  (void)close(fd);
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * printfbench_main
+ ****************************************************************************/
+
+int printfbench_main(int argc, char *argv[])
+{
+  printf("printf benchmark: %d iterations per test\n", NLOOPS);
+
+  bench_sprintf();
+#if CONFIG_NFILE_STREAMS > 0
+  bench_fprintf();
+#endif
+#if CONFIG_NFILE_DESCRIPTORS > 0
+  bench_dprintf();
+#endif
+  return 0;
+}
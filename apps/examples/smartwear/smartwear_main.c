@@ -0,0 +1,519 @@
+/****************************************************************************
+ * examples/smartwear/smartwear_main.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <nuttx/fs/fs.h>
+#include <nuttx/fs/ioctl.h>
+#include <nuttx/mtd.h>
+#include <nuttx/smart.h>
+
+/****************************************************************************
+ * Definitions
+ ****************************************************************************/
+/* Configuration ************************************************************/
+
+/* This must exactly match the default configuration in drivers/mtd/rammtd.c */
+
+#ifndef CONFIG_RAMMTD_ERASESIZE
+#  define CONFIG_RAMMTD_ERASESIZE 4096
+#endif
+
+#ifndef CONFIG_EXAMPLES_SMARTWEAR_NEBLOCKS
+#  define CONFIG_EXAMPLES_SMARTWEAR_NEBLOCKS 64
+#endif
+
+#ifndef CONFIG_EXAMPLES_SMARTWEAR_STATICPCT
+#  define CONFIG_EXAMPLES_SMARTWEAR_STATICPCT 50
+#endif
+
+#ifndef CONFIG_EXAMPLES_SMARTWEAR_NHOT
+#  define CONFIG_EXAMPLES_SMARTWEAR_NHOT 16
+#endif
+
+#ifndef CONFIG_EXAMPLES_SMARTWEAR_NWRITES
+#  define CONFIG_EXAMPLES_SMARTWEAR_NWRITES 20000
+#endif
+
+#define SMARTWEAR_BUFSIZE \
+  (CONFIG_RAMMTD_ERASESIZE * CONFIG_EXAMPLES_SMARTWEAR_NEBLOCKS)
+
+#define SMARTWEAR_MINOR   7
+#define SMARTWEAR_DEVNAME "/dev/smart7"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The RAM MTD device is wrapped so that every program and erase operation
+ * performed by the SMART layer can be counted.
+ */
+
+struct smartwear_mtd_s
+{
+  struct mtd_dev_s mtd;           /* Must be first */
+  FAR struct mtd_dev_s *lower;    /* The RAM MTD device */
+  uint32_t nprogrammed;           /* Number of blocks programmed */
+  uint32_t nupdated;              /* Number of sector header updates */
+  uint32_t nerased;               /* Number of erase blocks erased */
+  uint32_t erasecount[CONFIG_EXAMPLES_SMARTWEAR_NEBLOCKS];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static uint8_t g_simflash[SMARTWEAR_BUFSIZE];
+static struct smartwear_mtd_s g_wrapper;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: smartwear_erase, smartwear_bread, smartwear_bwrite, smartwear_read,
+ *       smartwear_write, smartwear_ioctl
+ *
+ * Description:
+ *   Counting wrappers around the RAM MTD device methods
+ *
+ ****************************************************************************/
+
+static int smartwear_erase(FAR struct mtd_dev_s *dev, off_t startblock,
+                           size_t nblocks)
+{
+  FAR struct smartwear_mtd_s *priv = (FAR struct smartwear_mtd_s *)dev;
+  size_t i;
+
+  for (i = 0; i < nblocks; i++)
+    {
+      priv->erasecount[startblock + i]++;
+    }
+
+  priv->nerased += nblocks;
+  return MTD_ERASE(priv->lower, startblock, nblocks);
+}
+
+static ssize_t smartwear_bread(FAR struct mtd_dev_s *dev, off_t startblock,
+                               size_t nblocks, FAR uint8_t *buffer)
+{
+  FAR struct smartwear_mtd_s *priv = (FAR struct smartwear_mtd_s *)dev;
+  return MTD_BREAD(priv->lower, startblock, nblocks, buffer);
+}
+
+static ssize_t smartwear_bwrite(FAR struct mtd_dev_s *dev, off_t startblock,
+                                size_t nblocks, FAR const uint8_t *buffer)
+{
+  FAR struct smartwear_mtd_s *priv = (FAR struct smartwear_mtd_s *)dev;
+
+  priv->nprogrammed += nblocks;
+  return MTD_BWRITE(priv->lower, startblock, nblocks, buffer);
+}
+
+static ssize_t smartwear_read(FAR struct mtd_dev_s *dev, off_t offset,
+                              size_t nbytes, FAR uint8_t *buffer)
+{
+  FAR struct smartwear_mtd_s *priv = (FAR struct smartwear_mtd_s *)dev;
+  return MTD_READ(priv->lower, offset, nbytes, buffer);
+}
+
+#ifdef CONFIG_MTD_BYTE_WRITE
+static ssize_t smartwear_write(FAR struct mtd_dev_s *dev, off_t offset,
+                               size_t nbytes, FAR const uint8_t *buffer)
+{
+  FAR struct smartwear_mtd_s *priv = (FAR struct smartwear_mtd_s *)dev;
+  struct mtd_geometry_s geo;
+  uint8_t block[512];
+  off_t blkno;
+  ssize_t ret;
+
+  /* Byte writes are used only to update sector headers and are counted
+   * separately.
+   */
+
+  priv->nupdated++;
+  if (priv->lower->write)
+    {
+      return priv->lower->write(priv->lower, offset, nbytes, buffer);
+    }
+
+  /* The RAM MTD device does not support byte writes.  Emulate them with a
+   * read-modify-write of the containing block.
+   */
+
+  ret = MTD_IOCTL(priv->lower, MTDIOC_GEOMETRY,
+                  (unsigned long)((uintptr_t)&geo));
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  blkno = offset / geo.blocksize;
+  if (geo.blocksize > sizeof(block) ||
+      (offset % geo.blocksize) + nbytes > geo.blocksize)
+    {
+      return -EINVAL;
+    }
+
+  ret = MTD_BREAD(priv->lower, blkno, 1, block);
+  if (ret == 1)
+    {
+      memcpy(&block[offset % geo.blocksize], buffer, nbytes);
+      ret = MTD_BWRITE(priv->lower, blkno, 1, block);
+    }
+
+  return ret == 1 ? (ssize_t)nbytes : -EIO;
+}
+#endif
+
+static int smartwear_ioctl(FAR struct mtd_dev_s *dev, int cmd,
+                           unsigned long arg)
+{
+  FAR struct smartwear_mtd_s *priv = (FAR struct smartwear_mtd_s *)dev;
+  int i;
+
+  /* A bulk erase erases every erase block */
+
+  if (cmd == MTDIOC_BULKERASE)
+    {
+      for (i = 0; i < CONFIG_EXAMPLES_SMARTWEAR_NEBLOCKS; i++)
+        {
+          priv->erasecount[i]++;
+        }
+
+      priv->nerased += CONFIG_EXAMPLES_SMARTWEAR_NEBLOCKS;
+    }
+
+  return MTD_IOCTL(priv->lower, cmd, arg);
+}
+
+/****************************************************************************
+ * Name: smartwear_fill
+ *
+ * Description:
+ *   Fill the sector buffer with a pattern that depends on the logical
+ *   sector number and its version.
+ *
+ ****************************************************************************/
+
+static void smartwear_fill(FAR uint8_t *buffer, size_t size,
+                           uint16_t sector, uint16_t version)
+{
+  size_t i;
+
+  for (i = 0; i < size; i++)
+    {
+      buffer[i] = (uint8_t)(sector * 7 + version * 13 + i);
+    }
+}
+
+/****************************************************************************
+ * Name: smartwear_writesector
+ ****************************************************************************/
+
+static int smartwear_writesector(FAR struct inode *inode, uint16_t sector,
+                                 uint16_t version, FAR uint8_t *buffer,
+                                 uint16_t size)
+{
+  struct smart_read_write_s req;
+
+  smartwear_fill(buffer, size, sector, version);
+
+  req.logsector = sector;
+  req.offset    = 0;
+  req.count     = size;
+  req.buffer    = buffer;
+
+  return inode->u.i_bops->ioctl(inode, BIOC_WRITESECT, (unsigned long)&req);
+}
+
+/****************************************************************************
+ * Name: smartwear_verify
+ ****************************************************************************/
+
+static int smartwear_verify(FAR struct inode *inode, FAR uint16_t *sectors,
+                            FAR uint16_t *versions, int nsectors,
+                            FAR uint8_t *buffer, FAR uint8_t *expected,
+                            uint16_t size)
+{
+  struct smart_read_write_s req;
+  int errors = 0;
+  int ret;
+  int i;
+
+  for (i = 0; i < nsectors; i++)
+    {
+      smartwear_fill(expected, size, sectors[i], versions[i]);
+
+      req.logsector = sectors[i];
+      req.offset    = 0;
+      req.count     = size;
+      req.buffer    = buffer;
+
+      ret = inode->u.i_bops->ioctl(inode, BIOC_READSECT, (unsigned long)&req);
+      if (ret != size || memcmp(buffer, expected, size) != 0)
+        {
+          printf("ERROR: Logical sector %d is corrupted: %d\n",
+                 sectors[i], ret);
+          errors++;
+        }
+    }
+
+  return errors;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * smartwear_main
+ ****************************************************************************/
+
+int smartwear_main(int argc, char *argv[])
+{
+  FAR struct inode *inode;
+  FAR uint16_t *sectors;
+  FAR uint16_t *versions;
+  FAR uint8_t *buffer;
+  FAR uint8_t *expected;
+  struct smart_format_s fmt;
+  struct mtd_geometry_s geo;
+  uint32_t minerase;
+  uint32_t maxerase;
+  uint32_t nhostwrites;
+  uint32_t nprogrammed;
+  uint32_t sectblocks;
+  uint32_t wa;
+  uint16_t size;
+  int nstatic;
+  int nsectors;
+  int errors;
+  int ret;
+  int i;
+
+  /* Create and wrap the RAM MTD device */
+
+  memset(&g_wrapper, 0, sizeof(struct smartwear_mtd_s));
+  g_wrapper.lower = rammtd_initialize(g_simflash, SMARTWEAR_BUFSIZE);
+  if (!g_wrapper.lower)
+    {
+      printf("ERROR: Failed to create the RAM MTD instance\n");
+      return 1;
+    }
+
+  g_wrapper.mtd.erase  = smartwear_erase;
+  g_wrapper.mtd.bread  = smartwear_bread;
+  g_wrapper.mtd.bwrite = smartwear_bwrite;
+  g_wrapper.mtd.read   = smartwear_read;
+#ifdef CONFIG_MTD_BYTE_WRITE
+  g_wrapper.mtd.write  = smartwear_write;
+#endif
+  g_wrapper.mtd.ioctl  = smartwear_ioctl;
+
+  /* Bind the SMART block driver to the wrapped MTD device */
+
+  ret = smart_initialize(SMARTWEAR_MINOR, &g_wrapper.mtd, NULL);
+  if (ret < 0)
+    {
+      printf("ERROR: SMART initialization failed: %d\n", -ret);
+      return 1;
+    }
+
+  ret = open_blockdriver(SMARTWEAR_DEVNAME, 0, &inode);
+  if (ret < 0)
+    {
+      printf("ERROR: Failed to open %s: %d\n", SMARTWEAR_DEVNAME, -ret);
+      return 1;
+    }
+
+  /* Low-level format the device and get its format */
+
+  ret = inode->u.i_bops->ioctl(inode, BIOC_LLFORMAT, 1);
+  if (ret >= 0)
+    {
+      ret = inode->u.i_bops->ioctl(inode, BIOC_GETFORMAT,
+                                   (unsigned long)&fmt);
+    }
+
+  if (ret < 0)
+    {
+      printf("ERROR: Failed to format %s: %d\n", SMARTWEAR_DEVNAME, -ret);
+      goto errout_with_inode;
+    }
+
+  ret = MTD_IOCTL(g_wrapper.lower, MTDIOC_GEOMETRY,
+                  (unsigned long)((uintptr_t)&geo));
+  if (ret < 0)
+    {
+      printf("ERROR: Failed to get the MTD geometry: %d\n", -ret);
+      goto errout_with_inode;
+    }
+
+  /* Fill the requested percentage of the device with static data.  The
+   * remaining logical sectors are rewritten over and over.
+   */
+
+  size     = fmt.availbytes;
+  nstatic  = (int)fmt.nfreesectors * CONFIG_EXAMPLES_SMARTWEAR_STATICPCT / 100;
+  nsectors = nstatic + CONFIG_EXAMPLES_SMARTWEAR_NHOT;
+
+  sectors  = (FAR uint16_t *)malloc(2 * nsectors * sizeof(uint16_t));
+  buffer   = (FAR uint8_t *)malloc(2 * size);
+  if (!sectors || !buffer)
+    {
+      printf("ERROR: Failed to allocate buffers\n");
+      ret = -ENOMEM;
+      goto errout_with_buffers;
+    }
+
+  versions = sectors + nsectors;
+  expected = buffer + size;
+
+  printf("SMART wear test:\n");
+  printf("  Erase blocks:    %d\n", CONFIG_EXAMPLES_SMARTWEAR_NEBLOCKS);
+  printf("  Sector size:     %d\n", fmt.sectorsize);
+  printf("  Free sectors:    %d\n", fmt.nfreesectors);
+  printf("  Static sectors:  %d\n", nstatic);
+  printf("  Hot sectors:     %d\n", CONFIG_EXAMPLES_SMARTWEAR_NHOT);
+  printf("  Host writes:     %d\n", CONFIG_EXAMPLES_SMARTWEAR_NWRITES);
+
+  for (i = 0; i < nsectors; i++)
+    {
+      ret = inode->u.i_bops->ioctl(inode, BIOC_ALLOCSECT, 0);
+      if (ret < 0)
+        {
+          printf("ERROR: Failed to allocate sector %d: %d\n", i, -ret);
+          goto errout_with_buffers;
+        }
+
+      sectors[i]  = (uint16_t)ret;
+      versions[i] = 0;
+
+      ret = smartwear_writesector(inode, sectors[i], 0, buffer, size);
+      if (ret < 0)
+        {
+          printf("ERROR: Failed to write sector %d: %d\n", sectors[i], -ret);
+          goto errout_with_buffers;
+        }
+    }
+
+  /* Now rewrite the hot sectors.  Only the hot portion of the device is
+   * counted.
+   */
+
+  nprogrammed = g_wrapper.nprogrammed;
+  memset(g_wrapper.erasecount, 0, sizeof(g_wrapper.erasecount));
+  g_wrapper.nerased  = 0;
+  g_wrapper.nupdated = 0;
+
+  srand(1);
+  for (nhostwrites = 0; nhostwrites < CONFIG_EXAMPLES_SMARTWEAR_NWRITES;
+       nhostwrites++)
+    {
+      i = nstatic + rand() % CONFIG_EXAMPLES_SMARTWEAR_NHOT;
+      versions[i]++;
+
+      ret = smartwear_writesector(inode, sectors[i], versions[i], buffer,
+                                  size);
+      if (ret < 0)
+        {
+          printf("ERROR: Failed to write sector %d: %d\n", sectors[i], -ret);
+          goto errout_with_buffers;
+        }
+    }
+
+  /* Verify every sector */
+
+  errors = smartwear_verify(inode, sectors, versions, nsectors, buffer,
+                            expected, size);
+
+  /* Report the write amplification (the number of sectors programmed per
+   * sector written by the host) and the spread of erase counts.  Without
+   * CONFIG_MTD_BYTE_WRITE, sector header updates are performed with
+   * read-modify-write cycles and are included in the programmed count.
+   */
+
+  sectblocks  = fmt.sectorsize / geo.blocksize;
+  nprogrammed = g_wrapper.nprogrammed - nprogrammed;
+
+  minerase = UINT32_MAX;
+  maxerase = 0;
+  for (i = 0; i < CONFIG_EXAMPLES_SMARTWEAR_NEBLOCKS; i++)
+    {
+      if (g_wrapper.erasecount[i] < minerase)
+        {
+          minerase = g_wrapper.erasecount[i];
+        }
+
+      if (g_wrapper.erasecount[i] > maxerase)
+        {
+          maxerase = g_wrapper.erasecount[i];
+        }
+    }
+
+  wa = (100 * nprogrammed) / (nhostwrites * sectblocks);
+  printf("\nResults:\n");
+  printf("  Blocks programmed:   %lu\n", (unsigned long)nprogrammed);
+  printf("  Header updates:      %lu\n", (unsigned long)g_wrapper.nupdated);
+  printf("  Write amplification: %lu.%02lu\n",
+         (unsigned long)(wa / 100), (unsigned long)(wa % 100));
+  printf("  Erasures:            %lu (min %lu max %lu spread %lu)\n",
+         (unsigned long)g_wrapper.nerased, (unsigned long)minerase,
+         (unsigned long)maxerase, (unsigned long)(maxerase - minerase));
+
+  printf("\n%s: %d errors\n", errors ? "FAILED" : "PASSED", errors);
+  ret = errors ? -EIO : OK;
+
+errout_with_buffers:
+  free(sectors);
+  free(buffer);
+
+errout_with_inode:
+  close_blockdriver(inode);
+  return ret < 0 ? 1 : 0;
+}
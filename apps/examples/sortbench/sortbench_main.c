@@ -0,0 +1,314 @@
+/****************************************************************************
+ * examples/sortbench/sortbench_main.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+/****************************************************************************
+ * Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_SORTBENCH_NELEM
+#  define CONFIG_EXAMPLES_SORTBENCH_NELEM 4096
+#endif
+
+#define NELEM CONFIG_EXAMPLES_SORTBENCH_NELEM
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum pattern_e
+{
+  PATTERN_SORTED = 0,   /* 0, 1, 2, ... */
+  PATTERN_REVERSED,     /* N, N-1, N-2, ... */
+  PATTERN_RANDOM,       /* Pseudo-random values */
+  PATTERN_FEWKEYS,      /* Pseudo-random values with only 4 distinct keys */
+  PATTERN_ORGANPIPE,    /* 0, 1, ..., N/2, ..., 1, 0 */
+  PATTERN_INTERLEAVED,  /* Ascending odd elements and even elements */
+  NPATTERNS
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const char *g_names[NPATTERNS] =
+{
+  "sorted", "reversed", "random", "fewkeys", "organpipe", "interleaved"
+};
+
+static uint32_t g_ncompares;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: compare
+ ****************************************************************************/
+
+static int compare(FAR const void *a, FAR const void *b)
+{
+  int ia = *(FAR const int *)a;
+  int ib = *(FAR const int *)b;
+
+  g_ncompares++;
+  return ia < ib ? -1 : (ia > ib ? 1 : 0);
+}
+
+/****************************************************************************
+ * Name: fill
+ ****************************************************************************/
+
+static void fill(FAR int *array, enum pattern_e pattern)
+{
+  int i;
+
+  srand(1);
+  for (i = 0; i < NELEM; i++)
+    {
+      switch (pattern)
+        {
+          default:
+          case PATTERN_SORTED:
+            array[i] = i;
+            break;
+
+          case PATTERN_REVERSED:
+            array[i] = NELEM - i;
+            break;
+
+          case PATTERN_RANDOM:
+            array[i] = rand();
+            break;
+
+          case PATTERN_FEWKEYS:
+            array[i] = rand() & 3;
+            break;
+
+          case PATTERN_ORGANPIPE:
+            array[i] = i < NELEM / 2 ? i : NELEM - i;
+            break;
+
+          case PATTERN_INTERLEAVED:
+            array[i] = (i & 1) ? i : NELEM + i;
+            break;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: elapsed_usec
+ ****************************************************************************/
+
+static uint32_t elapsed_usec(FAR const struct timespec *start)
+{
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_REALTIME, &now);
+  return (uint32_t)((now.tv_sec - start->tv_sec) * 1000000 +
+                    (now.tv_nsec - start->tv_nsec) / 1000);
+}
+
+/****************************************************************************
+ * Name: verify
+ ****************************************************************************/
+
+static int verify(FAR const int *array, FAR const char *name)
+{
+  int i;
+
+  for (i = 1; i < NELEM; i++)
+    {
+      if (array[i - 1] > array[i])
+        {
+          printf("ERROR: %s: array[%d]=%d > array[%d]=%d\n",
+                 name, i - 1, array[i - 1], i, array[i]);
+          return 1;
+        }
+    }
+
+  return 0;
+}
+
+/****************************************************************************
+ * Name: bench_qsort
+ ****************************************************************************/
+
+static int bench_qsort(FAR int *array)
+{
+  struct timespec start;
+  uint32_t usec;
+  int errors = 0;
+  int i;
+
+  printf("\nqsort() of %d integers:\n", NELEM);
+
+  for (i = 0; i < NPATTERNS; i++)
+    {
+      fill(array, (enum pattern_e)i);
+
+      g_ncompares = 0;
+      (void)clock_gettime(CLOCK_REALTIME, &start);
+      qsort(array, NELEM, sizeof(int), compare);
+      usec = elapsed_usec(&start);
+
+      printf("  %-12s %10lu usec %10lu compares\n", g_names[i],
+             (unsigned long)usec, (unsigned long)g_ncompares);
+
+      errors += verify(array, g_names[i]);
+    }
+
+  return errors;
+}
+
+/****************************************************************************
+ * Name: bench_qselect
+ ****************************************************************************/
+
+static int bench_qselect(FAR int *array)
+{
+  struct timespec start;
+  uint32_t usec;
+  int median;
+  int errors = 0;
+  int i;
+
+  printf("\nqselect() of the median of %d integers:\n", NELEM);
+
+  for (i = 0; i < NPATTERNS; i++)
+    {
+      fill(array, (enum pattern_e)i);
+
+      g_ncompares = 0;
+      (void)clock_gettime(CLOCK_REALTIME, &start);
+      qselect(array, NELEM, sizeof(int), NELEM / 2, compare);
+      usec = elapsed_usec(&start);
+
+      printf("  %-12s %10lu usec %10lu compares\n", g_names[i],
+             (unsigned long)usec, (unsigned long)g_ncompares);
+
+      /* Sort the array and check that the same element is the median */
+
+      median = array[NELEM / 2];
+      qsort(array, NELEM, sizeof(int), compare);
+      if (array[NELEM / 2] != median)
+        {
+          printf("ERROR: %s: median %d, expected %d\n",
+                 g_names[i], median, array[NELEM / 2]);
+          errors++;
+        }
+    }
+
+  return errors;
+}
+
+/****************************************************************************
+ * Name: bench_bsearch
+ ****************************************************************************/
+
+static int bench_bsearch(FAR int *array)
+{
+  struct timespec start;
+  FAR int *found;
+  uint32_t usec;
+  int errors = 0;
+  int i;
+
+  printf("\nbsearch() for each of %d integers:\n", NELEM);
+
+  fill(array, PATTERN_SORTED);
+
+  g_ncompares = 0;
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+  for (i = 0; i < NELEM; i++)
+    {
+      found = (FAR int *)bsearch(&i, array, NELEM, sizeof(int), compare);
+      if (found == NULL || *found != i)
+        {
+          errors++;
+        }
+    }
+
+  usec = elapsed_usec(&start);
+  printf("  %-12s %10lu usec %10lu compares\n", "sorted",
+         (unsigned long)usec, (unsigned long)g_ncompares);
+
+  if (errors > 0)
+    {
+      printf("ERROR: %d keys were not found\n", errors);
+    }
+
+  return errors;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * sortbench_main
+ ****************************************************************************/
+
+int sortbench_main(int argc, char *argv[])
+{
+  FAR int *array;
+  int errors;
+
+  array = (FAR int *)malloc(NELEM * sizeof(int));
+  if (!array)
+    {
+      printf("ERROR: Failed to allocate %d integers\n", NELEM);
+      return 1;
+    }
+
+  errors  = bench_qsort(array);
+  errors += bench_qselect(array);
+  errors += bench_bsearch(array);
+
+  printf("\n%s: %d errors\n", errors ? "FAILED" : "PASSED", errors);
+
+  free(array);
+  return errors ? 1 : 0;
+}
@@ -1,7 +1,7 @@
 /****************************************************************************
  * examples/usbstorage/usbmsc_main.c
  *
- *   Copyright (C) 2008-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -47,6 +47,7 @@
 
 #include <nuttx/usb/usbdev.h>
 #include <nuttx/usb/usbdev_trace.h>
+#include <nuttx/usb/usbmsc.h>
 
 #include "usbmsc.h"
 
@@ -192,6 +193,47 @@ static void final_memory_usage(FAR const char *msg)
 #  define final_memory_usage(msg)
 #endif
 
+/****************************************************************************
+ * Name: show_cmdstats
+ ****************************************************************************/
+
+#if defined(CONFIG_NSH_BUILTIN_APPS) && defined(CONFIG_USBMSC_STATS)
+static void show_cmdstats(FAR const char *name,
+                          FAR const struct usbmsc_cmdstats_s *cmdstats)
+{
+  message("%-6s%10lu%10lu%10lu%10lu\n", name,
+          (unsigned long)cmdstats->ncmds, (unsigned long)cmdstats->nsectors,
+          cmdstats->ncmds ? (unsigned long)(cmdstats->totalticks / cmdstats->ncmds) : 0ul,
+          (unsigned long)cmdstats->maxticks);
+}
+#endif
+
+/****************************************************************************
+ * Name: show_stats
+ ****************************************************************************/
+
+#if defined(CONFIG_NSH_BUILTIN_APPS) && defined(CONFIG_USBMSC_STATS)
+static void show_stats(FAR void *handle)
+{
+  struct usbmsc_stats_s stats;
+
+  if (usbmsc_getstats(handle, &stats, false) == OK)
+    {
+      message("\nSCSI command statistics (latency in ticks):\n");
+      message("          cmds   sectors   average     worst\n");
+      show_cmdstats("read", &stats.read);
+      show_cmdstats("write", &stats.write);
+      show_cmdstats("other", &stats.other);
+      message("Block driver reads: %lu writes: %lu\n",
+              (unsigned long)stats.ioread, (unsigned long)stats.iowrite);
+      message("Sectors prefetched: %lu used: %lu\n",
+              (unsigned long)stats.prefetched, (unsigned long)stats.prefetchhits);
+    }
+}
+#else
+#  define show_stats(handle)
+#endif
+
 /****************************************************************************
  * Name: usbmsc_enumerate
  ****************************************************************************/
@@ -573,6 +615,10 @@ int msdis_main(int argc, char *argv[])
     }
    check_test_memory_usage("Since MS connection");
 
+  /* Show what the driver did while it was connected */
+
+   show_stats(g_usbmsc.mshandle);
+
   /* Then disconnect the device and uninitialize the USB mass storage driver */
 
    usbmsc_uninitialize(g_usbmsc.mshandle);
@@ -1,7 +1,7 @@
 /****************************************************************************
  * arch/sim/src/up_framebuffer.c
  *
- *   Copyright (C) 2008-2010 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2010, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -44,6 +44,7 @@
 #include <errno.h>
 #include <debug.h>
 
+#include <nuttx/kmalloc.h>
 #include <nuttx/fb.h>
 #include "up_internal.h"
 
@@ -80,6 +81,12 @@
 #  error "Unsupported BPP"
 #endif
 
+/* Double buffering is only useful when the display is visible */
+
+#if defined(CONFIG_SIM_FBDOUBLEBUFFER) && !defined(CONFIG_SIM_X11FB)
+#  error "CONFIG_SIM_FBDOUBLEBUFFER requires CONFIG_SIM_X11FB"
+#endif
+
 /* Framebuffer characteristics in bytes */
 
 #define FB_WIDTH ((CONFIG_SIM_FBWIDTH * CONFIG_SIM_FBBPP + 7) / 8)
@@ -111,6 +118,12 @@ static int up_putcmap(FAR struct fb_vtable_s *vtable, FAR const struct fb_cmap_s
 #ifdef CONFIG_FB_HWCURSOR
 static int up_getcursor(FAR struct fb_vtable_s *vtable, FAR struct fb_cursorattrib_s *attrib);
 static int up_setcursor(FAR struct fb_vtable_s *vtable, FAR struct fb_setcursor_s *setttings);
+#endif
+
+  /* The following is provided only if the framebuffer is double buffered */
+
+#ifdef CONFIG_FB_FLIP
+static int up_flip(FAR struct fb_vtable_s *vtable);
 #endif
 
 /****************************************************************************
@@ -149,6 +162,14 @@ static const struct fb_planeinfo_s g_planeinfo =
 static struct fb_planeinfo_s g_planeinfo;
 #endif
 
+/* When double buffered, NX renders into a back buffer (g_planeinfo.fbmem)
+ * and the X11 image is the front buffer that is shown on each refresh.
+ */
+
+#ifdef CONFIG_SIM_FBDOUBLEBUFFER
+static FAR void *g_fbfront;
+#endif
+
 /* Current cursor position */
 
 #ifdef CONFIG_FB_HWCURSOR
@@ -177,6 +198,9 @@ struct fb_vtable_s g_fbobject =
   .getcursor     = up_getcursor,
   .setcursor     = up_setcursor,
 #endif
+#ifdef CONFIG_FB_FLIP
+  .flip          = up_flip,
+#endif
 };
 
 /****************************************************************************
@@ -340,6 +364,25 @@ static int up_setcursor(FAR struct fb_vtable_s *vtable,
 }
 #endif
 
+/****************************************************************************
+ * Name: up_flip
+ *
+ * Description:
+ *   Make the contents of the back buffer visible.  The X11 image is only
+ *   presented on the periodic display refresh in up_idle() (the simulated
+ *   vertical sync), so each refresh shows the last complete frame, never
+ *   one that is partially rendered.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FB_FLIP
+static int up_flip(FAR struct fb_vtable_s *vtable)
+{
+  memcpy(g_fbfront, g_planeinfo.fbmem, g_planeinfo.fblen);
+  return OK;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -355,9 +398,29 @@ static int up_setcursor(FAR struct fb_vtable_s *vtable,
 int up_fbinitialize(void)
 {
 #ifdef CONFIG_SIM_X11FB
-  return up_x11initialize(CONFIG_SIM_FBWIDTH, CONFIG_SIM_FBHEIGHT,
-                          &g_planeinfo.fbmem, &g_planeinfo.fblen,
-                          &g_planeinfo.bpp, &g_planeinfo.stride);
+  int ret;
+
+  ret = up_x11initialize(CONFIG_SIM_FBWIDTH, CONFIG_SIM_FBHEIGHT,
+                         &g_planeinfo.fbmem, &g_planeinfo.fblen,
+                         &g_planeinfo.bpp, &g_planeinfo.stride);
+
+#ifdef CONFIG_SIM_FBDOUBLEBUFFER
+  /* Allocate the back buffer.  The X11 image becomes the front buffer */
+
+  if (ret == OK && !g_fbfront)
+    {
+      g_fbfront = g_planeinfo.fbmem;
+      g_planeinfo.fbmem = kzalloc(g_planeinfo.fblen);
+      if (!g_planeinfo.fbmem)
+        {
+          g_planeinfo.fbmem = g_fbfront;
+          g_fbfront = NULL;
+          return -ENOMEM;
+        }
+    }
+#endif
+
+  return ret;
 #else
   return OK;
 #endif
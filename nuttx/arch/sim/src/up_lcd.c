@@ -1,7 +1,7 @@
 /****************************************************************************
  * arch/sim/src/up_lcd.c
  *
- *   Copyright (C) 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -135,6 +135,14 @@ struct sim_dev_s
   /* Private LCD-specific information follows */
 
   uint8_t power;        /* Current power setting */
+
+  /* Simulated bus traffic.  Each transfer costs one address setup (the
+   * window and cursor commands of a typical parallel or SPI controller)
+   * followed by one data transaction per pixel.
+   */
+
+  uint32_t nsetup;      /* Number of address setup sequences */
+  uint32_t ndata;       /* Number of pixel data transactions */
 };
 
 /****************************************************************************
@@ -147,6 +155,13 @@ static int sim_putrun(fb_coord_t row, fb_coord_t col, FAR const uint8_t *buffer,
                       size_t npixels);
 static int sim_getrun(fb_coord_t row, fb_coord_t col, FAR uint8_t *buffer,
                       size_t npixels);
+#ifdef CONFIG_SIM_LCDPUTAREA
+static int sim_putarea(fb_coord_t row, fb_coord_t col, fb_coord_t nrows,
+                       fb_coord_t ncols, FAR const uint8_t *buffer,
+                       size_t stride);
+static int sim_fillarea(fb_coord_t row, fb_coord_t col, fb_coord_t nrows,
+                        fb_coord_t ncols, uint32_t color);
+#endif
 
 /* LCD Configuration */
 
@@ -207,6 +222,10 @@ static const struct lcd_planeinfo_s g_planeinfo =
 {
   .putrun = sim_putrun,            /* Put a run into LCD memory */
   .getrun = sim_getrun,            /* Get a run from LCD memory */
+#ifdef CONFIG_SIM_LCDPUTAREA
+  .putarea  = sim_putarea,         /* Put a rectangle into LCD memory */
+  .fillarea = sim_fillarea,        /* Fill a rectangle in LCD memory */
+#endif
   .buffer = (uint8_t*)g_runbuffer, /* Run scratch buffer */
   .bpp    = CONFIG_SIM_FBBPP,      /* Bits-per-pixel */
 };
@@ -255,10 +274,65 @@ static struct sim_dev_s g_lcddev =
 static int sim_putrun(fb_coord_t row, fb_coord_t col, FAR const uint8_t *buffer,
                        size_t npixels)
 {
-  lcddbg("row: %d col: %d npixels: %d\n", row, col, npixels);
+  g_lcddev.nsetup++;
+  g_lcddev.ndata += npixels;
+
+  lcddbg("row: %d col: %d npixels: %d setup: %u data: %u\n",
+         row, col, npixels, g_lcddev.nsetup, g_lcddev.ndata);
   return OK;
 }
 
+/****************************************************************************
+ * Name:  sim_putarea
+ *
+ * Description:
+ *   This method can be used to write a rectangular area to the LCD:
+ *
+ *  row     - Starting row to write to (range: 0 <= row < yres)
+ *  col     - Starting column to write to (range: 0 <= col < xres)
+ *  nrows   - The number of rows to write
+ *  ncols   - The number of pixels in each row
+ *  buffer  - The buffer containing the first row of the area
+ *  stride  - The distance in bytes from one row in buffer to the next
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SIM_LCDPUTAREA
+static int sim_putarea(fb_coord_t row, fb_coord_t col, fb_coord_t nrows,
+                       fb_coord_t ncols, FAR const uint8_t *buffer,
+                       size_t stride)
+{
+  g_lcddev.nsetup++;
+  g_lcddev.ndata += (uint32_t)nrows * ncols;
+
+  lcddbg("row: %d col: %d nrows: %d ncols: %d setup: %u data: %u\n",
+         row, col, nrows, ncols, g_lcddev.nsetup, g_lcddev.ndata);
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name:  sim_fillarea
+ *
+ * Description:
+ *   This method can be used to fill a rectangular area of the LCD with one
+ *   color (row, col, nrows, ncols as for sim_putarea).
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SIM_LCDPUTAREA
+static int sim_fillarea(fb_coord_t row, fb_coord_t col, fb_coord_t nrows,
+                        fb_coord_t ncols, uint32_t color)
+{
+  g_lcddev.nsetup++;
+  g_lcddev.ndata += (uint32_t)nrows * ncols;
+
+  lcddbg("row: %d col: %d nrows: %d ncols: %d setup: %u data: %u\n",
+         row, col, nrows, ncols, g_lcddev.nsetup, g_lcddev.ndata);
+  return OK;
+}
+#endif
+
 /****************************************************************************
  * Name:  sim_getrun
  *
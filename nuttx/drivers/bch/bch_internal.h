@@ -1,7 +1,7 @@
 /****************************************************************************
  * drivers/bch/bch_internal.h
  *
- *   Copyright (C) 2008-2009 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -52,6 +52,21 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* Configuration ************************************************************/
+/* CONFIG_BCH_NCACHESECTORS - The number of sectors held in the sector cache.
+ * CONFIG_BCH_WRITEBACK - Keep written data in the cache until the sector is
+ *   evicted, the device is closed, or BIOC_FLUSH is requested.  Otherwise,
+ *   written data is flushed at the end of each write.
+ */
+
+#ifndef CONFIG_BCH_NCACHESECTORS
+#  define CONFIG_BCH_NCACHESECTORS 1
+#endif
+
+#if CONFIG_BCH_NCACHESECTORS < 1
+#  error "CONFIG_BCH_NCACHESECTORS must be at least one"
+#endif
+
 #define bchlib_semgive(d) sem_post(&(d)->sem)  /* To match bchlib_semtake */
 #define MAX_OPENCNT     (255)                  /* Limit of uint8_t */
 
@@ -59,17 +74,27 @@
  * Public Types
  ****************************************************************************/
 
+/* One entry in the sector cache */
+
+struct bch_cache_s
+{
+  size_t   sector;     /* The sector in the buffer ((size_t)-1 if none) */
+  uint32_t lastuse;    /* Access count at the last use (for LRU replacement) */
+  bool     dirty;      /* Data has been written to the buffer */
+  FAR uint8_t *buffer; /* One sector buffer */
+};
+
 struct bchlib_s
 {
   struct inode *inode; /* I-node of the block driver */
   sem_t    sem;        /* For atomic accesses to this structure */
   size_t   nsectors;   /* Number of sectors supported by the device */
-  size_t   sector;     /* The current sector in the buffer */
+  uint32_t access;     /* Count of cache accesses */
   uint16_t sectsize;   /* The size of one sector on the device */
   uint8_t  refs;       /* Number of references */
-  bool  dirty;         /* Data has been written to the buffer */
   bool  readonly;      /* true:  Only read operations are supported */
-  FAR uint8_t *buffer; /* One sector buffer */
+  FAR uint8_t *buffer; /* Memory for all of the sector buffers */
+  struct bch_cache_s cache[CONFIG_BCH_NCACHESECTORS];
 };
 
 /****************************************************************************
@@ -91,8 +116,13 @@ EXTERN const struct file_operations bch_fops;
  ****************************************************************************/
 
 EXTERN void bchlib_semtake(FAR struct bchlib_s *bch);
-EXTERN int  bchlib_flushsector(FAR struct bchlib_s *bch);
+EXTERN int  bchlib_flushcache(FAR struct bchlib_s *bch);
 EXTERN int  bchlib_readsector(FAR struct bchlib_s *bch, size_t sector);
+EXTERN void bchlib_readcached(FAR struct bchlib_s *bch, FAR uint8_t *buffer,
+                              size_t sector, size_t nsectors);
+EXTERN void bchlib_writecached(FAR struct bchlib_s *bch,
+                               FAR const uint8_t *buffer, size_t sector,
+                               size_t nsectors);
 
 #undef EXTERN
 #if defined(__cplusplus)
@@ -1,7 +1,7 @@
 /****************************************************************************
  * drivers/bch/bchdev_driver.c
  *
- *   Copyright (C) 2008-2009 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -145,7 +145,7 @@ static int bch_close(FAR struct file *filp)
   /* Flush any dirty pages remaining in the cache */
 
   bchlib_semtake(bch);
-  (void)bchlib_flushsector(bch);
+  (void)bchlib_flushcache(bch);
 
   /* Decrement the reference count (I don't use bchlib_decref() because I
    * want the entire close operation to be atomic wrt other driver operations.
@@ -246,6 +246,14 @@ static int bch_ioctl(FAR struct file *filp, int cmd, unsigned long arg)
         }
       bchlib_semgive(bch);
     }
+  else if (cmd == BIOC_FLUSH)
+    {
+      /* Write any cached data to the block driver */
+
+      bchlib_semtake(bch);
+      ret = bchlib_flushcache(bch);
+      bchlib_semgive(bch);
+    }
 
   return ret;
 }
@@ -1,7 +1,7 @@
 /****************************************************************************
  * drivers/bch/bchlib_cache.c
  *
- *   Copyright (C) 2008-2009 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -41,6 +41,7 @@
 
 #include <sys/types.h>
 #include <stdbool.h>
+#include <string.h>
 #include <errno.h>
 #include <assert.h>
 #include <debug.h>
@@ -65,44 +66,128 @@
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: bchlib_writeentry
+ *
+ * Description:
+ *   Write one cache entry to the block driver (if dirty).  The entry stays
+ *   dirty if the write fails.
+ *
+ ****************************************************************************/
+
+static int bchlib_writeentry(FAR struct bchlib_s *bch,
+                             FAR struct bch_cache_s *entry)
+{
+  FAR struct inode *inode;
+  ssize_t ret = OK;
+
+  if (entry->dirty)
+    {
+      inode = bch->inode;
+      ret = inode->u.i_bops->write(inode, entry->buffer, entry->sector, 1);
+      if (ret < 0)
+        {
+          fdbg("Write failed: %d\n", (int)ret);
+          return (int)ret;
+        }
+
+      entry->dirty = false;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: bchlib_findentry
+ *
+ * Description:
+ *   Return the cache entry holding 'sector' or NULL if it is not cached.
+ *
+ ****************************************************************************/
+
+static FAR struct bch_cache_s *bchlib_findentry(FAR struct bchlib_s *bch,
+                                                size_t sector)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_BCH_NCACHESECTORS; i++)
+    {
+      if (bch->cache[i].sector == sector)
+        {
+          return &bch->cache[i];
+        }
+    }
+
+  return NULL;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
 /****************************************************************************
- * Name: bchlib_flushsector
+ * Name: bchlib_flushcache
  *
  * Description:
- *   Flush the current contents of the sector buffer (if dirty)
+ *   Write all dirty sectors in the cache to the block driver.  Sectors are
+ *   written in ascending order.  Sectors that cannot be written stay dirty
+ *   and the last error is returned.
  *
  * Assumptions:
  *   Caller must assume mutual exclusion
  *
  ****************************************************************************/
 
-int bchlib_flushsector(FAR struct bchlib_s *bch)
+int bchlib_flushcache(FAR struct bchlib_s *bch)
 {
-  FAR struct inode *inode;
-  ssize_t ret = OK;
+  FAR struct bch_cache_s *entry;
+  FAR struct bch_cache_s *prev = NULL;
+  int result = OK;
+  int ret;
+  int i;
 
-  if (bch->dirty)
+  for (;;)
     {
-      inode = bch->inode;
-      ret = inode->u.i_bops->write(inode, bch->buffer, bch->sector, 1);
+      /* Find the lowest numbered dirty sector above the last one written.
+       * (A sector whose write failed is still dirty and must be skipped).
+       */
+
+      entry = NULL;
+      for (i = 0; i < CONFIG_BCH_NCACHESECTORS; i++)
+        {
+          if (bch->cache[i].dirty &&
+              (prev == NULL || bch->cache[i].sector > prev->sector) &&
+              (entry == NULL || bch->cache[i].sector < entry->sector))
+            {
+              entry = &bch->cache[i];
+            }
+        }
+
+      if (entry == NULL)
+        {
+          return result;
+        }
+
+      ret = bchlib_writeentry(bch, entry);
       if (ret < 0)
         {
-          fdbg("Write failed: %d\n");
+          result = ret;
         }
-      bch->dirty = false;
+
+      prev = entry;
     }
-  return (int)ret;
 }
 
 /****************************************************************************
  * Name: bchlib_readsector
  *
  * Description:
- *   Flush the current contents of the sector buffer (if dirty)
+ *   Make sure that the sector is in the cache, replacing the least recently
+ *   used sector (and writing it if dirty) if necessary.
+ *
+ * Returned Value:
+ *   The index of the cache entry holding the sector or a negated errno
+ *   value on failure.
  *
  * Assumptions:
  *   Caller must assume mutual exclusion
@@ -111,23 +196,118 @@ int bchlib_flushsector(FAR struct bchlib_s *bch)
 
 int bchlib_readsector(FAR struct bchlib_s *bch, size_t sector)
 {
+  FAR struct bch_cache_s *entry;
   FAR struct inode *inode;
-  ssize_t ret = OK;
+  ssize_t ret;
+  int i;
 
-  if (bch->sector != sector)
+  entry = bchlib_findentry(bch, sector);
+  if (entry == NULL)
     {
-      inode = bch->inode;
+      /* Not cached.  Use an empty entry or else replace the least recently
+       * used one.
+       */
+
+      entry = &bch->cache[0];
+      for (i = 0; i < CONFIG_BCH_NCACHESECTORS; i++)
+        {
+          if (bch->cache[i].sector == (size_t)-1)
+            {
+              entry = &bch->cache[i];
+              break;
+            }
+
+          if (bch->cache[i].lastuse < entry->lastuse)
+            {
+              entry = &bch->cache[i];
+            }
+        }
 
-      (void)bchlib_flushsector(bch);
-      bch->sector = (size_t)-1;
+      /* Write back the old sector.  If that fails, keep its (dirty) data
+       * in the cache and report the error; the entry cannot be reused.
+       */
 
-      ret = inode->u.i_bops->read(inode, bch->buffer, sector, 1);
+      ret = bchlib_writeentry(bch, entry);
+      if (ret < 0)
+        {
+          return (int)ret;
+        }
+
+      entry->sector = (size_t)-1;
+
+      inode = bch->inode;
+      ret = inode->u.i_bops->read(inode, entry->buffer, sector, 1);
       if (ret < 0)
         {
-          fdbg("Read failed: %d\n");
+          fdbg("Read failed: %d\n", (int)ret);
+          return (int)ret;
         }
-      bch->sector = sector;
+
+      entry->sector = sector;
     }
-  return (int)ret;
+
+  entry->lastuse = ++bch->access;
+  return entry - bch->cache;
 }
 
+/****************************************************************************
+ * Name: bchlib_readcached
+ *
+ * Description:
+ *   Sectors were just read directly from the block driver into 'buffer'.
+ *   Replace any sectors that have newer (dirty) data in the cache.
+ *
+ * Assumptions:
+ *   Caller must assume mutual exclusion
+ *
+ ****************************************************************************/
+
+void bchlib_readcached(FAR struct bchlib_s *bch, FAR uint8_t *buffer,
+                       size_t sector, size_t nsectors)
+{
+  FAR struct bch_cache_s *entry;
+  int i;
+
+  for (i = 0; i < CONFIG_BCH_NCACHESECTORS; i++)
+    {
+      entry = &bch->cache[i];
+      if (entry->dirty && entry->sector >= sector &&
+          entry->sector < sector + nsectors)
+        {
+          memcpy(&buffer[(entry->sector - sector) * bch->sectsize],
+                 entry->buffer, bch->sectsize);
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: bchlib_writecached
+ *
+ * Description:
+ *   Sectors were just written directly to the block driver from 'buffer'.
+ *   Update any cached copies of those sectors; they are no longer dirty.
+ *
+ * Assumptions:
+ *   Caller must assume mutual exclusion
+ *
+ ****************************************************************************/
+
+void bchlib_writecached(FAR struct bchlib_s *bch, FAR const uint8_t *buffer,
+                        size_t sector, size_t nsectors)
+{
+  FAR struct bch_cache_s *entry;
+  int i;
+
+  for (i = 0; i < CONFIG_BCH_NCACHESECTORS; i++)
+    {
+      entry = &bch->cache[i];
+      if (entry->sector != (size_t)-1 && entry->sector >= sector &&
+          entry->sector < sector + nsectors)
+        {
+          memcpy(entry->buffer,
+                 &buffer[(entry->sector - sector) * bch->sectsize],
+                 bch->sectsize);
+          entry->dirty = false;
+        }
+    }
+}
@@ -1,7 +1,7 @@
 /****************************************************************************
  * drivers/bch/bchlib_read.c
  *
- *   Copyright (C) 2008-2009 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -87,6 +87,7 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, size_t offset, size_t le
   uint16_t sectoffset;
   size_t   nbytes;
   size_t   bytesread;
+  int      ndx;
   int      ret;
 
   /* Get rid of this special case right away */
@@ -113,9 +114,13 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, size_t offset, size_t le
   bytesread = 0;
   if (sectoffset > 0)
     {
-      /* Read the sector into the sector buffer */
+      /* Read the sector into the sector cache */
 
-      bchlib_readsector(bch, sector);
+      ndx = bchlib_readsector(bch, sector);
+      if (ndx < 0)
+        {
+          return ndx;
+        }
 
       /* Copy the tail end of the sector to the user buffer */
 
@@ -128,7 +133,7 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, size_t offset, size_t le
           nbytes = len;
         }
 
-      memcpy(buffer, &bch->buffer[sectoffset], nbytes);
+      memcpy(buffer, &bch->cache[ndx].buffer[sectoffset], nbytes);
 
       /* Adjust pointers and counts */
 
@@ -161,10 +166,14 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, size_t offset, size_t le
                                        sector, nsectors);
       if (ret < 0)
         {
-          fdbg("Read failed: %d\n");
+          fdbg("Read failed: %d\n", ret);
           return ret;
         }
 
+      /* The cache may hold newer data for some of these sectors */
+
+      bchlib_readcached(bch, (FAR uint8_t *)buffer, sector, nsectors);
+
       /* Adjust pointers and counts */
 
       sectoffset = 0;
@@ -186,13 +195,17 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, size_t offset, size_t le
 
   if (len > 0)
     {
-      /* Read the sector into the sector buffer */
+      /* Read the sector into the sector cache */
 
-      bchlib_readsector(bch, sector);
+      ndx = bchlib_readsector(bch, sector);
+      if (ndx < 0)
+        {
+          return bytesread > 0 ? bytesread : ndx;
+        }
 
       /* Copy the head end of the sector to the user buffer */
 
-      memcpy(buffer, bch->buffer, len);
+      memcpy(buffer, bch->cache[ndx].buffer, len);
 
       /* Adjust counts */
 
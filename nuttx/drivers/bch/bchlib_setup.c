@@ -1,7 +1,7 @@
 /****************************************************************************
  * drivers/bch/bchlib_setup.c
  *
- *   Copyright (C) 2008-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -88,6 +88,7 @@ int bchlib_setup(const char *blkdev, bool readonly, FAR void **handle)
   FAR struct bchlib_s *bch;
   struct geometry geo;
   int ret;
+  int i;
 
   DEBUGASSERT(blkdev);
 
@@ -137,12 +138,11 @@ int bchlib_setup(const char *blkdev, bool readonly, FAR void **handle)
   sem_init(&bch->sem, 0, 1);
   bch->nsectors = geo.geo_nsectors;
   bch->sectsize = geo.geo_sectorsize;
-  bch->sector   = (size_t)-1;
   bch->readonly = readonly;
 
-  /* Allocate the sector I/O buffer */
+  /* Allocate the sector cache buffers */
 
-  bch->buffer = (FAR uint8_t *)kmalloc(bch->sectsize);
+  bch->buffer = (FAR uint8_t *)kmalloc(CONFIG_BCH_NCACHESECTORS * bch->sectsize);
   if (!bch->buffer)
     {
       fdbg("Failed to allocate sector buffer\n");
@@ -150,6 +150,12 @@ int bchlib_setup(const char *blkdev, bool readonly, FAR void **handle)
       goto errout_with_bch;
     }
 
+  for (i = 0; i < CONFIG_BCH_NCACHESECTORS; i++)
+    {
+      bch->cache[i].sector = (size_t)-1;
+      bch->cache[i].buffer = &bch->buffer[i * bch->sectsize];
+    }
+
   *handle = bch;
   return OK;
 
@@ -1,7 +1,7 @@
 /****************************************************************************
  * drivers/bch/bchlib_write.c
  *
- *   Copyright (C) 2008-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -88,6 +88,7 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, size_t offset, si
   uint16_t sectoffset;
   size_t   nbytes;
   size_t   byteswritten;
+  int      ndx;
   int      ret;
 
   /* Get rid of this special case right away */
@@ -112,9 +113,13 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, size_t offset, si
   byteswritten = 0;
   if (sectoffset > 0)
     {
-      /* Read the full sector into the sector buffer */
+      /* Read the full sector into the sector cache */
 
-      bchlib_readsector(bch, sector);
+      ndx = bchlib_readsector(bch, sector);
+      if (ndx < 0)
+        {
+          return ndx;
+        }
 
       /* Copy the tail end of the sector from the user buffer */
 
@@ -127,8 +132,8 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, size_t offset, si
           nbytes = len;
         }
 
-      memcpy(&bch->buffer[sectoffset], buffer, nbytes);
-      bch->dirty = true;
+      memcpy(&bch->cache[ndx].buffer[sectoffset], buffer, nbytes);
+      bch->cache[ndx].dirty = true;
 
       /* Adjust pointers and counts */
 
@@ -167,6 +172,10 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, size_t offset, si
           return ret;
         }
 
+      /* Keep any cached copies of these sectors up to date */
+
+      bchlib_writecached(bch, (FAR const uint8_t *)buffer, sector, nsectors);
+
       /* Adjust pointers and counts */
 
       sectoffset    = 0;
@@ -188,28 +197,34 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, size_t offset, si
 
   if (len > 0)
     {
-      /* Read the sector into the sector buffer */
+      /* Read the sector into the sector cache */
 
-      bchlib_readsector(bch, sector);
+      ndx = bchlib_readsector(bch, sector);
+      if (ndx < 0)
+        {
+          return byteswritten > 0 ? byteswritten : ndx;
+        }
 
       /* Copy the head end of the sector from the user buffer */
 
-      memcpy(bch->buffer, buffer, len);
-      bch->dirty = true;
+      memcpy(bch->cache[ndx].buffer, buffer, len);
+      bch->cache[ndx].dirty = true;
 
       /* Adjust counts */
 
       byteswritten += len;
     }
 
+#ifndef CONFIG_BCH_WRITEBACK
   /* Finally, flush any cached writes to the device as well */
 
-  ret = bchlib_flushsector(bch);
+  ret = bchlib_flushcache(bch);
   if (ret < 0)
     {
       fdbg("Flush failed: %d\n", ret);
       return ret;
     }
+#endif
 
   return byteswritten;
 }
@@ -5,7 +5,7 @@
  * Think of this as a template for an LCD driver that you will proably ahve to
  * customize for any particular LCD hardware.
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Authors: Gregory Nutt <gnutt@nuttx.org>
  *
  * References: SSD1289, Rev 1.3, Apr 2007, Solomon Systech Limited
@@ -294,6 +294,11 @@ static inline uint16_t ssd1289_gramread(FAR struct ssd1289_lcd_s *lcd, FAR uint1
 #endif
 static void ssd1289_setcursor(FAR struct ssd1289_lcd_s *lcd, uint16_t column,
                               uint16_t row);
+#ifdef CONFIG_LCD_LANDSCAPE
+static void ssd1289_setwindow(FAR struct ssd1289_lcd_s *lcd, fb_coord_t row,
+                              fb_coord_t col, fb_coord_t nrows, fb_coord_t ncols);
+static void ssd1289_resetwindow(FAR struct ssd1289_lcd_s *lcd);
+#endif
 
 /* LCD Data Transfer Methods */
 
@@ -314,6 +319,12 @@ static int ssd1289_putrun(fb_coord_t row, fb_coord_t col, FAR const uint8_t *buf
              size_t npixels);
 static int ssd1289_getrun(fb_coord_t row, fb_coord_t col, FAR uint8_t *buffer,
              size_t npixels);
+#ifdef CONFIG_LCD_LANDSCAPE
+static int ssd1289_putarea(fb_coord_t row, fb_coord_t col, fb_coord_t nrows,
+             fb_coord_t ncols, FAR const uint8_t *buffer, size_t stride);
+static int ssd1289_fillarea(fb_coord_t row, fb_coord_t col, fb_coord_t nrows,
+             fb_coord_t ncols, uint32_t color);
+#endif
 
 /* LCD Configuration */
 
@@ -481,6 +492,48 @@ static void ssd1289_setcursor(FAR struct ssd1289_lcd_s *lcd, uint16_t column, ui
 #endif
 }
 
+/**************************************************************************************
+ * Name:  ssd1289_setwindow
+ *
+ * Description:
+ *   Restrict GRAM accesses to a rectangle of the display and move the address counter
+ *   to its first pixel.  In landscape mode, the address counter advances along the
+ *   display row (AM=1) and wraps to the beginning of the next row of the window, so
+ *   the whole rectangle can then be written as one stream of GRAM data.
+ *
+ **************************************************************************************/
+
+#ifdef CONFIG_LCD_LANDSCAPE
+static void ssd1289_setwindow(FAR struct ssd1289_lcd_s *lcd, fb_coord_t row,
+                              fb_coord_t col, fb_coord_t nrows, fb_coord_t ncols)
+{
+  ssd1289_putreg(lcd, SSD1289_HADDR,
+                 ((uint16_t)row << SSD1289_HADDR_HSA_SHIFT) |
+                 ((uint16_t)(row + nrows - 1) << SSD1289_HADDR_HEA_SHIFT));
+  ssd1289_putreg(lcd, SSD1289_VSTART, col);
+  ssd1289_putreg(lcd, SSD1289_VEND, col + ncols - 1);
+  ssd1289_setcursor(lcd, col, row);
+}
+#endif
+
+/**************************************************************************************
+ * Name:  ssd1289_resetwindow
+ *
+ * Description:
+ *   Restore the full screen GRAM window (0-239, 0-319) that putrun and getrun expect.
+ *
+ **************************************************************************************/
+
+#ifdef CONFIG_LCD_LANDSCAPE
+static void ssd1289_resetwindow(FAR struct ssd1289_lcd_s *lcd)
+{
+  ssd1289_putreg(lcd, SSD1289_HADDR,
+                (0 << SSD1289_HADDR_HSA_SHIFT) | (239 << SSD1289_HADDR_HEA_SHIFT));
+  ssd1289_putreg(lcd, SSD1289_VSTART, 0);
+  ssd1289_putreg(lcd, SSD1289_VEND, 319);
+}
+#endif
+
 /**************************************************************************************
  * Name:  ssd1289_dumprun
  *
@@ -698,6 +751,107 @@ static int ssd1289_putrun(fb_coord_t row, fb_coord_t col, FAR const uint8_t *buf
   return OK;
 }
 
+/**************************************************************************************
+ * Name:  ssd1289_putarea
+ *
+ * Description:
+ *   This method can be used to write a rectangular area to the LCD.  The GRAM window
+ *   is set once for the whole area instead of addressing the GRAM for each pixel as
+ *   ssd1289_putrun must in landscape mode.
+ *
+ *   row     - Starting row to write to (range: 0 <= row < yres)
+ *   col     - Starting column to write to (range: 0 <= col < xres)
+ *   nrows   - The number of rows to write
+ *   ncols   - The number of pixels in each row
+ *   buffer  - The buffer containing the first row of the area
+ *   stride  - The distance in bytes from one row in buffer to the next
+ *
+ **************************************************************************************/
+
+#ifdef CONFIG_LCD_LANDSCAPE
+static int ssd1289_putarea(fb_coord_t row, fb_coord_t col, fb_coord_t nrows,
+                           fb_coord_t ncols, FAR const uint8_t *buffer, size_t stride)
+{
+  FAR struct ssd1289_dev_s *priv = &g_lcddev;
+  FAR struct ssd1289_lcd_s *lcd = priv->lcd;
+  FAR const uint16_t *src;
+  int i;
+  int j;
+
+  lcdvdbg("row: %d col: %d nrows: %d ncols: %d\n", row, col, nrows, ncols);
+
+  /* The image must be aligned to 16-bit address boundaries.  Otherwise, let
+   * ssd1289_putrun complain about it.
+   */
+
+  if (!buffer || ((uintptr_t)buffer & 1) != 0 || (stride & 1) != 0)
+    {
+      return -EINVAL;
+    }
+
+  /* Select the LCD and write the whole area as one stream of GRAM data */
+
+  lcd->select(lcd);
+  ssd1289_setwindow(lcd, row, col, nrows, ncols);
+  ssd1289_gramselect(lcd);
+
+  for (i = 0; i < nrows; i++)
+    {
+      src = (FAR const uint16_t*)buffer;
+      for (j = 0; j < ncols; j++)
+        {
+          ssd1289_gramwrite(lcd, *src++);
+        }
+
+      buffer += stride;
+    }
+
+  /* Restore the full screen window and de-select the LCD */
+
+  ssd1289_resetwindow(lcd);
+  lcd->deselect(lcd);
+  return OK;
+}
+#endif
+
+/**************************************************************************************
+ * Name:  ssd1289_fillarea
+ *
+ * Description:
+ *   This method can be used to fill a rectangular area of the LCD with one color
+ *   (row, col, nrows, ncols as for ssd1289_putarea).
+ *
+ **************************************************************************************/
+
+#ifdef CONFIG_LCD_LANDSCAPE
+static int ssd1289_fillarea(fb_coord_t row, fb_coord_t col, fb_coord_t nrows,
+                            fb_coord_t ncols, uint32_t color)
+{
+  FAR struct ssd1289_dev_s *priv = &g_lcddev;
+  FAR struct ssd1289_lcd_s *lcd = priv->lcd;
+  uint32_t npixels;
+
+  lcdvdbg("row: %d col: %d nrows: %d ncols: %d\n", row, col, nrows, ncols);
+
+  /* Select the LCD and write the color to each pixel in the window */
+
+  lcd->select(lcd);
+  ssd1289_setwindow(lcd, row, col, nrows, ncols);
+  ssd1289_gramselect(lcd);
+
+  for (npixels = (uint32_t)nrows * ncols; npixels > 0; npixels--)
+    {
+      ssd1289_gramwrite(lcd, (uint16_t)color);
+    }
+
+  /* Restore the full screen window and de-select the LCD */
+
+  ssd1289_resetwindow(lcd);
+  lcd->deselect(lcd);
+  return OK;
+}
+#endif
+
 /**************************************************************************************
  * Name:  ssd1289_getrun
  *
@@ -874,6 +1028,10 @@ static int ssd1289_getplaneinfo(FAR struct lcd_dev_s *dev, unsigned int planeno,
 
   pinfo->putrun = ssd1289_putrun;            /* Put a run into LCD memory */
   pinfo->getrun = ssd1289_getrun;            /* Get a run from LCD memory */
+#ifdef CONFIG_LCD_LANDSCAPE
+  pinfo->putarea  = ssd1289_putarea;         /* Put a rectangle into LCD memory */
+  pinfo->fillarea = ssd1289_fillarea;        /* Fill a rectangle in LCD memory */
+#endif
   pinfo->buffer = (uint8_t*)priv->runbuffer; /* Run scratch buffer */
   pinfo->bpp    = SSD1289_BPP;               /* Bits-per-pixel */
   return OK;
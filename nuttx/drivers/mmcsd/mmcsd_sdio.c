@@ -1807,7 +1807,7 @@ static ssize_t mmcsd_writemultiple(FAR struct mmcsd_state_s *priv,
     {
       /* Send CMD55, APP_CMD, a verify that good R1 status is retured */
 
-      mmcsd_sendcmdpoll(priv, SD_CMD55, 0);
+      mmcsd_sendcmdpoll(priv, SD_CMD55, (uint32_t)priv->rca << 16);
       ret = mmcsd_recvR1(priv, SD_CMD55);
       if (ret != OK)
         {
@@ -1815,9 +1815,11 @@ static ssize_t mmcsd_writemultiple(FAR struct mmcsd_state_s *priv,
           return ret;
         }
 
-      /* Send CMD23, SET_WR_BLK_COUNT, and verify that good R1 status is returned */
+      /* Send ACMD23, SET_WR_BLK_ERASE_COUNT, with the number of blocks to
+       * be pre-erased and verify that good R1 status is returned.
+       */
 
-      mmcsd_sendcmdpoll(priv, SD_ACMD23, 0);
+      mmcsd_sendcmdpoll(priv, SD_ACMD23, nblocks);
       ret = mmcsd_recvR1(priv, SD_ACMD23);
       if (ret != OK)
         {
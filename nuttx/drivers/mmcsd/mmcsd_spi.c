@@ -90,6 +90,21 @@
 #  define CONFIG_MMCSD_SECTOR512          /* Force 512 byte sectors on all cards */
 #endif
 
+/* While waiting for the card to become ready or for a data token, bytes
+ * are clocked in CONFIG_MMCSD_SPIPOLLSIZE at a time with SPI_RECVBLOCK
+ * rather than one SPI_SEND call per byte.  Any data bytes that follow a
+ * token in the same poll are kept.  This value must not exceed 16, the
+ * smallest block (CSD/CID) that is received after a token.
+ */
+
+#ifndef CONFIG_MMCSD_SPIPOLLSIZE
+#  define CONFIG_MMCSD_SPIPOLLSIZE 8
+#endif
+
+#if CONFIG_MMCSD_SPIPOLLSIZE < 1 || CONFIG_MMCSD_SPIPOLLSIZE > 16
+#  error "CONFIG_MMCSD_SPIPOLLSIZE must be in the range 1-16"
+#endif
+
 /* Slot struct info *********************************************************/
 /* Slot status definitions */
 
@@ -155,6 +170,7 @@ struct mmcsd_slot_s
   uint32_t ocr;          /* Last 4 bytes of OCR (R3) */
   uint32_t r7;           /* Last 4 bytes of R7 */
   uint32_t spispeed;     /* Speed to use for SPI in data mode */
+  uint8_t  pollbuf[CONFIG_MMCSD_SPIPOLLSIZE]; /* Bytes clocked in while polling */
 };
 
 struct mmcsd_cmdinfo_s
@@ -176,6 +192,8 @@ static void     mmcsd_semgive(FAR struct mmcsd_slot_s *slot);
 /* Card SPI interface *******************************************************/
 
 static int      mmcsd_waitready(FAR struct mmcsd_slot_s *slot);
+static int      mmcsd_waittoken(FAR struct mmcsd_slot_s *slot,
+                  uint32_t timeout);
 static uint32_t mmcsd_sendcmd(FAR struct mmcsd_slot_s *slot,
                   const struct mmcsd_cmdinfo_s *cmd, uint32_t arg);
 static void     mmcsd_setblklen(FAR struct mmcsd_slot_s *slot,
@@ -405,25 +423,83 @@ static int mmcsd_waitready(FAR struct mmcsd_slot_s *slot)
   uint8_t response;
   uint32_t start;
   uint32_t elapsed;
+  int i;
 
-  /* Wait until the card is no longer busy (up to 500MS) */
+  /* Usually the card is not busy and a single byte tells us that */
+
+  response = SPI_SEND(spi, 0xff);
+  if (response == 0xff)
+    {
+      return OK;
+    }
+
+  /* Otherwise, wait until the card is no longer busy (up to 500MS).  The
+   * card holds MISO low while it is busy and releases it (0xff) when it is
+   * done, so the card is ready if any byte of the poll is 0xff.
+   */
 
   start = START_TIME;
   do
     {
-      response = SPI_SEND(spi, 0xff);
-      if (response == 0xff)
+      SPI_RECVBLOCK(spi, slot->pollbuf, CONFIG_MMCSD_SPIPOLLSIZE);
+      for (i = 0; i < CONFIG_MMCSD_SPIPOLLSIZE; i++)
         {
-          return OK;
+          if (slot->pollbuf[i] == 0xff)
+            {
+              return OK;
+            }
         }
+
       elapsed = ELAPSED_TIME(start);
     }
   while (elapsed < MMCSD_DELAY_500MS);
 
-  fdbg("Card still busy, last response: %02x\n", response);
+  fdbg("Card still busy, last response: %02x\n",
+       slot->pollbuf[CONFIG_MMCSD_SPIPOLLSIZE-1]);
   return -EBUSY;
 }
 
+/****************************************************************************
+ * Name: mmcsd_waittoken
+ *
+ * Description:
+ *   Clock in bytes until the card returns something other than 0xff (a
+ *   data token or a data error token) or until the timeout (in clock
+ *   ticks) expires.  On success, the index of the token in slot->pollbuf
+ *   is returned; any bytes after the token in slot->pollbuf have already
+ *   been received from the card.
+ *
+ * Assumptions:
+ *   MMC/SD card already selected
+ *
+ ****************************************************************************/
+
+static int mmcsd_waittoken(FAR struct mmcsd_slot_s *slot, uint32_t timeout)
+{
+  FAR struct spi_dev_s *spi = slot->spi;
+  uint32_t start;
+  uint32_t elapsed;
+  int i;
+
+  start = START_TIME;
+  do
+    {
+      SPI_RECVBLOCK(spi, slot->pollbuf, CONFIG_MMCSD_SPIPOLLSIZE);
+      for (i = 0; i < CONFIG_MMCSD_SPIPOLLSIZE; i++)
+        {
+          if (slot->pollbuf[i] != 0xff)
+            {
+              return i;
+            }
+        }
+
+      elapsed = ELAPSED_TIME(start);
+    }
+  while (elapsed < timeout);
+
+  return -ETIMEDOUT;
+}
+
 /****************************************************************************
  * Name: mmcsd_sendcmd
  *
@@ -922,27 +998,37 @@ static int mmcsd_getcardinfo(FAR struct mmcsd_slot_s *slot, uint8_t *buffer,
 static int mmcsd_recvblock(FAR struct mmcsd_slot_s *slot, uint8_t *buffer, int nbytes)
 {
   FAR struct spi_dev_s *spi = slot->spi;
-  uint32_t start;
-  uint32_t elapsed;
-  uint8_t  token;
+  uint8_t token = 0xff;
+  int navail;
+  int ndx;
+
+  DEBUGASSERT(nbytes >= CONFIG_MMCSD_SPIPOLLSIZE);
 
   /* Wait up to the maximum to receive a valid data token.  taccess is the
    * time from when the command is sent until the first byte of data is
    * received */
 
-  start = START_TIME;
-  do
+  ndx = mmcsd_waittoken(slot, slot->taccess);
+  if (ndx >= 0)
     {
-      token = SPI_SEND(spi, 0xff);
-      elapsed = ELAPSED_TIME(start);
+      token = slot->pollbuf[ndx];
     }
-  while (token == 0xff && elapsed < slot->taccess);
 
   if (token == MMCSD_SPIDT_STARTBLKSNGL)
     {
-      /* Receive the block */
+      /* The first few bytes of the block may have been received along with
+       * the token.
+       */
 
-      SPI_RECVBLOCK(spi, buffer, nbytes);
+      navail = CONFIG_MMCSD_SPIPOLLSIZE - ndx - 1;
+      if (navail > 0)
+        {
+          memcpy(buffer, &slot->pollbuf[ndx+1], navail);
+        }
+
+      /* Receive the rest of the block */
+
+      SPI_RECVBLOCK(spi, buffer + navail, nbytes - navail);
 
       /* Discard the CRC */
 
@@ -1098,6 +1184,7 @@ static ssize_t mmcsd_read(FAR struct inode *inode, unsigned char *buffer,
 {
   FAR struct mmcsd_slot_s *slot;
   FAR struct spi_dev_s *spi;
+  FAR unsigned char *dest;
   size_t nbytes;
   off_t  offset;
   uint8_t  response;
@@ -1198,22 +1285,29 @@ static ssize_t mmcsd_read(FAR struct inode *inode, unsigned char *buffer,
       response = mmcsd_sendcmd(slot, &g_cmd18, offset);
       if (response != MMCSD_SPIR1_OK)
         {
-          fdbg("CMD118 failed: R1=%02x\n", response);
+          fdbg("CMD18 failed: R1=%02x\n", response);
           goto errout_with_eio;
         }
 
       /* Receive each block */
 
+      dest = buffer;
       for (i = 0; i < nsectors; i++)
         {
-          if (mmcsd_recvblock(slot, buffer, SECTORSIZE(slot)) != 0)
+          if (mmcsd_recvblock(slot, dest, SECTORSIZE(slot)) != 0)
             {
               fdbg("Failed: to receive the block\n");
+
+              /* Stop the transmission so that the card is left ready for
+               * the next command.
+               */
+
+              (void)mmcsd_sendcmd(slot, &g_cmd12, 0);
               goto errout_with_eio;
             }
 
-         buffer += SECTORSIZE(slot);
-       }
+          dest += SECTORSIZE(slot);
+        }
 
       /* Send CMD12: Stops transmission */
 
@@ -1352,17 +1446,26 @@ static ssize_t mmcsd_write(FAR struct inode *inode, const unsigned char *buffer,
     }
   else
     {
-      /* Set the number of blocks to be pre-erased (SD only) */
+      /* Set the number of blocks to be pre-erased (SD only).  This is an
+       * application specific command and so must be preceded by CMD55.
+       */
 
       if (IS_SD(slot->type))
         {
+          response = mmcsd_sendcmd(slot, &g_cmd55, 0);
+          if (response != MMCSD_SPIR1_OK)
+            {
+              fdbg("CMD55 (ACMD23) failed: R1=%02x\n", response);
+              goto errout_with_sem;
+            }
+
           response = mmcsd_sendcmd(slot, &g_acmd23, nsectors);
           if (response != MMCSD_SPIR1_OK)
             {
               fdbg("ACMD23 failed: R1=%02x\n", response);
               goto errout_with_sem;
             }
-       }
+        }
 
       /* Send CMD25:  Continuously write blocks of data until the
        * tranmission is stopped.
@@ -1375,21 +1478,31 @@ static ssize_t mmcsd_write(FAR struct inode *inode, const unsigned char *buffer,
           goto errout_with_sem;
         }
 
-      /* Transmit each block */
+      /* Transmit each block.  The card is busy while it programs each
+       * block and will ignore the next data token until it is ready again.
+       */
 
       for (i = 0; i < nsectors; i++)
         {
-          if (mmcsd_xmitblock(slot, buffer, SECTORSIZE(slot), 0xfc) != 0)
+          if (mmcsd_xmitblock(slot, buffer, SECTORSIZE(slot), 0xfc) != 0 ||
+              mmcsd_waitready(slot) != OK)
             {
-              fdbg("Failed: to receive the block\n");
+              fdbg("Failed: to transmit the block\n");
+              SPI_SEND(spi, MMCSD_SPIDT_STOPTRANS);
+              SPI_SEND(spi, 0xff);
+              (void)mmcsd_waitready(slot);
               goto errout_with_sem;
             }
+
           buffer += SECTORSIZE(slot);
         }
 
-      /* Send the stop transmission token */
+      /* Send the stop transmission token.  The card may not signal busy
+       * until one byte after the stop token.
+       */
 
       SPI_SEND(spi, MMCSD_SPIDT_STOPTRANS);
+      SPI_SEND(spi, 0xff);
     }
 
   /* Wait until the card is no longer busy */
@@ -0,0 +1,858 @@
+/****************************************************************************
+ * drivers/mmcsd/mmcsd_spisim.c
+ * A simulated SD card (SPI mode) backed by a RAM buffer
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/kmalloc.h>
+#include <nuttx/spi.h>
+#include <nuttx/mmcsd.h>
+
+#include "mmcsd_spi.h"
+
+#if defined(CONFIG_MMCSD_SPI) && defined(CONFIG_MMCSD_SPISIM)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+/* Configuration ************************************************************/
+/* Timing of the simulated card is expressed in bytes clocked on the SPI bus:
+ *
+ * CONFIG_MMCSD_SPISIM_NAC - Bytes of 0xff before each data token on reads
+ * CONFIG_MMCSD_SPISIM_PROGBYTES - Busy bytes to program one written block
+ * CONFIG_MMCSD_SPISIM_ERASEBYTES - Additional busy bytes to erase a block
+ *   that was not pre-erased with ACMD23.  An ACMD23 pre-erase costs this
+ *   once for the whole transfer.
+ */
+
+#ifndef CONFIG_MMCSD_SPISIM_NAC
+#  define CONFIG_MMCSD_SPISIM_NAC 16
+#endif
+
+#if CONFIG_MMCSD_SPISIM_NAC < 1
+#  error "CONFIG_MMCSD_SPISIM_NAC must be at least 1"
+#endif
+
+#ifndef CONFIG_MMCSD_SPISIM_PROGBYTES
+#  define CONFIG_MMCSD_SPISIM_PROGBYTES 64
+#endif
+
+#ifndef CONFIG_MMCSD_SPISIM_ERASEBYTES
+#  define CONFIG_MMCSD_SPISIM_ERASEBYTES 256
+#endif
+
+/* The card is an SDHC (version 2, block addressed) card.  Its capacity is
+ * (C_SIZE+1) * 512KiB so the number of sectors is a multiple of 1024.
+ */
+
+#define SPISIM_SECTORSIZE   512
+#define SPISIM_CSIZEUNIT    1024
+
+/* Card states */
+
+#define SPISIM_STATE_CMD    0  /* Waiting for or receiving a command */
+#define SPISIM_STATE_READ   1  /* Sending data blocks (CMD9/10/17/18) */
+#define SPISIM_STATE_WRITE  2  /* Waiting for a data token (CMD24/25) */
+#define SPISIM_STATE_DATA   3  /* Receiving a data block */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This type represents the state of the simulated card */
+
+struct spisim_dev_s
+{
+  struct spi_dev_s spidev;     /* Externally visible part of the SPI interface */
+  FAR uint8_t *media;          /* Card contents */
+  FAR const uint8_t *src;      /* Source of the block being read */
+  uint32_t nsectors;           /* Card capacity in sectors */
+  uint32_t sector;             /* Current sector of a read or write */
+  uint32_t nerased;            /* Number of blocks pre-erased by ACMD23 */
+  uint32_t busy;               /* Remaining busy bytes */
+  uint16_t pos;                /* Byte position in the block being read/written */
+  uint16_t srclen;             /* Size of the block being read */
+  uint16_t nac;                /* Bytes of 0xff before the data token */
+  uint8_t  state;              /* See SPISIM_STATE_* definitions */
+  uint8_t  ncmd;               /* Number of command bytes received */
+  uint8_t  nout;               /* Number of queued response bytes */
+  uint8_t  outndx;             /* Index of the next response byte */
+  uint8_t  initcount;          /* ACMD41 commands before leaving IDLE */
+  bool     selected;           /* True: chip select asserted */
+  bool     idle;               /* True: card is in IDLE state */
+  bool     appcmd;             /* True: last command was CMD55 */
+  bool     multi;              /* True: CMD18 or CMD25 in progress */
+  uint8_t  cmd[6];             /* Command being received */
+  uint8_t  out[8];             /* Queued response bytes */
+  uint8_t  csd[16];            /* Card specific data */
+  uint8_t  blk[SPISIM_SECTORSIZE]; /* Block being written */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* Card model */
+
+static void     spisim_respond(FAR struct spisim_dev_s *priv,
+                  FAR const uint8_t *resp, int nbytes);
+static void     spisim_r1(FAR struct spisim_dev_s *priv, uint8_t r1);
+static void     spisim_command(FAR struct spisim_dev_s *priv);
+static uint8_t  spisim_output(FAR struct spisim_dev_s *priv);
+static void     spisim_input(FAR struct spisim_dev_s *priv, uint8_t ch);
+static uint8_t  spisim_xfer(FAR struct spisim_dev_s *priv, uint8_t ch);
+
+/* SPI methods */
+
+#ifndef CONFIG_SPI_OWNBUS
+static int      spisim_lock(FAR struct spi_dev_s *dev, bool lock);
+#endif
+static void     spisim_select(FAR struct spi_dev_s *dev, enum spi_dev_e devid,
+                  bool selected);
+static uint32_t spisim_setfrequency(FAR struct spi_dev_s *dev,
+                  uint32_t frequency);
+static void     spisim_setmode(FAR struct spi_dev_s *dev, enum spi_mode_e mode);
+static void     spisim_setbits(FAR struct spi_dev_s *dev, int nbits);
+static uint8_t  spisim_status(FAR struct spi_dev_s *dev, enum spi_dev_e devid);
+#ifdef CONFIG_SPI_CMDDATA
+static int      spisim_cmddata(FAR struct spi_dev_s *dev, enum spi_dev_e devid,
+                  bool cmd);
+#endif
+static uint16_t spisim_send(FAR struct spi_dev_s *dev, uint16_t wd);
+#ifdef CONFIG_SPI_EXCHANGE
+static void     spisim_exchange(FAR struct spi_dev_s *dev,
+                  FAR const void *txbuffer, FAR void *rxbuffer, size_t nwords);
+#else
+static void     spisim_sndblock(FAR struct spi_dev_s *dev,
+                  FAR const void *buffer, size_t nwords);
+static void     spisim_recvblock(FAR struct spi_dev_s *dev, FAR void *buffer,
+                  size_t nwords);
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct spi_ops_s g_spiops =
+{
+#ifndef CONFIG_SPI_OWNBUS
+  spisim_lock,          /* lock */
+#endif
+  spisim_select,        /* select */
+  spisim_setfrequency,  /* setfrequency */
+  spisim_setmode,       /* setmode */
+  spisim_setbits,       /* setbits */
+  spisim_status,        /* status */
+#ifdef CONFIG_SPI_CMDDATA
+  spisim_cmddata,       /* cmddata */
+#endif
+  spisim_send,          /* send */
+#ifdef CONFIG_SPI_EXCHANGE
+  spisim_exchange,      /* exchange */
+#else
+  spisim_sndblock,      /* sndblock */
+  spisim_recvblock,     /* recvblock */
+#endif
+  NULL                  /* registercallback */
+};
+
+/* Card identification:  Manufacturer 0x00, OEM "NX", product "SPSIM",
+ * revision 1.0.  The CRC fields are not checked in SPI mode.
+ */
+
+static const uint8_t g_cid[16] =
+{
+  0x00, 'N',  'X',  'S',  'P',  'S',  'I',  'M',
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x01, 0x01
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: spisim_respond
+ *
+ * Description:
+ *   Queue a command response.  The response is preceded by one byte of
+ *   0xff (NCR).
+ *
+ ****************************************************************************/
+
+static void spisim_respond(FAR struct spisim_dev_s *priv,
+                           FAR const uint8_t *resp, int nbytes)
+{
+  DEBUGASSERT(nbytes < sizeof(priv->out));
+
+  priv->out[0] = 0xff;
+  memcpy(&priv->out[1], resp, nbytes);
+  priv->nout   = nbytes + 1;
+  priv->outndx = 0;
+}
+
+/****************************************************************************
+ * Name: spisim_r1
+ *
+ * Description:
+ *   Queue an R1 response.  The IDLE bit is added as appropriate.
+ *
+ ****************************************************************************/
+
+static void spisim_r1(FAR struct spisim_dev_s *priv, uint8_t r1)
+{
+  if (priv->idle)
+    {
+      r1 |= MMCSD_SPIR1_IDLESTATE;
+    }
+
+  spisim_respond(priv, &r1, 1);
+}
+
+/****************************************************************************
+ * Name: spisim_command
+ *
+ * Description:
+ *   Execute the command in priv->cmd
+ *
+ ****************************************************************************/
+
+static void spisim_command(FAR struct spisim_dev_s *priv)
+{
+  uint8_t resp[5];
+  uint32_t arg;
+  uint8_t cmd;
+  bool appcmd;
+
+  cmd = priv->cmd[0];
+  arg = ((uint32_t)priv->cmd[1] << 24) | ((uint32_t)priv->cmd[2] << 16) |
+        ((uint32_t)priv->cmd[3] << 8)  |  (uint32_t)priv->cmd[4];
+
+  appcmd       = priv->appcmd;
+  priv->appcmd = false;
+
+  fvdbg("%sCMD%d[%08x]\n", appcmd ? "A" : "", cmd & 0x3f, arg);
+
+  /* Any command other than CMD12 terminates a multi-block read */
+
+  if (priv->state == SPISIM_STATE_READ && cmd != CMD12)
+    {
+      priv->state = SPISIM_STATE_CMD;
+    }
+
+  /* Only CMD0 is accepted until the card has been put into SPI mode, and
+   * only the initialization commands are accepted in the IDLE state.
+   */
+
+  if (priv->idle && cmd != CMD0 && cmd != CMD8 && cmd != CMD55 &&
+      cmd != CMD58 && !(appcmd && cmd == ACMD41))
+    {
+      spisim_r1(priv, MMCSD_SPIR1_ILLEGALCMD);
+      return;
+    }
+
+  switch (cmd)
+    {
+    case CMD0:    /* GO_IDLE_STATE */
+      priv->idle      = true;
+      priv->initcount = 2;
+      priv->nerased   = 0;
+      priv->busy      = 0;
+      priv->state     = SPISIM_STATE_CMD;
+      spisim_r1(priv, MMCSD_SPIR1_OK);
+      break;
+
+    case CMD8:    /* SEND_IF_COND: Echo the voltage and check pattern */
+      resp[0] = priv->idle ? MMCSD_SPIR1_IDLESTATE : MMCSD_SPIR1_OK;
+      resp[1] = 0;
+      resp[2] = 0;
+      resp[3] = (arg >> 8) & 0x0f;
+      resp[4] = arg & 0xff;
+      spisim_respond(priv, resp, 5);
+      break;
+
+    case CMD55:   /* APP_CMD */
+      priv->appcmd = true;
+      spisim_r1(priv, MMCSD_SPIR1_OK);
+      break;
+
+    case CMD58:   /* READ_OCR: Powered up, high capacity, 2.7-3.6V */
+      resp[0] = priv->idle ? MMCSD_SPIR1_IDLESTATE : MMCSD_SPIR1_OK;
+      resp[1] = (MMCSD_OCR_BUSY | MMCSD_OCR_CCS) >> 24;
+      resp[2] = 0xff;
+      resp[3] = 0x80;
+      resp[4] = 0;
+      spisim_respond(priv, resp, 5);
+      break;
+
+    case CMD9:    /* SEND_CSD */
+    case CMD10:   /* SEND_CID */
+      spisim_r1(priv, MMCSD_SPIR1_OK);
+      priv->src    = cmd == CMD9 ? priv->csd : g_cid;
+      priv->srclen = 16;
+      priv->nac    = 1;
+      priv->pos    = 0;
+      priv->multi  = false;
+      priv->state  = SPISIM_STATE_READ;
+      break;
+
+    case CMD12:   /* STOP_TRANSMISSION: Response follows a stuff byte */
+      priv->state = SPISIM_STATE_CMD;
+      resp[0]     = 0xff;
+      resp[1]     = MMCSD_SPIR1_OK;
+      spisim_respond(priv, resp, 2);
+      break;
+
+    case CMD16:   /* SET_BLOCKLEN: Only 512 bytes is supported */
+      spisim_r1(priv, arg == SPISIM_SECTORSIZE ?
+                MMCSD_SPIR1_OK : MMCSD_SPIR1_PARAMERROR);
+      break;
+
+    case CMD17:   /* READ_SINGLE_BLOCK */
+    case CMD18:   /* READ_MULTIPLE_BLOCK */
+    case CMD24:   /* WRITE_BLOCK */
+    case CMD25:   /* WRITE_MULTIPLE_BLOCK */
+      if (arg >= priv->nsectors)
+        {
+          spisim_r1(priv, MMCSD_SPIR1_ADDRERROR);
+          break;
+        }
+
+      spisim_r1(priv, MMCSD_SPIR1_OK);
+      priv->sector = arg;
+      priv->pos    = 0;
+      priv->multi  = (cmd == CMD18 || cmd == CMD25);
+
+      if (cmd == CMD17 || cmd == CMD18)
+        {
+          priv->src    = &priv->media[arg * SPISIM_SECTORSIZE];
+          priv->srclen = SPISIM_SECTORSIZE;
+          priv->nac    = CONFIG_MMCSD_SPISIM_NAC;
+          priv->state  = SPISIM_STATE_READ;
+        }
+      else
+        {
+          priv->state  = SPISIM_STATE_WRITE;
+        }
+      break;
+
+    case ACMD23:  /* SET_WR_BLK_ERASE_COUNT (CMD23 is not supported) */
+      if (!appcmd)
+        {
+          spisim_r1(priv, MMCSD_SPIR1_ILLEGALCMD);
+          break;
+        }
+
+      /* Erasing the blocks costs one erase time for the whole transfer */
+
+      priv->nerased = arg & 0x007fffff;
+      if (priv->nerased > 0)
+        {
+          priv->busy += CONFIG_MMCSD_SPISIM_ERASEBYTES;
+        }
+
+      spisim_r1(priv, MMCSD_SPIR1_OK);
+      break;
+
+    case ACMD41:  /* SD_SEND_OP_COND (CMD41 is not supported) */
+      if (!appcmd)
+        {
+          spisim_r1(priv, MMCSD_SPIR1_ILLEGALCMD);
+        }
+      else if (priv->initcount > 0)
+        {
+          priv->initcount--;
+          spisim_r1(priv, MMCSD_SPIR1_OK);
+        }
+      else
+        {
+          priv->idle = false;
+          spisim_r1(priv, MMCSD_SPIR1_OK);
+        }
+      break;
+
+    default:
+      spisim_r1(priv, MMCSD_SPIR1_ILLEGALCMD);
+      break;
+    }
+}
+
+/****************************************************************************
+ * Name: spisim_output
+ *
+ * Description:
+ *   Return the next byte driven by the card on MISO
+ *
+ ****************************************************************************/
+
+static uint8_t spisim_output(FAR struct spisim_dev_s *priv)
+{
+  uint16_t pos;
+
+  /* Queued command and data responses come first */
+
+  if (priv->outndx < priv->nout)
+    {
+      return priv->out[priv->outndx++];
+    }
+
+  /* The card holds MISO low while it is busy */
+
+  if (priv->busy > 0)
+    {
+      priv->busy--;
+      return 0x00;
+    }
+
+  if (priv->state != SPISIM_STATE_READ)
+    {
+      return 0xff;
+    }
+
+  /* Sending a data block:  NAC bytes of 0xff, the start block token, the
+   * data, then two bytes of CRC.  The CSD and CID registers are sent with
+   * a shorter delay than data blocks.
+   */
+
+  pos = priv->pos++;
+  if (pos < priv->nac)
+    {
+      return 0xff;
+    }
+
+  pos -= priv->nac;
+  if (pos == 0)
+    {
+      return MMCSD_SPIDT_STARTBLKSNGL;
+    }
+
+  pos--;
+  if (pos < priv->srclen)
+    {
+      return priv->src[pos];
+    }
+
+  pos -= priv->srclen;
+  if (pos == 1)
+    {
+      /* This is the last CRC byte.  Move on to the next sector of a
+       * multi-block read.  Reading beyond the end of the card is an error.
+       */
+
+      priv->pos = 0;
+      if (priv->multi && ++priv->sector < priv->nsectors)
+        {
+          priv->src += SPISIM_SECTORSIZE;
+        }
+      else
+        {
+          priv->state = SPISIM_STATE_CMD;
+        }
+    }
+
+  return 0;
+}
+
+/****************************************************************************
+ * Name: spisim_input
+ *
+ * Description:
+ *   Process one byte sent by the host on MOSI
+ *
+ ****************************************************************************/
+
+static void spisim_input(FAR struct spisim_dev_s *priv, uint8_t ch)
+{
+  uint32_t busy;
+
+  /* The card does not listen while it is busy */
+
+  if (priv->busy > 0)
+    {
+      return;
+    }
+
+  switch (priv->state)
+    {
+    case SPISIM_STATE_WRITE:
+      if (ch == MMCSD_SPIDT_STARTBLKSNGL || ch == MMCSD_SPIDT_STARTBLKMULTI)
+        {
+          priv->pos   = 0;
+          priv->state = SPISIM_STATE_DATA;
+        }
+      else if (ch == MMCSD_SPIDT_STOPTRANS && priv->multi)
+        {
+          /* The card goes busy one byte after the stop token */
+
+          priv->out[0]  = 0xff;
+          priv->nout    = 1;
+          priv->outndx  = 0;
+          priv->busy    = 2;
+          priv->nerased = 0;
+          priv->state   = SPISIM_STATE_CMD;
+        }
+      break;
+
+    case SPISIM_STATE_DATA:
+      if (priv->pos < SPISIM_SECTORSIZE)
+        {
+          priv->blk[priv->pos] = ch;
+        }
+
+      /* Program the block after the two CRC bytes have been received */
+
+      if (++priv->pos < SPISIM_SECTORSIZE + 2)
+        {
+          break;
+        }
+
+      memcpy(&priv->media[priv->sector * SPISIM_SECTORSIZE], priv->blk,
+             SPISIM_SECTORSIZE);
+
+      busy = CONFIG_MMCSD_SPISIM_PROGBYTES;
+      if (priv->nerased > 0)
+        {
+          priv->nerased--;
+        }
+      else
+        {
+          busy += CONFIG_MMCSD_SPISIM_ERASEBYTES;
+        }
+
+      priv->out[0] = MMCSD_SPIDR_ACCEPTED;
+      priv->nout   = 1;
+      priv->outndx = 0;
+      priv->busy   = busy;
+
+      /* Wait for the next data token of a multi-block write */
+
+      if (priv->multi && ++priv->sector < priv->nsectors)
+        {
+          priv->state = SPISIM_STATE_WRITE;
+        }
+      else
+        {
+          priv->state = SPISIM_STATE_CMD;
+        }
+      break;
+
+    case SPISIM_STATE_CMD:
+    case SPISIM_STATE_READ:
+    default:
+
+      /* A command starts with the bits 01 */
+
+      if (priv->ncmd > 0 || (ch & 0xc0) == 0x40)
+        {
+          priv->cmd[priv->ncmd++] = ch;
+          if (priv->ncmd >= 6)
+            {
+              priv->ncmd = 0;
+              spisim_command(priv);
+            }
+        }
+      break;
+    }
+}
+
+/****************************************************************************
+ * Name: spisim_xfer
+ *
+ * Description:
+ *   Exchange one byte with the card
+ *
+ ****************************************************************************/
+
+static uint8_t spisim_xfer(FAR struct spisim_dev_s *priv, uint8_t ch)
+{
+  uint8_t ret;
+
+  if (!priv->selected)
+    {
+      return 0xff;
+    }
+
+  ret = spisim_output(priv);
+  spisim_input(priv, ch);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: spisim_lock
+ ****************************************************************************/
+
+#ifndef CONFIG_SPI_OWNBUS
+static int spisim_lock(FAR struct spi_dev_s *dev, bool lock)
+{
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: spisim_select
+ *
+ * Description:
+ *   De-selecting the card abandons any partially received command.  A busy
+ *   card stays busy.
+ *
+ ****************************************************************************/
+
+static void spisim_select(FAR struct spi_dev_s *dev, enum spi_dev_e devid,
+                          bool selected)
+{
+  FAR struct spisim_dev_s *priv = (FAR struct spisim_dev_s *)dev;
+
+  if (devid == SPIDEV_MMCSD)
+    {
+      priv->selected = selected;
+      if (!selected)
+        {
+          priv->ncmd = 0;
+          priv->nout = 0;
+          if (priv->state == SPISIM_STATE_READ)
+            {
+              priv->state = SPISIM_STATE_CMD;
+            }
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: spisim_setfrequency
+ ****************************************************************************/
+
+static uint32_t spisim_setfrequency(FAR struct spi_dev_s *dev,
+                                    uint32_t frequency)
+{
+  return frequency;
+}
+
+/****************************************************************************
+ * Name: spisim_setmode
+ ****************************************************************************/
+
+static void spisim_setmode(FAR struct spi_dev_s *dev, enum spi_mode_e mode)
+{
+}
+
+/****************************************************************************
+ * Name: spisim_setbits
+ ****************************************************************************/
+
+static void spisim_setbits(FAR struct spi_dev_s *dev, int nbits)
+{
+  DEBUGASSERT(nbits == 8);
+}
+
+/****************************************************************************
+ * Name: spisim_status
+ *
+ * Description:
+ *   The simulated card is always present and never write protected
+ *
+ ****************************************************************************/
+
+static uint8_t spisim_status(FAR struct spi_dev_s *dev, enum spi_dev_e devid)
+{
+  return devid == SPIDEV_MMCSD ? SPI_STATUS_PRESENT : 0;
+}
+
+/****************************************************************************
+ * Name: spisim_cmddata
+ ****************************************************************************/
+
+#ifdef CONFIG_SPI_CMDDATA
+static int spisim_cmddata(FAR struct spi_dev_s *dev, enum spi_dev_e devid,
+                          bool cmd)
+{
+  return -ENOSYS;
+}
+#endif
+
+/****************************************************************************
+ * Name: spisim_send
+ ****************************************************************************/
+
+static uint16_t spisim_send(FAR struct spi_dev_s *dev, uint16_t wd)
+{
+  return spisim_xfer((FAR struct spisim_dev_s *)dev, (uint8_t)wd);
+}
+
+/****************************************************************************
+ * Name: spisim_exchange
+ *
+ * Description:
+ *   Exchange a block of data.  0xff is sent if there is no txbuffer.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SPI_EXCHANGE
+static void spisim_exchange(FAR struct spi_dev_s *dev,
+                            FAR const void *txbuffer, FAR void *rxbuffer,
+                            size_t nwords)
+{
+  FAR struct spisim_dev_s *priv = (FAR struct spisim_dev_s *)dev;
+  FAR const uint8_t *src = (FAR const uint8_t *)txbuffer;
+  FAR uint8_t *dest = (FAR uint8_t *)rxbuffer;
+  uint8_t ch;
+
+  while (nwords-- > 0)
+    {
+      ch = spisim_xfer(priv, src ? *src++ : 0xff);
+      if (dest)
+        {
+          *dest++ = ch;
+        }
+    }
+}
+
+#else
+/****************************************************************************
+ * Name: spisim_sndblock
+ ****************************************************************************/
+
+static void spisim_sndblock(FAR struct spi_dev_s *dev,
+                            FAR const void *buffer, size_t nwords)
+{
+  FAR struct spisim_dev_s *priv = (FAR struct spisim_dev_s *)dev;
+  FAR const uint8_t *src = (FAR const uint8_t *)buffer;
+
+  while (nwords-- > 0)
+    {
+      (void)spisim_xfer(priv, *src++);
+    }
+}
+
+/****************************************************************************
+ * Name: spisim_recvblock
+ ****************************************************************************/
+
+static void spisim_recvblock(FAR struct spi_dev_s *dev, FAR void *buffer,
+                             size_t nwords)
+{
+  FAR struct spisim_dev_s *priv = (FAR struct spisim_dev_s *)dev;
+  FAR uint8_t *dest = (FAR uint8_t *)buffer;
+
+  while (nwords-- > 0)
+    {
+      *dest++ = spisim_xfer(priv, 0xff);
+    }
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mmcsd_spisiminitialize
+ *
+ * Description:
+ *   Create a simulated SD card that is accessed through the returned SPI
+ *   interface.  The card is an SDHC card that uses the provided buffer as
+ *   its media.  The returned interface can be passed to
+ *   mmcsd_spislotinitialize() in order to exercise the SPI MMC/SD driver
+ *   without hardware.
+ *
+ * Input Parameters:
+ *   buffer - The card media.  It must hold nsectors 512-byte sectors.
+ *   nsectors - The number of sectors.  This is rounded down to a multiple
+ *     of 1024 (512KiB), the capacity unit of an SDHC card.
+ *
+ * Returned Value:
+ *   The SPI interface of the card on success; NULL on failure.
+ *
+ ****************************************************************************/
+
+FAR struct spi_dev_s *mmcsd_spisiminitialize(FAR uint8_t *buffer,
+                                             uint32_t nsectors)
+{
+  FAR struct spisim_dev_s *priv;
+  uint32_t csize;
+
+  csize = nsectors / SPISIM_CSIZEUNIT;
+  if (!buffer || csize < 1)
+    {
+      fdbg("Invalid arguments\n");
+      return NULL;
+    }
+
+  priv = (FAR struct spisim_dev_s *)kzalloc(sizeof(struct spisim_dev_s));
+  if (!priv)
+    {
+      fdbg("Failed to allocate the card structure\n");
+      return NULL;
+    }
+
+  priv->spidev.ops = &g_spiops;
+  priv->media      = buffer;
+  priv->nsectors   = csize * SPISIM_CSIZEUNIT;
+  priv->idle       = true;
+  priv->initcount  = 2;
+
+  /* Version 2.0 CSD:  TAAC 1ms, TRAN_SPEED 25MHz, block length 512, and
+   * C_SIZE describing the capacity.
+   */
+
+  csize--;
+  priv->csd[0]  = 0x40;
+  priv->csd[1]  = 0x0e;
+  priv->csd[3]  = 0x32;
+  priv->csd[4]  = 0x5b;
+  priv->csd[5]  = 0x59;
+  priv->csd[7]  = (csize >> 16) & 0x3f;
+  priv->csd[8]  = (csize >> 8) & 0xff;
+  priv->csd[9]  = csize & 0xff;
+  priv->csd[10] = 0x7f;
+  priv->csd[11] = 0x80;
+  priv->csd[12] = 0x0a;
+  priv->csd[13] = 0x40;
+  priv->csd[15] = 0x01;
+
+  fvdbg("nsectors: %d\n", priv->nsectors);
+  return &priv->spidev;
+}
+
+#endif /* CONFIG_MMCSD_SPI && CONFIG_MMCSD_SPISIM */
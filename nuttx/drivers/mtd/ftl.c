@@ -1,7 +1,7 @@
 /****************************************************************************
  * drivers/mtd/ftl.c
  *
- *   Copyright (C) 2009, 2011-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2009, 2011-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -46,6 +46,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <semaphore.h>
+#include <assert.h>
+#include <crc32.h>
 #include <debug.h>
 #include <errno.h>
 
@@ -54,19 +57,93 @@
 #include <nuttx/fs/ioctl.h>
 #include <nuttx/mtd.h>
 #include <nuttx/rwbuffer.h>
+#include <nuttx/wqueue.h>
 
 /****************************************************************************
  * Private Definitions
  ****************************************************************************/
 
 #if defined(CONFIG_FS_READAHEAD) || (defined(CONFIG_FS_WRITABLE) && defined(CONFIG_FS_WRITEBUFFER))
-#  defined CONFIG_FTL_RWBUFFER 1
+#  define CONFIG_FTL_RWBUFFER 1
+#endif
+
+/* Log-structured (mapped) mode.  Logical sectors are appended to pre-erased
+ * erase blocks and located through a logical-to-physical map held in RAM.
+ * The last R/W block of each erase block holds a summary of the logical
+ * sectors in that erase block; it is written when the erase block is
+ * closed and the map is rebuilt from these summaries when the FTL is
+ * initialized.
+ */
+
+#ifdef CONFIG_FTL_MAPPED
+#  ifndef CONFIG_FTL_MAPPED_RESERVE
+#    define CONFIG_FTL_MAPPED_RESERVE 8
+#  endif
+#  if CONFIG_FTL_MAPPED_RESERVE < 3
+#    error "CONFIG_FTL_MAPPED_RESERVE must be at least 3"
+#  endif
+#  ifndef CONFIG_FTL_MAPPED_GCTHRESHOLD
+#    define CONFIG_FTL_MAPPED_GCTHRESHOLD 4
+#  endif
+#  if defined(CONFIG_FS_WRITABLE) && defined(CONFIG_SCHED_WORKQUEUE)
+#    define FTL_BGGC 1
+#  endif
+
+/* Foreground garbage collection starts when fewer than this many erase
+ * blocks are free (or will be free once the open block is closed).
+ */
+
+#  define FTL_GCLOW        2
+
+#  define FTL_UNMAPPED     0xffff
+#  define FTL_MAGIC        "FTLm"
+#  define FTL_MAGICLEN     4
+
+/* Erase block states */
+
+#  define FTL_ERASED       0 /* Erased and ready to be opened */
+#  define FTL_DIRTY        1 /* No live data, must be erased before use */
+#  define FTL_OPEN         2 /* Being filled */
+#  define FTL_FULL         3 /* Closed and holds live data */
+#  define FTL_STALE        4 /* Closed and holds no live data, but may not be
+                              * erased until the open block is closed */
 #endif
 
 /****************************************************************************
  * Private Types
  ****************************************************************************/
 
+#ifdef CONFIG_FTL_MAPPED
+/* This is the summary written to the last R/W block of each erase block
+ * when the erase block is closed.  It records the logical sector held in
+ * each of the other R/W blocks.
+ */
+
+struct ftl_summary_s
+{
+  uint8_t  magic[FTL_MAGICLEN]; /* FTL_MAGIC */
+  uint32_t crc;                 /* CRC32 from seqno through lsector[] */
+  uint32_t seqno;               /* Order in which the erase blocks were closed */
+  uint16_t lsector[1];          /* Actual size is blkper - 1 */
+};
+
+#define SIZEOF_FTL_SUMMARY_S(n) \
+  (sizeof(struct ftl_summary_s) + ((n) - 1) * sizeof(uint16_t))
+
+/* The CRC covers everything that follows the crc field */
+
+#define FTL_CRCLEN(n) \
+  (SIZEOF_FTL_SUMMARY_S(n) - FTL_MAGICLEN - sizeof(uint32_t))
+
+/* Used to sort the closed erase blocks when the map is rebuilt */
+
+struct ftl_scan_s
+{
+  uint32_t seqno;
+  uint16_t block;
+};
+#endif
+
 struct ftl_struct_s
 {
   FAR struct mtd_dev_s *mtd;     /* Contained MTD interface */
@@ -78,6 +155,24 @@ struct ftl_struct_s
 #ifdef CONFIG_FS_WRITABLE
   FAR uint8_t          *eblock;  /* One, in-memory erase block */
 #endif
+#ifdef CONFIG_FTL_MAPPED
+  sem_t                 exclsem; /* Protects the mapping state */
+  uint16_t              nlsectors; /* Number of logical sectors exported */
+  FAR uint16_t         *map;     /* Logical-to-physical sector map */
+  FAR uint16_t         *nvalid;  /* Number of live sectors in each erase block */
+  FAR uint8_t          *state;   /* State of each erase block */
+  FAR struct ftl_summary_s *summary; /* Summary of the open erase block */
+  uint32_t              seqno;   /* Sequence number of the next closed block */
+  uint16_t              openblk; /* Erase block being filled (or FTL_UNMAPPED) */
+  uint16_t              wrpage;  /* Next free R/W block in openblk */
+  uint16_t              nerased; /* Number of FTL_ERASED erase blocks */
+  uint16_t              ndirty;  /* Number of FTL_DIRTY erase blocks */
+  uint16_t              nstale;  /* Number of FTL_STALE erase blocks */
+  uint16_t              nextfree; /* Where to start looking for a free block */
+#ifdef FTL_BGGC
+  struct work_s         work;    /* Background garbage collection */
+#endif
+#endif
 };
 
 /****************************************************************************
@@ -95,6 +190,7 @@ static ssize_t ftl_flush(FAR void *priv, FAR const uint8_t *buffer,
                  off_t startblock, size_t nblocks);
 static ssize_t ftl_write(FAR struct inode *inode, const unsigned char *buffer,
                  size_t start_sector, unsigned int nsectors);
+static int     ftl_sync(FAR struct ftl_struct_s *dev);
 #endif
 static int     ftl_geometry(FAR struct inode *inode, struct geometry *geometry);
 static int     ftl_ioctl(FAR struct inode *inode, int cmd, unsigned long arg);
@@ -144,8 +240,677 @@ static int ftl_open(FAR struct inode *inode)
 static int ftl_close(FAR struct inode *inode)
 {
   fvdbg("Entry\n");
+
+#if defined(CONFIG_FTL_MAPPED) && defined(CONFIG_FS_WRITABLE)
+  /* Make sure that the data written so far survives a power loss */
+
+  DEBUGASSERT(inode && inode->i_private);
+  return ftl_sync((FAR struct ftl_struct_s *)inode->i_private);
+#else
+  return OK;
+#endif
+}
+
+/****************************************************************************
+ * Name: ftl_semtake
+ *
+ * Description: Get exclusive access to the mapping state
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FTL_MAPPED
+static void ftl_semtake(FAR struct ftl_struct_s *dev)
+{
+  /* Take the semaphore (perhaps waiting) */
+
+  while (sem_wait(&dev->exclsem) != 0)
+    {
+      /* The only case that an error should occur here is if the wait was
+       * awakened by a signal.
+       */
+
+      ASSERT(errno == EINTR);
+    }
+}
+
+#define ftl_semgive(d) sem_post(&(d)->exclsem)
+
+/****************************************************************************
+ * Name: ftl_readsummary
+ *
+ * Description:
+ *   Read the summary of an erase block.  Returns -ENOENT if the erase block
+ *   has no valid summary (because it is erased, was never closed, or the
+ *   summary write was interrupted).
+ *
+ ****************************************************************************/
+
+static int ftl_readsummary(FAR struct ftl_struct_s *dev, uint16_t block,
+                           FAR struct ftl_summary_s *summary)
+{
+  size_t  len;
+  ssize_t nxfrd;
+
+  nxfrd = MTD_BREAD(dev->mtd, (off_t)block * dev->blkper + dev->blkper - 1,
+                    1, (FAR uint8_t *)summary);
+  if (nxfrd != 1)
+    {
+      fdbg("Read summary of erase block %d failed: %d\n", block, nxfrd);
+      return -EIO;
+    }
+
+  len = FTL_CRCLEN(dev->blkper - 1);
+
+  if (memcmp(summary->magic, FTL_MAGIC, FTL_MAGICLEN) != 0 ||
+      summary->crc != crc32((FAR const uint8_t *)&summary->seqno, len))
+    {
+      return -ENOENT;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: ftl_iserased
+ *
+ * Description: Check if the first R/W block of an erase block is erased
+ *
+ ****************************************************************************/
+
+static bool ftl_iserased(FAR struct ftl_struct_s *dev, uint16_t block)
+{
+  FAR uint8_t *buffer = (FAR uint8_t *)dev->summary;
+  ssize_t nxfrd;
+  int i;
+
+  nxfrd = MTD_BREAD(dev->mtd, (off_t)block * dev->blkper, 1, buffer);
+  if (nxfrd != 1)
+    {
+      return false;
+    }
+
+  for (i = 0; i < dev->geo.blocksize; i++)
+    {
+      if (buffer[i] != 0xff)
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+
+/****************************************************************************
+ * Name: ftl_invalidate
+ *
+ * Description:
+ *   The logical sector held in the R/W block 'physical' has been
+ *   superseded.
+ *
+ ****************************************************************************/
+
+static void ftl_invalidate(FAR struct ftl_struct_s *dev, uint16_t physical)
+{
+  uint16_t block = physical / dev->blkper;
+
+  DEBUGASSERT(dev->nvalid[block] > 0);
+  if (--dev->nvalid[block] == 0 && dev->state[block] == FTL_FULL)
+    {
+      dev->state[block] = FTL_STALE;
+      dev->nstale++;
+    }
+}
+
+/****************************************************************************
+ * Name: ftl_seqcompare
+ *
+ * Description: qsort() comparison of two closed erase blocks
+ *
+ ****************************************************************************/
+
+static int ftl_seqcompare(FAR const void *a, FAR const void *b)
+{
+  uint32_t seqa = ((FAR const struct ftl_scan_s *)a)->seqno;
+  uint32_t seqb = ((FAR const struct ftl_scan_s *)b)->seqno;
+
+  return seqa < seqb ? -1 : (seqa > seqb ? 1 : 0);
+}
+
+/****************************************************************************
+ * Name: ftl_mapscan
+ *
+ * Description:
+ *   Rebuild the logical-to-physical map from the summaries of the closed
+ *   erase blocks.  The summaries are replayed in the order in which the
+ *   erase blocks were closed so that the most recent copy of each logical
+ *   sector wins.
+ *
+ ****************************************************************************/
+
+static int ftl_mapscan(FAR struct ftl_struct_s *dev)
+{
+  FAR struct ftl_summary_s *summary = dev->summary;
+  FAR struct ftl_scan_s *scan;
+  uint16_t nfull = 0;
+  uint16_t block;
+  uint16_t lsector;
+  uint16_t physical;
+  uint16_t i;
+  uint16_t j;
+  int ret;
+
+  scan = (FAR struct ftl_scan_s *)
+    kmalloc(dev->geo.neraseblocks * sizeof(struct ftl_scan_s));
+  if (!scan)
+    {
+      return -ENOMEM;
+    }
+
+  memset(dev->map, 0xff, dev->nlsectors * sizeof(uint16_t));
+  memset(dev->nvalid, 0, dev->geo.neraseblocks * sizeof(uint16_t));
+  dev->seqno    = 0;
+  dev->nerased  = 0;
+  dev->ndirty   = 0;
+  dev->nstale   = 0;
+  dev->openblk  = FTL_UNMAPPED;
+  dev->wrpage   = 0;
+  dev->nextfree = 0;
+
+  /* Classify the erase blocks.  Anything that is neither closed nor
+   * obviously erased (such as the block that was open when power was lost)
+   * will be erased before it is used again.
+   */
+
+  for (block = 0; block < dev->geo.neraseblocks; block++)
+    {
+      ret = ftl_readsummary(dev, block, summary);
+      if (ret == OK)
+        {
+          scan[nfull].seqno = summary->seqno;
+          scan[nfull].block = block;
+          nfull++;
+
+          if (summary->seqno >= dev->seqno)
+            {
+              dev->seqno = summary->seqno + 1;
+            }
+
+          dev->state[block] = FTL_FULL;
+        }
+      else if (ret == -ENOENT && ftl_iserased(dev, block))
+        {
+          dev->state[block] = FTL_ERASED;
+          dev->nerased++;
+        }
+      else
+        {
+          dev->state[block] = FTL_DIRTY;
+          dev->ndirty++;
+        }
+    }
+
+  /* Replay the summaries, oldest first */
+
+  qsort(scan, nfull, sizeof(struct ftl_scan_s), ftl_seqcompare);
+  for (i = 0; i < nfull; i++)
+    {
+      block = scan[i].block;
+      ret   = ftl_readsummary(dev, block, summary);
+      if (ret < 0)
+        {
+          fdbg("Summary of erase block %d vanished: %d\n", block, ret);
+          kfree(scan);
+          return -EIO;
+        }
+
+      for (j = 0; j < dev->blkper - 1; j++)
+        {
+          lsector = summary->lsector[j];
+          if (lsector < dev->nlsectors)
+            {
+              physical = block * dev->blkper + j;
+              if (dev->map[lsector] != FTL_UNMAPPED)
+                {
+                  ftl_invalidate(dev, dev->map[lsector]);
+                }
+
+              dev->map[lsector] = physical;
+              dev->nvalid[block]++;
+            }
+        }
+    }
+
+  /* Everything that superseded the data in the stale blocks is on FLASH,
+   * so they can be reused.
+   */
+
+  for (block = 0; block < dev->geo.neraseblocks; block++)
+    {
+      if (dev->state[block] == FTL_STALE ||
+          (dev->state[block] == FTL_FULL && dev->nvalid[block] == 0))
+        {
+          dev->state[block] = FTL_DIRTY;
+          dev->ndirty++;
+        }
+    }
+
+  dev->nstale = 0;
+  kfree(scan);
+
+  fvdbg("%d closed, %d erased, %d dirty erase blocks, seqno %d\n",
+        nfull, dev->nerased, dev->ndirty, dev->seqno);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: ftl_eraseblock
+ *
+ * Description: Erase one dirty erase block
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_WRITABLE
+static int ftl_eraseblock(FAR struct ftl_struct_s *dev)
+{
+  uint16_t block;
+  uint16_t i;
+  int ret;
+
+  for (i = 0; i < dev->geo.neraseblocks; i++)
+    {
+      block = (dev->nextfree + i) % dev->geo.neraseblocks;
+      if (dev->state[block] == FTL_DIRTY)
+        {
+          ret = MTD_ERASE(dev->mtd, block, 1);
+          if (ret < 0)
+            {
+              fdbg("Erase block=%d failed: %d\n", block, ret);
+              return ret;
+            }
+
+          dev->state[block] = FTL_ERASED;
+          dev->ndirty--;
+          dev->nerased++;
+          return OK;
+        }
+    }
+
+  return -ENOENT;
+}
+
+/****************************************************************************
+ * Name: ftl_openblock
+ *
+ * Description:
+ *   Select the next erase block to be filled.  Pre-erased blocks are used
+ *   first; a dirty block is erased only when there are none.
+ *
+ ****************************************************************************/
+
+static int ftl_openblock(FAR struct ftl_struct_s *dev)
+{
+  uint16_t block;
+  uint16_t i;
+  int ret;
+
+  if (dev->nerased == 0)
+    {
+      ret = ftl_eraseblock(dev);
+      if (ret < 0)
+        {
+          fdbg("No free erase block: %d\n", ret);
+          return ret == -ENOENT ? -ENOSPC : ret;
+        }
+    }
+
+  for (i = 0; i < dev->geo.neraseblocks; i++)
+    {
+      block = (dev->nextfree + i) % dev->geo.neraseblocks;
+      if (dev->state[block] == FTL_ERASED)
+        {
+          dev->state[block] = FTL_OPEN;
+          dev->nerased--;
+          dev->openblk  = block;
+          dev->wrpage   = 0;
+          dev->nextfree = (block + 1) % dev->geo.neraseblocks;
+
+          memset(dev->summary, 0xff, dev->geo.blocksize);
+          return OK;
+        }
+    }
+
+  return -ENOSPC;
+}
+
+/****************************************************************************
+ * Name: ftl_closeblock
+ *
+ * Description:
+ *   Write the summary of the open erase block.  This checkpoints the map
+ *   entries for every sector in the block, after which the stale blocks
+ *   that those sectors superseded may be erased.
+ *
+ ****************************************************************************/
+
+static int ftl_closeblock(FAR struct ftl_struct_s *dev)
+{
+  FAR struct ftl_summary_s *summary = dev->summary;
+  uint16_t block = dev->openblk;
+  size_t   len;
+  ssize_t  nxfrd;
+
+  memcpy(summary->magic, FTL_MAGIC, FTL_MAGICLEN);
+  summary->seqno = dev->seqno++;
+
+  len = FTL_CRCLEN(dev->blkper - 1);
+  summary->crc = crc32((FAR const uint8_t *)&summary->seqno, len);
+
+  nxfrd = MTD_BWRITE(dev->mtd, (off_t)block * dev->blkper + dev->blkper - 1,
+                     1, (FAR const uint8_t *)summary);
+  if (nxfrd != 1)
+    {
+      fdbg("Write summary of erase block %d failed: %d\n", block, nxfrd);
+      return -EIO;
+    }
+
+  if (dev->nvalid[block] > 0)
+    {
+      dev->state[block] = FTL_FULL;
+    }
+  else
+    {
+      dev->state[block] = FTL_DIRTY;
+      dev->ndirty++;
+    }
+
+  dev->openblk = FTL_UNMAPPED;
+
+  /* Stale blocks may now be reused */
+
+  for (block = 0; dev->nstale > 0 && block < dev->geo.neraseblocks; block++)
+    {
+      if (dev->state[block] == FTL_STALE)
+        {
+          dev->state[block] = FTL_DIRTY;
+          dev->nstale--;
+          dev->ndirty++;
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: ftl_append
+ *
+ * Description:
+ *   Append up to nblocks consecutive logical sectors to the open erase
+ *   block, opening a new one if necessary.  Returns the number of sectors
+ *   written.
+ *
+ ****************************************************************************/
+
+static ssize_t ftl_append(FAR struct ftl_struct_s *dev,
+                          FAR const uint8_t *buffer, uint16_t lsector,
+                          size_t nblocks)
+{
+  uint16_t physical;
+  size_t   nwrite;
+  size_t   i;
+  ssize_t  nxfrd;
+  int      ret;
+
+  if (dev->openblk == FTL_UNMAPPED)
+    {
+      ret = ftl_openblock(dev);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  nwrite = dev->blkper - 1 - dev->wrpage;
+  if (nwrite > nblocks)
+    {
+      nwrite = nblocks;
+    }
+
+  physical = dev->openblk * dev->blkper + dev->wrpage;
+  nxfrd    = MTD_BWRITE(dev->mtd, physical, nwrite, buffer);
+  if (nxfrd != nwrite)
+    {
+      /* Never program these R/W blocks again; they are left unmapped */
+
+      fdbg("Write %d blocks at %d failed: %d\n", nwrite, physical, nxfrd);
+      dev->wrpage += nwrite;
+      return -EIO;
+    }
+
+  for (i = 0; i < nwrite; i++, lsector++, physical++)
+    {
+      if (dev->map[lsector] != FTL_UNMAPPED)
+        {
+          ftl_invalidate(dev, dev->map[lsector]);
+        }
+
+      dev->map[lsector] = physical;
+      dev->summary->lsector[dev->wrpage++] = lsector;
+      dev->nvalid[dev->openblk]++;
+    }
+
+  if (dev->wrpage >= dev->blkper - 1)
+    {
+      ret = ftl_closeblock(dev);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  return nwrite;
+}
+
+/****************************************************************************
+ * Name: ftl_relocate
+ *
+ * Description:
+ *   Move the live sectors out of the closed erase block with the fewest
+ *   live sectors.  The block becomes stale and is reclaimed when the open
+ *   block is next closed.
+ *
+ ****************************************************************************/
+
+static int ftl_relocate(FAR struct ftl_struct_s *dev)
+{
+  FAR struct ftl_summary_s *summary = (FAR struct ftl_summary_s *)dev->eblock;
+  FAR uint8_t *page = dev->eblock + dev->geo.blocksize;
+  uint16_t victim = FTL_UNMAPPED;
+  uint16_t block;
+  uint16_t lsector;
+  uint16_t physical;
+  uint16_t i;
+  ssize_t  nxfrd;
+  int      ret;
+
+  for (block = 0; block < dev->geo.neraseblocks; block++)
+    {
+      if (dev->state[block] == FTL_FULL &&
+          (victim == FTL_UNMAPPED || dev->nvalid[block] < dev->nvalid[victim]))
+        {
+          victim = block;
+        }
+    }
+
+  if (victim == FTL_UNMAPPED || dev->nvalid[victim] >= dev->blkper - 1)
+    {
+      fdbg("Nothing to reclaim\n");
+      return -ENOSPC;
+    }
+
+  ret = ftl_readsummary(dev, victim, summary);
+  if (ret < 0)
+    {
+      return -EIO;
+    }
+
+  for (i = 0; i < dev->blkper - 1 && dev->nvalid[victim] > 0; i++)
+    {
+      lsector  = summary->lsector[i];
+      physical = victim * dev->blkper + i;
+      if (lsector >= dev->nlsectors || dev->map[lsector] != physical)
+        {
+          continue;
+        }
+
+      nxfrd = MTD_BREAD(dev->mtd, physical, 1, page);
+      if (nxfrd != 1)
+        {
+          fdbg("Read block %d failed: %d\n", physical, nxfrd);
+          return -EIO;
+        }
+
+      nxfrd = ftl_append(dev, page, lsector, 1);
+      if (nxfrd < 0)
+        {
+          return (int)nxfrd;
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: ftl_reclaim
+ *
+ * Description:
+ *   Foreground garbage collection:  Make sure that there is always an
+ *   erase block to open before any more data is written.
+ *
+ ****************************************************************************/
+
+static int ftl_reclaim(FAR struct ftl_struct_s *dev)
+{
+  int ret;
+
+  while (dev->nerased + dev->ndirty + dev->nstale < FTL_GCLOW)
+    {
+      ret = ftl_relocate(dev);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: ftl_bgworker
+ *
+ * Description:
+ *   Background garbage collection:  Reclaim erase blocks until
+ *   CONFIG_FTL_MAPPED_GCTHRESHOLD are free and pre-erase all dirty ones so
+ *   that writers normally find an erased block waiting.
+ *
+ ****************************************************************************/
+
+#ifdef FTL_BGGC
+static void ftl_bgworker(FAR void *arg)
+{
+  FAR struct ftl_struct_s *dev = (FAR struct ftl_struct_s *)arg;
+
+  ftl_semtake(dev);
+  while (dev->nerased + dev->ndirty + dev->nstale <
+         CONFIG_FTL_MAPPED_GCTHRESHOLD && ftl_relocate(dev) == OK);
+
+  while (dev->ndirty > 0 && ftl_eraseblock(dev) == OK);
+  ftl_semgive(dev);
+}
+#endif
+
+/****************************************************************************
+ * Name: ftl_mapsync
+ *
+ * Description:
+ *   Close the open erase block so that everything written so far survives
+ *   a power loss.
+ *
+ ****************************************************************************/
+
+static int ftl_mapsync(FAR struct ftl_struct_s *dev)
+{
+  int ret = OK;
+
+  ftl_semtake(dev);
+  if (dev->openblk != FTL_UNMAPPED)
+    {
+      ret = ftl_closeblock(dev);
+    }
+
+  ftl_semgive(dev);
+  return ret;
+}
+#endif /* CONFIG_FS_WRITABLE */
+
+/****************************************************************************
+ * Name: ftl_mapinitialize
+ *
+ * Description: Allocate the mapping state and rebuild it from FLASH
+ *
+ ****************************************************************************/
+
+static int ftl_mapinitialize(FAR struct ftl_struct_s *dev)
+{
+  uint32_t nphysical = (uint32_t)dev->geo.neraseblocks * dev->blkper;
+  int ret;
+
+  if (dev->blkper < 2 || nphysical >= FTL_UNMAPPED ||
+      dev->geo.neraseblocks <= CONFIG_FTL_MAPPED_RESERVE ||
+      SIZEOF_FTL_SUMMARY_S(dev->blkper - 1) > dev->geo.blocksize)
+    {
+      fdbg("Geometry not supported by the mapped FTL\n");
+      return -EINVAL;
+    }
+
+  dev->nlsectors = (dev->geo.neraseblocks - CONFIG_FTL_MAPPED_RESERVE) *
+                   (dev->blkper - 1);
+
+  dev->map     = (FAR uint16_t *)kmalloc(dev->nlsectors * sizeof(uint16_t));
+  dev->nvalid  = (FAR uint16_t *)kmalloc(dev->geo.neraseblocks * sizeof(uint16_t));
+  dev->state   = (FAR uint8_t *)kmalloc(dev->geo.neraseblocks);
+  dev->summary = (FAR struct ftl_summary_s *)kmalloc(dev->geo.blocksize);
+
+  if (!dev->map || !dev->nvalid || !dev->state || !dev->summary)
+    {
+      fdbg("Failed to allocate the sector map\n");
+      ret = -ENOMEM;
+      goto errout;
+    }
+
+  sem_init(&dev->exclsem, 0, 1);
+#ifdef FTL_BGGC
+  memset(&dev->work, 0, sizeof(struct work_s));
+#endif
+
+  ret = ftl_mapscan(dev);
+  if (ret < 0)
+    {
+      sem_destroy(&dev->exclsem);
+      goto errout;
+    }
+
   return OK;
+
+errout:
+  /* kfree() accepts NULL */
+
+  kfree(dev->map);
+  kfree(dev->nvalid);
+  kfree(dev->state);
+  kfree(dev->summary);
+  return ret;
 }
+#endif /* CONFIG_FTL_MAPPED */
 
 /****************************************************************************
  * Name: ftl_reload
@@ -154,6 +919,63 @@ static int ftl_close(FAR struct inode *inode)
  *
  ****************************************************************************/
 
+#ifdef CONFIG_FTL_MAPPED
+static ssize_t ftl_reload(FAR void *priv, FAR uint8_t *buffer,
+                          off_t startblock, size_t nblocks)
+{
+  struct ftl_struct_s *dev = (struct ftl_struct_s *)priv;
+  uint16_t physical;
+  size_t   remaining;
+  size_t   nrun;
+  ssize_t  nxfrd;
+
+  if (startblock < 0 || startblock + nblocks > dev->nlsectors)
+    {
+      return -EINVAL;
+    }
+
+  ftl_semtake(dev);
+  for (remaining = nblocks; remaining > 0; remaining -= nrun)
+    {
+      /* Gather a run of sectors that are also consecutive on FLASH (or that
+       * have never been written).
+       */
+
+      physical = dev->map[startblock];
+      for (nrun = 1; nrun < remaining; nrun++)
+        {
+          if (physical == FTL_UNMAPPED ?
+              dev->map[startblock + nrun] != FTL_UNMAPPED :
+              dev->map[startblock + nrun] != physical + nrun)
+            {
+              break;
+            }
+        }
+
+      if (physical == FTL_UNMAPPED)
+        {
+          memset(buffer, 0xff, nrun * dev->geo.blocksize);
+        }
+      else
+        {
+          nxfrd = MTD_BREAD(dev->mtd, physical, nrun, buffer);
+          if (nxfrd != nrun)
+            {
+              fdbg("Read %d blocks starting at block %d failed: %d\n",
+                    nrun, physical, nxfrd);
+              ftl_semgive(dev);
+              return -EIO;
+            }
+        }
+
+      startblock += nrun;
+      buffer     += nrun * dev->geo.blocksize;
+    }
+
+  ftl_semgive(dev);
+  return nblocks;
+}
+#else
 static ssize_t ftl_reload(FAR void *priv, FAR uint8_t *buffer,
                           off_t startblock, size_t nblocks)
 {
@@ -170,6 +992,7 @@ static ssize_t ftl_reload(FAR void *priv, FAR uint8_t *buffer,
     }
   return nread;
 }
+#endif
 
 /****************************************************************************
  * Name: ftl_read
@@ -201,7 +1024,62 @@ static ssize_t ftl_read(FAR struct inode *inode, unsigned char *buffer,
  *
  ****************************************************************************/
 
-#ifdef CONFIG_FS_WRITABLE
+#if defined(CONFIG_FS_WRITABLE) && defined(CONFIG_FTL_MAPPED)
+static ssize_t ftl_flush(FAR void *priv, FAR const uint8_t *buffer,
+                         off_t startblock, size_t nblocks)
+{
+  struct ftl_struct_s *dev = (struct ftl_struct_s *)priv;
+  size_t  remaining;
+  ssize_t nxfrd;
+  int     ret;
+
+  if (startblock < 0 || startblock + nblocks > dev->nlsectors)
+    {
+      return -EINVAL;
+    }
+
+  /* Append the sectors to the open erase block.  Nothing is erased here
+   * unless garbage collection has fallen behind.
+   */
+
+  ftl_semtake(dev);
+  for (remaining = nblocks; remaining > 0; remaining -= nxfrd)
+    {
+      ret = ftl_reclaim(dev);
+      if (ret < 0)
+        {
+          goto errout;
+        }
+
+      nxfrd = ftl_append(dev, buffer, (uint16_t)startblock, remaining);
+      if (nxfrd < 0)
+        {
+          ret = (int)nxfrd;
+          goto errout;
+        }
+
+      startblock += nxfrd;
+      buffer     += nxfrd * dev->geo.blocksize;
+    }
+
+#ifdef FTL_BGGC
+  /* Let the worker thread get ahead of the next writes */
+
+  if ((dev->ndirty > 0 || dev->nerased + dev->nstale <
+       CONFIG_FTL_MAPPED_GCTHRESHOLD) && work_available(&dev->work))
+    {
+      (void)work_queue(LPWORK, &dev->work, ftl_bgworker, (FAR void *)dev, 0);
+    }
+#endif
+
+  ftl_semgive(dev);
+  return nblocks;
+
+errout:
+  ftl_semgive(dev);
+  return ret;
+}
+#elif defined(CONFIG_FS_WRITABLE)
 static ssize_t ftl_flush(FAR void *priv, FAR const uint8_t *buffer,
                          off_t startblock, size_t nblocks)
 {
@@ -396,6 +1274,33 @@ static ssize_t ftl_write(FAR struct inode *inode, const unsigned char *buffer,
 }
 #endif
 
+/****************************************************************************
+ * Name: ftl_sync
+ *
+ * Description: Write any buffered data to FLASH
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_WRITABLE
+static int ftl_sync(FAR struct ftl_struct_s *dev)
+{
+  int ret = OK;
+
+#ifdef CONFIG_FS_WRITEBUFFER
+  ret = rwb_flush(&dev->rwb);
+  if (ret < 0)
+    {
+      return ret;
+    }
+#endif
+
+#ifdef CONFIG_FTL_MAPPED
+  ret = ftl_mapsync(dev);
+#endif
+  return ret;
+}
+#endif
+
 /****************************************************************************
  * Name: ftl_geometry
  *
@@ -420,7 +1325,11 @@ static int ftl_geometry(FAR struct inode *inode, struct geometry *geometry)
 #else
       geometry->geo_writeenabled  = false;
 #endif
+#ifdef CONFIG_FTL_MAPPED
+      geometry->geo_nsectors      = dev->nlsectors;
+#else
       geometry->geo_nsectors      = dev->geo.neraseblocks * dev->blkper;
+#endif
       geometry->geo_sectorsize    = dev->geo.blocksize;
 
       fvdbg("available: true mediachanged: false writeenabled: %s\n",
@@ -447,14 +1356,30 @@ static int ftl_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 
   fvdbg("Entry\n");
   DEBUGASSERT(inode && inode->i_private);
+  dev = (struct ftl_struct_s *)inode->i_private;
+
+#ifdef CONFIG_FS_WRITABLE
+  /* Write any buffered data to FLASH */
 
-  /* Only one block driver ioctl command is supported by this driver (and
-   * that command is just passed on to the MTD driver in a slightly
+  if (cmd == BIOC_FLUSH)
+    {
+      return ftl_sync(dev);
+    }
+#endif
+
+  /* Only one other block driver ioctl command is supported by this driver
+   * (and that command is just passed on to the MTD driver in a slightly
    * different form).
    */
 
   if (cmd == BIOC_XIPBASE)
     {
+#ifdef CONFIG_FTL_MAPPED
+      /* Logical sectors are not stored in order on FLASH */
+
+      return -ENOTTY;
+#endif
+
       /* The argument accompanying the BIOC_XIPBASE should be non-NULL.  If
        * DEBUG is enabled, we will catch it here instead of in the MTD
        * driver.
@@ -478,7 +1403,6 @@ static int ftl_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
    * to the MTD driver (unchanged).
    */
 
-  dev = (struct ftl_struct_s *)inode->i_private;
   ret = MTD_IOCTL(dev->mtd, cmd, arg);
   if (ret < 0)
     {
@@ -559,11 +1483,29 @@ int ftl_initialize(int minor, FAR struct mtd_dev_s *mtd)
       dev->blkper = dev->geo.erasesize / dev->geo.blocksize;
       DEBUGASSERT(dev->blkper * dev->geo.blocksize == dev->geo.erasesize);
 
+#ifdef CONFIG_FTL_MAPPED
+      /* Rebuild the logical-to-physical sector map from FLASH */
+
+      ret = ftl_mapinitialize(dev);
+      if (ret < 0)
+        {
+#ifdef CONFIG_FS_WRITABLE
+          kfree(dev->eblock);
+#endif
+          kfree(dev);
+          return ret;
+        }
+#endif
+
       /* Configure read-ahead/write buffering */
 
 #ifdef CONFIG_FTL_RWBUFFER
       dev->rwb.blocksize   = dev->geo.blocksize;
+#ifdef CONFIG_FTL_MAPPED
+      dev->rwb.nblocks     = dev->nlsectors;
+#else
       dev->rwb.nblocks     = dev->geo.neraseblocks * dev->blkper;
+#endif
       dev->rwb.dev         = (FAR void *)dev;
 
 #if defined(CONFIG_FS_WRITABLE) && defined(CONFIG_FS_WRITEBUFFER)
@@ -0,0 +1,130 @@
+/****************************************************************************
+ * drivers/mtd/mtd_async.c
+ * Asynchronous MTD request support
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/mtd.h>
+
+#ifdef CONFIG_MTD_ASYNC
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mtd_submit
+ *
+ * Description:
+ *   Submit a list of asynchronous requests to an MTD device.  If the MTD
+ *   driver does not support asynchronous requests, each request is
+ *   performed synchronously and its callback is called before mtd_submit()
+ *   returns.
+ *
+ * Input Parameters:
+ *   dev - The MTD device.
+ *   req - The first request in a list of requests linked through flink.
+ *
+ * Returned Value:
+ *   OK if the requests were accepted; a negated errno value otherwise.  The
+ *   result of each request is returned in its result field.
+ *
+ ****************************************************************************/
+
+int mtd_submit(FAR struct mtd_dev_s *dev, FAR struct mtd_req_s *req)
+{
+  FAR struct mtd_req_s *next;
+
+  DEBUGASSERT(dev && req);
+
+  /* Let the driver queue the requests if it can */
+
+  if (dev->submit)
+    {
+      return dev->submit(dev, req);
+    }
+
+  /* Otherwise, perform each request now.  Get the next request before
+   * calling the callback because the callback may re-use the request.
+   */
+
+  for (; req; req = next)
+    {
+      next = req->flink;
+
+      switch (req->op)
+        {
+          case MTDREQ_ERASE:
+            req->result = MTD_ERASE(dev, req->start, req->count);
+            break;
+
+          case MTDREQ_BREAD:
+            req->result = MTD_BREAD(dev, req->start, req->count,
+                                    req->buffer);
+            break;
+
+          case MTDREQ_BWRITE:
+            req->result = MTD_BWRITE(dev, req->start, req->count,
+                                     req->buffer);
+            break;
+
+          case MTDREQ_READ:
+            req->result = MTD_READ(dev, req->start, req->count, req->buffer);
+            break;
+
+          default:
+            req->result = -EINVAL;
+            break;
+        }
+
+      if (req->callback)
+        {
+          req->callback(req);
+        }
+    }
+
+  return OK;
+}
+
+#endif /* CONFIG_MTD_ASYNC */
@@ -41,12 +41,18 @@
 
 #include <sys/types.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <string.h>
+#include <unistd.h>
 #include <assert.h>
 #include <errno.h>
 #include <debug.h>
 
+#include <arch/irq.h>
+
 #include <nuttx/kmalloc.h>
+#include <nuttx/clock.h>
+#include <nuttx/wqueue.h>
 #include <nuttx/fs/ioctl.h>
 #include <nuttx/mtd.h>
 
@@ -82,6 +88,31 @@
 #  error "CONFIG_RAMMTD_ERASESIZE must be an even multiple of CONFIG_RAMMTD_BLOCKSIZE"
 #endif
 
+/* Program and erase times are simulated only with CONFIG_RAMMTD_FLASHSIM */
+
+#ifndef CONFIG_RAMMTD_FLASHSIM
+#  undef CONFIG_RAMMTD_PROGTIME
+#  undef CONFIG_RAMMTD_ERASETIME
+#endif
+
+#ifndef CONFIG_RAMMTD_PROGTIME
+#  define CONFIG_RAMMTD_PROGTIME 0
+#endif
+
+#ifndef CONFIG_RAMMTD_ERASETIME
+#  define CONFIG_RAMMTD_ERASETIME 0
+#endif
+
+#if CONFIG_RAMMTD_PROGTIME > 0 || CONFIG_RAMMTD_ERASETIME > 0
+#  define RAMMTD_TIMING 1
+#endif
+
+/* Asynchronous requests are performed on the low priority work queue */
+
+#if defined(CONFIG_MTD_ASYNC) && defined(CONFIG_SCHED_WORKQUEUE)
+#  define RAMMTD_ASYNC 1
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -96,6 +127,15 @@ struct ram_dev_s
   struct mtd_dev_s mtd;      /* MTD device */
   FAR uint8_t     *start;    /* Start of RAM */
   size_t           nblocks;  /* Number of erase blocks */
+#ifdef RAMMTD_TIMING
+  uint32_t         busy;     /* Simulated busy time not yet waited (usec) */
+#endif
+#ifdef RAMMTD_ASYNC
+  bool             active;   /* True: The worker is processing requests */
+  FAR struct mtd_req_s *head; /* Head of the queue of pending requests */
+  FAR struct mtd_req_s *tail; /* Tail of the queue of pending requests */
+  struct work_s    work;     /* Performs queued requests */
+#endif
 };
 
 /****************************************************************************
@@ -114,6 +154,12 @@ static void *ram_write(FAR void *dest, FAR const void *src, size_t len);
 #  define ram_write(dest, src, len) memcpy(dest, src, len)
 #endif
 
+#ifdef RAMMTD_TIMING
+static void ram_busy(FAR struct ram_dev_s *priv, uint32_t usec);
+#else
+#  define ram_busy(priv, usec)
+#endif
+
 /* MTD driver methods */
 
 static int ram_erase(FAR struct mtd_dev_s *dev, off_t startblock, size_t nblocks);
@@ -128,6 +174,9 @@ static ssize_t ram_bytewrite(FAR struct mtd_dev_s *dev, off_t offset,
                              size_t nbytes, FAR const uint8_t *buf);
 #endif
 static int ram_ioctl(FAR struct mtd_dev_s *dev, int cmd, unsigned long arg);
+#ifdef RAMMTD_ASYNC
+static int ram_submit(FAR struct mtd_dev_s *dev, FAR struct mtd_req_s *req);
+#endif
 
 /****************************************************************************
  * Private Data
@@ -186,6 +235,31 @@ static void *ram_write(FAR void *dest, FAR const void *src, size_t len)
 }
 #endif
 
+/****************************************************************************
+ * Name: ram_busy
+ *
+ * Description:
+ *   Simulate the time that a FLASH device is busy programming or erasing.
+ *   The system timer is too coarse to wait for the time of each operation,
+ *   so the time is accumulated and waited for in whole system ticks.
+ *
+ ****************************************************************************/
+
+#ifdef RAMMTD_TIMING
+static void ram_busy(FAR struct ram_dev_s *priv, uint32_t usec)
+{
+  uint32_t ticks;
+
+  priv->busy += usec;
+  ticks = priv->busy / USEC_PER_TICK;
+  if (ticks > 0)
+    {
+      priv->busy -= ticks * USEC_PER_TICK;
+      usleep(ticks * USEC_PER_TICK);
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: ram_erase
  ****************************************************************************/
@@ -227,6 +301,7 @@ static int ram_erase(FAR struct mtd_dev_s *dev, off_t startblock, size_t nblocks
   /* Then erase the data in RAM */
 
   memset(&priv->start[offset], CONFIG_RAMMTD_ERASESTATE, nbytes);
+  ram_busy(priv, (nblocks / RAMMTD_BLKPER) * CONFIG_RAMMTD_ERASETIME);
   return OK;
 }
 
@@ -307,6 +382,7 @@ static ssize_t ram_bwrite(FAR struct mtd_dev_s *dev, off_t startblock,
   /* Then write the data to RAM */
 
   ram_write(&priv->start[offset], buf, nbytes);
+  ram_busy(priv, nblocks * CONFIG_RAMMTD_PROGTIME);
   return nblocks;
 }
 
@@ -356,6 +432,8 @@ static ssize_t ram_bytewrite(FAR struct mtd_dev_s *dev, off_t offset,
   /* Then write the data to RAM */
 
   ram_write(&priv->start[offset], buf, nbytes);
+  ram_busy(priv, ((nbytes + CONFIG_RAMMTD_BLOCKSIZE - 1) /
+                  CONFIG_RAMMTD_BLOCKSIZE) * CONFIG_RAMMTD_PROGTIME);
   return nbytes;
 }
 #endif
@@ -408,6 +486,7 @@ static int ram_ioctl(FAR struct mtd_dev_s *dev, int cmd, unsigned long arg)
             /* Erase the entire device */
 
             memset(priv->start, CONFIG_RAMMTD_ERASESTATE, size);
+            ram_busy(priv, priv->nblocks * CONFIG_RAMMTD_ERASETIME);
             ret = OK;
         }
         break;
@@ -420,6 +499,143 @@ static int ram_ioctl(FAR struct mtd_dev_s *dev, int cmd, unsigned long arg)
   return ret;
 }
 
+/****************************************************************************
+ * Name: ram_worker
+ *
+ * Description:
+ *   Perform queued requests in order on the low priority work queue.
+ *
+ ****************************************************************************/
+
+#ifdef RAMMTD_ASYNC
+static void ram_worker(FAR void *arg)
+{
+  FAR struct ram_dev_s *priv = (FAR struct ram_dev_s *)arg;
+  FAR struct mtd_req_s *req;
+  irqstate_t flags;
+
+  for (;;)
+    {
+      /* Remove the next request from the queue */
+
+      flags = irqsave();
+      req = priv->head;
+      if (!req)
+        {
+          priv->active = false;
+          irqrestore(flags);
+          break;
+        }
+
+      priv->head = req->flink;
+      if (!priv->head)
+        {
+          priv->tail = NULL;
+        }
+
+      irqrestore(flags);
+
+      /* Perform the request.  The simulated FLASH timing delays this
+       * thread, not the thread that submitted the request.
+       */
+
+      switch (req->op)
+        {
+          case MTDREQ_ERASE:
+            req->result = ram_erase(&priv->mtd, req->start, req->count);
+            break;
+
+          case MTDREQ_BREAD:
+            req->result = ram_bread(&priv->mtd, req->start, req->count,
+                                    req->buffer);
+            break;
+
+          case MTDREQ_BWRITE:
+            req->result = ram_bwrite(&priv->mtd, req->start, req->count,
+                                     req->buffer);
+            break;
+
+          case MTDREQ_READ:
+            req->result = ram_byteread(&priv->mtd, req->start, req->count,
+                                       req->buffer);
+            break;
+
+          default:
+            req->result = -EINVAL;
+            break;
+        }
+
+      /* Report completion.  The callback may submit more requests. */
+
+      if (req->callback)
+        {
+          req->callback(req);
+        }
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: ram_submit
+ ****************************************************************************/
+
+#ifdef RAMMTD_ASYNC
+static int ram_submit(FAR struct mtd_dev_s *dev, FAR struct mtd_req_s *req)
+{
+  FAR struct ram_dev_s *priv = (FAR struct ram_dev_s *)dev;
+  FAR struct mtd_req_s *tail;
+  irqstate_t flags;
+  bool start;
+  int ret;
+
+  DEBUGASSERT(dev && req);
+
+  /* Find the end of the new list of requests */
+
+  for (tail = req; tail->flink; tail = tail->flink);
+
+  /* Add the list to the end of the queue and start the worker if it is not
+   * already running.
+   */
+
+  flags = irqsave();
+  if (priv->tail)
+    {
+      priv->tail->flink = req;
+    }
+  else
+    {
+      priv->head = req;
+    }
+
+  priv->tail   = tail;
+  start        = !priv->active;
+  priv->active = true;
+  irqrestore(flags);
+
+  if (start)
+    {
+      ret = work_queue(LPWORK, &priv->work, ram_worker, priv, 0);
+      if (ret < 0)
+        {
+          /* The worker was not running so the queue held only the new
+           * requests.  Discard them so that the next submission starts
+           * the worker again.
+           */
+
+          flags        = irqsave();
+          priv->head   = NULL;
+          priv->tail   = NULL;
+          priv->active = false;
+          irqrestore(flags);
+          return ret;
+        }
+    }
+
+  return OK;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -471,6 +687,9 @@ FAR struct mtd_dev_s *rammtd_initialize(FAR uint8_t *start, size_t size)
   priv->mtd.write  = ram_bytewrite;
 #endif
   priv->mtd.ioctl  = ram_ioctl;
+#ifdef RAMMTD_ASYNC
+  priv->mtd.submit = ram_submit;
+#endif
 
   priv->start      = start;
   priv->nblocks    = nblocks;
@@ -116,6 +116,27 @@
 #define offsetof(type, member) ( (size_t) &( ( (type *) 0)->member))
 #endif
 
+/* Wear leveling */
+
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+#  ifndef CONFIG_MTD_SMART_WEAR_THRESHOLD
+#    define CONFIG_MTD_SMART_WEAR_THRESHOLD 16
+#  endif
+
+#  define SMART_NSTREAMS          2
+
+#  define smart_touchblock(d,b)   ((d)->wrstamp[b] = ++(d)->wrclock)
+#else
+#  define smart_touchblock(d,b)
+#endif
+
+/* Sectors are written into one of two streams so that data that is
+ * frequently rewritten does not share erase blocks with static data.
+ */
+
+#define SMART_STREAM_HOT          0   /* Sectors written by the file system */
+#define SMART_STREAM_COLD         1   /* Sectors relocated by the collector */
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -133,6 +154,12 @@ struct smart_struct_s
   FAR uint16_t         *sMap;             /* Virtual to physical sector map */
   FAR uint8_t          *releasecount;     /* Count of released sectors per erase block */
   FAR uint8_t          *freecount;        /* Count of free sectors per erase block */
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+  FAR uint32_t         *wrstamp;          /* wrclock at the last write per erase block */
+  FAR uint16_t         *erasecount;       /* Count of erasures per erase block */
+  uint32_t              wrclock;          /* Incremented on each sector write */
+  uint16_t              activeblk[SMART_NSTREAMS]; /* Open erase block per stream */
+#endif
   FAR char             *rwbuffer;         /* Our sector read/write buffer */
   const FAR char       *partname;         /* Optional partition name */
   uint8_t               formatversion;    /* Format version on the device */
@@ -290,6 +317,35 @@ static ssize_t smart_read(FAR struct inode *inode, unsigned char *buffer,
   return smart_reload(dev, buffer, start_sector, nsectors);
 }
 
+/****************************************************************************
+ * Name: smart_eraseblock
+ *
+ * Description: Erase one erase block and update its wear information
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_WRITABLE
+static int smart_eraseblock(FAR struct smart_struct_s *dev, uint16_t block)
+{
+  int ret;
+
+  ret = MTD_ERASE(dev->mtd, block, 1);
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+  if (ret >= 0)
+    {
+      if (dev->erasecount[block] < UINT16_MAX)
+        {
+          dev->erasecount[block]++;
+        }
+
+      dev->wrstamp[block] = dev->wrclock;
+    }
+#endif
+
+  return ret;
+}
+#endif /* CONFIG_FS_WRITABLE */
+
 /****************************************************************************
  * Name: smart_write
  *
@@ -358,7 +414,7 @@ static ssize_t smart_write(FAR struct inode *inode, const unsigned char *buffer,
           /* Erase the erase block */
 
           eraseblock = alignedblock / mtdBlksPerErase;
-          ret = MTD_ERASE(dev->mtd, eraseblock, 1);
+          ret = smart_eraseblock(dev, eraseblock);
           if (ret < 0)
             {
               fdbg("Erase block=%d failed: %d\n", eraseblock, ret);
@@ -460,6 +516,35 @@ static int smart_geometry(FAR struct inode *inode, struct geometry *geometry)
   return -EINVAL;
 }
 
+/****************************************************************************
+ * Name: smart_freedev
+ *
+ * Description: Free the SMART device structure and all of its buffers.
+ *
+ ****************************************************************************/
+
+static void smart_freedev(FAR struct smart_struct_s *dev)
+{
+  if (dev->sMap != NULL)
+    {
+      kfree(dev->sMap);
+    }
+
+  if (dev->rwbuffer != NULL)
+    {
+      kfree(dev->rwbuffer);
+    }
+
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+  if (dev->wrstamp != NULL)
+    {
+      kfree(dev->wrstamp);
+    }
+#endif
+
+  kfree(dev);
+}
+
 /****************************************************************************
  * Name: smart_setsectorsize
  *
@@ -501,11 +586,13 @@ static int smart_setsectorsize(struct smart_struct_s *dev, uint16_t size)
   if (dev->sMap != NULL)
     {
       kfree(dev->sMap);
+      dev->sMap = NULL;
     }
 
   if (dev->rwbuffer != NULL)
     {
       kfree(dev->rwbuffer);
+      dev->rwbuffer = NULL;
     }
 
   /* Allocate a virtual to physical sector map buffer.  Also allocate
@@ -520,13 +607,33 @@ static int smart_setsectorsize(struct smart_struct_s *dev, uint16_t size)
   if (!dev->sMap)
     {
       fdbg("Error allocating SMART virtual map buffer\n");
-      kfree(dev);
       return -EINVAL;
     }
 
   dev->releasecount = (uint8_t *) dev->sMap + (totalsectors * sizeof(uint16_t));
   dev->freecount = dev->releasecount + dev->neraseblocks;
 
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+  /* Allocate the wear information.  This depends only on the number of
+   * erase blocks so the erase counts survive changes of the sector size.
+   */
+
+  if (dev->wrstamp == NULL)
+    {
+      dev->wrstamp = (uint32_t *)kzalloc(dev->neraseblocks *
+                                         (sizeof(uint32_t) + sizeof(uint16_t)));
+      if (!dev->wrstamp)
+        {
+          fdbg("Error allocating SMART wear information\n");
+          kfree(dev->sMap);
+          dev->sMap = NULL;
+          return -EINVAL;
+        }
+
+      dev->erasecount = (uint16_t *)(dev->wrstamp + dev->neraseblocks);
+    }
+#endif
+
   /* Allocate a read/write buffer */
 
   dev->rwbuffer = (char *) kmalloc(size);
@@ -534,7 +641,7 @@ static int smart_setsectorsize(struct smart_struct_s *dev, uint16_t size)
     {
       fdbg("Error allocating SMART read/write buffer\n");
       kfree(dev->sMap);
-      kfree(dev);
+      dev->sMap = NULL;
       return -EINVAL;
     }
 
@@ -678,8 +785,17 @@ static int smart_scan(struct smart_struct_s *dev)
     {
       dev->freecount[sector] = dev->sectorsPerBlk;
       dev->releasecount[sector] = 0;
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+      dev->wrstamp[sector] = 0;
+#endif
     }
 
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+  dev->wrclock = 0;
+  dev->activeblk[SMART_STREAM_HOT] = 0xFFFF;
+  dev->activeblk[SMART_STREAM_COLD] = 0xFFFF;
+#endif
+
   /* Initialize the sector map */
 
   for (sector = 0; sector < totalsectors; sector++)
@@ -1104,8 +1220,25 @@ static inline int smart_llformat(struct smart_struct_s *dev, unsigned long arg)
 
       dev->releasecount[x] = 0;
       dev->freecount[x] = dev->sectorsPerBlk;
+
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+      /* Every erase block was erased by the bulk erase */
+
+      if (dev->erasecount[x] < UINT16_MAX)
+        {
+          dev->erasecount[x]++;
+        }
+
+      dev->wrstamp[x] = 0;
+#endif
     }
 
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+  dev->wrclock = 0;
+  dev->activeblk[SMART_STREAM_HOT] = 0xFFFF;
+  dev->activeblk[SMART_STREAM_COLD] = 0xFFFF;
+#endif
+
   /* Account for the format sector */
 
   dev->freecount[0]--;
@@ -1137,17 +1270,76 @@ static inline int smart_llformat(struct smart_struct_s *dev, unsigned long arg)
 }
 #endif /* CONFIG_FS_WRITABLE */
 
+/****************************************************************************
+ * Name: smart_openblock
+ *
+ * Description:  Selects a new erase block to receive the sectors written to
+ *               the specified stream.  Erase blocks with the most free
+ *               sectors are preferred.  Among those, the least worn block
+ *               is selected for frequently rewritten (hot) data and the most
+ *               worn block for static (cold) data.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+static uint16_t smart_openblock(FAR struct smart_struct_s *dev, int stream)
+{
+  uint16_t  other;
+  uint16_t  block;
+  uint16_t  x;
+
+  /* Don't share an erase block with the other stream if possible */
+
+  other = dev->activeblk[stream ^ 1];
+  block = 0xFFFF;
+
+  for (x = 0; x < dev->neraseblocks; x++)
+    {
+      if (dev->freecount[x] == 0 || x == other)
+        {
+          continue;
+        }
+
+      if (block == 0xFFFF || dev->freecount[x] > dev->freecount[block])
+        {
+          block = x;
+        }
+      else if (dev->freecount[x] == dev->freecount[block])
+        {
+          if (stream == SMART_STREAM_HOT ?
+              dev->erasecount[x] < dev->erasecount[block] :
+              dev->erasecount[x] > dev->erasecount[block])
+            {
+              block = x;
+            }
+        }
+    }
+
+  if (block == 0xFFFF && other != 0xFFFF && dev->freecount[other] > 0)
+    {
+      block = other;
+    }
+
+  dev->activeblk[stream] = block;
+  return block;
+}
+#endif
+
 /****************************************************************************
  * Name: smart_findfreephyssector
  *
  * Description:  Finds a free physical sector based on free and released
- *               count logic, taking into account reserved sectors.
+ *               count logic, taking into account reserved sectors.  With
+ *               wear leveling, sectors are allocated sequentially from the
+ *               erase block that is currently open for the stream.
  *
  ****************************************************************************/
 
-static int smart_findfreephyssector(struct smart_struct_s *dev)
+static int smart_findfreephyssector(struct smart_struct_s *dev, int stream)
 {
+#ifndef CONFIG_MTD_SMART_WEAR_LEVEL
   uint16_t  allocfreecount;
+#endif
   uint16_t  allocblock;
   uint16_t  physicalsector;
   uint16_t  x;
@@ -1159,9 +1351,16 @@ static int smart_findfreephyssector(struct smart_struct_s *dev)
    * sector from. This is based on the number of free sectors
    * available in each erase block. */
 
+  physicalsector = 0xFFFF;
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+  allocblock = dev->activeblk[stream];
+  if (allocblock == 0xFFFF || dev->freecount[allocblock] == 0)
+    {
+      allocblock = smart_openblock(dev, stream);
+    }
+#else
   allocfreecount = 0;
   allocblock = 0xFFFF;
-  physicalsector = 0xFFFF;
   for (x = 0; x < dev->neraseblocks; x++)
     {
       /* Test if this block has more free blocks than the
@@ -1175,6 +1374,7 @@ static int smart_findfreephyssector(struct smart_struct_s *dev)
           allocfreecount = dev->freecount[x];
         }
     }
+#endif
 
   /* Check if we found an allocblock. */
 
@@ -1215,224 +1415,414 @@ static int smart_findfreephyssector(struct smart_struct_s *dev)
 }
 
 /****************************************************************************
- * Name: smart_garbagecollect
+ * Name: smart_findvictim
  *
- * Description:  Performs garbage collection if needed.  This is determined
- *               by the count of released sectors relative to free and
- *               total sectors.
+ * Description:  Selects the erase block to be garbage collected.  Without
+ *               wear leveling, this is the block with the most released
+ *               sectors.  With wear leveling, a cost-benefit policy is
+ *               used:  The benefit (released sectors times the age of the
+ *               data in the block) is weighed against the cost of copying
+ *               the live sectors.  Blocks that have been erased more than
+ *               CONFIG_MTD_SMART_WEAR_THRESHOLD times more often than the
+ *               least worn block are only selected if there is no other
+ *               choice.
  *
  ****************************************************************************/
 
 #ifdef CONFIG_FS_WRITABLE
-static int smart_garbagecollect(struct smart_struct_s *dev)
+static uint16_t smart_findvictim(FAR struct smart_struct_s *dev)
 {
-  uint16_t  releasedsectors;
-  uint16_t  collectblock;
-  uint16_t  releasemax;
-  uint16_t  newsector;
-  bool      collect = TRUE;
-  int       x;
-  int       ret;
-  size_t    offset;
-  struct    smart_sect_header_s *header;
-  uint8_t   newstatus;
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+  uint32_t  score;
+  uint32_t  bestscore;
+  uint32_t  wornscore;
+  uint16_t  bestblock;
+  uint16_t  wornblock;
+  uint32_t  age;
+  uint16_t  minerase;
+  uint16_t  live;
+  uint16_t  x;
 
-  while (collect)
+  minerase = UINT16_MAX;
+  for (x = 0; x < dev->neraseblocks; x++)
     {
-      collect = FALSE;
+      if (dev->erasecount[x] < minerase)
+        {
+          minerase = dev->erasecount[x];
+        }
+    }
 
-      /* Calculate the number of released sectors on the device */
+  bestscore = 0;
+  wornscore = 0;
+  bestblock = 0xFFFF;
+  wornblock = 0xFFFF;
 
-      releasedsectors = 0;
-      collectblock = 0xFFFF;
-      releasemax = 0;
-      for (x = 0; x < dev->neraseblocks; x++)
+  for (x = 0; x < dev->neraseblocks; x++)
+    {
+      if (dev->releasecount[x] == 0)
         {
-          releasedsectors += dev->releasecount[x];
-          if (dev->releasecount[x] > releasemax)
+          continue;
+        }
+
+      live  = dev->sectorsPerBlk - dev->freecount[x] - dev->releasecount[x];
+      /* The age in writes (modulo 2^32).  Anything older than UINT16_MAX
+       * writes is treated as equally old so that the score cannot overflow.
+       */
+
+      age   = dev->wrclock - dev->wrstamp[x];
+      if (age > UINT16_MAX)
+        {
+          age = UINT16_MAX;
+        }
+
+      score = (((uint32_t)dev->releasecount[x] * ((uint32_t)age + 1)) << 4) /
+              (2 * (uint32_t)live + 1) + 1;
+
+      if (dev->erasecount[x] - minerase > CONFIG_MTD_SMART_WEAR_THRESHOLD)
+        {
+          if (score > wornscore)
             {
-              releasemax = dev->releasecount[x];
-              collectblock = x;
+              wornscore = score;
+              wornblock = x;
             }
         }
+      else if (score > bestscore)
+        {
+          bestscore = score;
+          bestblock = x;
+        }
+    }
 
-      /* Test if the released sectors count is greater than the
-       * free sectors.  If it is, then we will do garbage collection.
-       */
+  return bestblock != 0xFFFF ? bestblock : wornblock;
 
-      if (releasedsectors > dev->freesectors)
-        collect = TRUE;
+#else
+  uint16_t  collectblock;
+  uint16_t  releasemax;
+  int       x;
 
-      /* Test if we have more reached our reserved free sector limit */
+  collectblock = 0xFFFF;
+  releasemax = 0;
+  for (x = 0; x < dev->neraseblocks; x++)
+    {
+      if (dev->releasecount[x] > releasemax)
+        {
+          releasemax = dev->releasecount[x];
+          collectblock = x;
+        }
+    }
 
-      if (dev->freesectors <= (dev->sectorsPerBlk << 0) + 4)
-        collect = TRUE;
+  return collectblock;
+#endif
+}
+#endif /* CONFIG_FS_WRITABLE */
 
-      /* Test if we need to garbage collect */
+/****************************************************************************
+ * Name: smart_findstatic
+ *
+ * Description:  Static wear leveling.  Static data holds the erase blocks
+ *               where it resides so that those blocks are never erased.
+ *               If the least worn erase block that holds live data lags
+ *               the most worn erase block by more than
+ *               CONFIG_MTD_SMART_WEAR_THRESHOLD erasures, then that block
+ *               is returned so that its data can be moved to a worn block
+ *               and the block itself can be returned to service.
+ *
+ ****************************************************************************/
 
-      if (collect)
+#if defined(CONFIG_FS_WRITABLE) && defined(CONFIG_MTD_SMART_WEAR_LEVEL)
+static uint16_t smart_findstatic(FAR struct smart_struct_s *dev)
+{
+  uint16_t  minblock;
+  uint16_t  maxerase;
+  uint16_t  live;
+  uint16_t  x;
+
+  minblock = 0xFFFF;
+  maxerase = 0;
+
+  for (x = 0; x < dev->neraseblocks; x++)
+    {
+      if (dev->erasecount[x] > maxerase)
         {
-          if (collectblock == 0xFFFF)
-            {
-              /* Need to collect, but no sectors with released blocks! */
+          maxerase = dev->erasecount[x];
+        }
 
-              ret = -ENOSPC;
-              goto errout;
-            }
+      live = dev->sectorsPerBlk - dev->freecount[x] - dev->releasecount[x];
+      if (live == 0 || x == dev->activeblk[SMART_STREAM_HOT] ||
+          x == dev->activeblk[SMART_STREAM_COLD])
+        {
+          continue;
+        }
 
-          fdbg("Collecting block %d, free=%d released=%d\n",
-              collectblock, dev->freecount[collectblock],
-              dev->releasecount[collectblock]);
+      if (minblock == 0xFFFF ||
+          dev->erasecount[x] < dev->erasecount[minblock])
+        {
+          minblock = x;
+        }
+    }
 
-          if (dev->freecount[collectblock] == 6)
-            {
-              fdbg("here!\n");
-            }
+  if (minblock == 0xFFFF ||
+      maxerase - dev->erasecount[minblock] <= CONFIG_MTD_SMART_WEAR_THRESHOLD)
+    {
+      return 0xFFFF;
+    }
 
-          /* Perform collection on block with the most released sectors.
-           * First mark the block as having no free sectors so we don't
-           * try to move sectors into the block we are trying to erase.
-           */
+  /* There must be room for the live sectors outside of the erase block */
 
-          dev->freecount[collectblock] = 0;
+  live = dev->sectorsPerBlk - dev->freecount[minblock] -
+         dev->releasecount[minblock];
+  if (dev->freesectors - dev->freecount[minblock] <=
+      live + dev->sectorsPerBlk + 4)
+    {
+      return 0xFFFF;
+    }
 
-          /* Next move all live data in the block to a new home. */
+  return minblock;
+}
+#endif
 
-          for (x = collectblock * dev->sectorsPerBlk; x <
-             (collectblock + 1) * dev->sectorsPerBlk; x++)
-            {
-              /* Read the next sector from this erase block */
+/****************************************************************************
+ * Name: smart_relocateblock
+ *
+ * Description:  Moves all live sectors out of an erase block and then
+ *               erases it.  The live sectors are written to the cold
+ *               stream.
+ *
+ ****************************************************************************/
 
-              ret = MTD_BREAD(dev->mtd, x * dev->mtdBlksPerSector,
-                  dev->mtdBlksPerSector, (uint8_t *) dev->rwbuffer);
-              if (ret != dev->mtdBlksPerSector)
-                {
-                  fdbg("Error reading sector %d\n", x);
-                  ret = -EIO;
-                  goto errout;
-                }
+#ifdef CONFIG_FS_WRITABLE
+static int smart_relocateblock(FAR struct smart_struct_s *dev,
+                               uint16_t collectblock)
+{
+  uint16_t  newsector;
+  int       x;
+  int       ret;
+  size_t    offset;
+  struct    smart_sect_header_s *header;
+  uint8_t   newstatus;
 
-              /* Test if if the block is in use */
+  fdbg("Collecting block %d, free=%d released=%d\n",
+      collectblock, dev->freecount[collectblock],
+      dev->releasecount[collectblock]);
 
-              header = (struct smart_sect_header_s *) dev->rwbuffer;
-              if (((header->status & SMART_STATUS_COMMITTED) ==
-                  (CONFIG_SMARTFS_ERASEDSTATE & SMART_STATUS_COMMITTED)) ||
-                  ((header->status & SMART_STATUS_RELEASED) !=
-                   (CONFIG_SMARTFS_ERASEDSTATE & SMART_STATUS_RELEASED)))
-                {
-                  /* This sector doesn't have live data (free or released).
-                   * just continue to the next sector and don't move it.
-                   */
+  /* First mark the block as having no free sectors so we don't
+   * try to move sectors into the block we are trying to erase.
+   */
 
-                  continue;
-                }
+  dev->freecount[collectblock] = 0;
 
-              /* Find a new sector where it can live, NOT in this erase block */
+  /* Next move all live data in the block to a new home. */
 
-              newsector = smart_findfreephyssector(dev);
-              if (newsector == 0xFFFF)
-                {
-                  /* Unable to find a free sector!!! */
+  for (x = collectblock * dev->sectorsPerBlk; x <
+     (collectblock + 1) * dev->sectorsPerBlk; x++)
+    {
+      /* Read the next sector from this erase block */
 
-                  fdbg("Can't find a free sector for relocation\n");
-                  ret = -EIO;
-                  goto errout;
-                }
+      ret = MTD_BREAD(dev->mtd, x * dev->mtdBlksPerSector,
+          dev->mtdBlksPerSector, (uint8_t *) dev->rwbuffer);
+      if (ret != dev->mtdBlksPerSector)
+        {
+          fdbg("Error reading sector %d\n", x);
+          return -EIO;
+        }
 
-              /* Increment the sequence number and clear the "commit" flag */
+      /* Test if if the block is in use */
 
-              (*((uint16_t *) header->seq))++;
-              if (*((uint16_t *) header->seq) == 0xFFFF)
-                {
-                  *((uint16_t *) header->seq) = 1;
-                }
+      header = (struct smart_sect_header_s *) dev->rwbuffer;
+      if (((header->status & SMART_STATUS_COMMITTED) ==
+          (CONFIG_SMARTFS_ERASEDSTATE & SMART_STATUS_COMMITTED)) ||
+          ((header->status & SMART_STATUS_RELEASED) !=
+           (CONFIG_SMARTFS_ERASEDSTATE & SMART_STATUS_RELEASED)))
+        {
+          /* This sector doesn't have live data (free or released).
+           * just continue to the next sector and don't move it.
+           */
+
+          continue;
+        }
+
+      /* Find a new sector where it can live, NOT in this erase block */
+
+      newsector = smart_findfreephyssector(dev, SMART_STREAM_COLD);
+      if (newsector == 0xFFFF)
+        {
+          /* Unable to find a free sector!!! */
+
+          fdbg("Can't find a free sector for relocation\n");
+          return -EIO;
+        }
+
+      /* Increment the sequence number and clear the "commit" flag */
+
+      (*((uint16_t *) header->seq))++;
+      if (*((uint16_t *) header->seq) == 0xFFFF)
+        {
+          *((uint16_t *) header->seq) = 1;
+        }
 #if CONFIG_SMARTFS_ERASEDSTATE == 0xFF
-              header->status |= SMART_STATUS_COMMITTED;
+      header->status |= SMART_STATUS_COMMITTED;
 #else
-              header->status &= ~SMART_STATUS_COMMITTED;
+      header->status &= ~SMART_STATUS_COMMITTED;
 #endif
 
-              /* Write the data to the new physical sector location */
+      /* Write the data to the new physical sector location */
 
-              ret = MTD_BWRITE(dev->mtd, newsector * dev->mtdBlksPerSector,
-                               dev->mtdBlksPerSector, (uint8_t *) dev->rwbuffer);
+      ret = MTD_BWRITE(dev->mtd, newsector * dev->mtdBlksPerSector,
+                       dev->mtdBlksPerSector, (uint8_t *) dev->rwbuffer);
 
-              /* Commit the sector */
+      /* Commit the sector */
 
-              offset = newsector * dev->mtdBlksPerSector * dev->geo.blocksize +
-                  offsetof(struct smart_sect_header_s, status);
+      offset = newsector * dev->mtdBlksPerSector * dev->geo.blocksize +
+          offsetof(struct smart_sect_header_s, status);
 #if CONFIG_SMARTFS_ERASEDSTATE == 0xFF
-              newstatus = header->status & ~SMART_STATUS_COMMITTED;
+      newstatus = header->status & ~SMART_STATUS_COMMITTED;
 #else
-              newstatus = header->status | SMART_STATUS_COMMITTED;
+      newstatus = header->status | SMART_STATUS_COMMITTED;
 #endif
-              ret = smart_bytewrite(dev, offset, 1, &newstatus);
-              if (ret < 0)
-                {
-                  fdbg("Error %d committing new sector %d\n" -ret, newsector);
-                  goto errout;
-                }
+      ret = smart_bytewrite(dev, offset, 1, &newstatus);
+      if (ret < 0)
+        {
+          fdbg("Error %d committing new sector %d\n", -ret, newsector);
+          return ret;
+        }
 
-              /* Release the old physical sector */
+      /* Release the old physical sector */
 
 #if CONFIG_SMARTFS_ERASEDSTATE == 0xFF
-              newstatus = header->status & ~SMART_STATUS_RELEASED;
+      newstatus = header->status & ~SMART_STATUS_RELEASED;
 #else
-              newstatus = header->status | SMART_STATUS_RELEASED;
+      newstatus = header->status | SMART_STATUS_RELEASED;
 #endif
-              offset = x * dev->mtdBlksPerSector * dev->geo.blocksize +
-                  offsetof(struct smart_sect_header_s, status);
-              ret = smart_bytewrite(dev, offset, 1, &newstatus);
-              if (ret < 0)
-                {
-                  fdbg("Error %d releasing old sector %d\n" -ret, x);
-                  goto errout;
-                }
+      offset = x * dev->mtdBlksPerSector * dev->geo.blocksize +
+          offsetof(struct smart_sect_header_s, status);
+      ret = smart_bytewrite(dev, offset, 1, &newstatus);
+      if (ret < 0)
+        {
+          fdbg("Error %d releasing old sector %d\n", -ret, x);
+          return ret;
+        }
 
-              /* Update the variables */
+      /* Update the variables */
 
-              dev->sMap[*((uint16_t *) header->logicalsector)] = newsector;
-              dev->freecount[newsector / dev->sectorsPerBlk]--;
-            }
+      dev->sMap[*((uint16_t *) header->logicalsector)] = newsector;
+      dev->freecount[newsector / dev->sectorsPerBlk]--;
+    }
 
-          /* Now erase the erase block */
+  /* Now erase the erase block */
 
-          MTD_ERASE(dev->mtd, collectblock, 1);
+  smart_eraseblock(dev, collectblock);
 
-          dev->freesectors += dev->releasecount[collectblock];
-          dev->freecount[collectblock] = dev->sectorsPerBlk;
-          dev->releasecount[collectblock] = 0;
+  dev->freesectors += dev->releasecount[collectblock];
+  dev->freecount[collectblock] = dev->sectorsPerBlk;
+  dev->releasecount[collectblock] = 0;
 
-          /* If this is block zero, then be sure to write the sector size */
+  /* If this is block zero, then be sure to write the sector size */
 
-          if (collectblock == 0)
-            {
-              /* Set the sector size in the 1st header */
+  if (collectblock == 0)
+    {
+      /* Set the sector size in the 1st header */
 
-              uint8_t sectsize = dev->sectorsize >> 7;
+      uint8_t sectsize = dev->sectorsize >> 7;
 #if ( CONFIG_SMARTFS_ERASEDSTATE == 0xFF )
-              newstatus = (uint8_t) ~SMART_STATUS_SIZEBITS | sectsize;
+      newstatus = (uint8_t) ~SMART_STATUS_SIZEBITS | sectsize;
 #else
-              newstatus = (uint8_t) sectsize;
+      newstatus = (uint8_t) sectsize;
 #endif
-              /* Write the sector size to the device */
+      /* Write the sector size to the device */
 
-              offset = offsetof(struct smart_sect_header_s, status);
-              ret = smart_bytewrite(dev, offset, 1, &newstatus);
-              if (ret < 0)
-                {
-                  fdbg("Error %d setting sector 0 size\n", -ret);
-                }
+      offset = offsetof(struct smart_sect_header_s, status);
+      ret = smart_bytewrite(dev, offset, 1, &newstatus);
+      if (ret < 0)
+        {
+          fdbg("Error %d setting sector 0 size\n", -ret);
+        }
+    }
+
+  return OK;
+}
+#endif /* CONFIG_FS_WRITABLE */
+
+/****************************************************************************
+ * Name: smart_garbagecollect
+ *
+ * Description:  Performs garbage collection if needed.  This is determined
+ *               by the count of released sectors relative to free and
+ *               total sectors.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_WRITABLE
+static int smart_garbagecollect(struct smart_struct_s *dev)
+{
+  uint16_t  releasedsectors;
+  uint16_t  collectblock;
+  bool      collect = TRUE;
+  int       x;
+  int       ret;
+
+  while (collect)
+    {
+      collect = FALSE;
+
+      /* Calculate the number of released sectors on the device */
+
+      releasedsectors = 0;
+      for (x = 0; x < dev->neraseblocks; x++)
+        {
+          releasedsectors += dev->releasecount[x];
+        }
+
+      /* Test if the released sectors count is greater than the
+       * free sectors.  If it is, then we will do garbage collection.
+       */
+
+      if (releasedsectors > dev->freesectors)
+        collect = TRUE;
+
+      /* Test if we have more reached our reserved free sector limit */
+
+      if (dev->freesectors <= (dev->sectorsPerBlk << 0) + 4)
+        collect = TRUE;
+
+      /* Test if we need to garbage collect */
+
+      if (collect)
+        {
+          collectblock = smart_findvictim(dev);
+          if (collectblock == 0xFFFF)
+            {
+              /* Need to collect, but no sectors with released blocks! */
+
+              ret = -ENOSPC;
+              goto errout;
             }
 
-          /* Update the block aging information in the format signature sector */
+          /* Perform collection on the selected block */
+
+          ret = smart_relocateblock(dev, collectblock);
+          if (ret < 0)
+            {
+              goto errout;
+            }
         }
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
       else
         {
           /* Test for aging sectors and push them to a new location
            * so we wear evenly.
            */
+
+          collectblock = smart_findstatic(dev);
+          if (collectblock != 0xFFFF)
+            {
+              ret = smart_relocateblock(dev, collectblock);
+              if (ret < 0)
+                {
+                  goto errout;
+                }
+            }
         }
+#endif
     }
 
   return OK;
@@ -1527,7 +1917,7 @@ static inline int smart_writesector(struct smart_struct_s *dev, unsigned long ar
     {
       /* Find a new physical sector to save data to */
 
-      physsector = smart_findfreephyssector(dev);
+      physsector = smart_findfreephyssector(dev, SMART_STREAM_HOT);
       if (physsector == 0xFFFF)
         {
           fdbg("Error relocating sector %d\n", req->logsector);
@@ -1600,6 +1990,7 @@ static inline int smart_writesector(struct smart_struct_s *dev, unsigned long ar
       dev->releasecount[dev->sMap[req->logsector] / dev->sectorsPerBlk]++;
       dev->freecount[physsector / dev->sectorsPerBlk]--;
       dev->freesectors--;
+      smart_touchblock(dev, physsector / dev->sectorsPerBlk);
 
       /* Update the sector map */
 
@@ -1619,6 +2010,7 @@ static inline int smart_writesector(struct smart_struct_s *dev, unsigned long ar
       offset = mtdblock * dev->geo.blocksize +
           sizeof(struct smart_sect_header_s) + req->offset;
       ret = smart_bytewrite(dev, offset, req->count, req->buffer);
+      smart_touchblock(dev, physsector / dev->sectorsPerBlk);
     }
 
   ret = OK;
@@ -1809,7 +2201,7 @@ static inline int smart_allocsector(struct smart_struct_s *dev, unsigned long re
 
   /* Find a free physical sector */
 
-  physicalsector = smart_findfreephyssector(dev);
+  physicalsector = smart_findfreephyssector(dev, SMART_STREAM_HOT);
   fvdbg("Alloc: log=%d, phys=%d, erase block=%d, free=%d, released=%d\n",
           logsector, physicalsector, physicalsector /
           dev->sectorsPerBlk, dev->freesectors, releasecount);
@@ -1851,6 +2243,7 @@ static inline int smart_allocsector(struct smart_struct_s *dev, unsigned long re
   dev->sMap[logsector] = physicalsector;
   dev->freecount[physicalsector / dev->sectorsPerBlk]--;
   dev->freesectors--;
+  smart_touchblock(dev, physicalsector / dev->sectorsPerBlk);
 
   /* Return the logical sector number */
 
@@ -1947,7 +2340,7 @@ static inline int smart_freesector(struct smart_struct_s *dev, unsigned long
     {
       /* Erase the block */
 
-      MTD_ERASE(dev->mtd, block, 1);
+      smart_eraseblock(dev, block);
 
       dev->freesectors += dev->releasecount[block];
       dev->releasecount[block] = 0;
@@ -2135,10 +2528,14 @@ int smart_initialize(int minor, FAR struct mtd_dev_s *mtd, const char *partname)
 
       dev->sMap = NULL;
       dev->rwbuffer = NULL;
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+      dev->wrstamp = NULL;
+      dev->erasecount = NULL;
+#endif
       ret = smart_setsectorsize(dev, CONFIG_MTD_SMART_SECTOR_SIZE);
       if (ret != OK)
         {
-          kfree(dev);
+          smart_freedev(dev);
           goto errout;
         }
 
@@ -2148,7 +2545,7 @@ int smart_initialize(int minor, FAR struct mtd_dev_s *mtd, const char *partname)
       if (totalsectors > 65534)
         {
           fdbg("SMART Sector size too small for device\n");
-          kfree(dev);
+          smart_freedev(dev);
           ret = -EINVAL;
           goto errout;
         }
@@ -2179,9 +2576,7 @@ int smart_initialize(int minor, FAR struct mtd_dev_s *mtd, const char *partname)
       if (rootdirdev == NULL)
         {
           fdbg("register_blockdriver failed: %d\n", -ret);
-          kfree(dev->sMap);
-          kfree(dev->rwbuffer);
-          kfree(dev);
+          smart_freedev(dev);
           ret = -ENOMEM;
           goto errout;
         }
@@ -2206,9 +2601,7 @@ int smart_initialize(int minor, FAR struct mtd_dev_s *mtd, const char *partname)
       if (ret < 0)
         {
           fdbg("register_blockdriver failed: %d\n", -ret);
-          kfree(dev->sMap);
-          kfree(dev->rwbuffer);
-          kfree(dev);
+          smart_freedev(dev);
           goto errout;
         }
 
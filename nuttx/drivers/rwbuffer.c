@@ -1,7 +1,7 @@
 /****************************************************************************
  * drivers/rwbuffer.c
  *
- *   Copyright (C) 2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -33,6 +33,7 @@
  *
  ****************************************************************************/
 
+
 /****************************************************************************
  * Included Files
  ****************************************************************************/
@@ -51,6 +52,7 @@
 #include <debug.h>
 
 #include <nuttx/kmalloc.h>
+#include <nuttx/clock.h>
 #include <nuttx/wqueue.h>
 #include <nuttx/rwbuffer.h>
 
@@ -62,7 +64,7 @@
 
 /* Configuration ************************************************************/
 
-#ifndef CONFIG_SCHED_WORKQUEUE
+#if defined(CONFIG_FS_WRITEBUFFER) && !defined(CONFIG_SCHED_WORKQUEUE)
 #  error "Worker thread support is required (CONFIG_SCHED_WORKQUEUE)"
 #endif
 
@@ -70,6 +72,22 @@
 #  define CONFIG_FS_WRDELAY 350
 #endif
 
+#ifndef CONFIG_FS_RHMINBLOCKS
+#  define CONFIG_FS_RHMINBLOCKS 2
+#endif
+
+/* Write buffer states */
+
+#define RWB_WRSTATE_EMPTY    0 /* The buffer holds no data */
+#define RWB_WRSTATE_DIRTY    1 /* The buffer holds data not yet written */
+#define RWB_WRSTATE_FLUSHING 2 /* The buffer is being written to the media */
+
+/* Helpers */
+
+#define RWB_WRDELAY          MSEC2TICK(CONFIG_FS_WRDELAY)
+#define RWB_WRFULL(r,w)      ((w)->nblocks >= (r)->wrmaxblocks)
+#define RWB_WREND(w)         ((w)->blockstart + (w)->nblocks)
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -122,8 +140,9 @@ static inline bool rwb_overlap(off_t blockstart1, size_t nblocks1,
 
   /* If the buffer 1 is wholly outside of buffer 2, return false */
 
-  if ((blockend1   < blockstart2) || /* Wholly "below" */
-      (blockstart1 > blockend2))     /* Wholly "above" */
+  if (nblocks1 == 0 || nblocks2 == 0 ||
+      (blockend1   <= blockstart2) ||  /* Wholly "below" */
+      (blockstart1 >= blockend2))      /* Wholly "above" */
     {
       return false;
     }
@@ -133,155 +152,555 @@ static inline bool rwb_overlap(off_t blockstart1, size_t nblocks1,
     }
 }
 
+/****************************************************************************
+ * Name: rwb_devflush
+ *
+ * Description:
+ *   Call the driver's flush method.  Driver callouts are serialized because
+ *   the write buffers may be flushed on the worker thread at the same time
+ *   that a read is in progress.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_WRITEBUFFER
+static ssize_t rwb_devflush(FAR struct rwbuffer_s *rwb,
+                            FAR const uint8_t *buffer, off_t startblock,
+                            size_t nblocks)
+{
+  ssize_t ret;
+
+  rwb_semtake(&rwb->devsem);
+  ret = rwb->wrflush(rwb->dev, buffer, startblock, nblocks);
+  rwb_semgive(&rwb->devsem);
+  return ret;
+}
+#endif
+
+/****************************************************************************
+ * Name: rwb_devreload
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_READAHEAD
+static ssize_t rwb_devreload(FAR struct rwbuffer_s *rwb, FAR uint8_t *buffer,
+                             off_t startblock, size_t nblocks)
+{
+  ssize_t ret;
+
+#ifdef CONFIG_FS_WRITEBUFFER
+  rwb_semtake(&rwb->devsem);
+#endif
+  ret = rwb->rhreload(rwb->dev, buffer, startblock, nblocks);
+#ifdef CONFIG_FS_WRITEBUFFER
+  rwb_semgive(&rwb->devsem);
+#endif
+  return ret;
+}
+#endif
+
 /****************************************************************************
  * Name: rwb_resetwrbuffer
  ****************************************************************************/
 
 #ifdef CONFIG_FS_WRITEBUFFER
-static inline void rwb_resetwrbuffer(struct rwbuffer_s *rwb)
+static inline void rwb_resetwrbuffer(FAR struct rwb_wrbuffer_s *wb)
 {
   /* We assume that the caller holds the wrsem */
 
-  rwb->wrnblocks       = 0;
-  rwb->wrblockstart    = (off_t)-1;
-  rwb->wrexpectedblock = (off_t)-1;
+  wb->nblocks    = 0;
+  wb->blockstart = (off_t)-1;
+  wb->state      = RWB_WRSTATE_EMPTY;
 }
 #endif
 
 /****************************************************************************
- * Name: rwb_wrflush
+ * Name: rwb_wrstartwork
+ *
+ * Description:
+ *   (Re-)schedule the background flush after 'delay' ticks.  The caller
+ *   holds the wrsem.
+ *
  ****************************************************************************/
 
 #ifdef CONFIG_FS_WRITEBUFFER
-static void rwb_wrflush(struct rwbuffer_s *rwb)
+static void rwb_wrworker(FAR void *arg);
+
+static void rwb_wrstartwork(FAR struct rwbuffer_s *rwb, uint32_t delay)
 {
-  int ret;
+  (void)work_cancel(LPWORK, &rwb->work);
+  (void)work_queue(LPWORK, &rwb->work, rwb_wrworker, (FAR void *)rwb, delay);
+}
+#endif
+
+/****************************************************************************
+ * Name: rwb_wrwait
+ *
+ * Description:
+ *   Wait for a flush that is in progress on another thread to complete.
+ *   The caller holds the wrsem; the wrsem is released while waiting and
+ *   is held again on return.  Any buffer state may have changed.
+ *
+ ****************************************************************************/
 
-  fvdbg("Timeout!\n");
-  
+#ifdef CONFIG_FS_WRITEBUFFER
+static void rwb_wrwait(FAR struct rwbuffer_s *rwb)
+{
+  rwb->wrwaiters++;
+  rwb_semgive(&rwb->wrsem);
+  rwb_semtake(&rwb->wrdone);
   rwb_semtake(&rwb->wrsem);
-  if (rwb->wrnblocks)
+}
+#endif
+
+/****************************************************************************
+ * Name: rwb_wrmerge
+ *
+ * Description:
+ *   Merge write buffers that hold adjacent runs of blocks so that they can
+ *   be written to the media with a single transfer.  The caller holds the
+ *   wrsem.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_WRITEBUFFER
+static void rwb_wrmerge(FAR struct rwbuffer_s *rwb)
+{
+  FAR struct rwb_wrbuffer_s *wb1;
+  FAR struct rwb_wrbuffer_s *wb2;
+  bool merged;
+  int i;
+  int j;
+
+  do
+    {
+      merged = false;
+      for (i = 0; i < CONFIG_FS_NWRBUFFERS; i++)
+        {
+          wb1 = &rwb->wrbuf[i];
+          if (wb1->state != RWB_WRSTATE_DIRTY || RWB_WRFULL(rwb, wb1))
+            {
+              continue;
+            }
+
+          for (j = 0; j < CONFIG_FS_NWRBUFFERS; j++)
+            {
+              /* Does buffer 2 start where buffer 1 ends, and is there room
+               * for all of buffer 2 at the end of buffer 1?
+               */
+
+              wb2 = &rwb->wrbuf[j];
+              if (wb2->state == RWB_WRSTATE_DIRTY &&
+                  wb2->blockstart == RWB_WREND(wb1) &&
+                  wb1->nblocks + wb2->nblocks <= rwb->wrmaxblocks)
+                {
+                  fvdbg("Merging %ld+%d into %ld+%d\n",
+                        (long)wb2->blockstart, wb2->nblocks,
+                        (long)wb1->blockstart, wb1->nblocks);
+
+                  memcpy(&wb1->buffer[wb1->nblocks * rwb->blocksize],
+                         wb2->buffer, wb2->nblocks * rwb->blocksize);
+                  wb1->nblocks += wb2->nblocks;
+                  rwb_resetwrbuffer(wb2);
+                  merged = true;
+                }
+            }
+        }
+    }
+  while (merged);
+}
+#endif
+
+/****************************************************************************
+ * Name: rwb_wrflushbuffers
+ *
+ * Description:
+ *   Write dirty buffers to the media:  All dirty buffers if 'all' is true;
+ *   otherwise only the full ones.  The caller holds the wrsem.  The wrsem
+ *   is released while the data is being transferred so that other threads
+ *   may continue to fill the remaining buffers; it is held again on return
+ *   and any buffer state may have changed.
+ *
+ *   Adjacent runs are merged first.  Full buffers that are followed (in
+ *   memory) by the next run of blocks are written with one transfer.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_WRITEBUFFER
+static int rwb_wrflushbuffers(FAR struct rwbuffer_s *rwb, bool all)
+{
+  FAR struct rwb_wrbuffer_s *wb;
+  uint32_t mine = 0;
+  ssize_t nwritten;
+  size_t nblocks;
+  int ret = OK;
+  int i;
+  int j;
+
+  /* Merge adjacent runs, then claim the buffers to be written */
+
+  rwb_wrmerge(rwb);
+
+  for (i = 0; i < CONFIG_FS_NWRBUFFERS; i++)
+    {
+      wb = &rwb->wrbuf[i];
+      if (wb->state == RWB_WRSTATE_DIRTY && (all || RWB_WRFULL(rwb, wb)))
+        {
+          wb->state = RWB_WRSTATE_FLUSHING;
+          mine |= ((uint32_t)1 << i);
+        }
+    }
+
+  if (mine == 0)
+    {
+      return OK;
+    }
+
+  /* Nobody else will touch a buffer in the FLUSHING state so we can let go
+   * of the wrsem while the data is transferred.
+   */
+
+  rwb_semgive(&rwb->wrsem);
+
+  for (i = 0; i < CONFIG_FS_NWRBUFFERS; i = j + 1)
     {
+      j = i;
+      if ((mine & ((uint32_t)1 << i)) == 0)
+        {
+          continue;
+        }
+
+      /* Extend the transfer through any following buffers that continue
+       * the same run of blocks.  That is possible only if the preceding
+       * buffer is full because the buffers are contiguous in memory.
+       */
+
+      wb      = &rwb->wrbuf[i];
+      nblocks = wb->nblocks;
+
+      while (j + 1 < CONFIG_FS_NWRBUFFERS &&
+             (mine & ((uint32_t)1 << (j + 1))) != 0 &&
+             RWB_WRFULL(rwb, &rwb->wrbuf[j]) &&
+             rwb->wrbuf[j + 1].blockstart == RWB_WREND(&rwb->wrbuf[j]))
+        {
+          j++;
+          nblocks += rwb->wrbuf[j].nblocks;
+        }
+
       fvdbg("Flushing: blockstart=0x%08lx nblocks=%d from buffer=%p\n",
-      (long)rwb->wrblockstart, rwb->wrnblocks, rwb->wrbuffer);
+            (long)wb->blockstart, (int)nblocks, wb->buffer);
 
-      /* Flush cache.  On success, the flush method will return the number
-       * of blocks written.  Anything other than the number requested is
-       * an error.
+      /* On success, the flush method will return the number of blocks
+       * written.  Anything other than the number requested is an error.
        */
 
-      ret = rwb->wrflush(rwb->dev, rwb->wrbuffer, rwb->wrblockstart, rwb->wrnblocks);
-      if (ret != rwb->wrnblocks)
+      nwritten = rwb_devflush(rwb, wb->buffer, wb->blockstart, nblocks);
+      if (nwritten != nblocks)
         {
-          fdbg("ERROR: Error flushing write buffer: %d\n", ret);
+          fdbg("ERROR: Error flushing write buffer: %d\n", (int)nwritten);
+          ret = nwritten < 0 ? (int)nwritten : -EIO;
         }
-      
-      rwb_resetwrbuffer(rwb);
     }
 
-  rwb_semgive(&rwb->wrsem);
+  /* Release the buffers and wake up anyone waiting for them */
+
+  rwb_semtake(&rwb->wrsem);
+  for (i = 0; i < CONFIG_FS_NWRBUFFERS; i++)
+    {
+      if ((mine & ((uint32_t)1 << i)) != 0)
+        {
+          rwb_resetwrbuffer(&rwb->wrbuf[i]);
+        }
+    }
+
+  while (rwb->wrwaiters > 0)
+    {
+      rwb->wrwaiters--;
+      rwb_semgive(&rwb->wrdone);
+    }
+
+  return ret;
 }
 #endif
 
 /****************************************************************************
- * Name: rwb_wrtimeout
+ * Name: rwb_wrsync
+ *
+ * Description:
+ *   Make sure that no buffered write data overlaps the specified range of
+ *   blocks:  Flush any dirty buffers that do and wait for any such flush in
+ *   progress on another thread.  The caller holds the wrsem.
+ *
  ****************************************************************************/
 
-static void rwb_wrtimeout(FAR void *arg)
+#ifdef CONFIG_FS_WRITEBUFFER
+static int rwb_wrsync(FAR struct rwbuffer_s *rwb, off_t startblock,
+                      size_t nblocks)
 {
-  /* The following assumes that the size of a pointer is 4-bytes or less */
-
-  FAR struct rwbuffer_s *rwb = (struct rwbuffer_s *)arg;
-  DEBUGASSERT(rwb != NULL);
+  FAR struct rwb_wrbuffer_s *wb;
+  bool dirty;
+  bool flushing;
+  int ret = OK;
+  int err;
+  int i;
+
+  for (;;)
+    {
+      dirty    = false;
+      flushing = false;
 
-  /* If a timeout elpases with with write buffer activity, this watchdog
-   * handler function will be evoked on the thread of execution of the
-   * worker thread.
-   */
+      for (i = 0; i < CONFIG_FS_NWRBUFFERS; i++)
+        {
+          wb = &rwb->wrbuf[i];
+          if (rwb_overlap(wb->blockstart, wb->nblocks, startblock, nblocks))
+            {
+              if (wb->state == RWB_WRSTATE_DIRTY)
+                {
+                  dirty = true;
+                }
+              else if (wb->state == RWB_WRSTATE_FLUSHING)
+                {
+                  flushing = true;
+                }
+            }
+        }
 
-  rwb_wrflush(rwb);
+      if (dirty)
+        {
+          err = rwb_wrflushbuffers(rwb, true);
+          if (err < 0)
+            {
+              ret = err;
+            }
+        }
+      else if (flushing)
+        {
+          rwb_wrwait(rwb);
+        }
+      else
+        {
+          return ret;
+        }
+    }
 }
+#endif
 
 /****************************************************************************
- * Name: rwb_wrstarttimeout
+ * Name: rwb_wrworker
+ *
+ * Description:
+ *   Runs on the worker thread.  Full buffers are written immediately;
+ *   partially filled buffers are written once there has been no write
+ *   activity for CONFIG_FS_WRDELAY milliseconds.
+ *
  ****************************************************************************/
 
-static void rwb_wrstarttimeout(FAR struct rwbuffer_s *rwb)
+#ifdef CONFIG_FS_WRITEBUFFER
+static void rwb_wrworker(FAR void *arg)
 {
-  /* CONFIG_FS_WRDELAY provides the delay period in milliseconds. CLK_TCK
-   * provides the clock tick of the system (frequency in Hz).
-   */
+  FAR struct rwbuffer_s *rwb = (struct rwbuffer_s *)arg;
+  uint32_t elapsed;
+  bool dirty;
+  int i;
+
+  DEBUGASSERT(rwb != NULL);
+
+  rwb_semtake(&rwb->wrsem);
+  (void)rwb_wrflushbuffers(rwb, false);
+
+  /* Is there anything left in a partially filled buffer? */
+
+  dirty = false;
+  for (i = 0; i < CONFIG_FS_NWRBUFFERS; i++)
+    {
+      if (rwb->wrbuf[i].state == RWB_WRSTATE_DIRTY)
+        {
+          dirty = true;
+        }
+    }
+
+  if (dirty)
+    {
+      elapsed = clock_systimer() - rwb->wrlastwrite;
+      if (elapsed >= RWB_WRDELAY)
+        {
+          fvdbg("Timeout!\n");
+          (void)rwb_wrflushbuffers(rwb, true);
+        }
+      else
+        {
+          rwb_wrstartwork(rwb, RWB_WRDELAY - elapsed);
+        }
+    }
 
-  int ticks = (CONFIG_FS_WRDELAY + CLK_TCK/2) / CLK_TCK;
-  (void)work_queue(LPWORK, &rwb->work, rwb_wrtimeout, (FAR void *)rwb, ticks);
+  rwb_semgive(&rwb->wrsem);
 }
+#endif
 
 /****************************************************************************
- * Name: rwb_wrcanceltimeout
+ * Name: rwb_wrdoneworker
+ *
+ * Description:
+ *   Runs on the worker thread after any earlier work has completed.  Used
+ *   by rwb_uninitialize() to wait for the flush worker.
+ *
  ****************************************************************************/
 
-static inline void rwb_wrcanceltimeout(struct rwbuffer_s *rwb)
+#ifdef CONFIG_FS_WRITEBUFFER
+static void rwb_wrdoneworker(FAR void *arg)
 {
-  (void)work_cancel(LPWORK, &rwb->work);
+  rwb_semgive((FAR sem_t *)arg);
 }
+#endif
 
 /****************************************************************************
  * Name: rwb_writebuffer
+ *
+ * Description:
+ *   Add the write data to the write buffers.  The caller holds the wrsem.
+ *
  ****************************************************************************/
 
 #ifdef CONFIG_FS_WRITEBUFFER
 static ssize_t rwb_writebuffer(FAR struct rwbuffer_s *rwb,
-                               off_t startblock, uint32_t nblocks,
+                               off_t startblock, size_t nblocks,
                                FAR const uint8_t *wrbuffer)
 {
+  FAR struct rwb_wrbuffer_s *wb;
+  FAR struct rwb_wrbuffer_s *target;
+  FAR struct rwb_wrbuffer_s *empty;
+  bool overlap;
+  bool flushing;
+  bool full;
   int ret;
+  int i;
 
-  /* Write writebuffer Logic */
+  for (;;)
+    {
+      target   = NULL;
+      empty    = NULL;
+      overlap  = false;
+      flushing = false;
+      full     = false;
 
-  rwb_wrcanceltimeout(rwb);
-  
-  /* First: Should we flush out our cache? We would do that if (1) we already
-   * buffering blocks and the next block writing is not in the same sequence,
-   * or (2) the number of blocks would exceed our allocated buffer capacity
-   */
+      for (i = 0; i < CONFIG_FS_NWRBUFFERS; i++)
+        {
+          wb = &rwb->wrbuf[i];
+          switch (wb->state)
+            {
+            case RWB_WRSTATE_EMPTY:
+              if (empty == NULL)
+                {
+                  empty = wb;
+                }
+              break;
+
+            case RWB_WRSTATE_DIRTY:
+              if (RWB_WRFULL(rwb, wb))
+                {
+                  full = true;
+                }
+
+              if (rwb_overlap(wb->blockstart, wb->nblocks,
+                              startblock, nblocks))
+                {
+                  /* Re-writing blocks already in the buffer? */
+
+                  if (startblock >= wb->blockstart &&
+                      startblock + nblocks <= RWB_WREND(wb))
+                    {
+                      target = wb;
+                    }
+                  else
+                    {
+                      overlap = true;
+                    }
+                }
+
+              /* Or continuing the run in the buffer? */
+
+              else if (startblock == RWB_WREND(wb) &&
+                       wb->nblocks + nblocks <= rwb->wrmaxblocks &&
+                       target == NULL)
+                {
+                  target = wb;
+                }
+              break;
+
+            case RWB_WRSTATE_FLUSHING:
+              flushing = true;
+              if (rwb_overlap(wb->blockstart, wb->nblocks,
+                              startblock, nblocks))
+                {
+                  overlap = true;
+                }
+              break;
+            }
+        }
 
-  if (((startblock != rwb->wrexpectedblock) && (rwb->wrnblocks)) ||
-      ((rwb->wrnblocks + nblocks) > rwb->wrmaxblocks))
-    {
-      fvdbg("writebuffer miss, expected: %08x, given: %08x\n",
-            rwb->wrexpectedblock, startblock);
-    
-      /* Flush the write buffer */
+      /* The blocks may not be in more than one buffer.  Get rid of any
+       * partial overlap before buffering the new data.
+       */
 
-      ret = rwb->wrflush(rwb, rwb->wrbuffer, rwb->wrblockstart, rwb->wrnblocks);
-      if (ret < 0)
+      if (overlap)
         {
-          fdbg("ERROR: Error writing multiple from cache: %d\n", -ret);
-          return ret;
+          ret = rwb_wrsync(rwb, startblock, nblocks);
+          if (ret < 0)
+            {
+              return ret;
+            }
+
+          continue;
+        }
+
+      if (target == NULL && empty != NULL)
+        {
+          fvdbg("Fresh buffer starting at block: 0x%08lx\n",
+                (long)startblock);
+
+          target             = empty;
+          target->blockstart = startblock;
+          target->state      = RWB_WRSTATE_DIRTY;
         }
 
-      rwb_resetwrbuffer(rwb);
+      if (target != NULL)
+        {
+          break;
+        }
+
+      /* No buffer is available.  Wait for a flush that is in progress or,
+       * if there is none, write out the full buffers (or all buffers if
+       * none are full) now.
+       */
+
+      if (flushing)
+        {
+          rwb_wrwait(rwb);
+        }
+      else
+        {
+          ret = rwb_wrflushbuffers(rwb, !full);
+          if (ret < 0)
+            {
+              return ret;
+            }
+        }
     }
-  
-  /* writebuffer is empty? Then initialize it */
 
-  if (!rwb->wrnblocks)
+  /* Add data to the buffer */
+
+  memcpy(&target->buffer[(startblock - target->blockstart) * rwb->blocksize],
+         wrbuffer, nblocks * rwb->blocksize);
+
+  if (startblock + nblocks > RWB_WREND(target))
     {
-      fvdbg("Fresh cache starting at block: 0x%08x\n", startblock);
-      rwb->wrblockstart = startblock;
+      target->nblocks = startblock + nblocks - target->blockstart;
     }
-  
-  /* Add data to cache */
 
-  fvdbg("writebuffer: copying %d bytes from %p to %p\n",
-        nblocks * wrb->blocksize, wrbuffer,
-        &rwb->wrbuffer[rwb->wrnblocks * rwb->blocksize]);
-  memcpy(&rwb->wrbuffer[rwb->wrnblocks * rwb->blocksize],
-         wrbuffer, nblocks * rwb->blocksize);
+  /* Write full buffers in the background right away.  Otherwise, flush
+   * the data if no further write activity occurs for a while.
+   */
 
-  rwb->wrnblocks      += nblocks;
-  rwb->wrexpectedblock = rwb->wrblockstart + rwb->wrnblocks;
-  rwb_wrstarttimeout(rwb);
+  rwb->wrlastwrite = clock_systimer();
+  rwb_wrstartwork(rwb, RWB_WRFULL(rwb, target) ? 0 : RWB_WRDELAY);
   return nblocks;
 }
 #endif
@@ -301,51 +720,50 @@ static inline void rwb_resetrhbuffer(struct rwbuffer_s *rwb)
 #endif
 
 /****************************************************************************
- * Name: rwb_bufferread
+ * Name: rwb_rhsync
+ *
+ * Description:
+ *   Before reading from the media, make sure that any buffered write data
+ *   for the blocks has been written.
+ *
  ****************************************************************************/
 
 #ifdef CONFIG_FS_READAHEAD
-static inline void
-rwb_bufferread(struct rwbuffer_s *rwb,  off_t startblock,
-               size_t nblocks, uint8_t **rdbuffer)
+static inline int rwb_rhsync(FAR struct rwbuffer_s *rwb, off_t startblock,
+                             size_t nblocks)
 {
-  /* We assume that (1) the caller holds the readAheadBufferSemphore, and (2)
-   * that the caller already knows that all of the blocks are in the
-   * read-ahead buffer.
-   */
-
-  /* Convert the units from blocks to bytes */
-
-  off_t  blockoffset = startblock - rwb->rhblockstart;
-  off_t  byteoffset  = rwb->blocksize * blockoffset;
-  size_t nbytes      = rwb->blocksize * nblocks;
-
-  /* Get the byte address in the read-ahead buffer */
-
-  uint8_t *rhbuffer    = rwb->rhbuffer + byteoffset;
-
-  /* Copy the data from the read-ahead buffer into the IO buffer */
-
-  memcpy(*rdbuffer, rhbuffer, nbytes);
+#ifdef CONFIG_FS_WRITEBUFFER
+  int ret = OK;
 
-  /* Update the caller's copy for the next address */
+  if (rwb->wrmaxblocks > 0)
+    {
+      rwb_semtake(&rwb->wrsem);
+      ret = rwb_wrsync(rwb, startblock, nblocks);
+      rwb_semgive(&rwb->wrsem);
+    }
 
-  *rdbuffer += nbytes;
+  return ret;
+#else
+  return OK;
+#endif
 }
 #endif
 
 /****************************************************************************
  * Name: rwb_rhreload
+ *
+ * Description:
+ *   Refill the read-ahead buffer with the current read-ahead window of
+ *   blocks beginning at startblock.
+ *
  ****************************************************************************/
 
 #ifdef CONFIG_FS_READAHEAD
 static int rwb_rhreload(struct rwbuffer_s *rwb, off_t startblock)
 {
-  /* Get the block number +1 of the last block that will fit in the
-   * read-ahead buffer
-   */
+  /* Get the block number +1 of the last block to be read */
 
-  off_t  endblock  = startblock + rwb->rhmaxblocks;
+  off_t  endblock  = startblock + rwb->rhwindow;
   size_t nblocks;
   int    ret;
 
@@ -364,7 +782,13 @@ static int rwb_rhreload(struct rwbuffer_s *rwb, off_t startblock)
 
   /* Now perform the read */
 
-  ret = rwb->rhreload(rwb->dev, rwb->rhbuffer, startblock, nblocks);
+  ret = rwb_rhsync(rwb, startblock, nblocks);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  ret = rwb_devreload(rwb, rwb->rhbuffer, startblock, nblocks);
   if (ret == nblocks)
     {
       /* Update information about what is in the read-ahead buffer */
@@ -391,6 +815,9 @@ static int rwb_rhreload(struct rwbuffer_s *rwb, off_t startblock)
 int rwb_initialize(FAR struct rwbuffer_s *rwb)
 {
   uint32_t allocsize;
+#ifdef CONFIG_FS_WRITEBUFFER
+  int i;
+#endif
 
   /* Sanity checking */
 
@@ -411,30 +838,41 @@ int rwb_initialize(FAR struct rwbuffer_s *rwb)
 #endif
 
 #ifdef CONFIG_FS_WRITEBUFFER
-  fvdbg("Initialize the write buffer\n");
+  fvdbg("Initialize the write buffers\n");
 
-  /* Initialize the write buffer access semaphore */
+  /* Initialize the write buffer access semaphores */
 
   sem_init(&rwb->wrsem, 0, 1);
+  sem_init(&rwb->wrdone, 0, 0);
+  sem_init(&rwb->devsem, 0, 1);
+  rwb->wrwaiters   = 0;
+  rwb->wrlastwrite = 0;
+  memset(&rwb->work, 0, sizeof(struct work_s));
+
+  /* Allocate one chunk of memory for all of the write buffers.  The
+   * buffers are laid out contiguously so that a full buffer and the
+   * buffer that follows it can be written with a single transfer.
+   */
 
-  /* Initialize write buffer parameters */
-
-  rwb_resetwrbuffer(rwb);
-
-  /* Allocate the write buffer */
-
-  rwb->wrbuffer = NULL;
+  allocsize = 0;
   if (rwb->wrmaxblocks > 0)
     {
-      allocsize     = rwb->wrmaxblocks * rwb->blocksize;
+      allocsize     = CONFIG_FS_NWRBUFFERS * rwb->wrmaxblocks * rwb->blocksize;
       rwb->wrbuffer = kmalloc(allocsize);
       if (!rwb->wrbuffer)
         {
-          fdbg("Write buffer kmalloc(%d) failed\n", allocsizee);
+          fdbg("Write buffer kmalloc(%d) failed\n", allocsize);
           return -ENOMEM;
         }
     }
-  
+
+  for (i = 0; i < CONFIG_FS_NWRBUFFERS; i++)
+    {
+      rwb->wrbuf[i].buffer = rwb->wrbuffer ?
+        &rwb->wrbuffer[i * rwb->wrmaxblocks * rwb->blocksize] : NULL;
+      rwb_resetwrbuffer(&rwb->wrbuf[i]);
+    }
+
   fvdbg("Write buffer size: %d bytes\n", allocsize);
 #endif /* CONFIG_FS_WRITEBUFFER */
 
@@ -445,13 +883,21 @@ int rwb_initialize(FAR struct rwbuffer_s *rwb)
 
   sem_init(&rwb->rhsem, 0, 1);
 
-  /* Initialize read-ahead buffer parameters */
+  /* Initialize read-ahead buffer parameters.  The read-ahead window starts
+   * small and grows while the access pattern is sequential.
+   */
 
   rwb_resetrhbuffer(rwb);
+  rwb->rhexpected = (off_t)-1;
+  rwb->rhwindow   = CONFIG_FS_RHMINBLOCKS;
+  if (rwb->rhwindow > rwb->rhmaxblocks)
+    {
+      rwb->rhwindow = rwb->rhmaxblocks;
+    }
 
   /* Allocate the read-ahead buffer */
 
-  rwb->rhbuffer = NULL;
+  allocsize = 0;
   if (rwb->rhmaxblocks > 0)
     {
       allocsize     = rwb->rhmaxblocks * rwb->blocksize;
@@ -462,7 +908,7 @@ int rwb_initialize(FAR struct rwbuffer_s *rwb)
           return -ENOMEM;
         }
     }
-  
+
   fvdbg("Read-ahead buffer size: %d bytes\n", allocsize);
 #endif /* CONFIG_FS_READAHEAD */
   return 0;
@@ -470,113 +916,188 @@ int rwb_initialize(FAR struct rwbuffer_s *rwb)
 
 /****************************************************************************
  * Name: rwb_uninitialize
+ *
+ * Description:
+ *   Release the buffers.  Any buffered write data is flushed first and
+ *   the buffers are not freed until any flush in progress on the worker
+ *   thread has completed.
+ *
  ****************************************************************************/
 
 void rwb_uninitialize(FAR struct rwbuffer_s *rwb)
 {
 #ifdef CONFIG_FS_WRITEBUFFER
-  rwb_wrcanceltimeout(rwb);
-  sem_destroy(&rwb->wrsem);
+  struct work_s work;
+  sem_t done;
+
+  /* If there is no write buffer, then the worker has never been started */
+
   if (rwb->wrbuffer)
     {
+      /* Write any buffered data and wait for any flush in progress.  After
+       * that there is nothing dirty and the worker will not re-queue itself.
+       */
+
+      rwb_semtake(&rwb->wrsem);
+      (void)rwb_wrsync(rwb, 0, rwb->nblocks);
+      (void)work_cancel(LPWORK, &rwb->work);
+      rwb_semgive(&rwb->wrsem);
+
+      /* The worker may have been de-queued but still be waiting for the
+       * wrsem.  The work queue runs one item at a time, so that worker has
+       * returned when a no-op work item queued now has run.
+       */
+
+      sem_init(&done, 0, 0);
+      memset(&work, 0, sizeof(struct work_s));
+      if (work_queue(LPWORK, &work, rwb_wrdoneworker, (FAR void *)&done, 0) == OK)
+        {
+          rwb_semtake(&done);
+        }
+
+      sem_destroy(&done);
       kfree(rwb->wrbuffer);
+      rwb->wrbuffer = NULL;
     }
+
+  sem_destroy(&rwb->wrsem);
+  sem_destroy(&rwb->wrdone);
+  sem_destroy(&rwb->devsem);
 #endif
 
 #ifdef CONFIG_FS_READAHEAD
-  sem_destroy(&rwb->rhsem);
   if (rwb->rhbuffer)
     {
+      /* Wait for any read in progress to release the read-ahead buffer */
+
+      rwb_semtake(&rwb->rhsem);
       kfree(rwb->rhbuffer);
+      rwb->rhbuffer = NULL;
+      rwb_semgive(&rwb->rhsem);
     }
+
+  sem_destroy(&rwb->rhsem);
 #endif
 }
 
 /****************************************************************************
  * Name: rwb_read
+ *
+ * Description:
+ *   Read blocks through the read-ahead buffer.  Sequential access is
+ *   detected and the read-ahead window is doubled on each reload (up to
+ *   rhmaxblocks) while it continues; any other access resets the window
+ *   to CONFIG_FS_RHMINBLOCKS.  Requests at least as large as the window
+ *   are read directly into the caller's buffer.
+ *
  ****************************************************************************/
 
-int rwb_read(FAR struct rwbuffer_s *rwb, off_t startblock, uint32_t nblocks,
-             FAR uint8_t *rdbuffer)
+#ifdef CONFIG_FS_READAHEAD
+ssize_t rwb_read(FAR struct rwbuffer_s *rwb, off_t startblock,
+                 size_t nblocks, FAR uint8_t *rdbuffer)
 {
-  uint32_t remaining;
- 
+  size_t remaining;
+  size_t nbufblocks;
+  bool sequential;
+  int ret;
+
   fvdbg("startblock=%ld nblocks=%ld rdbuffer=%p\n",
         (long)startblock, (long)nblocks, rdbuffer);
 
-#ifdef CONFIG_FS_WRITEBUFFER
-  /* If the new read data overlaps any part of the write buffer, then
-   * flush the write data onto the physical media before reading.  We
-   * could attempt some more exotic handling -- but this simple logic
-   * is well-suited for simple streaming applications.
-   */
+  /* Without a read-ahead buffer, just read the data from the media */
 
-  if (rwb->wrmaxblocks > 0)
+  if (rwb->rhmaxblocks == 0)
     {
-      /* If the write buffer overlaps the block(s) requested, then flush the
-       * write buffer.
-       */
+      ret = rwb_rhsync(rwb, startblock, nblocks);
+      if (ret < 0)
+        {
+          return ret;
+        }
 
-      rwb_semtake(&rwb->wrsem);
-      if (rwb_overlap(rwb->wrblockstart, rwb->wrnblocks, startblock, nblocks))
+      return rwb_devreload(rwb, rdbuffer, startblock, nblocks);
+    }
+
+  rwb_semtake(&rwb->rhsem);
+
+  /* Is this read a continuation of the last one? */
+
+  sequential      = (startblock == rwb->rhexpected);
+  rwb->rhexpected = startblock + nblocks;
+
+  if (!sequential)
+    {
+      rwb->rhwindow = CONFIG_FS_RHMINBLOCKS;
+      if (rwb->rhwindow > rwb->rhmaxblocks)
         {
-          rwb_wrflush(rwb);
+          rwb->rhwindow = rwb->rhmaxblocks;
         }
-      rwb_semgive(&rwb->wrsem);
     }
-#endif
 
-#ifdef CONFIG_FS_READAHEAD
   /* Loop until we have read all of the requested blocks */
 
-  rwb_semtake(&rwb->rhsem);
-  for (remaining = nblocks; remaining > 0;)
+  for (remaining = nblocks; remaining > 0; )
     {
-      /* Is there anything in the read-ahead buffer? */
+      /* Is the next block in the read-ahead buffer? */
 
-      if (rwb->rhnblocks > 0)
+      if (rwb->rhnblocks > 0 && startblock >= rwb->rhblockstart &&
+          startblock < rwb->rhblockstart + rwb->rhnblocks)
         {
-          off_t  startblock = startblock;
-          size_t nbufblocks = 0;
-          off_t  bufferend;
+          /* Yes.. copy as many blocks as are available */
 
-          /* Loop for each block we find in the read-head buffer.  Count the
-           * number of buffers that we can read from read-ahead buffer.
-           */
-
-          bufferend = rwb->rhblockstart + rwb->rhnblocks;
-
-          while ((startblock >= rwb->rhblockstart) &&
-                 (startblock < bufferend) &&
-                 (remaining > 0))
+          nbufblocks = rwb->rhblockstart + rwb->rhnblocks - startblock;
+          if (nbufblocks > remaining)
             {
-              /* This is one more that we will read from the read ahead buffer */
-
-              nbufblocks++;
+              nbufblocks = remaining;
+            }
 
-              /* And one less that we will read from the media */
+          memcpy(rdbuffer,
+                 &rwb->rhbuffer[(startblock - rwb->rhblockstart) * rwb->blocksize],
+                 nbufblocks * rwb->blocksize);
 
-              startblock++;
-              remaining--;
-            }
+          rdbuffer   += nbufblocks * rwb->blocksize;
+          startblock += nbufblocks;
+          remaining  -= nbufblocks;
+          continue;
+        }
 
-          /* Then read the data from the read-ahead buffer */
+      /* A miss.  While the access is sequential, open up the window */
 
-          rwb_bufferread(rwb, startblock, nbufblocks, &rdbuffer);
+      if (sequential && rwb->rhwindow < rwb->rhmaxblocks)
+        {
+          rwb->rhwindow = rwb->rhwindow < (rwb->rhmaxblocks >> 1) ?
+                          rwb->rhwindow << 1 : rwb->rhmaxblocks;
         }
 
-      /* If we did not get all of the data from the buffer, then we have to refill
-       * the buffer and try again.
+      /* There is nothing to be gained by copying a large request through
+       * the read-ahead buffer.
        */
 
-      if (remaining > 0)
+      if (remaining >= rwb->rhwindow)
         {
-          int ret = rwb_rhreload(rwb, startblock);
-          if (ret < 0)
+          ret = rwb_rhsync(rwb, startblock, remaining);
+          if (ret >= 0)
             {
-              fdbg("ERROR: Failed to fill the read-ahead buffer: %d\n", -ret);
-              return ret;
+              ret = rwb_devreload(rwb, rdbuffer, startblock, remaining);
+            }
+
+          if (ret != remaining)
+            {
+              fdbg("ERROR: Read failed: %d\n", ret);
+              rwb_semgive(&rwb->rhsem);
+              return ret < 0 ? ret : -EIO;
             }
+
+          break;
+        }
+
+      /* Otherwise, refill the read-ahead buffer and try again. */
+
+      ret = rwb_rhreload(rwb, startblock);
+      if (ret < 0)
+        {
+          fdbg("ERROR: Failed to fill the read-ahead buffer: %d\n", -ret);
+          rwb_semgive(&rwb->rhsem);
+          return ret;
         }
     }
 
@@ -586,73 +1107,97 @@ int rwb_read(FAR struct rwbuffer_s *rwb, off_t startblock, uint32_t nblocks,
    */
 
   rwb_semgive(&rwb->rhsem);
-  return 0;
-#else
-  return rwb->rhreload(rwb->dev, startblock, nblocks, rdbuffer);
-#endif
+  return nblocks;
 }
+#endif
 
 /****************************************************************************
  * Name: rwb_write
  ****************************************************************************/
 
-int rwb_write(FAR struct rwbuffer_s *rwb, off_t startblock,
-              size_t nblocks, FAR const uint8_t *wrbuffer)
+#ifdef CONFIG_FS_WRITEBUFFER
+ssize_t rwb_write(FAR struct rwbuffer_s *rwb, off_t startblock,
+                  size_t nblocks, FAR const uint8_t *wrbuffer)
 {
-  int ret;
+  ssize_t ret;
 
-#ifdef CONFIG_FS_READAHEAD
-  /* If the new write data overlaps any part of the read buffer, then
-   * flush the data from the read buffer.  We could attempt some more
-   * exotic handling -- but this simple logic is well-suited for simple
-   * streaming applications.
-   */
+  fvdbg("startblock=%ld nblocks=%ld wrbuffer=%p\n",
+        (long)startblock, (long)nblocks, wrbuffer);
 
-  rwb_semtake(&rwb->rhsem);
-  if (rwb_overlap(rwb->rhblockstart, rwb->rhnblocks, startblock, nblocks))
-    {
-      rwb_resetrhbuffer(rwb);
-    }
-  rwb_give(&rwb->rhsem);
-#endif
+  rwb_semtake(&rwb->wrsem);
 
-#ifdef CONFIG_FS_WRITEBUFFER
-  fvdbg("startblock=%d wrbuffer=%p\n", startblock, wrbuffer);
+  /* Use the write buffers unless the transfer is bigger than a buffer */
 
-  /* Use the block cache unless the buffer size is bigger than block cache */   
-     
   if (nblocks > rwb->wrmaxblocks)
     {
-      /* First flush the cache */
+      /* First flush any buffered data for these blocks */
 
-      rwb_semtake(&rwb->wrsem);
-      rwb_wrflush(rwb);
-      rwb_semgive(&rwb->wrsem);
+      ret = rwb_wrsync(rwb, startblock, nblocks);
 
       /* Then transfer the data directly to the media */
 
-      ret = rwb->wrflush(rwb->dev, startblock, nblocks, wrbuffer);
+      if (ret >= 0)
+        {
+          ret = rwb_devflush(rwb, wrbuffer, startblock, nblocks);
+        }
     }
   else
     {
-      /* Buffer the data in the write buffer */
+      /* Buffer the data in the write buffers */
 
       ret = rwb_writebuffer(rwb, startblock, nblocks, wrbuffer);
     }
 
+  rwb_semgive(&rwb->wrsem);
+
+#ifdef CONFIG_FS_READAHEAD
+  /* If the new write data overlaps any part of the read buffer, then
+   * discard the data from the read buffer.  This is done after the
+   * new data has been buffered so that a concurrent reload cannot leave
+   * stale data in the read-ahead buffer.
+   */
+
+  if (rwb->rhmaxblocks > 0)
+    {
+      rwb_semtake(&rwb->rhsem);
+      if (rwb_overlap(rwb->rhblockstart, rwb->rhnblocks, startblock, nblocks))
+        {
+          rwb_resetrhbuffer(rwb);
+        }
+
+      rwb_semgive(&rwb->rhsem);
+    }
+#endif
+
   /* On success, return the number of blocks that we were requested to write.
    * This is for compatibility with the normal return of a block driver write
    * method
    */
 
   return ret;
+}
+#endif
 
-#else
+/****************************************************************************
+ * Name: rwb_flush
+ *
+ * Description:
+ *   Write all buffered data to the media and wait for the write to
+ *   complete.
+ *
+ ****************************************************************************/
 
-  return rwb->wrflush(rwb->dev, startblock, nblocks, wrbuffer);
+#ifdef CONFIG_FS_WRITEBUFFER
+int rwb_flush(FAR struct rwbuffer_s *rwb)
+{
+  int ret;
 
-#endif
+  rwb_semtake(&rwb->wrsem);
+  ret = rwb_wrsync(rwb, 0, rwb->nblocks);
+  rwb_semgive(&rwb->wrsem);
+  return ret;
 }
+#endif
 
 /****************************************************************************
  * Name: rwb_mediaremoved
@@ -665,18 +1210,31 @@ int rwb_write(FAR struct rwbuffer_s *rwb, off_t startblock,
 int rwb_mediaremoved(FAR struct rwbuffer_s *rwb)
 {
 #ifdef CONFIG_FS_WRITEBUFFER
+  int i;
+
+  /* Discard all buffered write data.  Buffers that are being flushed on
+   * the worker thread will be released when that write fails.
+   */
+
   rwb_semtake(&rwb->wrsem);
-  rwb_resetwrbuffer(rwb);
+  for (i = 0; i < CONFIG_FS_NWRBUFFERS; i++)
+    {
+      if (rwb->wrbuf[i].state == RWB_WRSTATE_DIRTY)
+        {
+          rwb_resetwrbuffer(&rwb->wrbuf[i]);
+        }
+    }
+
   rwb_semgive(&rwb->wrsem);
 #endif
 
 #ifdef CONFIG_FS_READAHEAD
   rwb_semtake(&rwb->rhsem);
   rwb_resetrhbuffer(rwb);
+  rwb->rhexpected = (off_t)-1;
   rwb_semgive(&rwb->rhsem);
 #endif
   return 0;
 }
 
 #endif /* CONFIG_FS_WRITEBUFFER || CONFIG_FS_READAHEAD */
-
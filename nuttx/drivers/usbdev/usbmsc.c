@@ -1,7 +1,7 @@
 /****************************************************************************
  * drivers/usbdev/usbmsc.c
  *
- *   Copyright (C) 2008-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Mass storage class device.  Bulk-only with SCSI subclass.
@@ -1378,6 +1378,7 @@ int usbmsc_bindlun(FAR void *handle, FAR const char *drvrpath,
   FAR struct usbmsc_lun_s *lun;
   FAR struct inode *inode;
   struct geometry geo;
+  uint32_t iosize;
   int ret;
 
 #ifdef CONFIG_DEBUG
@@ -1453,26 +1454,27 @@ int usbmsc_bindlun(FAR void *handle, FAR const char *drvrpath,
 
   memset(lun, 0, sizeof(struct usbmsc_lun_s *));
 
-  /* Allocate an I/O buffer big enough to hold one hardware sector.  SCSI commands
-   * are processed one at a time so all LUNs may share a single I/O buffer.  The
-   * I/O buffer will be allocated so that is it as large as the largest block
-   * device sector size
+  /* Allocate I/O buffer(s) big enough to hold CONFIG_USBMSC_NIOSECTORS
+   * hardware sectors.  SCSI commands are processed one at a time so all LUNs
+   * may share the same I/O buffers.  The I/O buffers will be allocated so that
+   * they are as large as required by the largest block device sector size.
    */
 
+  iosize = (uint32_t)geo.geo_sectorsize * CONFIG_USBMSC_NIOSECTORS;
   if (!priv->iobuffer)
     {
-      priv->iobuffer = (uint8_t*)kmalloc(geo.geo_sectorsize);
+      priv->iobuffer = (uint8_t*)kmalloc(iosize * USBMSC_NIOBUFFERS);
       if (!priv->iobuffer)
         {
           usbtrace(TRACE_CLSERROR(USBMSC_TRACEERR_ALLOCIOBUFFER), geo.geo_sectorsize);
           return -ENOMEM;
         }
-      priv->iosize = geo.geo_sectorsize;
+      priv->iosize = iosize;
     }
-  else if (priv->iosize < geo.geo_sectorsize)
+  else if (priv->iosize < iosize)
     {
       void *tmp;
-      tmp = (uint8_t*)krealloc(priv->iobuffer, geo.geo_sectorsize);
+      tmp = (uint8_t*)krealloc(priv->iobuffer, iosize * USBMSC_NIOBUFFERS);
       if (!tmp)
         {
           usbtrace(TRACE_CLSERROR(USBMSC_TRACEERR_REALLOCIOBUFFER), geo.geo_sectorsize);
@@ -1480,9 +1482,21 @@ int usbmsc_bindlun(FAR void *handle, FAR const char *drvrpath,
         }
 
       priv->iobuffer = (uint8_t*)tmp;
-      priv->iosize   = geo.geo_sectorsize;
+      priv->iosize   = iosize;
     }
 
+#ifdef CONFIG_USBMSC_DBLBUFFER
+  /* The layout of the I/O buffers may have changed; discard any sectors that
+   * were read in advance.
+   */
+
+  priv->ioidx      = 0;
+  priv->ransectors = 0;
+#ifdef CONFIG_USBMSC_READAHEAD
+  priv->rapending  = 0;
+#endif
+#endif
+
   lun->inode       = inode;
   lun->startsector = startsector;
   lun->nsectors    = nsectors;
@@ -1559,6 +1573,18 @@ int usbmsc_unbindlun(FAR void *handle, unsigned int lunno)
 
      usbmsc_lununinitialize(lun);
      ret = OK;
+
+#ifdef CONFIG_USBMSC_DBLBUFFER
+     /* Discard any sectors that were read from this LUN in advance */
+
+     if (priv->ralun == lun)
+       {
+         priv->ransectors = 0;
+#ifdef CONFIG_USBMSC_READAHEAD
+         priv->rapending  = 0;
+#endif
+       }
+#endif
    }
 
   pthread_mutex_unlock(&priv->mutex);
@@ -1776,3 +1802,52 @@ void usbmsc_uninitialize(FAR void *handle)
 
   kfree(priv);
 }
+
+/****************************************************************************
+ * Name: usbmsc_getstats
+ *
+ * Description:
+ *   Return the command statistics collected by the USB storage class driver
+ *
+ * Input Parameters:
+ *   handle - The handle returned by a previous call to usbmsc_configure().
+ *   stats  - The location to return the statistics.
+ *   reset  - True: Reset the statistics after they are sampled.
+ *
+ * Returned Value:
+ *   0 on success; a negated errno on failure
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_USBMSC_STATS
+int usbmsc_getstats(FAR void *handle, FAR struct usbmsc_stats_s *stats,
+                    bool reset)
+{
+  FAR struct usbmsc_alloc_s *alloc = (FAR struct usbmsc_alloc_s *)handle;
+  FAR struct usbmsc_dev_s *priv;
+  irqstate_t flags;
+
+#ifdef CONFIG_DEBUG
+  if (!alloc || !stats)
+    {
+      return -EINVAL;
+    }
+#endif
+
+  priv = &alloc->dev;
+
+  /* The statistics are updated by the worker thread with interrupts
+   * disabled.
+   */
+
+  flags = irqsave();
+  memcpy(stats, &priv->stats, sizeof(struct usbmsc_stats_s));
+  if (reset)
+    {
+      memset(&priv->stats, 0, sizeof(struct usbmsc_stats_s));
+    }
+
+  irqrestore(flags);
+  return OK;
+}
+#endif
@@ -1,7 +1,7 @@
 /****************************************************************************
  * drivers/usbdev/usbmsc.h
  *
- *   Copyright (C) 2008-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Mass storage class device.  Bulk-only with SCSI subclass.
@@ -53,6 +53,7 @@
 #include <nuttx/fs/fs.h>
 #include <nuttx/usb/storage.h>
 #include <nuttx/usb/usbdev.h>
+#include <nuttx/usb/usbmsc.h>
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -96,6 +97,28 @@
 #  define CONFIG_USBMSC_NRDREQS 4
 #endif
 
+/* Size of each I/O buffer in sectors and the number of I/O buffers.  Read-ahead
+ * requires the second I/O buffer.
+ */
+
+#ifndef CONFIG_USBMSC_NIOSECTORS
+#  define CONFIG_USBMSC_NIOSECTORS 1
+#endif
+
+#if CONFIG_USBMSC_NIOSECTORS < 1
+#  error "CONFIG_USBMSC_NIOSECTORS must be at least one"
+#endif
+
+#ifndef CONFIG_USBMSC_DBLBUFFER
+#  undef CONFIG_USBMSC_READAHEAD
+#endif
+
+#ifdef CONFIG_USBMSC_DBLBUFFER
+#  define USBMSC_NIOBUFFERS 2
+#else
+#  define USBMSC_NIOBUFFERS 1
+#endif
+
 /* Logical endpoint numbers / max packet sizes */
 
 #ifndef CONFIG_USBMSC_EPBULKOUT
@@ -394,6 +417,16 @@
 #define USBMSC_DRVR_WRITE(l,b,s,n) ((l)->inode->u.i_bops->write((l)->inode,b,s,n))
 #define USBMSC_DRVR_GEOMETRY(l,g) ((l)->inode->u.i_bops->geometry((l)->inode,g))
 
+/* I/O buffer helpers *******************************************************/
+
+/* Address of I/O buffer n (0..USBMSC_NIOBUFFERS-1) */
+
+#define USBMSC_IOBUFFER(p,n)  (&(p)->iobuffer[(n) * (p)->iosize])
+
+/* Number of sectors of LUN l that fit into one I/O buffer */
+
+#define USBMSC_IOSECTORS(p,l) ((p)->iosize / (l)->sectorsize)
+
 /* Everpresent MIN/MAX macros ***********************************************/
 
 #ifndef MIN
@@ -479,9 +512,10 @@ struct usbmsc_dev_s
   uint8_t           cbwdir:2;         /* Direction from CBW. See USBMSC_FLAGS_DIR* definitions */
   uint8_t           cdblen;           /* Length of cdb[] from CBW */
   uint8_t           cbwlun;           /* LUN from the CBW */
-  uint16_t          nsectbytes;       /* Bytes buffered in iobuffer[] */
   uint16_t          nreqbytes;        /* Bytes buffered in head write requests */
-  uint16_t          iosize;           /* Size of iobuffer[] */
+  uint32_t          nsectbytes;       /* Bytes buffered in the current I/O buffer */
+  uint32_t          iolen;            /* Bytes read into the current I/O buffer */
+  uint32_t          iosize;           /* Size of one I/O buffer */
   uint32_t          cbwlen;           /* Length of data from CBW */
   uint32_t          cbwtag;           /* Tag from the CBW */
   union
@@ -491,7 +525,29 @@ struct usbmsc_dev_s
     } u;
   uint32_t          sector;           /* Current sector (relative to lun->startsector) */
   uint32_t          residue;          /* Untransferred amount reported in the CSW */
-  uint8_t          *iobuffer;         /* Buffer for data transfers */
+  uint8_t          *iobuffer;         /* Buffer(s) for data transfers */
+
+#ifdef CONFIG_USBMSC_DBLBUFFER
+  /* Double buffering.  The sectors in the second (alternate) I/O buffer were
+   * read in advance and are valid only while ransectors is non-zero.
+   */
+
+  uint8_t           ioidx;            /* Index of the current I/O buffer */
+#ifdef CONFIG_USBMSC_READAHEAD
+  uint8_t           rapending:1;      /* Sequential read-ahead should be started */
+#endif
+  FAR struct usbmsc_lun_s *ralun;     /* LUN of the data in the alternate buffer */
+  uint32_t          rasector;         /* First sector in the alternate buffer */
+  uint32_t          ransectors;       /* Number of sectors in the alternate buffer */
+#endif
+
+#ifdef CONFIG_USBMSC_STATS
+  /* Command statistics */
+
+  uint32_t          cmdstart;         /* Time that the current CBW was received */
+  uint32_t          cmdsectors;       /* Sectors transferred by the current command */
+  struct usbmsc_stats_s stats;        /* Accumulated statistics */
+#endif
 
   /* Write request list */
 
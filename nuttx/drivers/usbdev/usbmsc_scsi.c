@@ -1,7 +1,7 @@
 /****************************************************************************
  * drivers/usbdev/usbmsc_scsi.c
  *
- *   Copyright (C) 2008-2010, 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2010, 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Mass storage class device.  Bulk-only with SCSI subclass.
@@ -68,6 +68,7 @@
 #include <debug.h>
 
 #include <nuttx/arch.h>
+#include <nuttx/clock.h>
 #include <nuttx/scsi.h>
 #include <nuttx/usb/storage.h>
 #include <nuttx/usb/usbdev.h>
@@ -127,6 +128,18 @@ static void     usbmsc_putle16(uint8_t * buf, uint16_t val);
 #endif
 static void     usbmsc_putle32(uint8_t *buf, uint32_t val);
 
+/* Block Driver Access ******************************************************/
+
+#ifdef CONFIG_USBMSC_DBLBUFFER
+static void     usbmsc_prefetch(FAR struct usbmsc_dev_s *priv,
+                  FAR struct usbmsc_lun_s *lun, uint32_t sector,
+                  uint32_t nsectors);
+static inline void usbmsc_discard(FAR struct usbmsc_dev_s *priv);
+#endif
+#ifdef CONFIG_USBMSC_STATS
+static void     usbmsc_cmdstats(FAR struct usbmsc_dev_s *priv);
+#endif
+
 /* SCSI Command Processing **************************************************/
 
 static inline int usbmsc_cmdtestunitready(FAR struct usbmsc_dev_s *priv);
@@ -164,6 +177,8 @@ static inline int usbmsc_setupcmd(FAR struct usbmsc_dev_s *priv,
 static int    usbmsc_idlestate(FAR struct usbmsc_dev_s *priv);
 static int    usbmsc_cmdparsestate(FAR struct usbmsc_dev_s *priv);
 static int    usbmsc_cmdreadstate(FAR struct usbmsc_dev_s *priv);
+static void   usbmsc_rdresubmit(FAR struct usbmsc_dev_s *priv,
+                FAR struct usbmsc_req_s *privreq);
 static int    usbmsc_cmdwritestate(FAR struct usbmsc_dev_s *priv);
 static int    usbmsc_cmdfinishstate(FAR struct usbmsc_dev_s *priv);
 static int    usbmsc_cmdstatusstate(FAR struct usbmsc_dev_s *priv);
@@ -340,6 +355,119 @@ static void usbmsc_putle32(uint8_t *buf, uint32_t val)
   buf[3] = val >> 24;
 }
 
+/****************************************************************************
+ * Block Driver Access
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: usbmsc_prefetch
+ *
+ * Description:
+ *   Read sectors into the alternate I/O buffer in advance of their use.  This
+ *   is done when the worker thread would otherwise have to wait for the USB
+ *   controller.  On failure, the alternate buffer is simply left empty; the
+ *   error will be reported when the sectors are actually needed.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_USBMSC_DBLBUFFER
+static void usbmsc_prefetch(FAR struct usbmsc_dev_s *priv,
+                            FAR struct usbmsc_lun_s *lun, uint32_t sector,
+                            uint32_t nsectors)
+{
+  ssize_t nread;
+
+  nread = USBMSC_DRVR_READ(lun, USBMSC_IOBUFFER(priv, priv->ioidx ^ 1),
+                           sector, nsectors);
+  if (nread > 0)
+    {
+      usbtrace(TRACE_CLASSSTATE(USBMSC_CLASSSTATE_READAHEAD), nread);
+      priv->ralun      = lun;
+      priv->rasector   = sector;
+      priv->ransectors = nread;
+    }
+
+#ifdef CONFIG_USBMSC_STATS
+  priv->stats.ioread++;
+  if (nread > 0)
+    {
+      priv->stats.prefetched += nread;
+    }
+#endif
+}
+#endif
+
+/****************************************************************************
+ * Name: usbmsc_discard
+ *
+ * Description:
+ *   Discard any sectors that were read in advance (because they may no
+ *   longer match the media).
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_USBMSC_DBLBUFFER
+static inline void usbmsc_discard(FAR struct usbmsc_dev_s *priv)
+{
+  priv->ransectors = 0;
+#ifdef CONFIG_USBMSC_READAHEAD
+  priv->rapending  = 0;
+#endif
+}
+#endif
+
+/****************************************************************************
+ * Name: usbmsc_cmdstats
+ *
+ * Description:
+ *   Account for the command that has just completed.  Called when the CSW
+ *   has been queued.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_USBMSC_STATS
+static void usbmsc_cmdstats(FAR struct usbmsc_dev_s *priv)
+{
+  FAR struct usbmsc_cmdstats_s *cmdstats;
+  irqstate_t flags;
+  uint32_t elapsed;
+
+  elapsed = clock_systimer() - priv->cmdstart;
+  usbtrace(TRACE_CLASSSTATE(USBMSC_CLASSSTATE_CMDLATENCY), (uint16_t)MIN(elapsed, 0xffff));
+
+  switch (priv->cdb[0])
+    {
+    case SCSI_CMD_READ6:
+    case SCSI_CMD_READ10:
+    case SCSI_CMD_READ12:
+      cmdstats = &priv->stats.read;
+      break;
+
+    case SCSI_CMD_WRITE6:
+    case SCSI_CMD_WRITE10:
+    case SCSI_CMD_WRITE12:
+      cmdstats = &priv->stats.write;
+      break;
+
+    default:
+      cmdstats = &priv->stats.other;
+      break;
+    }
+
+  /* usbmsc_getstats() may sample the statistics from another thread */
+
+  flags = irqsave();
+  cmdstats->ncmds++;
+  cmdstats->nsectors   += priv->cmdsectors;
+  cmdstats->totalticks += elapsed;
+  if (elapsed > cmdstats->maxticks)
+    {
+      cmdstats->maxticks = elapsed;
+    }
+  irqrestore(flags);
+}
+#endif
+
 /****************************************************************************
  * SCSI Worker Thread
  ****************************************************************************/
@@ -1048,10 +1176,12 @@ static inline int usbmsc_cmdverify10(FAR struct usbmsc_dev_s *priv)
 {
   FAR struct scsicmd_verify10_s *verf = (FAR struct scsicmd_verify10_s *)priv->cdb;
   FAR struct usbmsc_lun_s *lun = priv->lun;
+  FAR uint8_t *iobuffer;
   uint32_t  lba;
   uint16_t  blocks;
   size_t  sector;
   ssize_t nread;
+  int     nsectors;
   int     ret;
   int     i;
 
@@ -1095,11 +1225,21 @@ static inline int usbmsc_cmdverify10(FAR struct usbmsc_dev_s *priv)
         }
       else
         {
-          /* Try to read the requested blocks */
+          /* Try to read the requested blocks, as many at a time as will fit
+           * into the current I/O buffer (the alternate I/O buffer may hold
+           * sectors that were read in advance).
+           */
 
-          for (i = 0, sector = lba + lun->startsector; i < blocks; i++, sector++)
+#ifdef CONFIG_USBMSC_DBLBUFFER
+          iobuffer = USBMSC_IOBUFFER(priv, priv->ioidx);
+#else
+          iobuffer = priv->iobuffer;
+#endif
+
+          for (i = 0, sector = lba + lun->startsector; i < blocks; i += nsectors, sector += nsectors)
             {
-              nread = USBMSC_DRVR_READ(lun, priv->iobuffer, sector, 1);
+              nsectors = MIN(blocks - i, USBMSC_IOSECTORS(priv, lun));
+              nread    = USBMSC_DRVR_READ(lun, iobuffer, sector, nsectors);
               if (nread < 0)
                 {
                   usbtrace(TRACE_CLSERROR(USBMSC_TRACEERR_VERIFY10READFAIL), i);
@@ -1548,12 +1688,43 @@ static int usbmsc_idlestate(FAR struct usbmsc_dev_s *priv)
   if (!privreq)
     {
       usbtrace(TRACE_CLSERROR(USBMSC_TRACEERR_IDLERDREQLISTEMPTY), 0);
+
+#ifdef CONFIG_USBMSC_READAHEAD
+      /* The last command was a read that ended where the data in the
+       * alternate I/O buffer would begin.  Read ahead while the host
+       * prepares the next CBW.  If the next command reads sequentially,
+       * its first block driver access has then already been done.
+       */
+
+      if (priv->rapending)
+        {
+          FAR struct usbmsc_lun_s *lun = priv->ralun;
+
+          priv->rapending = 0;
+          pthread_mutex_lock(&priv->mutex);
+          if (lun->inode && priv->ransectors == 0 && priv->rasector < lun->nsectors)
+            {
+              usbmsc_prefetch(priv, lun, priv->rasector,
+                              MIN(lun->nsectors - priv->rasector,
+                                  USBMSC_IOSECTORS(priv, lun)));
+            }
+
+          pthread_mutex_unlock(&priv->mutex);
+        }
+#endif
       return -ENOMEM;
     }
 
   req = privreq->req;
   cbw = (FAR struct usbmsc_cbw_s *)req->buf;
 
+#ifdef CONFIG_USBMSC_STATS
+  /* Command latency is measured from the receipt of the CBW */
+
+  priv->cmdstart   = clock_systimer();
+  priv->cmdsectors = 0;
+#endif
+
   /* Handle the CBW */
 
   usbmsc_dumpdata("SCSCI CBW", (uint8_t*)cbw, USBMSC_CBW_SIZEOF - USBMSC_MAXCDBLEN);
@@ -1986,10 +2157,14 @@ static int usbmsc_cmdparsestate(FAR struct usbmsc_dev_s *priv)
  * State variables:
  *   xfrlen     - holds the number of sectors read to be read.
  *   sector     - holds the sector number of the next sector to be read
- *   nsectbytes - holds the number of bytes buffered for the current sector
+ *   nsectbytes - holds the number of bytes remaining in the current I/O buffer
+ *   iolen      - holds the number of bytes read into the current I/O buffer
  *   nreqbytes  - holds the number of bytes currently buffered in the request
  *                at the head of the wrreqlist.
  *
+ *   With CONFIG_USBMSC_DBLBUFFER, the alternate I/O buffer may also hold
+ *   ransectors sectors beginning at rasector that were read in advance.
+ *
  ****************************************************************************/
 
 static int usbmsc_cmdreadstate(FAR struct usbmsc_dev_s *priv)
@@ -1997,8 +2172,10 @@ static int usbmsc_cmdreadstate(FAR struct usbmsc_dev_s *priv)
   FAR struct usbmsc_lun_s *lun = priv->lun;
   FAR struct usbmsc_req_s *privreq;
   FAR struct usbdev_req_s *req;
+  FAR uint8_t *iobuffer;
   irqstate_t flags;
   ssize_t nread;
+  uint32_t nsectors;
   uint8_t *src;
   uint8_t *dest;
   int nbytes;
@@ -2017,20 +2194,64 @@ static int usbmsc_cmdreadstate(FAR struct usbmsc_dev_s *priv)
 
       if (priv->nsectbytes <= 0)
         {
-          /* Yes.. read the next sector */
+          /* Yes.. get the next sectors, as many as will fit into the I/O
+           * buffer.
+           */
+
+          nsectors = MIN(priv->u.xfrlen, USBMSC_IOSECTORS(priv, lun));
+
+#ifdef CONFIG_USBMSC_DBLBUFFER
+          /* Were these sectors already read into the alternate I/O buffer?
+           * If so, just switch buffers.
+           */
 
-          nread = USBMSC_DRVR_READ(lun, priv->iobuffer, priv->sector, 1);
-          if (nread < 0)
+          if (priv->ransectors > 0 && priv->ralun == lun &&
+              priv->rasector == priv->sector)
             {
-              usbtrace(TRACE_CLSERROR(USBMSC_TRACEERR_CMDREADREADFAIL), -nread);
-              lun->sd     = SCSI_KCQME_UNRRE1;
-              lun->sdinfo = priv->sector;
-              break;
+              nsectors         = MIN(nsectors, priv->ransectors);
+              priv->ioidx     ^= 1;
+              priv->ransectors = 0;
+
+              usbtrace(TRACE_CLASSSTATE(USBMSC_CLASSSTATE_READAHEADHIT), nsectors);
+#ifdef CONFIG_USBMSC_STATS
+              priv->stats.prefetchhits += nsectors;
+#endif
+            }
+          else
+#endif
+            {
+#ifdef CONFIG_USBMSC_DBLBUFFER
+              /* Anything in the alternate I/O buffer is not what the host
+               * is reading now.  Discard it so that it can be re-used.
+               */
+
+              priv->ransectors = 0;
+              iobuffer = USBMSC_IOBUFFER(priv, priv->ioidx);
+#else
+              iobuffer = priv->iobuffer;
+#endif
+              nread = USBMSC_DRVR_READ(lun, iobuffer, priv->sector, nsectors);
+#ifdef CONFIG_USBMSC_STATS
+              priv->stats.ioread++;
+#endif
+              if (nread <= 0)
+                {
+                  usbtrace(TRACE_CLSERROR(USBMSC_TRACEERR_CMDREADREADFAIL), -nread);
+                  lun->sd     = SCSI_KCQME_UNRRE1;
+                  lun->sdinfo = priv->sector;
+                  break;
+                }
+
+              nsectors = nread;
             }
 
-          priv->nsectbytes = lun->sectorsize;
-          priv->u.xfrlen--;
-          priv->sector++;
+          priv->iolen      = nsectors * lun->sectorsize;
+          priv->nsectbytes = priv->iolen;
+          priv->u.xfrlen  -= nsectors;
+          priv->sector    += nsectors;
+#ifdef CONFIG_USBMSC_STATS
+          priv->cmdsectors += nsectors;
+#endif
         }
 
       /* Check if there is a request in the wrreqlist that we will be able to
@@ -2039,6 +2260,22 @@ static int usbmsc_cmdreadstate(FAR struct usbmsc_dev_s *priv)
 
       privreq = (FAR struct usbmsc_req_s *)sq_peek(&priv->wrreqlist);
 
+#ifdef CONFIG_USBMSC_DBLBUFFER
+      /* If all of the write requests are in flight, then the worker thread
+       * would have to wait for the USB controller anyway.  Use that time to
+       * read the next sectors of the command into the alternate I/O buffer.
+       * A request may well have been returned by the time that completes.
+       */
+
+      if (!privreq && priv->u.xfrlen > 0 && priv->ransectors == 0)
+        {
+          usbmsc_prefetch(priv, lun, priv->sector,
+                          MIN(priv->u.xfrlen, USBMSC_IOSECTORS(priv, lun)));
+
+          privreq = (FAR struct usbmsc_req_s *)sq_peek(&priv->wrreqlist);
+        }
+#endif
+
       /* If there no request structures available, then just return an error.
        * This will cause us to remain in the CMDREAD state.  When a request is
        * returned, the worker thread will be awakened in the USBMSC_STATE_CMDREAD
@@ -2057,7 +2294,12 @@ static int usbmsc_cmdreadstate(FAR struct usbmsc_dev_s *priv)
        * all of the data available in the sector buffer.
        */
 
-      src    = &priv->iobuffer[lun->sectorsize - priv->nsectbytes];
+#ifdef CONFIG_USBMSC_DBLBUFFER
+      iobuffer = USBMSC_IOBUFFER(priv, priv->ioidx);
+#else
+      iobuffer = priv->iobuffer;
+#endif
+      src    = &iobuffer[priv->iolen - priv->nsectbytes];
       dest   = &req->buf[priv->nreqbytes];
 
       nbytes = MIN(CONFIG_USBMSC_BULKINREQLEN - priv->nreqbytes, priv->nsectbytes);
@@ -2108,11 +2350,50 @@ static int usbmsc_cmdreadstate(FAR struct usbmsc_dev_s *priv)
         }
     }
 
+#ifdef CONFIG_USBMSC_READAHEAD
+  /* If the command completed normally, the host may well continue reading
+   * sequentially.  Request a read-ahead when we next become idle.
+   */
+
+  if (priv->u.xfrlen == 0 && priv->nsectbytes == 0 && priv->ransectors == 0)
+    {
+      priv->ralun     = lun;
+      priv->rasector  = priv->sector;
+      priv->rapending = 1;
+    }
+#endif
+
   usbtrace(TRACE_CLASSSTATE(USBMSC_CLASSSTATE_CMDREADCMDFINISH), priv->u.xfrlen);
   priv->thstate  = USBMSC_STATE_CMDFINISH;
   return OK;
 }
 
+/****************************************************************************
+ * Name: usbmsc_rdresubmit
+ *
+ * Description:
+ *   Return a read request whose data has been consumed to the bulk OUT
+ *   endpoint to be re-filled.
+ *
+ ****************************************************************************/
+
+static void usbmsc_rdresubmit(FAR struct usbmsc_dev_s *priv,
+                              FAR struct usbmsc_req_s *privreq)
+{
+  FAR struct usbdev_req_s *req = privreq->req;
+  int ret;
+
+  req->len      = CONFIG_USBMSC_BULKOUTREQLEN;
+  req->priv     = privreq;
+  req->callback = usbmsc_rdcomplete;
+
+  ret = EP_SUBMIT(priv->epbulkout, req);
+  if (ret != OK)
+    {
+      usbtrace(TRACE_CLSERROR(USBMSC_TRACEERR_CMDWRITERDSUBMIT), (uint16_t)-ret);
+    }
+}
+
 /****************************************************************************
  * Name: usbmsc_cmdwritestate
  *
@@ -2132,10 +2413,15 @@ static int usbmsc_cmdreadstate(FAR struct usbmsc_dev_s *priv)
  * State variables:
  *   xfrlen     - holds the number of sectors read to be written.
  *   sector     - holds the sector number of the next sector to write
- *   nsectbytes - holds the number of bytes buffered for the current sector
+ *   nsectbytes - holds the number of bytes buffered in the I/O buffer
  *   nreqbytes  - holds the number of untransferred bytes currently in the
  *                request at the head of the rdreqlist.
  *
+ *   Data is accumulated in the I/O buffer until either the I/O buffer is
+ *   full or all of the remaining sectors of the command have been received,
+ *   then all of the buffered sectors are written in one block driver
+ *   access.
+ *
  ****************************************************************************/
 
 static int usbmsc_cmdwritestate(FAR struct usbmsc_dev_s *priv)
@@ -2143,12 +2429,23 @@ static int usbmsc_cmdwritestate(FAR struct usbmsc_dev_s *priv)
   FAR struct usbmsc_lun_s *lun = priv->lun;
   FAR struct usbmsc_req_s *privreq;
   FAR struct usbdev_req_s *req;
+  FAR uint8_t *iobuffer;
   ssize_t nwritten;
+  uint32_t nsectors;
+  uint32_t iolen;
   uint16_t xfrd;
   uint8_t *src;
   uint8_t *dest;
   int nbytes;
-  int ret;
+
+#ifdef CONFIG_USBMSC_DBLBUFFER
+  /* Sectors that were read in advance may be stale after the write */
+
+  usbmsc_discard(priv);
+  iobuffer = USBMSC_IOBUFFER(priv, priv->ioidx);
+#else
+  iobuffer = priv->iobuffer;
+#endif
 
   /* Loop transferring data until either (1) all of the data has been
    * transferred, or (2) we have written all of the data in the available
@@ -2190,10 +2487,13 @@ static int usbmsc_cmdwritestate(FAR struct usbmsc_dev_s *priv)
         {
           /* Copy the data received in the read request into the sector I/O buffer */
 
+          nsectors = MIN(priv->u.xfrlen, USBMSC_IOSECTORS(priv, lun));
+          iolen    = nsectors * lun->sectorsize;
+
           src  = &req->buf[xfrd - priv->nreqbytes];
-          dest = &priv->iobuffer[priv->nsectbytes];
+          dest = &iobuffer[priv->nsectbytes];
 
-          nbytes = MIN(lun->sectorsize - priv->nsectbytes, priv->nreqbytes);
+          nbytes = MIN(iolen - priv->nsectbytes, priv->nreqbytes);
 
           /* Copy the data from the sector buffer to the USB request and update counts */
 
@@ -2203,12 +2503,26 @@ static int usbmsc_cmdwritestate(FAR struct usbmsc_dev_s *priv)
 
           /* Is the I/O buffer full? */
 
-          if (priv->nsectbytes >= lun->sectorsize)
+          if (priv->nsectbytes >= iolen)
             {
-              /* Yes.. Write the next sector */
+              /* Yes.. If all of the data in the read request has been
+               * consumed, return the request to the endpoint now so that
+               * the host can send more data while we write.
+               */
 
-              nwritten = USBMSC_DRVR_WRITE(lun, priv->iobuffer, priv->sector, 1);
-              if (nwritten < 0)
+              if (priv->nreqbytes == 0 && privreq)
+                {
+                  usbmsc_rdresubmit(priv, privreq);
+                  privreq = NULL;
+                }
+
+              /* Write the buffered sectors */
+
+              nwritten = USBMSC_DRVR_WRITE(lun, iobuffer, priv->sector, nsectors);
+#ifdef CONFIG_USBMSC_STATS
+              priv->stats.iowrite++;
+#endif
+              if (nwritten < (ssize_t)nsectors)
                 {
                   usbtrace(TRACE_CLSERROR(USBMSC_TRACEERR_CMDWRITEWRITEFAIL), -nwritten);
                   lun->sd     = SCSI_KCQME_WRITEFAULTAUTOREALLOCFAILED;
@@ -2217,25 +2531,23 @@ static int usbmsc_cmdwritestate(FAR struct usbmsc_dev_s *priv)
                 }
 
               priv->nsectbytes = 0;
-              priv->residue   -= lun->sectorsize;
-              priv->u.xfrlen--;
-              priv->sector++;
+              priv->residue   -= iolen;
+              priv->u.xfrlen  -= nsectors;
+              priv->sector    += nsectors;
+#ifdef CONFIG_USBMSC_STATS
+              priv->cmdsectors += nsectors;
+#endif
             }
         }
 
       /* In either case, we are finished with this read request and can return it
-       * to the endpoint.  Then we will go back to the top of the top and attempt
-       * to get the next read request.
+       * to the endpoint (if that was not already done).  Then we will go back to
+       * the top of the top and attempt to get the next read request.
        */
 
-      req->len      = CONFIG_USBMSC_BULKOUTREQLEN;
-      req->priv     = privreq;
-      req->callback = usbmsc_rdcomplete;
-
-      ret = EP_SUBMIT(priv->epbulkout, req);
-      if (ret != OK)
+      if (privreq)
         {
-          usbtrace(TRACE_CLSERROR(USBMSC_TRACEERR_CMDWRITERDSUBMIT), (uint16_t)-ret);
+          usbmsc_rdresubmit(priv, privreq);
         }
 
       /* Did the host decide to stop early? */
@@ -2243,6 +2555,32 @@ static int usbmsc_cmdwritestate(FAR struct usbmsc_dev_s *priv)
       if (xfrd != CONFIG_USBMSC_BULKOUTREQLEN)
         {
           priv->shortpacket = 1;
+
+          /* Write any complete sectors that are still buffered */
+
+          nsectors = priv->nsectbytes / lun->sectorsize;
+          if (nsectors > 0)
+            {
+              nwritten = USBMSC_DRVR_WRITE(lun, iobuffer, priv->sector, nsectors);
+#ifdef CONFIG_USBMSC_STATS
+              priv->stats.iowrite++;
+#endif
+              if (nwritten < (ssize_t)nsectors)
+                {
+                  usbtrace(TRACE_CLSERROR(USBMSC_TRACEERR_CMDWRITEWRITEFAIL), -nwritten);
+                  lun->sd     = SCSI_KCQME_WRITEFAULTAUTOREALLOCFAILED;
+                  lun->sdinfo = priv->sector;
+                  goto errout;
+                }
+
+              priv->residue   -= nsectors * lun->sectorsize;
+              priv->u.xfrlen  -= nsectors;
+              priv->sector    += nsectors;
+#ifdef CONFIG_USBMSC_STATS
+              priv->cmdsectors += nsectors;
+#endif
+            }
+
           goto errout;
         }
     }
@@ -2495,6 +2833,10 @@ static int usbmsc_cmdstatusstate(FAR struct usbmsc_dev_s *priv)
       irqrestore(flags);
     }
 
+#ifdef CONFIG_USBMSC_STATS
+  usbmsc_cmdstats(priv);
+#endif
+
   /* Return to the IDLE state */
 
   usbtrace(TRACE_CLASSSTATE(USBMSC_CLASSSTATE_CMDSTATUSIDLE), 0);
@@ -2616,6 +2958,12 @@ void *usbmsc_workerthread(void *arg)
           /* For all of these events... terminate any transactions in progress */
 
           priv->thstate = USBMSC_STATE_IDLE;
+
+#ifdef CONFIG_USBMSC_DBLBUFFER
+          /* And forget any sectors that were read in advance */
+
+          usbmsc_discard(priv);
+#endif
         }
       irqrestore(flags);
 
@@ -39,6 +39,7 @@
 
 #include <nuttx/config.h>
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 #include <semaphore.h>
@@ -49,6 +50,8 @@
 #include <nuttx/fs/fs.h>
 #include <nuttx/net/net.h>
 
+#include "fs_internal.h"
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -107,6 +110,32 @@ static inline int fs_checkfd(FAR struct tcb_s *tcb, int fd, int oflags)
 }
 #endif
 
+/****************************************************************************
+ * Name: fs_ischardev
+ *
+ * Description:
+ *   Return true if the file descriptor refers to a character driver (such
+ *   as a serial console) rather than to a file in a mounted file system,
+ *   a block driver or a socket.
+ *
+ ****************************************************************************/
+
+#if CONFIG_NFILE_DESCRIPTORS > 0 && CONFIG_STDIO_BUFFER_SIZE > 0 && \
+    defined(CONFIG_STDIO_LINEBUFFER)
+static inline bool fs_ischardev(FAR struct tcb_s *tcb, int fd)
+{
+  FAR struct inode *inode;
+
+  if ((unsigned int)fd >= CONFIG_NFILE_DESCRIPTORS)
+    {
+      return false;
+    }
+
+  inode = tcb->group->tg_filelist.fl_files[fd].f_inode;
+  return inode != NULL && INODE_IS_DRIVER(inode);
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -238,8 +267,20 @@ FAR struct file_struct *fs_fdopen(int fd, int oflags, FAR struct tcb_s *tcb)
 
           stream->fs_bufend  = &stream->fs_bufstart[CONFIG_STDIO_BUFFER_SIZE];
           stream->fs_bufpos  = stream->fs_bufstart;
-          stream->fs_bufpos  = stream->fs_bufstart;
           stream->fs_bufread = stream->fs_bufstart;
+
+#if defined(CONFIG_STDIO_LINEBUFFER) && CONFIG_NFILE_DESCRIPTORS > 0
+          /* Text streams on character devices (the console, serial
+           * ports, ...) are line buffered by default.  Regular files stay
+           * fully buffered and newlines have no special meaning for
+           * streams opened in binary mode.
+           */
+
+          if ((oflags & O_BINARY) == 0 && fs_ischardev(tcb, fd))
+            {
+              stream->fs_flags = __FS_FLAG_LBF;
+            }
+#endif
 #endif
           /* Save the file description and open flags.  Setting the
            * file descriptor locks this stream.
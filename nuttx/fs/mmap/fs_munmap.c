@@ -1,7 +1,7 @@
 /****************************************************************************
  * fs/mmap/fs_munmap.c
  *
- *   Copyright (C) 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -139,13 +139,15 @@ int munmap(FAR void *start, size_t length)
         }
     }
 
-  /* Did we find the region */
+  /* Did we find the region?  If not, then this is an address on
+   * directly accessible media (case 1 above) and there is nothing to undo.
+   */
 
   if (!curr)
     {
-      fdbg("Region not found\n");
-      err = EINVAL;
-      goto errout_with_semaphore;
+      fvdbg("Not a RAM mapping\n");
+      sem_post(&g_rammaps.exclsem);
+      return OK;
     }
 
   /* Get the offset from the beginning of the region and the actual number
@@ -50,6 +50,7 @@
 #include <semaphore.h>
 
 #include <nuttx/mtd.h>
+#include <nuttx/wqueue.h>
 #include <nuttx/fs/nxffs.h>
 
 /****************************************************************************
@@ -283,6 +284,22 @@ struct nxffs_wrfile_s
   uint32_t                  crc;        /* Accumulated data block CRC */
 };
 
+/* This structure describes one entry in the RAM-resident inode index.  The
+ * index maps an inode name to the FLASH offset of its inode header so that
+ * an inode can be located without scanning the FLASH.
+ */
+
+#ifdef CONFIG_NXFFS_INDEX
+struct nxffs_ixnode_s
+{
+  FAR struct nxffs_ixnode_s *flink;    /* Supports a singly linked list */
+  off_t                     hoffset;   /* FLASH offset to the inode header */
+  uint32_t                  hash;      /* Hash of the inode name */
+  char                      name[1];   /* Inode name (variable length) */
+};
+#define SIZEOF_NXFFS_IXNODE(n) (sizeof(struct nxffs_ixnode_s) + (n))
+#endif
+
 /* This structure represents the overall state of on NXFFS instance. */
 
 struct nxffs_volume_s
@@ -301,6 +318,17 @@ struct nxffs_volume_s
   FAR struct nxffs_ofile_s *ofiles;    /* A singly-linked list of open files */
   FAR uint8_t              *cache;     /* On cached erase block for general I/O */
   FAR uint8_t              *pack;      /* A full erase block to support packing */
+  bool                      packpending; /* True: Incremental packing is suspended */
+  uint32_t                  npacks;    /* Number of completed packing operations */
+  uint32_t                  nsteps;    /* Number of incremental packing steps */
+  uint32_t                  nerased;   /* Number of erase blocks re-written by packing */
+#ifdef CONFIG_NXFFS_BGPACK
+  struct work_s             work;      /* Supports background packing */
+#endif
+#ifdef CONFIG_NXFFS_INDEX
+  bool                      ixvalid;   /* True: The inode index is complete */
+  FAR struct nxffs_ixnode_s *index[CONFIG_NXFFS_NINDEX]; /* Inode index hash buckets */
+#endif
 };
 
 /* This structure describes the state of the blocks on the NXFFS volume */
@@ -362,6 +390,9 @@ extern struct nxffs_volume_s g_volume;
  *   data is written, or (2) recalculated as part of the file system packing
  *   operation.
  *
+ *   If CONFIG_NXFFS_INDEX is defined, then the RAM-resident inode index is
+ *   rebuilt as a side effect of the inode scan.
+ *
  * Input Parameters:
  *   volume - Identifies the NXFFS volume
  *
@@ -829,7 +860,8 @@ extern int nxffs_wrinode(FAR struct nxffs_volume_s *volume,
  * Name: nxffs_updateinode
  *
  * Description:
- *   The packing logic has moved an inode.  Check if any open files are using
+ *   The packing logic has moved an inode.  Update the location of the inode
+ *   in the inode index (if enabled).  Check if any open files are using
  *   this inode and, if so, move the data in the open file structure as well.
  *
  * Input parameters
@@ -1016,6 +1048,109 @@ extern int nxffs_rdblkhdr(FAR struct nxffs_volume_s *volume, off_t offset,
 
 extern int nxffs_rminode(FAR struct nxffs_volume_s *volume, FAR const char *name);
 
+/****************************************************************************
+ * Name: nxffs_resetindex
+ *
+ * Description:
+ *   Discard all entries in the RAM-resident inode index and mark the index
+ *   as valid (but empty).  This is done before the index is rebuilt by
+ *   nxffs_limits() and when the volume is re-formatted.
+ *
+ * Input Parameters:
+ *   volume - Describes the NXFFS volume
+ *
+ * Returned Value:
+ *   None
+ *
+ * Defined in nxffs_index.c
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXFFS_INDEX
+extern void nxffs_resetindex(FAR struct nxffs_volume_s *volume);
+#else
+#  define nxffs_resetindex(v)
+#endif
+
+/****************************************************************************
+ * Name: nxffs_addindex
+ *
+ * Description:
+ *   Add an inode to the RAM-resident inode index or, if an inode of the
+ *   same name is already in the index, update the FLASH offset of its
+ *   inode header.  If memory cannot be allocated for the new entry, then
+ *   the index is discarded and nxffs_findinode() will revert to scanning
+ *   FLASH.
+ *
+ * Input Parameters:
+ *   volume  - Describes the NXFFS volume
+ *   name    - The name of the inode
+ *   hoffset - The FLASH offset to the inode header
+ *
+ * Returned Value:
+ *   None
+ *
+ * Defined in nxffs_index.c
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXFFS_INDEX
+extern void nxffs_addindex(FAR struct nxffs_volume_s *volume,
+                           FAR const char *name, off_t hoffset);
+#else
+#  define nxffs_addindex(v,n,o)
+#endif
+
+/****************************************************************************
+ * Name: nxffs_rmindex
+ *
+ * Description:
+ *   Remove the inode with this name from the RAM-resident inode index.
+ *
+ * Input Parameters:
+ *   volume - Describes the NXFFS volume
+ *   name   - The name of the inode to be removed
+ *
+ * Returned Value:
+ *   None
+ *
+ * Defined in nxffs_index.c
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXFFS_INDEX
+extern void nxffs_rmindex(FAR struct nxffs_volume_s *volume,
+                          FAR const char *name);
+#else
+#  define nxffs_rmindex(v,n)
+#endif
+
+/****************************************************************************
+ * Name: nxffs_findindex
+ *
+ * Description:
+ *   Look up the FLASH offset of the inode header with this name in the
+ *   RAM-resident inode index.
+ *
+ * Input Parameters:
+ *   volume  - Describes the NXFFS volume
+ *   name    - The name of the inode to find
+ *   hoffset - The location to return the FLASH offset to the inode header
+ *
+ * Returned Value:
+ *   Zero (OK) is returned if the inode is in the index; -ENOENT is returned
+ *   if the index is valid but the inode is not in the index; -ENOSYS is
+ *   returned if the index is not valid and FLASH must be scanned.
+ *
+ * Defined in nxffs_index.c
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXFFS_INDEX
+extern int nxffs_findindex(FAR struct nxffs_volume_s *volume,
+                           FAR const char *name, FAR off_t *hoffset);
+#endif
+
 /****************************************************************************
  * Name: nxffs_pack
  *
@@ -1034,6 +1169,72 @@ extern int nxffs_rminode(FAR struct nxffs_volume_s *volume, FAR const char *name
 
 extern int nxffs_pack(FAR struct nxffs_volume_s *volume);
 
+/****************************************************************************
+ * Name: nxffs_packstep
+ *
+ * Description:
+ *   Perform one step of an incremental packing operation:  Re-write at
+ *   most CONFIG_NXFFS_PACKSTEP erase blocks (more if a large inode spans
+ *   several erase blocks) and leave the volume in a consistent state.
+ *   volume->packpending will be true on return if there is more packing
+ *   to be done.  Unlike nxffs_pack(), this cannot be used while there is
+ *   an open writer.
+ *
+ * Input Parameters:
+ *   volume - The volume to be packed.
+ *
+ * Returned Values:
+ *   Zero on success; Otherwise, a negated errno value is returned to
+ *   indicate the nature of the failure.  -EBUSY is returned if there is an
+ *   open writer.
+ *
+ ****************************************************************************/
+
+extern int nxffs_packstep(FAR struct nxffs_volume_s *volume);
+
+/****************************************************************************
+ * Name: nxffs_bgpack
+ *
+ * Description:
+ *   Schedule background packing of the volume on the low priority work
+ *   queue.  Packing will be performed in steps (see nxffs_packstep()) when
+ *   the volume has been idle for CONFIG_NXFFS_BGPACK_DELAY milliseconds.
+ *   This is called whenever an inode is deleted.  The caller must hold the
+ *   volume exclsem.
+ *
+ * Input Parameters:
+ *   volume - The volume to be packed.
+ *
+ * Returned Values:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXFFS_BGPACK
+extern void nxffs_bgpack(FAR struct nxffs_volume_s *volume);
+#else
+#  define nxffs_bgpack(v)
+#endif
+
+/****************************************************************************
+ * Name: nxffs_packstats
+ *
+ * Description:
+ *   Return statistics describing the packing state of the volume.
+ *
+ * Input Parameters:
+ *   volume - The volume of interest.
+ *   stats  - The location to return the statistics.
+ *
+ * Returned Values:
+ *   Zero on success; Otherwise, a negated errno value is returned to
+ *   indicate the nature of the failure.
+ *
+ ****************************************************************************/
+
+extern int nxffs_packstats(FAR struct nxffs_volume_s *volume,
+                           FAR struct nxffs_packstats_s *stats);
+
 /****************************************************************************
  * Standard mountpoint operation methods
  *
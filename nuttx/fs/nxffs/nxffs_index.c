@@ -0,0 +1,308 @@
+/****************************************************************************
+ * fs/nxffs/nxffs_index.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+#include <errno.h>
+#include <assert.h>
+#include <debug.h>
+#include <crc32.h>
+
+#include <nuttx/kmalloc.h>
+#include <nuttx/mtd.h>
+
+#include "nxffs.h"
+
+#ifdef CONFIG_NXFFS_INDEX
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxffs_freeindex
+ *
+ * Description:
+ *   Free all entries in the inode index.
+ *
+ ****************************************************************************/
+
+static void nxffs_freeindex(FAR struct nxffs_volume_s *volume)
+{
+  FAR struct nxffs_ixnode_s *node;
+  FAR struct nxffs_ixnode_s *next;
+  int i;
+
+  for (i = 0; i < CONFIG_NXFFS_NINDEX; i++)
+    {
+      for (node = volume->index[i]; node; node = next)
+        {
+          next = node->flink;
+          kfree(node);
+        }
+
+      volume->index[i] = NULL;
+    }
+}
+
+/****************************************************************************
+ * Name: nxffs_ixfind
+ *
+ * Description:
+ *   Find the index entry for this name.  On return, *prev refers to the
+ *   entry before the matching entry in the hash bucket (or NULL if the
+ *   matching entry is at the head of the bucket).
+ *
+ ****************************************************************************/
+
+static FAR struct nxffs_ixnode_s *
+nxffs_ixfind(FAR struct nxffs_volume_s *volume, FAR const char *name,
+             uint32_t hash, FAR struct nxffs_ixnode_s **prev)
+{
+  FAR struct nxffs_ixnode_s *node;
+
+  *prev = NULL;
+  for (node = volume->index[hash % CONFIG_NXFFS_NINDEX];
+       node;
+       node = node->flink)
+    {
+      if (node->hash == hash && strcmp(node->name, name) == 0)
+        {
+          return node;
+        }
+
+      *prev = node;
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxffs_resetindex
+ *
+ * Description:
+ *   Discard all entries in the RAM-resident inode index and mark the index
+ *   as valid (but empty).  This is done before the index is rebuilt by
+ *   nxffs_limits() and when the volume is re-formatted.
+ *
+ * Input Parameters:
+ *   volume - Describes the NXFFS volume
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxffs_resetindex(FAR struct nxffs_volume_s *volume)
+{
+  nxffs_freeindex(volume);
+  volume->ixvalid = true;
+}
+
+/****************************************************************************
+ * Name: nxffs_addindex
+ *
+ * Description:
+ *   Add an inode to the RAM-resident inode index or, if an inode of the
+ *   same name is already in the index, update the FLASH offset of its
+ *   inode header.  If memory cannot be allocated for the new entry, then
+ *   the index is discarded and nxffs_findinode() will revert to scanning
+ *   FLASH.
+ *
+ * Input Parameters:
+ *   volume  - Describes the NXFFS volume
+ *   name    - The name of the inode
+ *   hoffset - The FLASH offset to the inode header
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxffs_addindex(FAR struct nxffs_volume_s *volume, FAR const char *name,
+                    off_t hoffset)
+{
+  FAR struct nxffs_ixnode_s *node;
+  FAR struct nxffs_ixnode_s *prev;
+  uint32_t hash;
+  int namlen;
+  int ndx;
+
+  if (!volume->ixvalid)
+    {
+      return;
+    }
+
+  /* Is there already an entry for an inode with this name?  That will be
+   * the case when the packing logic moves an inode.
+   */
+
+  namlen = strlen(name);
+  hash   = crc32((FAR const uint8_t *)name, namlen);
+  node   = nxffs_ixfind(volume, name, hash, &prev);
+  if (node)
+    {
+      node->hoffset = hoffset;
+      return;
+    }
+
+  /* No.. allocate a new entry with space for the name */
+
+  node = (FAR struct nxffs_ixnode_s *)kmalloc(SIZEOF_NXFFS_IXNODE(namlen));
+  if (!node)
+    {
+      /* The index is no longer complete and, hence, cannot be trusted.
+       * Discard it and fall back to scanning FLASH.
+       */
+
+      fdbg("Failed to allocate index entry, discarding the index\n");
+      nxffs_freeindex(volume);
+      volume->ixvalid = false;
+      return;
+    }
+
+  node->hoffset = hoffset;
+  node->hash    = hash;
+  memcpy(node->name, name, namlen + 1);
+
+  /* Add the new entry at the head of its hash bucket */
+
+  ndx                = hash % CONFIG_NXFFS_NINDEX;
+  node->flink        = volume->index[ndx];
+  volume->index[ndx] = node;
+}
+
+/****************************************************************************
+ * Name: nxffs_rmindex
+ *
+ * Description:
+ *   Remove the inode with this name from the RAM-resident inode index.
+ *
+ * Input Parameters:
+ *   volume - Describes the NXFFS volume
+ *   name   - The name of the inode to be removed
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxffs_rmindex(FAR struct nxffs_volume_s *volume, FAR const char *name)
+{
+  FAR struct nxffs_ixnode_s *node;
+  FAR struct nxffs_ixnode_s *prev;
+  uint32_t hash;
+
+  hash = crc32((FAR const uint8_t *)name, strlen(name));
+  node = nxffs_ixfind(volume, name, hash, &prev);
+  if (node)
+    {
+      if (prev)
+        {
+          prev->flink = node->flink;
+        }
+      else
+        {
+          volume->index[hash % CONFIG_NXFFS_NINDEX] = node->flink;
+        }
+
+      kfree(node);
+    }
+}
+
+/****************************************************************************
+ * Name: nxffs_findindex
+ *
+ * Description:
+ *   Look up the FLASH offset of the inode header with this name in the
+ *   RAM-resident inode index.
+ *
+ * Input Parameters:
+ *   volume  - Describes the NXFFS volume
+ *   name    - The name of the inode to find
+ *   hoffset - The location to return the FLASH offset to the inode header
+ *
+ * Returned Value:
+ *   Zero (OK) is returned if the inode is in the index; -ENOENT is returned
+ *   if the index is valid but the inode is not in the index; -ENOSYS is
+ *   returned if the index is not valid and FLASH must be scanned.
+ *
+ ****************************************************************************/
+
+int nxffs_findindex(FAR struct nxffs_volume_s *volume, FAR const char *name,
+                    FAR off_t *hoffset)
+{
+  FAR struct nxffs_ixnode_s *node;
+  FAR struct nxffs_ixnode_s *prev;
+  uint32_t hash;
+
+  if (!volume->ixvalid)
+    {
+      return -ENOSYS;
+    }
+
+  hash = crc32((FAR const uint8_t *)name, strlen(name));
+  node = nxffs_ixfind(volume, name, hash, &prev);
+  if (!node)
+    {
+      return -ENOENT;
+    }
+
+  *hoffset = node->hoffset;
+  return OK;
+}
+
+#endif /* CONFIG_NXFFS_INDEX */
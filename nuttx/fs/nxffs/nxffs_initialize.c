@@ -273,6 +273,9 @@ int nxffs_initialize(FAR struct mtd_dev_s *mtd)
   ret = nxffs_limits(volume);
   if (ret == OK)
     {
+      /* Reclaim any FLASH used by deleted inodes when the volume is idle */
+
+      nxffs_bgpack(volume);
       return OK;
     }
   fdbg("Failed to calculate file system limits: %d\n", -ret);
@@ -304,6 +307,9 @@ errout_with_volume:
  *   data is written, or (2) recalculated as part of the file system packing
  *   operation.
  *
+ *   If CONFIG_NXFFS_INDEX is defined, then the RAM-resident inode index is
+ *   rebuilt as a side effect of the inode scan.
+ *
  * Input Parameters:
  *   volume - Identifies the NXFFS volume
  *
@@ -332,6 +338,10 @@ int nxffs_limits(FAR struct nxffs_volume_s *volume)
       return ret;
     }
 
+  /* Discard any old index content.  The index is rebuilt below. */
+
+  nxffs_resetindex(volume);
+
   /* Then find the first valid inode in or beyond the first valid block */
 
   offset = block * volume->geo.blocksize;
@@ -365,6 +375,10 @@ int nxffs_limits(FAR struct nxffs_volume_s *volume)
       volume->inoffset = entry.hoffset;
       fvdbg("First inode at offset %d\n", volume->inoffset);
 
+      /* Add the inode to the (re-initialized) inode index */
+
+      nxffs_addindex(volume, entry.name, entry.hoffset);
+
       /* Discard this entry and set the next offset. */
 
       offset = nxffs_inodeend(volume, &entry);
@@ -377,7 +391,11 @@ int nxffs_limits(FAR struct nxffs_volume_s *volume)
     {
       while ((ret = nxffs_nextentry(volume, offset, &entry)) == OK)
         {
-          /* Discard the entry and guess the next offset. */
+          /* Add the inode to the index, discard the entry, and guess the
+           * next offset.
+           */
+
+          nxffs_addindex(volume, entry.name, entry.hoffset);
 
           offset = nxffs_inodeend(volume, &entry);
           nxffs_freeentry(&entry);    
@@ -517,6 +535,14 @@ int nxffs_unbind(FAR void *handle, FAR struct inode **blkdriver)
 #ifndef CONFIG_NXFFS_PREALLOCATED
 #  error "No design to support dynamic allocation of volumes"
 #else
-  return g_volume.ofiles ? -EBUSY : OK;
+  if (g_volume.ofiles)
+    {
+      return -EBUSY;
+    }
+
+#ifdef CONFIG_NXFFS_BGPACK
+  (void)work_cancel(LPWORK, &g_volume.work);
+#endif
+  return OK;
 #endif
 }
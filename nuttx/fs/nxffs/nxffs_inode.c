@@ -1,7 +1,7 @@
 /****************************************************************************
  * fs/nxffs/nxffs_inode.c
  *
- *   Copyright (C) 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * References: Linux/Documentation/filesystems/romfs.txt
@@ -72,7 +72,8 @@
  * Name: nxffs_rdentry
  *
  * Description:
- *   Read the inode entry at this offset.  Called only from nxffs_nextentry().
+ *   Read the inode entry at this offset.  Called from nxffs_nextentry() and
+ *   from nxffs_findinode() when the inode offset is known from the index.
  *
  * Input Parameters:
  *   volume - Describes the current volume.
@@ -392,6 +393,48 @@ int nxffs_findinode(FAR struct nxffs_volume_s *volume, FAR const char *name,
   off_t offset;
   int ret;
 
+#ifdef CONFIG_NXFFS_INDEX
+  /* If the inode index is valid, then it tells us where the inode header
+   * is (or that there is no such inode) without scanning FLASH.
+   */
+
+  ret = nxffs_findindex(volume, name, &offset);
+  if (ret == -ENOENT)
+    {
+      fvdbg("No inode found: %d\n", -ret);
+      return ret;
+    }
+  else if (ret == OK)
+    {
+      /* Make sure that the block containing the inode header is in the
+       * cache, then read and verify the inode header.
+       */
+
+      nxffs_ioseek(volume, offset);
+      ret = nxffs_rdcache(volume, volume->ioblock);
+      if (ret == OK)
+        {
+          ret = nxffs_rdentry(volume, offset, entry);
+          if (ret == OK)
+            {
+              if (strcmp(name, entry->name) == 0)
+                {
+                  return OK;
+                }
+
+              nxffs_freeentry(entry);
+            }
+        }
+
+      /* This should not happen.  Discard the stale index entry and fall
+       * back to scanning FLASH.
+       */
+
+      fdbg("Bad index entry for '%s' at offset %d\n", name, offset);
+      nxffs_rmindex(volume, name);
+    }
+#endif
+
   /* Start with the first valid inode that was discovered when the volume
    * was created (or modified after the last file system re-packing).
    */
@@ -418,8 +461,12 @@ int nxffs_findinode(FAR struct nxffs_volume_s *volume, FAR const char *name,
 
       else if (strcmp(name, entry->name) == 0)
         {
-          /* Yes, return success with the entry data in 'entry' */
+          /* Yes, return success with the entry data in 'entry' (after
+           * repairing the index if we got here because of a bad index
+           * entry).
+           */
 
+          nxffs_addindex(volume, name, entry->hoffset);
           return OK;
         }
 
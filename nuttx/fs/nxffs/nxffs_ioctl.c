@@ -1,7 +1,7 @@
 /****************************************************************************
  * fs/nxffs/nxffs_ioctl.c
  *
- *   Copyright (C) 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * References: Linux/Documentation/filesystems/romfs.txt
@@ -108,7 +108,7 @@ int nxffs_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
       goto errout;
     }
 
-  /* Only a reformat and optimize commands are supported */
+  /* Only the reformat, optimize, and packing commands are supported */
 
   if (cmd == FIOC_REFORMAT)
     {
@@ -136,6 +136,32 @@ int nxffs_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 
       ret = nxffs_pack(volume);
     }
+
+  else if (cmd == FIOC_PACKSTEP)
+    {
+      fvdbg("Pack step command\n");
+
+      /* Perform one step of an incremental packing operation */
+
+      ret = nxffs_packstep(volume);
+    }
+
+  else if (cmd == FIOC_PACKSTATS)
+    {
+      FAR struct nxffs_packstats_s *stats =
+        (FAR struct nxffs_packstats_s *)((uintptr_t)arg);
+
+      fvdbg("Pack statistics command\n");
+
+      if (!stats)
+        {
+          ret = -EINVAL;
+        }
+      else
+        {
+          ret = nxffs_packstats(volume, stats);
+        }
+    }
   else
     {
       /* No other commands supported */
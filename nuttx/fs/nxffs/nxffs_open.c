@@ -1276,11 +1276,14 @@ int nxffs_wrinode(FAR struct nxffs_volume_s *volume,
       fdbg("Failed to write inode header block %d: %d\n",
            volume->ioblock, -ret);
     }
+  else
+    {
+      /* Add the new inode to the index (or update its location) */
 
-  /* The volume is now available for other writers */
+      nxffs_addindex(volume, entry->name, entry->hoffset);
+    }
 
 errout:
-  sem_post(&volume->wrsem);
   return ret;
 }
 
@@ -1288,7 +1291,8 @@ errout:
  * Name: nxffs_updateinode
  *
  * Description:
- *   The packing logic has moved an inode.  Check if any open files are using
+ *   The packing logic has moved an inode.  Update the location of the inode
+ *   in the inode index (if enabled).  Check if any open files are using
  *   this inode and, if so, move the data in the open file structure as well.
  *
  * Input parameters
@@ -1306,6 +1310,10 @@ int nxffs_updateinode(FAR struct nxffs_volume_s *volume,
 {
   FAR struct nxffs_ofile_s *ofile;
 
+  /* Update the location of the inode in the index */
+
+  nxffs_addindex(volume, entry->name, entry->hoffset);
+
   /* Find the open inode structure matching this name */
 
   ofile = nxffs_findofile(volume, entry->name);
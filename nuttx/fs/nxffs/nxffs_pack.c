@@ -1,7 +1,7 @@
 /****************************************************************************
  * fs/nxffs/nxffs_pack.c
  *
- *   Copyright (C) 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * References: Linux/Documentation/filesystems/romfs.txt
@@ -42,12 +42,15 @@
 #include <nuttx/config.h>
 
 #include <string.h>
+#include <semaphore.h>
 #include <errno.h>
 #include <assert.h>
 #include <crc32.h>
 #include <debug.h>
 
 #include <nuttx/kmalloc.h>
+#include <nuttx/clock.h>
+#include <nuttx/wqueue.h>
 
 #include "nxffs.h"
 
@@ -182,6 +185,61 @@ static inline bool nxffs_packvalid(FAR struct nxffs_pack_s *pack)
           blkhdr->state == BLOCK_STATE_GOOD);
 }
 
+/****************************************************************************
+ * Name: nxffs_packerased
+ *
+ * Description:
+ *   After all inodes have been packed, the remainder of each erase block is
+ *   reset to the erased state.  Check if the erase block in the pack buffer
+ *   is already in that state from the current position to the end.
+ *
+ * Input Parameters:
+ *   volume - Describes the NXFFS volume
+ *   pack   - The volume packing state structure.
+ *
+ * Returned Values:
+ *   True if the erase block does not need to be re-written.
+ *
+ ****************************************************************************/
+
+static bool nxffs_packerased(FAR struct nxffs_volume_s *volume,
+                             FAR struct nxffs_pack_s *pack)
+{
+  FAR struct nxffs_block_s *blkhdr;
+  FAR uint8_t *iobuffer;
+  off_t block;
+  size_t offset;
+  size_t nbytes;
+  int i;
+
+  for (i = 0, block = pack->block0, iobuffer = volume->pack;
+       i < volume->blkper;
+       i++, block++, iobuffer += volume->geo.blocksize)
+    {
+      /* Blocks before the current position and invalid blocks are not
+       * modified.
+       */
+
+      blkhdr = (FAR struct nxffs_block_s *)iobuffer;
+      if (block < pack->ioblock ||
+          memcmp(blkhdr->magic, g_blockmagic, NXFFS_MAGICSIZE) != 0 ||
+          blkhdr->state != BLOCK_STATE_GOOD)
+        {
+          continue;
+        }
+
+      offset = (block == pack->ioblock) ? pack->iooffset :
+                                          SIZEOF_NXFFS_BLOCK_HDR;
+      nbytes = volume->geo.blocksize - offset;
+      if (nxffs_erased(&iobuffer[offset], nbytes) < nbytes)
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+
 /****************************************************************************
  * Name: nxffs_mediacheck
  *
@@ -665,6 +723,14 @@ static int nxffs_wrinodehdr(FAR struct nxffs_volume_s *volume,
        */
 
       ret = nxffs_wrinode(volume, &pack->dest.entry);
+      if (ret == OK)
+        {
+          /* If any open files reference this inode, then update the open
+           * file state.
+           */
+
+          ret = nxffs_updateinode(volume, &pack->dest.entry);
+        }
     }
   else
     {
@@ -1247,18 +1313,102 @@ static inline int nxffs_packwriter(FAR struct nxffs_volume_s *volume,
 }
 
 /****************************************************************************
- * Public Functions
+ * Name: nxffs_packsuspend
+ *
+ * Description:
+ *   Suspend an incremental packing operation after an erase block has been
+ *   written.  At this point, the inodes that have been packed have valid
+ *   inode headers at both their new and their old locations.  Mark the
+ *   old inode headers that still remain in FLASH as deleted so that the
+ *   volume is left in a consistent state.  The next packing operation will
+ *   then naturally resume at the point where this one left off.
+ *
+ *   The inode currently being packed is still intact at its old location
+ *   (the caller assures that its inode header lies beyond the last erase
+ *   block written).  The partial copy in the destination has no inode
+ *   header and will be overwritten when packing resumes.
+ *
+ * Input Parameters:
+ *   volume   - The volume being packed
+ *   pack     - The volume packing state structure.
+ *   offset   - The FLASH offset to the first byte after the last erase
+ *              block written.
+ *   froffset - The free FLASH offset before packing began.
+ *
+ * Returned Values:
+ *   Zero on success; Otherwise, a negated errno value is returned to
+ *   indicate the nature of the failure.
+ *
  ****************************************************************************/
 
+static int nxffs_packsuspend(FAR struct nxffs_volume_s *volume,
+                             FAR struct nxffs_pack_s *pack, off_t offset,
+                             off_t froffset)
+{
+  FAR struct nxffs_inode_s *inode;
+  struct nxffs_entry_s entry;
+  int ret;
+
+  /* Nothing beyond the last erase block written has been modified and so
+   * the free FLASH region is the same as before packing began.
+   */
+
+  volume->froffset = froffset;
+
+  /* Mark the old copies of each of the inodes that have already been
+   * moved as deleted.
+   */
+
+  while (offset < pack->src.entry.hoffset)
+    {
+      ret = nxffs_nextentry(volume, offset, &entry);
+      if (ret < 0 || entry.hoffset >= pack->src.entry.hoffset)
+        {
+          if (ret == OK)
+            {
+              nxffs_freeentry(&entry);
+            }
+          break;
+        }
+
+      nxffs_ioseek(volume, entry.hoffset);
+      ret = nxffs_rdcache(volume, volume->ioblock);
+      if (ret < 0)
+        {
+          fdbg("Failed to read block %d: %d\n", volume->ioblock, -ret);
+          nxffs_freeentry(&entry);
+          return ret;
+        }
+
+      inode = (FAR struct nxffs_inode_s *)&volume->cache[volume->iooffset];
+      inode->state = INODE_STATE_DELETED;
+
+      ret = nxffs_wrcache(volume);
+      if (ret < 0)
+        {
+          fdbg("Failed to write block %d: %d\n", volume->ioblock, -ret);
+          nxffs_freeentry(&entry);
+          return ret;
+        }
+
+      offset = nxffs_inodeend(volume, &entry);
+      nxffs_freeentry(&entry);
+    }
+
+  return OK;
+}
+
 /****************************************************************************
- * Name: nxffs_pack
+ * Name: nxffs_packeblocks
  *
  * Description:
  *   Pack and re-write the filesystem in order to free up memory at the end
- *   of FLASH.
+ *   of FLASH.  This implements both nxffs_pack() and nxffs_packstep().
  *
  * Input Parameters:
- *   volume - The volume to be packed.
+ *   volume  - The volume to be packed.
+ *   neblocks - The maximum number of erase blocks to be re-written or zero
+ *              if the entire volume should be packed.
  *
  * Returned Values:
  *   Zero on success; Otherwise, a negated errno value is returned to
@@ -1266,21 +1416,30 @@ static inline int nxffs_packwriter(FAR struct nxffs_volume_s *volume,
  *
  ****************************************************************************/
 
-int nxffs_pack(FAR struct nxffs_volume_s *volume)
+static int nxffs_packeblocks(FAR struct nxffs_volume_s *volume,
+                             off_t neblocks)
 {
   struct nxffs_pack_s pack;
   FAR struct nxffs_wrfile_s *wrfile;
+  off_t froffset;
+  off_t srcoffset;
   off_t iooffset;
+  off_t offset;
   off_t eblock;
   off_t block;
+  off_t nwritten;
   bool packed;
   int i;
   int ret;
 
   /* Get the offset to the first valid inode entry */
 
-  wrfile = NULL;
-  packed = false;
+  wrfile    = NULL;
+  packed    = false;
+  nwritten  = 0;
+  srcoffset = 0;
+  froffset  = volume->froffset;
+  volume->packpending = false;
 
   iooffset = nxffs_mediacheck(volume, &pack);
   if (iooffset == 0)
@@ -1388,6 +1547,12 @@ int nxffs_pack(FAR struct nxffs_volume_s *volume)
         }
     }
 
+  /* Remember the first inode to be packed.  An incremental packing step
+   * cannot be suspended until it has been packed.
+   */
+
+  srcoffset = pack.src.entry.hoffset;
+
   /* Otherwise, begin pack at this src/dest block combination.  Initialize
    * ioblock and iooffset with the position of the first inode header.  In
    * this case, the FLASH offset to the first inode header is return in 
@@ -1400,6 +1565,15 @@ start_pack:
   pack.iooffset    = nxffs_getoffset(volume, iooffset, pack.ioblock);
   volume->froffset = iooffset;
 
+  /* Inodes may be moved to a location before the first inode (if the
+   * first inodes were deleted).
+   */
+
+  if (iooffset < volume->inoffset)
+    {
+      volume->inoffset = iooffset;
+    }
+
   /* Then pack all erase blocks starting with the erase block that contains
    * the ioblock and through the final erase block on the FLASH.
    */
@@ -1421,6 +1595,27 @@ start_pack:
           goto errout_with_pack;
         }
 
+      /* If all of the inodes have been packed and the remainder of this
+       * erase block is already in the erased state, then there is no need
+       * to erase and re-write it.
+       */
+
+      if (packed && !wrfile && nxffs_packerased(volume, &pack))
+        {
+          pack.iooffset = SIZEOF_NXFFS_BLOCK_HDR;
+          ret = OK;
+
+          /* When packing incrementally, stop at the old free FLASH region */
+
+          if (neblocks > 0 &&
+              (eblock + 1) * volume->geo.erasesize >= froffset)
+            {
+              break;
+            }
+
+          continue;
+        }
+
       /* Pack each I/O block */
 
       for (i = 0, block = pack.block0, pack.iobuffer = volume->pack;
@@ -1563,10 +1758,280 @@ start_pack:
                eblock, pack.block0, -ret);
           goto errout_with_pack;
         }
+
+      ret = OK;
+      volume->nerased++;
+
+      /* Is this an incremental packing operation? */
+
+      if (neblocks > 0)
+        {
+          /* Yes.. If all of the inodes have been packed, then we are
+           * finished when we have reached the old free FLASH region;
+           * everything after that is already erased.
+           */
+
+          offset = (eblock + 1) * volume->geo.erasesize;
+          if (packed && offset >= froffset)
+            {
+              break;
+            }
+
+          /* Otherwise, suspend the packing operation when the limit is
+           * reached, but only if (1) at least one inode has been completely
+           * packed in this step (the partially packed inode will be packed
+           * again when packing resumes so this assures progress) and (2)
+           * the inode currently being packed is still intact at its old
+           * location.
+           *
+           * Once all inodes have been packed, the packing operation cannot
+           * be suspended:  The FLASH after the last inode is erased and
+           * inodes that are written later, at the old free FLASH offset,
+           * would not be found beyond the erased region.
+           */
+
+          else if (!packed && ++nwritten >= neblocks &&
+                   pack.src.entry.hoffset != srcoffset &&
+                   pack.src.entry.hoffset >= offset)
+            {
+              ret = nxffs_packsuspend(volume, &pack, offset, froffset);
+              volume->packpending = true;
+              break;
+            }
+        }
     }
 
 errout_with_pack:
+
+  /* The packing operation may have re-written the blocks in the cache */
+
+  volume->cblock = (off_t)-1;
+
   nxffs_freeentry(&pack.src.entry);
   nxffs_freeentry(&pack.dest.entry);
   return ret;
 }
+
+/****************************************************************************
+ * Name: nxffs_packworker
+ *
+ * Description:
+ *   Perform one step of background packing on the low priority work queue.
+ *   Re-schedule if there is more to be done.
+ *
+ * Input Parameters:
+ *   arg - The volume to be packed.
+ *
+ * Returned Values:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXFFS_BGPACK
+static void nxffs_packworker(FAR void *arg)
+{
+  FAR struct nxffs_volume_s *volume = (FAR struct nxffs_volume_s *)arg;
+  int ret;
+
+  ret = sem_wait(&volume->exclsem);
+  if (ret != OK)
+    {
+      fdbg("sem_wait failed: %d\n", errno);
+      return;
+    }
+
+  /* If there is an open writer, then the volume is not idle.  Try again
+   * later.  Otherwise, perform one packing step.
+   */
+
+  if (nxffs_findwriter(volume))
+    {
+      nxffs_bgpack(volume);
+    }
+  else
+    {
+      ret = nxffs_packstep(volume);
+      if (ret < 0)
+        {
+          fdbg("nxffs_packstep failed: %d\n", -ret);
+        }
+      else if (volume->packpending)
+        {
+          nxffs_bgpack(volume);
+        }
+    }
+
+  sem_post(&volume->exclsem);
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxffs_pack
+ *
+ * Description:
+ *   Pack and re-write the filesystem in order to free up memory at the end
+ *   of FLASH.
+ *
+ * Input Parameters:
+ *   volume - The volume to be packed.
+ *
+ * Returned Values:
+ *   Zero on success; Otherwise, a negated errno value is returned to
+ *   indicate the nature of the failure.
+ *
+ ****************************************************************************/
+
+int nxffs_pack(FAR struct nxffs_volume_s *volume)
+{
+  int ret;
+
+  ret = nxffs_packeblocks(volume, 0);
+  if (ret >= 0)
+    {
+      volume->npacks++;
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: nxffs_packstep
+ *
+ * Description:
+ *   Perform one step of an incremental packing operation:  Re-write at
+ *   most CONFIG_NXFFS_PACKSTEP erase blocks (more if a large inode spans
+ *   several erase blocks) and leave the volume in a consistent state.
+ *   volume->packpending will be true on return if there is more packing
+ *   to be done.  Unlike nxffs_pack(), this cannot be used while there is
+ *   an open writer.
+ *
+ * Input Parameters:
+ *   volume - The volume to be packed.
+ *
+ * Returned Values:
+ *   Zero on success; Otherwise, a negated errno value is returned to
+ *   indicate the nature of the failure.
+ *
+ ****************************************************************************/
+
+int nxffs_packstep(FAR struct nxffs_volume_s *volume)
+{
+  int ret;
+
+  /* Writing is performed at the end of the free FLASH region which will be
+   * unchanged if the packing operation is suspended.  But the in-progress
+   * write cannot be packed incrementally.
+   */
+
+  if (nxffs_findwriter(volume))
+    {
+      return -EBUSY;
+    }
+
+  ret = nxffs_packeblocks(volume, CONFIG_NXFFS_PACKSTEP);
+  if (ret >= 0)
+    {
+      volume->nsteps++;
+      if (!volume->packpending)
+        {
+          volume->npacks++;
+        }
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: nxffs_bgpack
+ *
+ * Description:
+ *   Schedule background packing of the volume on the low priority work
+ *   queue.  Packing will be performed in steps (see nxffs_packstep()) when
+ *   the volume has been idle for CONFIG_NXFFS_BGPACK_DELAY milliseconds.
+ *   This is called whenever an inode is deleted.  The caller must hold the
+ *   volume exclsem.
+ *
+ * Input Parameters:
+ *   volume - The volume to be packed.
+ *
+ * Returned Values:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXFFS_BGPACK
+void nxffs_bgpack(FAR struct nxffs_volume_s *volume)
+{
+  /* Cancel any pending work so that the delay restarts now */
+
+  (void)work_cancel(LPWORK, &volume->work);
+  (void)work_queue(LPWORK, &volume->work, nxffs_packworker,
+                   (FAR void *)volume, MSEC2TICK(CONFIG_NXFFS_BGPACK_DELAY));
+}
+#endif
+
+/****************************************************************************
+ * Name: nxffs_packstats
+ *
+ * Description:
+ *   Return statistics describing the packing state of the volume.
+ *
+ * Input Parameters:
+ *   volume - The volume of interest.
+ *   stats  - The location to return the statistics.
+ *
+ * Returned Values:
+ *   Zero on success; Otherwise, a negated errno value is returned to
+ *   indicate the nature of the failure.
+ *
+ ****************************************************************************/
+
+int nxffs_packstats(FAR struct nxffs_volume_s *volume,
+                    FAR struct nxffs_packstats_s *stats)
+{
+  struct nxffs_entry_s entry;
+  off_t offset;
+  int ret;
+
+  memset(stats, 0, sizeof(struct nxffs_packstats_s));
+
+  /* Add up the FLASH used by each valid inode */
+
+  offset = volume->inoffset;
+  while ((ret = nxffs_nextentry(volume, offset, &entry)) == OK)
+    {
+      stats->used += SIZEOF_NXFFS_INODE_HDR + strlen(entry.name) +
+                     entry.datlen;
+
+      offset = nxffs_inodeend(volume, &entry);
+      nxffs_freeentry(&entry);
+    }
+
+  if (ret != -ENOENT)
+    {
+      fdbg("nxffs_nextentry failed: %d\n", -ret);
+      return ret;
+    }
+
+  /* Everything else between the first inode and the free FLASH region is
+   * occupied by deleted inodes.
+   */
+
+  stats->size        = volume->nblocks * volume->geo.blocksize;
+  stats->available   = stats->size - volume->froffset;
+  stats->reclaimable = volume->froffset - volume->inoffset - stats->used;
+  if (stats->reclaimable < 0)
+    {
+      stats->reclaimable = 0;
+    }
+
+  stats->npacks      = volume->npacks;
+  stats->nsteps      = volume->nsteps;
+  stats->nerased     = volume->nerased;
+  stats->pending     = volume->packpending;
+  return OK;
+}
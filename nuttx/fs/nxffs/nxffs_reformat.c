@@ -1,7 +1,7 @@
 /****************************************************************************
  * fs/nxffs/nxffs_reformat.c
  *
- *   Copyright (C) 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * References: Linux/Documentation/filesystems/romfs.txt
@@ -256,6 +256,10 @@ int nxffs_reformat(FAR struct nxffs_volume_s *volume)
       return ret;
     }
 
+  /* There are no inodes on the freshly formatted volume */
+
+  nxffs_resetindex(volume);
+
   /* Check for bad blocks */
 
   ret = nxffs_badblocks(volume);
@@ -1,7 +1,7 @@
 /****************************************************************************
  * fs/nxffs/nxffs_unlink.c
  *
- *   Copyright (C) 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * References: Linux/Documentation/filesystems/romfs.txt
@@ -143,6 +143,15 @@ int nxffs_rminode(FAR struct nxffs_volume_s *volume, FAR const char *name)
     {
       fdbg("Failed to read data into cache: %d\n", ret);
     }
+  else
+    {
+      /* The inode no longer exists; remove it from the index and schedule
+       * background packing to reclaim the FLASH that it occupied.
+       */
+
+      nxffs_rmindex(volume, name);
+      nxffs_bgpack(volume);
+    }
 
 errout_with_entry:
   nxffs_freeentry(&entry);
@@ -1,7 +1,7 @@
 /****************************************************************************
  * rm/romfs/fs_romfs.h
  *
- *   Copyright (C) 2008-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * References: Linux/Documentation/filesystems/romfs.txt
@@ -383,6 +383,20 @@ static ssize_t romfs_read(FAR struct file *filep, FAR char *buffer,
       buflen = bytesleft;
     }
 
+  /* In XIP mode, the file data is contiguous in directly accessible memory
+   * and can be copied to the user's buffer in one step.
+   */
+
+  if (rm->rm_xipbase)
+    {
+      memcpy(userbuffer, rm->rm_xipbase + rf->rf_startoffset + filep->f_pos,
+             buflen);
+
+      filep->f_pos += buflen;
+      romfs_semgive(rm);
+      return buflen;
+    }
+
   /* Loop until either (1) all data has been transferred, or (2) an
    * error occurs.
    */
@@ -951,6 +965,12 @@ static int romfs_bind(FAR struct inode *blkdriver, FAR const void *data,
       goto errout_with_buffer;
     }
 
+#ifdef CONFIG_FS_ROMFS_DIRHASH
+  /* Build the directory index.  Path lookups still work without it. */
+
+  (void)romfs_hashbuild(rm);
+#endif
+
   /* Mounted! */
 
   *handle = (void*)rm;
@@ -1030,6 +1050,9 @@ static int romfs_unbind(FAR void *handle, FAR struct inode **blkdriver)
 
       /* Release the mountpoint private data */
 
+#ifdef CONFIG_FS_ROMFS_DIRHASH
+      romfs_hashfree(rm);
+#endif
       if (!rm->rm_xipbase && rm->rm_buffer)
         {
           kfree(rm->rm_buffer);
@@ -1,7 +1,7 @@
 /****************************************************************************
  * fs/romfs/fs_romfs.h
  *
- *   Copyright (C) 2008-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * References: Linux/Documentation/filesystems/romfs.txt
@@ -125,6 +125,12 @@
 
 #define ROMF_MAX_LINKS 64
 
+/* Directory hash index */
+
+#ifndef CONFIG_FS_ROMFS_DIRHASH_MAXENTRIES
+#  define CONFIG_FS_ROMFS_DIRHASH_MAXENTRIES 1024
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -134,6 +140,19 @@
  * mounted with a fat32 filesystem.
  */
 
+#ifdef CONFIG_FS_ROMFS_DIRHASH
+/* This structure is one entry of the directory hash index.  The index is
+ * sorted by key so that the entries with a given key can be found with a
+ * binary search.
+ */
+
+struct romfs_hashent_s
+{
+  uint32_t rh_key;                  /* Hash of the directory and entry name */
+  uint32_t rh_offset;               /* Offset to the directory entry */
+};
+#endif
+
 struct romfs_file_s;
 struct romfs_mountpt_s
 {
@@ -149,6 +168,11 @@ struct romfs_mountpt_s
   uint32_t rm_cachesector;          /* Current sector in the rm_buffer */
   uint8_t *rm_xipbase;              /* Base address of directly accessible media */
   uint8_t *rm_buffer;               /* Device sector buffer, allocated if rm_xipbase==0 */
+#ifdef CONFIG_FS_ROMFS_DIRHASH
+  struct romfs_hashent_s *rm_hash;  /* Directory hash index (may be NULL) */
+  uint32_t rm_nhash;                /* Number of entries in the index */
+  uint32_t rm_nhashalloc;           /* Number of entries allocated */
+#endif
 };
 
 /* This structure represents on open file under the mountpoint.  An instance
@@ -221,6 +245,13 @@ EXTERN int  romfs_parsefilename(struct romfs_mountpt_s *rm, uint32_t offset,
                   char *pname);
 EXTERN int  romfs_datastart(struct romfs_mountpt_s *rm, uint32_t offset,
                   uint32_t *start);
+#ifdef CONFIG_FS_ROMFS_DIRHASH
+EXTERN uint32_t romfs_hashkey(uint32_t diroffset, const char *name,
+                  int namelen);
+EXTERN int  romfs_hashbuild(struct romfs_mountpt_s *rm);
+EXTERN void romfs_hashfree(struct romfs_mountpt_s *rm);
+EXTERN uint32_t romfs_hashfirst(struct romfs_mountpt_s *rm, uint32_t key);
+#endif
 
 #undef EXTERN
 #if defined(__cplusplus)
@@ -0,0 +1,324 @@
+/****************************************************************************
+ * fs/romfs/fs_romfshash.c
+ * Directory hash index for ROMFS path lookups
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/kmalloc.h>
+
+#include "fs_romfs.h"
+
+#ifdef CONFIG_FS_ROMFS_DIRHASH
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The index starts with this many entries and is doubled as needed */
+
+#define ROMFS_HASH_NINITIAL 32
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: romfs_hashcompare
+ *
+ * Description:
+ *   qsort() comparison function:  Order index entries by key, then by
+ *   offset.
+ *
+ ****************************************************************************/
+
+static int romfs_hashcompare(FAR const void *a, FAR const void *b)
+{
+  FAR const struct romfs_hashent_s *ha = (FAR const struct romfs_hashent_s *)a;
+  FAR const struct romfs_hashent_s *hb = (FAR const struct romfs_hashent_s *)b;
+
+  if (ha->rh_key != hb->rh_key)
+    {
+      return ha->rh_key < hb->rh_key ? -1 : 1;
+    }
+
+  if (ha->rh_offset != hb->rh_offset)
+    {
+      return ha->rh_offset < hb->rh_offset ? -1 : 1;
+    }
+
+  return 0;
+}
+
+/****************************************************************************
+ * Name: romfs_hashdir
+ *
+ * Description:
+ *   Add every entry of the directory whose first entry is at 'diroffset'
+ *   to the index, growing the index as necessary.
+ *
+ ****************************************************************************/
+
+static int romfs_hashdir(FAR struct romfs_mountpt_s *rm, uint32_t diroffset)
+{
+  FAR struct romfs_hashent_s *newhash;
+  char name[NAME_MAX+1];
+  uint32_t offset;
+  uint32_t linkoffset;
+  uint32_t next;
+  uint32_t info;
+  uint32_t size;
+  uint32_t nalloc;
+  int ret;
+
+  offset = diroffset;
+  do
+    {
+      ret = romfs_parsedirentry(rm, offset, &linkoffset, &next, &info, &size);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      ret = romfs_parsefilename(rm, offset, name);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      /* Make room for one more entry */
+
+      if (rm->rm_nhash >= rm->rm_nhashalloc)
+        {
+          if (rm->rm_nhashalloc >= CONFIG_FS_ROMFS_DIRHASH_MAXENTRIES)
+            {
+              return -E2BIG;
+            }
+
+          nalloc = rm->rm_nhashalloc ? 2 * rm->rm_nhashalloc :
+                                       ROMFS_HASH_NINITIAL;
+          if (nalloc > CONFIG_FS_ROMFS_DIRHASH_MAXENTRIES)
+            {
+              nalloc = CONFIG_FS_ROMFS_DIRHASH_MAXENTRIES;
+            }
+
+          newhash = (FAR struct romfs_hashent_s *)
+            krealloc(rm->rm_hash, nalloc * sizeof(struct romfs_hashent_s));
+          if (!newhash)
+            {
+              return -ENOMEM;
+            }
+
+          rm->rm_hash       = newhash;
+          rm->rm_nhashalloc = nalloc;
+        }
+
+      rm->rm_hash[rm->rm_nhash].rh_key    =
+        romfs_hashkey(diroffset, name, strlen(name));
+      rm->rm_hash[rm->rm_nhash].rh_offset = offset;
+      rm->rm_nhash++;
+
+      offset = next & RFNEXT_OFFSETMASK;
+    }
+  while (offset != 0);
+
+  return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: romfs_hashkey
+ *
+ * Description:
+ *   Return the index key of the entry 'name' in the directory whose first
+ *   entry is at 'diroffset'.
+ *
+ ****************************************************************************/
+
+uint32_t romfs_hashkey(uint32_t diroffset, FAR const char *name, int namelen)
+{
+  uint32_t hash = (2166136261u ^ diroffset) * 16777619u;
+
+  while (namelen-- > 0)
+    {
+      hash = (hash ^ (uint8_t)*name++) * 16777619u;
+    }
+
+  return hash;
+}
+
+/****************************************************************************
+ * Name: romfs_hashbuild
+ *
+ * Description:
+ *   Walk the whole file system and build the index of all directory
+ *   entries.  This is called as part of the ROMFS mount operation.  If
+ *   the index cannot be built, path lookups will search the directories
+ *   on the media.
+ *
+ ****************************************************************************/
+
+int romfs_hashbuild(FAR struct romfs_mountpt_s *rm)
+{
+  FAR struct romfs_hashent_s *newhash;
+  char name[NAME_MAX+1];
+  uint32_t linkoffset;
+  uint32_t next;
+  uint32_t info;
+  uint32_t size;
+  uint32_t ndx;
+  int ret;
+
+  rm->rm_hash       = NULL;
+  rm->rm_nhash      = 0;
+  rm->rm_nhashalloc = 0;
+
+  /* Index the root directory.  Then index the sub-directories in the order
+   * that they are found, using the index itself as the list of directories
+   * still to be visited.
+   */
+
+  ret = romfs_hashdir(rm, rm->rm_rootoffset);
+  for (ndx = 0; ret == OK && ndx < rm->rm_nhash; ndx++)
+    {
+      ret = romfs_parsedirentry(rm, rm->rm_hash[ndx].rh_offset, &linkoffset,
+                                &next, &info, &size);
+      if (ret == OK && IS_DIRECTORY(next))
+        {
+          /* The "." and ".." entries are hard links to directories that
+           * have already been visited.
+           */
+
+          ret = romfs_parsefilename(rm, rm->rm_hash[ndx].rh_offset, name);
+          if (ret == OK && strcmp(name, ".") != 0 && strcmp(name, "..") != 0)
+            {
+              ret = romfs_hashdir(rm, info);
+            }
+        }
+    }
+
+  if (ret < 0)
+    {
+      fdbg("Failed to build the directory index: %d\n", ret);
+      romfs_hashfree(rm);
+      return ret;
+    }
+
+  /* Release the unused part of the index and sort it for binary search */
+
+  if (rm->rm_nhash < rm->rm_nhashalloc)
+    {
+      newhash = (FAR struct romfs_hashent_s *)
+        krealloc(rm->rm_hash, rm->rm_nhash * sizeof(struct romfs_hashent_s));
+      if (newhash)
+        {
+          rm->rm_hash       = newhash;
+          rm->rm_nhashalloc = rm->rm_nhash;
+        }
+    }
+
+  qsort(rm->rm_hash, rm->rm_nhash, sizeof(struct romfs_hashent_s),
+        romfs_hashcompare);
+
+  fvdbg("Indexed %d directory entries\n", rm->rm_nhash);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: romfs_hashfree
+ *
+ * Description:
+ *   Release the directory index.
+ *
+ ****************************************************************************/
+
+void romfs_hashfree(FAR struct romfs_mountpt_s *rm)
+{
+  if (rm->rm_hash)
+    {
+      kfree(rm->rm_hash);
+    }
+
+  rm->rm_hash       = NULL;
+  rm->rm_nhash      = 0;
+  rm->rm_nhashalloc = 0;
+}
+
+/****************************************************************************
+ * Name: romfs_hashfirst
+ *
+ * Description:
+ *   Return the index of the first entry in the directory index with this
+ *   key.  If there is no such entry, the returned index will refer to an
+ *   entry with a different key or will be equal to rm->rm_nhash.
+ *
+ ****************************************************************************/
+
+uint32_t romfs_hashfirst(FAR struct romfs_mountpt_s *rm, uint32_t key)
+{
+  uint32_t low  = 0;
+  uint32_t high = rm->rm_nhash;
+  uint32_t mid;
+
+  while (low < high)
+    {
+      mid = (low + high) >> 1;
+      if (rm->rm_hash[mid].rh_key < key)
+        {
+          low = mid + 1;
+        }
+      else
+        {
+          high = mid;
+        }
+    }
+
+  return low;
+}
+
+#endif /* CONFIG_FS_ROMFS_DIRHASH */
@@ -309,6 +309,34 @@ static inline int romfs_searchdir(struct romfs_mountpt_s *rm,
   int16_t  ndx;
   int      ret;
 
+#ifdef CONFIG_FS_ROMFS_DIRHASH
+  /* If there is a directory index, then only the entries with a matching
+   * key need to be checked.  The index includes every entry so there is
+   * no need to search the directory on the media if none of them match.
+   */
+
+  if (rm->rm_hash)
+    {
+      uint32_t key = romfs_hashkey(dirinfo->rd_dir.fr_firstoffset,
+                                   entryname, entrylen);
+      uint32_t i;
+
+      for (i = romfs_hashfirst(rm, key);
+           i < rm->rm_nhash && rm->rm_hash[i].rh_key == key;
+           i++)
+        {
+          ret = romfs_checkentry(rm, rm->rm_hash[i].rh_offset, entryname,
+                                 entrylen, dirinfo);
+          if (ret == OK)
+            {
+              return OK;
+            }
+        }
+
+      return -ENOENT;
+    }
+#endif
+
   /* Then loop through the current directory until the directory
    * with the matching name is found.  Or until all of the entries
    * the directory have been examined.
@@ -837,11 +865,18 @@ int romfs_parsedirentry(struct romfs_mountpt_s *rm, uint32_t offset, uint32_t *p
       return ret;
     }
 
-  /* Because everything is chunked and aligned to 16-bit boundaries,
-   * we know that most the basic node info fits into the sector.  The
-   * associated name may not, however.
+  /* Following the hard links may have replaced the sector in the cache, so
+   * read the sector holding the real file header.  Because everything is
+   * chunked and aligned to 16-bit boundaries, we know that most the basic
+   * node info fits into the sector.  The associated name may not, however.
    */
 
+  ndx = romfs_devcacheread(rm, *poffset);
+  if (ndx < 0)
+    {
+      return ndx;
+    }
+
    next  = romfs_devread32(rm, ndx + ROMFS_FHDR_NEXT);
   *pnext = (save & RFNEXT_OFFSETMASK) | (next & RFNEXT_ALLMODEMASK);
   *pinfo = romfs_devread32(rm, ndx + ROMFS_FHDR_INFO);
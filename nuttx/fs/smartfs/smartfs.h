@@ -203,6 +203,23 @@
 #define   CONFIG_SMARTFS_DIRDEPTH 8
 #endif
 
+/* Sector cache and directory index configuration.  The directory index
+ * validates its hits by reading the indexed directory sector, so it is only
+ * useful (and only available) together with the sector cache.
+ */
+
+#ifndef CONFIG_SMARTFS_SECTORCACHE
+#  undef CONFIG_SMARTFS_DIRINDEX
+#endif
+
+#ifndef CONFIG_SMARTFS_NCACHESECTORS
+#  define CONFIG_SMARTFS_NCACHESECTORS 4
+#endif
+
+#ifndef CONFIG_SMARTFS_NDIRINDEX
+#  define CONFIG_SMARTFS_NDIRINDEX 16
+#endif
+
 #define SMARTFS_ERASEDSTATE_16BIT (uint16_t) ((CONFIG_SMARTFS_ERASEDSTATE << 8) | \
                                     CONFIG_SMARTFS_ERASEDSTATE)
 
@@ -282,6 +299,49 @@ struct smartfs_ofile_s
                                           * causes the sector to change. */
 };
 
+#ifdef CONFIG_SMARTFS_SECTORCACHE
+/* This structure describes one logical sector held in the sector cache */
+
+struct smartfs_cachesect_s
+{
+  uint16_t                  sector;     /* Logical sector number (0xffff: unused) */
+  uint32_t                  age;        /* LRU time stamp of the last access */
+  FAR uint8_t              *data;       /* Cached sector data (availbytes) */
+};
+
+#ifdef CONFIG_SMARTFS_DIRINDEX
+/* This structure describes one directory index entry.  It remembers where
+ * the entry for a name was last found in a directory so that the next
+ * lookup of the same name does not have to scan the directory chain.
+ */
+
+struct smartfs_dirindex_s
+{
+  uint16_t                  dirsector;  /* First sector of the parent directory
+                                         * (0xffff: unused) */
+  uint16_t                  hash;       /* Hash of the entry name */
+  uint16_t                  dsector;    /* Sector holding the directory entry */
+  uint16_t                  doffset;    /* Offset of the entry in dsector */
+  uint32_t                  age;        /* LRU time stamp of the last access */
+};
+#endif
+
+/* This structure holds the sector cache and directory index of a volume.
+ * Like the working buffers, it is shared by all mounts of the same block
+ * driver.
+ */
+
+struct smartfs_cache_s
+{
+  uint32_t                  clock;      /* LRU clock */
+  struct smartfs_cachestats_s stats;    /* Hit/miss counters */
+  struct smartfs_cachesect_s sect[CONFIG_SMARTFS_NCACHESECTORS];
+#ifdef CONFIG_SMARTFS_DIRINDEX
+  struct smartfs_dirindex_s index[CONFIG_SMARTFS_NDIRINDEX];
+#endif
+};
+#endif
+
 /* This structure represents the overall mountpoint state.  An instance of this
  * structure is retained as inode private data on each mountpoint that is
  * mounted with a smartfs filesystem.
@@ -300,6 +360,9 @@ struct smartfs_mountpt_s
   char                       *fs_rwbuffer;  /* Read/Write working buffer */
   char                       *fs_workbuffer;/* Working buffer */
   uint8_t                     fs_rootsector;/* Root directory sector num */
+#ifdef CONFIG_SMARTFS_SECTORCACHE
+  FAR struct smartfs_cache_s *fs_cache;     /* Sector cache and directory index */
+#endif
 };
 
 /****************************************************************************
@@ -344,6 +407,34 @@ int smartfs_countdirentries(struct smartfs_mountpt_s *fs,
 int smartfs_truncatefile(struct smartfs_mountpt_s *fs,
         struct smartfs_entry_s *entry);
 
+/* Sector access.  These go through the sector cache when it is enabled */
+
+#ifdef CONFIG_SMARTFS_SECTORCACHE
+int smartfs_cacheinit(struct smartfs_mountpt_s *fs);
+
+void smartfs_cachefree(struct smartfs_mountpt_s *fs);
+
+int smartfs_readsector(struct smartfs_mountpt_s *fs,
+        struct smart_read_write_s *req);
+
+int smartfs_writesector(struct smartfs_mountpt_s *fs,
+        struct smart_read_write_s *req);
+
+int smartfs_freesector(struct smartfs_mountpt_s *fs, uint16_t sector);
+#else
+#  define smartfs_readsector(f,r)  FS_IOCTL(f, BIOC_READSECT, (unsigned long)(r))
+#  define smartfs_writesector(f,r) FS_IOCTL(f, BIOC_WRITESECT, (unsigned long)(r))
+#  define smartfs_freesector(f,s)  FS_IOCTL(f, BIOC_FREESECT, (unsigned long)(s))
+#endif
+
+#ifdef CONFIG_SMARTFS_DIRINDEX
+int smartfs_findindex(struct smartfs_mountpt_s *fs, uint16_t dirsector,
+        const char *name, uint16_t *dsector, uint16_t *doffset);
+
+void smartfs_addindex(struct smartfs_mountpt_s *fs, uint16_t dirsector,
+        const char *name, uint16_t dsector, uint16_t doffset);
+#endif
+
 struct file;        /* Forward references */
 struct inode;
 struct fs_dirent_s;
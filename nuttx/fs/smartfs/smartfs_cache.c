@@ -0,0 +1,471 @@
+/****************************************************************************
+ * fs/smartfs/smartfs_cache.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/kmalloc.h>
+#include <nuttx/fs/fs.h>
+#include <nuttx/fs/ioctl.h>
+
+#include "smartfs.h"
+
+#ifdef CONFIG_SMARTFS_SECTORCACHE
+
+/****************************************************************************
+ * Definitions
+ ****************************************************************************/
+
+#define SMARTFS_UNUSED  0xffff
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: smartfs_cachefind
+ *
+ * Description:
+ *   Return the cache slot holding the logical sector or NULL if the sector
+ *   is not cached.
+ *
+ ****************************************************************************/
+
+static FAR struct smartfs_cachesect_s *
+smartfs_cachefind(FAR struct smartfs_cache_s *cache, uint16_t sector)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_SMARTFS_NCACHESECTORS; i++)
+    {
+      if (cache->sect[i].sector == sector)
+        {
+          return &cache->sect[i];
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: smartfs_cachealloc
+ *
+ * Description:
+ *   Return an unused cache slot or, if there is none, the least recently
+ *   used one.
+ *
+ ****************************************************************************/
+
+static FAR struct smartfs_cachesect_s *
+smartfs_cachealloc(FAR struct smartfs_cache_s *cache)
+{
+  FAR struct smartfs_cachesect_s *victim = &cache->sect[0];
+  int i;
+
+  for (i = 0; i < CONFIG_SMARTFS_NCACHESECTORS; i++)
+    {
+      if (cache->sect[i].sector == SMARTFS_UNUSED)
+        {
+          return &cache->sect[i];
+        }
+
+      if (cache->sect[i].age < victim->age)
+        {
+          victim = &cache->sect[i];
+        }
+    }
+
+  return victim;
+}
+
+/****************************************************************************
+ * Name: smartfs_namehash
+ *
+ * Description:
+ *   Hash the significant part of an entry name (at most namesize
+ *   characters, just as the directory scan compares them).
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SMARTFS_DIRINDEX
+static uint16_t smartfs_namehash(FAR const char *name, uint8_t namesize)
+{
+  uint16_t hash = 5381;
+  int i;
+
+  for (i = 0; i < namesize && name[i] != '\0'; i++)
+    {
+      hash = (hash << 5) + hash + (uint8_t)name[i];
+    }
+
+  return hash;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: smartfs_cacheinit
+ *
+ * Description:
+ *   Allocate the sector cache and directory index of a volume.  The cache
+ *   is an optimization only:  If it cannot be allocated, then all sector
+ *   accesses go directly to the block driver.
+ *
+ ****************************************************************************/
+
+int smartfs_cacheinit(FAR struct smartfs_mountpt_s *fs)
+{
+  FAR struct smartfs_cache_s *cache;
+  FAR uint8_t *data;
+  int i;
+
+  cache = (FAR struct smartfs_cache_s *)
+    kzalloc(sizeof(struct smartfs_cache_s) +
+            CONFIG_SMARTFS_NCACHESECTORS * fs->fs_llformat.availbytes);
+
+  fs->fs_cache = cache;
+  if (!cache)
+    {
+      fdbg("Failed to allocate the sector cache\n");
+      return -ENOMEM;
+    }
+
+  data = (FAR uint8_t *)&cache[1];
+  for (i = 0; i < CONFIG_SMARTFS_NCACHESECTORS; i++)
+    {
+      cache->sect[i].sector = SMARTFS_UNUSED;
+      cache->sect[i].data   = data;
+      data += fs->fs_llformat.availbytes;
+    }
+
+#ifdef CONFIG_SMARTFS_DIRINDEX
+  for (i = 0; i < CONFIG_SMARTFS_NDIRINDEX; i++)
+    {
+      cache->index[i].dirsector = SMARTFS_UNUSED;
+    }
+#endif
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: smartfs_cachefree
+ *
+ * Description:
+ *   Release the sector cache and directory index of a volume.
+ *
+ ****************************************************************************/
+
+void smartfs_cachefree(FAR struct smartfs_mountpt_s *fs)
+{
+  if (fs->fs_cache)
+    {
+      kfree(fs->fs_cache);
+      fs->fs_cache = NULL;
+    }
+}
+
+/****************************************************************************
+ * Name: smartfs_readsector
+ *
+ * Description:
+ *   Read (part of) a logical sector.  Reads of a cached sector are served
+ *   from RAM.  Whole-sector reads that miss are added to the cache;
+ *   partial reads (such as the chain header reads done when walking a
+ *   file) are passed through without displacing anything.
+ *
+ ****************************************************************************/
+
+int smartfs_readsector(FAR struct smartfs_mountpt_s *fs,
+                       FAR struct smart_read_write_s *req)
+{
+  FAR struct smartfs_cache_s *cache = fs->fs_cache;
+  FAR struct smartfs_cachesect_s *cs;
+  int ret;
+
+  if (!cache)
+    {
+      return FS_IOCTL(fs, BIOC_READSECT, (unsigned long)req);
+    }
+
+  cs = smartfs_cachefind(cache, req->logsector);
+  if (cs)
+    {
+      memcpy((FAR uint8_t *)req->buffer, &cs->data[req->offset], req->count);
+      cs->age = ++cache->clock;
+      cache->stats.hits++;
+      return req->count;
+    }
+
+  cache->stats.misses++;
+  ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long)req);
+  if (ret >= 0 && req->offset == 0 &&
+      req->count == fs->fs_llformat.availbytes)
+    {
+      cs = smartfs_cachealloc(cache);
+      cs->sector = req->logsector;
+      cs->age    = ++cache->clock;
+      memcpy(cs->data, req->buffer, req->count);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: smartfs_writesector
+ *
+ * Description:
+ *   Write (part of) a logical sector.  The cache is write-through:  The
+ *   data is always written to the block driver and a cached copy of the
+ *   sector is updated to match.
+ *
+ ****************************************************************************/
+
+int smartfs_writesector(FAR struct smartfs_mountpt_s *fs,
+                        FAR struct smart_read_write_s *req)
+{
+  FAR struct smartfs_cache_s *cache = fs->fs_cache;
+  FAR struct smartfs_cachesect_s *cs;
+  int ret;
+
+  ret = FS_IOCTL(fs, BIOC_WRITESECT, (unsigned long)req);
+  if (cache)
+    {
+      cs = smartfs_cachefind(cache, req->logsector);
+      if (cs)
+        {
+          if (ret >= 0)
+            {
+              memcpy(&cs->data[req->offset], req->buffer, req->count);
+            }
+          else
+            {
+              /* The content of the sector is unknown after a failed write */
+
+              cs->sector = SMARTFS_UNUSED;
+            }
+        }
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: smartfs_freesector
+ *
+ * Description:
+ *   Free a logical sector.  The sector is dropped from the cache, as are
+ *   any directory index entries that refer to it.
+ *
+ ****************************************************************************/
+
+int smartfs_freesector(FAR struct smartfs_mountpt_s *fs, uint16_t sector)
+{
+  FAR struct smartfs_cache_s *cache = fs->fs_cache;
+  FAR struct smartfs_cachesect_s *cs;
+#ifdef CONFIG_SMARTFS_DIRINDEX
+  FAR struct smartfs_dirindex_s *ix;
+  int i;
+#endif
+
+  if (cache)
+    {
+      cs = smartfs_cachefind(cache, sector);
+      if (cs)
+        {
+          cs->sector = SMARTFS_UNUSED;
+        }
+
+#ifdef CONFIG_SMARTFS_DIRINDEX
+      for (i = 0; i < CONFIG_SMARTFS_NDIRINDEX; i++)
+        {
+          ix = &cache->index[i];
+          if (ix->dsector == sector || ix->dirsector == sector)
+            {
+              ix->dirsector = SMARTFS_UNUSED;
+            }
+        }
+#endif
+    }
+
+  return FS_IOCTL(fs, BIOC_FREESECT, (unsigned long)sector);
+}
+
+/****************************************************************************
+ * Name: smartfs_findindex
+ *
+ * Description:
+ *   Look up the entry for name in the directory starting at dirsector.
+ *   Index entries are only hints:  A hit is confirmed by reading the
+ *   indexed directory sector (normally from the sector cache) and checking
+ *   that an active entry with the same name is still there.  Stale entries
+ *   are discarded.
+ *
+ *   On success, the directory sector has been read into fs->fs_rwbuffer
+ *   and the location of the entry is returned in dsector and doffset.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SMARTFS_DIRINDEX
+int smartfs_findindex(FAR struct smartfs_mountpt_s *fs, uint16_t dirsector,
+                      FAR const char *name, FAR uint16_t *dsector,
+                      FAR uint16_t *doffset)
+{
+  FAR struct smartfs_cache_s *cache = fs->fs_cache;
+  FAR struct smartfs_dirindex_s *ix;
+  FAR struct smartfs_entry_header_s *entry;
+  struct smart_read_write_s readwrite;
+  uint16_t entrysize;
+  uint16_t hash;
+  int ret;
+  int i;
+
+  if (!cache)
+    {
+      return -ENOENT;
+    }
+
+  entrysize = sizeof(struct smartfs_entry_header_s) + fs->fs_llformat.namesize;
+  hash = smartfs_namehash(name, fs->fs_llformat.namesize);
+
+  for (i = 0; i < CONFIG_SMARTFS_NDIRINDEX; i++)
+    {
+      ix = &cache->index[i];
+      if (ix->dirsector != dirsector || ix->hash != hash)
+        {
+          continue;
+        }
+
+      readwrite.logsector = ix->dsector;
+      readwrite.offset = 0;
+      readwrite.count = fs->fs_llformat.availbytes;
+      readwrite.buffer = (uint8_t *)fs->fs_rwbuffer;
+      ret = smartfs_readsector(fs, &readwrite);
+
+      entry = (struct smartfs_entry_header_s *) &fs->fs_rwbuffer[ix->doffset];
+      if (ret >= 0 && ix->doffset + entrysize <= readwrite.count &&
+          (entry->flags & SMARTFS_DIRENT_EMPTY) !=
+          (SMARTFS_ERASEDSTATE_16BIT & SMARTFS_DIRENT_EMPTY) &&
+          (entry->flags & SMARTFS_DIRENT_ACTIVE) ==
+          (SMARTFS_ERASEDSTATE_16BIT & SMARTFS_DIRENT_ACTIVE) &&
+          strncmp(entry->name, name, fs->fs_llformat.namesize) == 0)
+        {
+          ix->age = ++cache->clock;
+          cache->stats.ixhits++;
+
+          *dsector = ix->dsector;
+          *doffset = ix->doffset;
+          return OK;
+        }
+
+      /* The entry was deleted, renamed, or this is a hash collision */
+
+      ix->dirsector = SMARTFS_UNUSED;
+    }
+
+  cache->stats.ixmisses++;
+  return -ENOENT;
+}
+
+/****************************************************************************
+ * Name: smartfs_addindex
+ *
+ * Description:
+ *   Record where the entry for name was found in the directory starting at
+ *   dirsector, replacing the least recently used index entry if necessary.
+ *
+ ****************************************************************************/
+
+void smartfs_addindex(FAR struct smartfs_mountpt_s *fs, uint16_t dirsector,
+                      FAR const char *name, uint16_t dsector,
+                      uint16_t doffset)
+{
+  FAR struct smartfs_cache_s *cache = fs->fs_cache;
+  FAR struct smartfs_dirindex_s *victim;
+  FAR struct smartfs_dirindex_s *ix;
+  uint16_t hash;
+  int i;
+
+  if (!cache)
+    {
+      return;
+    }
+
+  hash   = smartfs_namehash(name, fs->fs_llformat.namesize);
+  victim = &cache->index[0];
+
+  for (i = 0; i < CONFIG_SMARTFS_NDIRINDEX; i++)
+    {
+      ix = &cache->index[i];
+      if (ix->dirsector == dirsector && ix->hash == hash)
+        {
+          victim = ix;
+          break;
+        }
+
+      if (ix->dirsector == SMARTFS_UNUSED)
+        {
+          if (victim->dirsector != SMARTFS_UNUSED)
+            {
+              victim = ix;
+            }
+        }
+      else if (victim->dirsector != SMARTFS_UNUSED && ix->age < victim->age)
+        {
+          victim = ix;
+        }
+    }
+
+  victim->dirsector = dirsector;
+  victim->hash      = hash;
+  victim->dsector   = dsector;
+  victim->doffset   = doffset;
+  victim->age       = ++cache->clock;
+}
+#endif /* CONFIG_SMARTFS_DIRINDEX */
+#endif /* CONFIG_SMARTFS_SECTORCACHE */
@@ -485,7 +485,7 @@ static ssize_t smartfs_read(FAR struct file *filep, char *buffer, size_t buflen)
       readwrite.offset = 0;
       readwrite.buffer = (uint8_t *) fs->fs_rwbuffer;
       readwrite.count = fs->fs_llformat.availbytes;
-      ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+      ret = smartfs_readsector(fs, &readwrite);
       if (ret < 0)
         {
           fdbg("Error %d reading sector %d data\n", ret, sf->currsector);
@@ -586,7 +586,7 @@ static int smartfs_sync_internal(struct smartfs_mountpt_s *fs,
       readwrite.offset = 0;
       readwrite.buffer = (uint8_t *) fs->fs_rwbuffer;
       readwrite.count = sizeof(struct smartfs_chain_header_s);
-      ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+      ret = smartfs_readsector(fs, &readwrite);
       if (ret < 0)
         {
           fdbg("Error %d reading sector %d data\n", ret, sf->currsector);
@@ -608,7 +608,7 @@ static int smartfs_sync_internal(struct smartfs_mountpt_s *fs,
       readwrite.offset = offsetof(struct smartfs_chain_header_s, used);
       readwrite.count = sizeof(uint16_t);
       readwrite.buffer = (uint8_t *) &fs->fs_rwbuffer[readwrite.offset];
-      ret = FS_IOCTL(fs, BIOC_WRITESECT, (unsigned long) &readwrite);
+      ret = smartfs_writesector(fs, &readwrite);
       if (ret < 0)
         {
           fdbg("Error %d writing used bytes for sector %d\n", ret, sf->currsector);
@@ -710,7 +710,7 @@ static ssize_t smartfs_write(FAR struct file *filep, const char *buffer,
 
       /* Now perform the write. */
 
-      ret = FS_IOCTL(fs, BIOC_WRITESECT, (unsigned long) &readwrite);
+      ret = smartfs_writesector(fs, &readwrite);
       if (ret < 0)
         {
           fdbg("Error %d writing sector %d data\n", ret, sf->currsector);
@@ -736,7 +736,7 @@ static ssize_t smartfs_write(FAR struct file *filep, const char *buffer,
           readwrite.offset = 0;
           readwrite.buffer = (uint8_t *) fs->fs_rwbuffer;
           readwrite.count = sizeof(struct smartfs_chain_header_s);
-          ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+          ret = smartfs_readsector(fs, &readwrite);
           if (ret < 0)
             {
               fdbg("Error %d reading sector %d header\n", ret, sf->currsector);
@@ -771,7 +771,7 @@ static ssize_t smartfs_write(FAR struct file *filep, const char *buffer,
 
       /* Perform the write */
 
-      ret = FS_IOCTL(fs, BIOC_WRITESECT, (unsigned long) &readwrite);
+      ret = smartfs_writesector(fs, &readwrite);
       if (ret < 0)
         {
           fdbg("Error %d writing sector %d data\n", ret, sf->currsector);
@@ -816,7 +816,7 @@ static ssize_t smartfs_write(FAR struct file *filep, const char *buffer,
                 nextsector);
               readwrite.buffer = (uint8_t *) header->nextsector;
               readwrite.count = sizeof(uint16_t);
-              ret = FS_IOCTL(fs, BIOC_WRITESECT, (unsigned long) &readwrite);
+              ret = smartfs_writesector(fs, &readwrite);
               if (ret < 0)
                 {
                   fdbg("Error %d writing next sector\n", ret);
@@ -949,7 +949,7 @@ static off_t smartfs_seek_internal(struct smartfs_mountpt_s *fs,
       readwrite.offset = 0;
       readwrite.count = sizeof(struct smartfs_chain_header_s);
       readwrite.buffer = (uint8_t *) fs->fs_rwbuffer;
-      ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+      ret = smartfs_readsector(fs, &readwrite);
       if (ret < 0)
         {
           fdbg("Error %d reading sector %d header\n", ret, sf->currsector);
@@ -1018,9 +1018,44 @@ static off_t smartfs_seek(FAR struct file *filep, off_t offset, int whence)
 
 static int smartfs_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 {
+#ifdef CONFIG_SMARTFS_SECTORCACHE
+  struct smartfs_mountpt_s *fs;
+  FAR struct smartfs_cachestats_s *stats;
+  int ret = -ENOSYS;
+
+  if (cmd == FIOC_CACHESTATS)
+    {
+      /* Return the sector cache and directory index counters */
+
+      DEBUGASSERT(filep->f_inode != NULL);
+      fs    = filep->f_inode->i_private;
+      stats = (FAR struct smartfs_cachestats_s *)((uintptr_t)arg);
+      if (!stats)
+        {
+          return -EINVAL;
+        }
+
+      smartfs_semtake(fs);
+      if (fs->fs_cache)
+        {
+          memcpy(stats, &fs->fs_cache->stats,
+                 sizeof(struct smartfs_cachestats_s));
+          ret = OK;
+        }
+      else
+        {
+          ret = -ENOMEM;
+        }
+
+      smartfs_semgive(fs);
+    }
+
+  return ret;
+#else
   /* We don't use any ioctls */
 
   return -ENOSYS;
+#endif
 }
 
 /****************************************************************************
@@ -1192,7 +1227,7 @@ static int smartfs_readdir(struct inode *mountpt, struct fs_dirent_s *dir)
       readwrite.count = fs->fs_llformat.availbytes;
       readwrite.buffer = (uint8_t *)fs->fs_rwbuffer;
       readwrite.offset = 0;
-      ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+      ret = smartfs_readsector(fs, &readwrite);
       if (ret < 0)
         {
           goto errout_with_semaphore;
@@ -1774,7 +1809,7 @@ int smartfs_rename(struct inode *mountpt, const char *oldrelpath,
           readwrite.offset = 0;
           readwrite.count = fs->fs_llformat.availbytes;
           readwrite.buffer = (uint8_t *) fs->fs_rwbuffer;
-          ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+          ret = smartfs_readsector(fs, &readwrite);
           if (ret < 0)
             {
               fdbg("Error %d reading sector %d data\n", ret, oldentry.dsector);
@@ -1846,7 +1881,7 @@ int smartfs_rename(struct inode *mountpt, const char *oldrelpath,
       readwrite.offset = 0;
       readwrite.count = fs->fs_llformat.availbytes;
       readwrite.buffer = (uint8_t *) fs->fs_rwbuffer;
-      ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+      ret = smartfs_readsector(fs, &readwrite);
       if (ret < 0)
         {
           fdbg("Error %d reading sector %d data\n", ret, oldentry.dsector);
@@ -1865,7 +1900,7 @@ int smartfs_rename(struct inode *mountpt, const char *oldrelpath,
       readwrite.offset = oldentry.doffset;
       readwrite.count = sizeof(direntry->flags);
       readwrite.buffer = (uint8_t *) &direntry->flags;
-      ret = FS_IOCTL(fs, BIOC_WRITESECT, (unsigned long) &readwrite);
+      ret = smartfs_writesector(fs, &readwrite);
       if (ret < 0)
         {
           fdbg("Error %d writing flag bytes for sector %d\n", ret, readwrite.logsector);
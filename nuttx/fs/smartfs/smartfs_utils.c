@@ -198,6 +198,9 @@ int smartfs_mount(struct smartfs_mountpt_s *fs, bool writeable)
 
           fs->fs_rwbuffer = nextfs->fs_rwbuffer;
           fs->fs_workbuffer = nextfs->fs_workbuffer;
+#ifdef CONFIG_SMARTFS_SECTORCACHE
+          fs->fs_cache = nextfs->fs_cache;
+#endif
           break;
         }
 
@@ -212,6 +215,9 @@ int smartfs_mount(struct smartfs_mountpt_s *fs, bool writeable)
     {
       fs->fs_rwbuffer = (char *) kmalloc(fs->fs_llformat.availbytes);
       fs->fs_workbuffer = (char *) kmalloc(256);
+#ifdef CONFIG_SMARTFS_SECTORCACHE
+      (void)smartfs_cacheinit(fs);
+#endif
     }
 
   /* Now add ourselves to the linked list of SMART mounts */
@@ -230,6 +236,9 @@ int smartfs_mount(struct smartfs_mountpt_s *fs, bool writeable)
   fs->fs_rwbuffer = (char *) kmalloc(fs->fs_llformat.availbytes);
   fs->fs_workbuffer = (char *) kmalloc(256);
   fs->fs_rootsector = SMARTFS_ROOT_DIR_SECTOR;
+#ifdef CONFIG_SMARTFS_SECTORCACHE
+  (void)smartfs_cacheinit(fs);
+#endif
 #endif
 
   /* We did it! */
@@ -342,6 +351,9 @@ int smartfs_unmount(struct smartfs_mountpt_s *fs)
 
       kfree(fs->fs_rwbuffer);
       kfree(fs->fs_workbuffer);
+#ifdef CONFIG_SMARTFS_SECTORCACHE
+      smartfs_cachefree(fs);
+#endif
 
       /* Set the buffer's to invalid value to catch program bugs */
 
@@ -380,6 +392,9 @@ int smartfs_unmount(struct smartfs_mountpt_s *fs)
 
   kfree(fs->fs_rwbuffer);
   kfree(fs->fs_workbuffer);
+#ifdef CONFIG_SMARTFS_SECTORCACHE
+  smartfs_cachefree(fs);
+#endif
 #endif
 
   return ret;
@@ -414,6 +429,7 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs,
   uint16_t    dirsector;
   uint16_t    entrysize;
   uint16_t    offset;
+  uint16_t    startoffset;
   struct      smartfs_chain_header_s *header;
   struct      smart_read_write_s readwrite;
   struct      smartfs_entry_header_s *entry;
@@ -499,6 +515,17 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs,
           /* Search for the entry in the current directory */
 
           dirsector = dirstack[depth];
+          startoffset = sizeof(struct smartfs_chain_header_s);
+
+#ifdef CONFIG_SMARTFS_DIRINDEX
+          /* If the directory index knows where this entry lives, then start
+           * the search right at the entry instead of at the head of the
+           * directory chain.
+           */
+
+          (void)smartfs_findindex(fs, dirsector, fs->fs_workbuffer,
+                                  &dirsector, &startoffset);
+#endif
 
           /* Read the directory */
 
@@ -516,7 +543,7 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs,
               readwrite.count = fs->fs_llformat.availbytes;
               readwrite.buffer = (uint8_t *)fs->fs_rwbuffer;
               readwrite.offset = 0;
-              ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+              ret = smartfs_readsector(fs, &readwrite);
               if (ret < 0)
                 {
                   goto errout;
@@ -529,7 +556,8 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs,
 
               /* Search for the entry */
 
-              offset = sizeof(struct smartfs_chain_header_s);
+              offset = startoffset;
+              startoffset = sizeof(struct smartfs_chain_header_s);
               entry = (struct smartfs_entry_header_s *) &fs->fs_rwbuffer[offset];
               while (offset < readwrite.count)
                 {
@@ -560,6 +588,11 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs,
                        * open it and continue searching.
                        */
 
+#ifdef CONFIG_SMARTFS_DIRINDEX
+                      smartfs_addindex(fs, dirstack[depth], fs->fs_workbuffer,
+                                       readwrite.logsector, offset);
+#endif
+
                       if (*ptr == '\0')
                         {
                           /* We are at the last segment.  Report the entry */
@@ -597,7 +630,7 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs,
                                   /* Read the next sector of the file */
 
                                   readwrite.logsector = dirsector;
-                                  ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+                                  ret = smartfs_readsector(fs, &readwrite);
                                   if (ret < 0)
                                     {
                                       fdbg("Error in sector chain at %d!\n", dirsector);
@@ -755,7 +788,7 @@ int smartfs_createentry(struct smartfs_mountpt_s *fs,
       readwrite.count = fs->fs_llformat.availbytes;
       readwrite.offset = 0;
       readwrite.buffer = (uint8_t *) fs->fs_rwbuffer;
-      ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+      ret = smartfs_readsector(fs, &readwrite);
       if (ret < 0)
         {
           goto errout;
@@ -822,7 +855,7 @@ int smartfs_createentry(struct smartfs_mountpt_s *fs,
               nextsector);
           readwrite.count = sizeof(uint16_t);
           readwrite.buffer = chainheader->nextsector;
-          ret = FS_IOCTL(fs, BIOC_WRITESECT, (unsigned long) &readwrite);
+          ret = smartfs_writesector(fs, &readwrite);
           if (ret < 0)
             {
               fdbg("Error chaining sector %d\n", nextsector);
@@ -872,7 +905,7 @@ int smartfs_createentry(struct smartfs_mountpt_s *fs,
       readwrite.offset = offsetof(struct smartfs_chain_header_s, type);
       readwrite.buffer = (uint8_t *) &chainheader->type;
       readwrite.logsector = nextsector;
-      ret = FS_IOCTL(fs, BIOC_WRITESECT, (unsigned long) &readwrite);
+      ret = smartfs_writesector(fs, &readwrite);
       if (ret < 0)
         {
           fdbg("Error %d setting new sector type for sector %d\n",ret,  nextsector);
@@ -899,7 +932,7 @@ int smartfs_createentry(struct smartfs_mountpt_s *fs,
   readwrite.offset = offset;
   readwrite.count = entrysize;
   readwrite.buffer = (uint8_t *) &fs->fs_rwbuffer[offset];
-  ret = FS_IOCTL(fs, BIOC_WRITESECT, (unsigned long) &readwrite);
+  ret = smartfs_writesector(fs, &readwrite);
   if (ret < 0)
     {
       goto errout;
@@ -975,7 +1008,7 @@ int smartfs_deleteentry(struct smartfs_mountpt_s *fs,
 
       sector = nextsector;
       readwrite.logsector = sector;
-      ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+      ret = smartfs_readsector(fs, &readwrite);
       if (ret < 0)
         {
           fdbg("Error reading sector %d\n", nextsector);
@@ -985,7 +1018,7 @@ int smartfs_deleteentry(struct smartfs_mountpt_s *fs,
       /* Release this sector */
 
       nextsector = SMARTFS_NEXTSECTOR(header);
-      ret = FS_IOCTL(fs, BIOC_FREESECT, sector);
+      ret = smartfs_freesector(fs, sector);
     }
 
   /* Remove the entry from the directory tree */
@@ -994,7 +1027,7 @@ int smartfs_deleteentry(struct smartfs_mountpt_s *fs,
   readwrite.offset = 0;
   readwrite.count = fs->fs_llformat.availbytes;
   readwrite.buffer = (uint8_t *) fs->fs_rwbuffer;
-  ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+  ret = smartfs_readsector(fs, &readwrite);
   if (ret < 0)
     {
       fdbg("Error reading directory info at sector %s\n", entry->dsector);
@@ -1015,7 +1048,7 @@ int smartfs_deleteentry(struct smartfs_mountpt_s *fs,
   readwrite.offset = entry->doffset;
   readwrite.count = sizeof(uint16_t);
   readwrite.buffer = (uint8_t *) &direntry->flags;
-  ret = FS_IOCTL(fs, BIOC_WRITESECT, (unsigned long) &readwrite);
+  ret = smartfs_writesector(fs, &readwrite);
   if (ret < 0)
     {
       fdbg("Error marking entry inactive at sector %s\n", entry->dsector);
@@ -1073,7 +1106,7 @@ int smartfs_deleteentry(struct smartfs_mountpt_s *fs,
               /* Read the header for the next sector */
 
               readwrite.logsector = sector;
-              ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+              ret = smartfs_readsector(fs, &readwrite);
               if (ret < 0)
                 {
                   fdbg("Error reading sector %d\n", nextsector);
@@ -1090,7 +1123,7 @@ int smartfs_deleteentry(struct smartfs_mountpt_s *fs,
                   readwrite.offset = offsetof(struct smartfs_chain_header_s, nextsector);
                   readwrite.count = sizeof(uint16_t);
                   readwrite.buffer = header->nextsector;
-                  ret = FS_IOCTL(fs, BIOC_WRITESECT, (unsigned long) &readwrite);
+                  ret = smartfs_writesector(fs, &readwrite);
                   if (ret < 0)
                     {
                       fdbg("Error unchaining sector (%d)\n", nextsector);
@@ -1099,7 +1132,7 @@ int smartfs_deleteentry(struct smartfs_mountpt_s *fs,
 
                   /* Now release our sector */
 
-                  ret = FS_IOCTL(fs, BIOC_FREESECT, (unsigned long) entry->dsector);
+                  ret = smartfs_freesector(fs, entry->dsector);
                   if (ret < 0)
                     {
                       fdbg("Error freeing sector %d\n", entry->dsector);
@@ -1158,7 +1191,7 @@ int smartfs_countdirentries(struct smartfs_mountpt_s *fs,
       readwrite.offset = 0;
       readwrite.count = fs->fs_llformat.availbytes;
       readwrite.buffer = (uint8_t *) fs->fs_rwbuffer;
-      ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+      ret = smartfs_readsector(fs, &readwrite);
       if (ret < 0)
         {
           fdbg("Error reading sector %d\n", nextsector);
@@ -1235,7 +1268,7 @@ int smartfs_truncatefile(struct smartfs_mountpt_s *fs,
       readwrite.offset = 0;
       readwrite.count = sizeof(struct smartfs_chain_header_s);
       readwrite.buffer = (uint8_t *) fs->fs_rwbuffer;
-      ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
+      ret = smartfs_readsector(fs, &readwrite);
       if (ret < 0)
         {
           fdbg("Error reading sector %d header\n", nextsector);
@@ -1262,7 +1295,7 @@ int smartfs_truncatefile(struct smartfs_mountpt_s *fs,
           /* Now write the new sector data */
 
           readwrite.count = fs->fs_llformat.availbytes;
-          ret = FS_IOCTL(fs, BIOC_WRITESECT, (unsigned long) &readwrite);
+          ret = smartfs_writesector(fs, &readwrite);
           if (ret < 0)
             {
               fdbg("Error blanking 1st sector (%d) of file\n", nextsector);
@@ -1277,7 +1310,7 @@ int smartfs_truncatefile(struct smartfs_mountpt_s *fs,
         {
           /* Not the 1st sector -- release it */
 
-          ret = FS_IOCTL(fs, BIOC_FREESECT, (unsigned long) nextsector);
+          ret = smartfs_freesector(fs, nextsector);
           if (ret < 0)
             {
               fdbg("Error freeing sector %d\n", nextsector);
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe.h
  *
- *   Copyright (C) 2008-2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -42,6 +42,7 @@
 
 #include <nuttx/config.h>
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -62,6 +63,16 @@
 #  define CONFIG_NX_NCOLORS 256
 #endif
 
+#ifndef CONFIG_NX_NDAMAGE
+#  define CONFIG_NX_NDAMAGE      4  /* Max damaged rectangles per window */
+#endif
+
+/* Backing stores are rendered with the framebuffer raster operations */
+
+#if defined(CONFIG_NX_BACKINGSTORE) && defined(CONFIG_NX_LCDDRIVER)
+#  error "CONFIG_NX_BACKINGSTORE is not supported with CONFIG_NX_LCDDRIVER"
+#endif
+
 /* NXBE Definitions *********************************************************/
 /* These are the values for the clipping order provided to nx_clipper */
 
@@ -76,9 +87,30 @@
 #define NXBE_WINDOW_BLOCKED  (1 << 0) /* The window is blocked and will not
                                        * receive further input. */
 
+#define NXBE_WINDOW_BACKED   (1 << 1) /* A backing store was requested for
+                                       * the window */
+
 #define NXBE_ISBLOCKED(wnd)  (((wnd)->flags & NXBE_WINDOW_BLOCKED) != 0)
 #define NXBE_SETBLOCKED(wnd) do { (wnd)->flags |= NXBE_WINDOW_BLOCKED; } while (0)
 
+/* True if the window's contents are currently held in a backing store */
+
+#ifdef CONFIG_NX_BACKINGSTORE
+#  define NXBE_ISBACKED(wnd) ((wnd)->bs[0].fbmem != NULL)
+#endif
+
+/* Must be called whenever the window stack or the geometry of any window
+ * changes.  This invalidates the cached visible regions of all windows.
+ * Zero is never used so that a new window never has a valid region.
+ */
+
+#ifdef CONFIG_NX_CLIPCACHE
+#  define NXBE_CLIPCHANGED(be) \
+  do { if (++(be)->clipgen == 0) (be)->clipgen = 1; } while (0)
+#else
+#  define NXBE_CLIPCHANGED(be)
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -114,6 +146,12 @@ struct nxbe_plane_s
                         FAR const void *src,
                         FAR const struct nxgl_point_s *origin,
                         unsigned int srcstride);
+#ifdef CONFIG_NX_BLEND
+  void (*blendrectangle)(FAR NX_PLANEINFOTYPE *pinfo,
+                         FAR const struct nxgl_rect_s *dest,
+                         FAR const struct nxgl_blend_s *blend,
+                         FAR const struct nxgl_point_s *origin);
+#endif
 
   /* Framebuffer plane info describing destination video plane */
 
@@ -166,9 +204,42 @@ struct nxbe_window_s
 
   struct nxgl_rect_s bounds;          /* The bounding rectangle of window */
 
+  /* Regions of the window that must be redrawn by the client.  These are
+   * in window-relative coordinates and are accumulated until the next call
+   * to nxbe_flushdamage().
+   */
+
+#if CONFIG_NX_NDAMAGE > 0
+  uint8_t ndamage;                    /* Number of valid damage rectangles */
+  struct nxgl_rect_s damage[CONFIG_NX_NDAMAGE];
+#endif
+
+  /* Off-screen copy of the entire window (including any parts that are
+   * obscured or off the display), one per color plane.  Each is
+   * addressed in window-relative coordinates.  fbmem is NULL if the
+   * window has no backing store.
+   */
+
+#ifdef CONFIG_NX_BACKINGSTORE
+  NX_PLANEINFOTYPE bs[CONFIG_NX_NPLANES];
+#endif
+
+  /* The visible region of the window (the parts on the display and not
+   * obscured by any window above) as a list of non-overlapping rectangles
+   * in absolute screen coordinates.  The list is valid only while visgen
+   * is equal to the back-end clipgen.
+   */
+
+#ifdef CONFIG_NX_CLIPCACHE
+  uint32_t visgen;                    /* clipgen when vislist was built */
+  uint16_t nvisible;                  /* Number of rectangles in vislist */
+  uint16_t mxvisible;                 /* Allocated size of vislist */
+  FAR struct nxgl_rect_s *vislist;    /* The visible rectangles */
+#endif
+
   /* Window flags (see the NXBE_* bit definitions above) */
 
-#ifdef CONFIG_NX_MULTIUSER            /* Currently used only in multi-user mode */
+#if defined(CONFIG_NX_MULTIUSER) || defined(CONFIG_NX_BACKINGSTORE)
   uint8_t flags;
 #endif
 
@@ -187,6 +258,9 @@ struct nxbe_state_s
 
   FAR struct nxbe_window_s *topwnd; /* The window at the top of the display */
   struct nxbe_window_s bkgd;        /* The background window is always at the bottom */
+#ifdef CONFIG_NX_CLIPCACHE
+  uint32_t clipgen;                 /* Incremented when any visible region changes */
+#endif
 
   /* At present, only a solid colored background is supported for refills.  The
    * following provides the background color.  It would be nice to support
@@ -445,6 +519,120 @@ EXTERN void nxbe_bitmap(FAR struct nxbe_window_s *wnd,
                        FAR const struct nxgl_point_s *origin,
                        unsigned int stride);
 
+/****************************************************************************
+ * Name: nxbe_blendbitmap
+ *
+ * Description:
+ *   Alpha-blend a rectangular region of a larger image (or a solid color)
+ *   into the rectangle in the specified window.
+ *
+ * Input Parameters:
+ *   wnd    - The window that will receive the blended image
+ *   dest   - Describes the rectangular on the display that will receive the
+ *            the blended image.
+ *   blend  - The image or color, opacity, and alpha map for each plane.
+ *   origin - The origin of the upper, left-most corner of the full image
+ *            and alpha map.  Both dest and origin are in window
+ *            coordinates, however, origin may lie outside of the display.
+ *
+ * Return:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_BLEND
+EXTERN void nxbe_blendbitmap(FAR struct nxbe_window_s *wnd,
+                             FAR const struct nxgl_rect_s *dest,
+                             FAR const struct nxgl_blend_s blend[CONFIG_NX_NPLANES],
+                             FAR const struct nxgl_point_s *origin);
+#endif
+
+/****************************************************************************
+ * Name: nxbe_damage
+ *
+ * Descripton:
+ *   Add the rectangular region (in absolute screen coordinates) to the
+ *   damage list of the specified window.  Overlapping and adjacent regions
+ *   are coalesced.  The client will be asked to redraw the region on the
+ *   next call to nxbe_flushdamage().
+ *
+ ****************************************************************************/
+
+#if CONFIG_NX_NDAMAGE > 0
+EXTERN void nxbe_damage(FAR struct nxbe_window_s *wnd,
+                        FAR const struct nxgl_rect_s *rect);
+#else
+#  define nxbe_damage(wnd,rect) nxfe_redrawreq(wnd,rect)
+#endif
+
+/****************************************************************************
+ * Name: nxbe_flushdamage
+ *
+ * Descripton:
+ *   Send one redraw request for each damaged region of each window and
+ *   clear the damage lists.  This is called once after each server message
+ *   (multi-user mode) or each NX call (single user mode) that may damage
+ *   windows.
+ *
+ ****************************************************************************/
+
+#if CONFIG_NX_NDAMAGE > 0
+EXTERN void nxbe_flushdamage(FAR struct nxbe_state_s *be);
+#else
+#  define nxbe_flushdamage(be) ((void)(be))
+#endif
+
+/****************************************************************************
+ * Name: nxbe_backingstore
+ *
+ * Descripton:
+ *   Enable or disable the backing store of a window.  While enabled, all
+ *   drawing operations are also rendered into an off-screen copy of the
+ *   window and exposed regions are restored from that copy rather than
+ *   being redrawn by the client.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_BACKINGSTORE
+EXTERN int nxbe_backingstore(FAR struct nxbe_window_s *wnd, bool enable);
+
+/****************************************************************************
+ * Name: nxbe_bsresize
+ *
+ * Descripton:
+ *   Re-allocate the backing store of a window after its size changes.  The
+ *   overlapping part of the old contents is preserved.
+ *
+ ****************************************************************************/
+
+EXTERN void nxbe_bsresize(FAR struct nxbe_window_s *wnd);
+
+/****************************************************************************
+ * Name: nxbe_bsupdate
+ *
+ * Descripton:
+ *   Copy the visible portions of the rectangular region (in absolute
+ *   screen coordinates, within the window and the display) from the
+ *   window's backing store to the display.
+ *
+ ****************************************************************************/
+
+EXTERN void nxbe_bsupdate(FAR struct nxbe_window_s *wnd,
+                          FAR const struct nxgl_rect_s *rect);
+
+/****************************************************************************
+ * Name: nxbe_bsrect
+ *
+ * Descripton:
+ *   Convert a rectangle in absolute screen coordinates that lies within
+ *   the window into backing store (window-relative) coordinates.
+ *
+ ****************************************************************************/
+
+#  define nxbe_bsrect(wnd,dest,src) \
+     nxgl_rectoffset(dest, src, -(wnd)->bounds.pt1.x, -(wnd)->bounds.pt1.y)
+#endif
+
 /****************************************************************************
  * Name: nxbe_redraw
  *
@@ -512,6 +700,33 @@ EXTERN void nxbe_clipper(FAR struct nxbe_window_s *wnd,
                          FAR struct nxbe_clipops_s *cops,
                          FAR struct nxbe_plane_s *plane);
 
+/****************************************************************************
+ * Name: nxbe_clipwindow
+ *
+ * Descripton:
+ *   Clip a rectangle to the visible region of a window and call the visible
+ *   callback for each visible part.  The obscured callback is not used.
+ *   If CONFIG_NX_CLIPCACHE is enabled, the cached visible region of the
+ *   window is used (and is recomputed first if it is no longer valid).
+ *   Otherwise, this is equivalent to calling nxbe_clipper() for the window
+ *   above with the default clip order.
+ *
+ * Input Parameters:
+ *   wnd   - The window to be clipped.
+ *   dest  - The region of concern (in absolute screen coordinates)
+ *   cops  - The callbacks to handle visible parts of the rectangle.
+ *   plane - The raster operations to be used by the callback functions.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+EXTERN void nxbe_clipwindow(FAR struct nxbe_window_s *wnd,
+                            FAR const struct nxgl_rect_s *dest,
+                            FAR struct nxbe_clipops_s *cops,
+                            FAR struct nxbe_plane_s *plane);
+
 /****************************************************************************
  * Name: nxbe_clipnull
  *
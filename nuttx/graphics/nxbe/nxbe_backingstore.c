@@ -0,0 +1,302 @@
+/****************************************************************************
+ * graphics/nxbe/nxbe_backingstore.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/kmalloc.h>
+#include <nuttx/nx/nxglib.h>
+
+#include "nxbe.h"
+#include "nxfe.h"
+
+#ifdef CONFIG_NX_BACKINGSTORE
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct nxbe_bsupdate_s
+{
+  struct nxbe_clipops_s cops;
+  FAR NX_PLANEINFOTYPE *bs;         /* Backing store of one color plane */
+  struct nxgl_point_s origin;       /* Position of the window on the display */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxbe_clipbscopy
+ *
+ * Description:
+ *  Called from nxbe_clipwindow() to copy visible portions of the rectangle
+ *  from the backing store to the display.
+ *
+ ****************************************************************************/
+
+static void nxbe_clipbscopy(FAR struct nxbe_clipops_s *cops,
+                            FAR struct nxbe_plane_s *plane,
+                            FAR const struct nxgl_rect_s *rect)
+{
+  struct nxbe_bsupdate_s *info = (struct nxbe_bsupdate_s *)cops;
+  plane->copyrectangle(&plane->pinfo, rect, info->bs->fbmem,
+                       &info->origin, info->bs->stride);
+}
+
+/****************************************************************************
+ * Name: nxbe_bsfree
+ *
+ * Description:
+ *  Free the backing store memory of each color plane
+ *
+ ****************************************************************************/
+
+static void nxbe_bsfree(FAR struct nxbe_window_s *wnd)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_NX_NPLANES; i++)
+    {
+      if (wnd->bs[i].fbmem)
+        {
+          kfree(wnd->bs[i].fbmem);
+          wnd->bs[i].fbmem = NULL;
+        }
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxbe_backingstore
+ *
+ * Descripton:
+ *   Enable or disable the backing store of a window.  While enabled, all
+ *   drawing operations are also rendered into an off-screen copy of the
+ *   window and exposed regions are restored from that copy rather than
+ *   being redrawn by the client.
+ *
+ * Input Parameters:
+ *   wnd    - The window
+ *   enable - True: allocate a backing store; false: free it
+ *
+ * Return:
+ *   OK on success; -ENOMEM if the backing store could not be allocated
+ *
+ ****************************************************************************/
+
+int nxbe_backingstore(FAR struct nxbe_window_s *wnd, bool enable)
+{
+  if (!enable)
+    {
+      wnd->flags &= ~NXBE_WINDOW_BACKED;
+      nxbe_bsfree(wnd);
+      return OK;
+    }
+
+  if ((wnd->flags & NXBE_WINDOW_BACKED) == 0)
+    {
+      wnd->flags |= NXBE_WINDOW_BACKED;
+      nxbe_bsresize(wnd);
+      if ((wnd->flags & NXBE_WINDOW_BACKED) == 0)
+        {
+          return -ENOMEM;
+        }
+
+      /* The new backing store is empty.  Have the client redraw the whole
+       * window so that the backing store is filled in.
+       */
+
+      nxbe_damage(wnd, &wnd->bounds);
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: nxbe_bsresize
+ *
+ * Descripton:
+ *   Re-allocate the backing store of a window after its size changes.  The
+ *   overlapping part of the old contents is preserved.  If memory is not
+ *   available, the backing store is disabled and the window falls back to
+ *   redraw requests.
+ *
+ ****************************************************************************/
+
+void nxbe_bsresize(FAR struct nxbe_window_s *wnd)
+{
+  NX_PLANEINFOTYPE bs;
+  FAR const uint8_t *src;
+  FAR uint8_t *dest;
+  nxgl_coord_t width;
+  nxgl_coord_t height;
+  unsigned int nbytes;
+  unsigned int nrows;
+  unsigned int row;
+  int i;
+
+  if ((wnd->flags & NXBE_WINDOW_BACKED) == 0)
+    {
+      return;
+    }
+
+  width  = wnd->bounds.pt2.x - wnd->bounds.pt1.x + 1;
+  height = wnd->bounds.pt2.y - wnd->bounds.pt1.y + 1;
+
+  /* This is a real loop even with only one color plane so that a plane
+   * whose size is unchanged can be skipped.
+   */
+
+  for (i = 0; i < wnd->be->vinfo.nplanes; i++)
+    {
+      bs.fbmem  = NULL;
+      bs.bpp    = wnd->be->plane[i].pinfo.bpp;
+      bs.stride = 0;
+      bs.fblen  = 0;
+
+      if (width > 0 && height > 0)
+        {
+          bs.stride = (width * bs.bpp + 7) >> 3;
+          bs.fblen  = (uint32_t)bs.stride * height;
+
+          /* Nothing needs to be done for this plane if its size did not
+           * change.
+           */
+
+          if (wnd->bs[i].fbmem && wnd->bs[i].stride == bs.stride &&
+              wnd->bs[i].fblen == bs.fblen)
+            {
+              continue;
+            }
+
+          bs.fbmem = kzalloc(bs.fblen);
+          if (!bs.fbmem)
+            {
+              gdbg("Failed to allocate a %d byte backing store\n", bs.fblen);
+              wnd->flags &= ~NXBE_WINDOW_BACKED;
+              nxbe_bsfree(wnd);
+              return;
+            }
+        }
+
+      /* Preserve the part of the old contents that is still within the
+       * window.
+       */
+
+      if (wnd->bs[i].fbmem)
+        {
+          if (bs.fbmem)
+            {
+              nbytes = ngl_min(wnd->bs[i].stride, bs.stride);
+              nrows  = ngl_min(wnd->bs[i].fblen / wnd->bs[i].stride,
+                               (unsigned int)height);
+              src    = (FAR const uint8_t *)wnd->bs[i].fbmem;
+              dest   = (FAR uint8_t *)bs.fbmem;
+
+              for (row = 0; row < nrows; row++)
+                {
+                  memcpy(dest, src, nbytes);
+                  src  += wnd->bs[i].stride;
+                  dest += bs.stride;
+                }
+            }
+
+          kfree(wnd->bs[i].fbmem);
+        }
+
+      wnd->bs[i] = bs;
+    }
+}
+
+/****************************************************************************
+ * Name: nxbe_bsupdate
+ *
+ * Descripton:
+ *   Copy the visible portions of the rectangular region (in absolute
+ *   screen coordinates, within the window and the display) from the
+ *   window's backing store to the display.
+ *
+ ****************************************************************************/
+
+void nxbe_bsupdate(FAR struct nxbe_window_s *wnd,
+                   FAR const struct nxgl_rect_s *rect)
+{
+  struct nxbe_bsupdate_s info;
+  int i;
+
+  info.cops.visible  = nxbe_clipbscopy;
+  info.cops.obscured = nxbe_clipnull;
+  info.origin.x      = wnd->bounds.pt1.x;
+  info.origin.y      = wnd->bounds.pt1.y;
+
+#if CONFIG_NX_NPLANES > 1
+  for (i = 0; i < wnd->be->vinfo.nplanes; i++)
+#else
+  i = 0;
+#endif
+    {
+      info.bs = &wnd->bs[i];
+      nxbe_clipwindow(wnd, rect,
+                      &info.cops, &wnd->be->plane[i]);
+    }
+}
+
+#endif /* CONFIG_NX_BACKINGSTORE */
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe_bitmap.c
  *
- *   Copyright (C) 2008-2009, 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -77,7 +77,7 @@ struct nx_bitmap_s
  * Name: nxs_clipcopy
  *
  * Description:
- *  Called from nxbe_clipper() to performed the fill operation on visible portions
+ *  Called from nxbe_clipwindow() to performed the fill operation on visible portions
  *  of the rectangle.
  *
  ****************************************************************************/
@@ -164,6 +164,29 @@ void nxbe_bitmap(FAR struct nxbe_window_s *wnd, FAR const struct nxgl_rect_s *de
   /* Clip to the limits of the window and of the background screen */
 
   nxgl_rectintersect(&remaining, &bounds, &wnd->bounds);
+
+#ifdef CONFIG_NX_BACKINGSTORE
+  /* Copy the whole image into the backing store (the original origin is
+   * already in window-relative coordinates).
+   */
+
+  if (NXBE_ISBACKED(wnd) && !nxgl_nullrect(&remaining))
+    {
+      struct nxgl_rect_s bsrect;
+
+      nxbe_bsrect(wnd, &bsrect, &remaining);
+#if CONFIG_NX_NPLANES > 1
+      for (i = 0; i < wnd->be->vinfo.nplanes; i++)
+#else
+      i = 0;
+#endif
+        {
+          wnd->be->plane[i].copyrectangle(&wnd->bs[i], &bsrect, src[i],
+                                          origin, stride);
+        }
+    }
+#endif
+
   nxgl_rectintersect(&remaining, &remaining, &wnd->be->bkgd.bounds);
   if (nxgl_nullrect(&remaining))
     {
@@ -185,8 +208,8 @@ void nxbe_bitmap(FAR struct nxbe_window_s *wnd, FAR const struct nxgl_rect_s *de
       info.origin.y      = offset.y;
       info.stride        = stride;
 
-      nxbe_clipper(wnd->above, &remaining, NX_CLIPORDER_DEFAULT,
-                   &info.cops, &wnd->be->plane[i]);
+      nxbe_clipwindow(wnd, &remaining,
+                      &info.cops, &wnd->be->plane[i]);
     }
 }
 
@@ -0,0 +1,226 @@
+/****************************************************************************
+ * graphics/nxbe/nxbe_blendbitmap.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/nx/nxglib.h>
+#include "nxbe.h"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct nx_blend_s
+{
+  struct nxbe_clipops_s cops;
+  FAR const struct nxgl_blend_s *blend; /* Image/color, opacity and alpha map */
+  struct nxgl_point_s origin;           /* Offset into the source image data */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxs_clipblend
+ *
+ * Description:
+ *  Called from nxbe_clipwindow() to performed the blend operation on visible
+ *  portions of the rectangle.
+ *
+ ****************************************************************************/
+
+static void nxs_clipblend(FAR struct nxbe_clipops_s *cops,
+                          FAR struct nxbe_plane_s *plane,
+                          FAR const struct nxgl_rect_s *rect)
+{
+  struct nx_blend_s *blendinfo = (struct nx_blend_s *)cops;
+  plane->blendrectangle(&plane->pinfo, rect, blendinfo->blend,
+                        &blendinfo->origin);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxbe_blendbitmap
+ *
+ * Description:
+ *   Alpha-blend a rectangular region of a larger image (or a solid color)
+ *   into the rectangle in the specified window.
+ *
+ * Input Parameters:
+ *   wnd    - The window that will receive the blended image
+ *   dest   - Describes the rectangular on the display that will receive the
+ *            the blended image.
+ *   blend  - The image or color, opacity, and alpha map for each plane.
+ *   origin - The origin of the upper, left-most corner of the full image
+ *            and alpha map.  Both dest and origin are in window
+ *            coordinates, however, origin may lie outside of the display.
+ *
+ * Return:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxbe_blendbitmap(FAR struct nxbe_window_s *wnd,
+                      FAR const struct nxgl_rect_s *dest,
+                      FAR const struct nxgl_blend_s blend[CONFIG_NX_NPLANES],
+                      FAR const struct nxgl_point_s *origin)
+{
+  struct nx_blend_s info;
+  struct nxgl_rect_s bounds;
+  struct nxgl_point_s offset;
+  struct nxgl_rect_s remaining;
+  unsigned int width;
+  int i;
+
+#ifdef CONFIG_DEBUG
+  if (!wnd || !dest || !blend || !origin)
+    {
+      return;
+    }
+#endif
+
+  /* Blending is not supported at all color resolutions */
+
+  if (!wnd->be->plane[0].blendrectangle)
+    {
+      gdbg("Blending not supported at %d bpp\n", wnd->be->plane[0].pinfo.bpp);
+      return;
+    }
+
+  /* Verify that the destination rectangle begins "below" and to the "right"
+   * of the origin
+   */
+
+  if (dest->pt1.x < origin->x || dest->pt1.y < origin->y)
+    {
+      gdbg("Bad dest start position\n");
+      return;
+    }
+
+  /* Verify that the width of the destination rectangle does not exceed the
+   * width of the source image or of the alpha map (taking into account the
+   * origin)
+   */
+
+  width = dest->pt2.x - origin->x + 1;
+  for (i = 0; i < wnd->be->vinfo.nplanes; i++)
+    {
+      if ((blend[i].image &&
+           ((width * wnd->be->plane[i].pinfo.bpp + 7) >> 3) > blend[i].stride) ||
+          (blend[i].alpha && width > blend[i].astride))
+        {
+          gdbg("Bad dest width\n");
+          return;
+        }
+    }
+
+  /* Offset the rectangle and image origin by the window origin */
+
+  nxgl_rectoffset(&bounds, dest, wnd->bounds.pt1.x, wnd->bounds.pt1.y);
+  nxgl_vectoradd(&offset, origin, &wnd->bounds.pt1);
+
+  /* Clip to the limits of the window and of the background screen */
+
+  nxgl_rectintersect(&remaining, &bounds, &wnd->bounds);
+
+#ifdef CONFIG_NX_BACKINGSTORE
+  /* Blend the whole image into the backing store (the original origin is
+   * already in window-relative coordinates).
+   */
+
+  if (NXBE_ISBACKED(wnd) && !nxgl_nullrect(&remaining))
+    {
+      struct nxgl_rect_s bsrect;
+
+      nxbe_bsrect(wnd, &bsrect, &remaining);
+#if CONFIG_NX_NPLANES > 1
+      for (i = 0; i < wnd->be->vinfo.nplanes; i++)
+#else
+      i = 0;
+#endif
+        {
+          wnd->be->plane[i].blendrectangle(&wnd->bs[i], &bsrect, &blend[i],
+                                           origin);
+        }
+    }
+#endif
+
+  nxgl_rectintersect(&remaining, &remaining, &wnd->be->bkgd.bounds);
+  if (nxgl_nullrect(&remaining))
+    {
+      return;
+    }
+
+  /* Then perform the clipped blend */
+
+#if CONFIG_NX_NPLANES > 1
+  for (i = 0; i < wnd->be->vinfo.nplanes; i++)
+#else
+  i = 0;
+#endif
+    {
+      info.cops.visible  = nxs_clipblend;
+      info.cops.obscured = nxbe_clipnull;
+      info.blend         = &blend[i];
+      info.origin.x      = offset.x;
+      info.origin.y      = offset.y;
+
+      nxbe_clipwindow(wnd, &remaining,
+                      &info.cops, &wnd->be->plane[i]);
+    }
+}
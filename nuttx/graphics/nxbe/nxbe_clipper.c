@@ -54,6 +54,7 @@
  ****************************************************************************/
 
 #define NX_INITIAL_STACKSIZE (32)
+#define NX_INITIAL_VISSIZE   (8)
 
 /****************************************************************************
  * Private Types
@@ -78,6 +79,17 @@ struct nxbe_clipstack_s
   struct nxbe_cliprect_s   *stack;   /* The stack of deferred rectangles */
 };
 
+/* Used to collect the visible region of a window */
+
+#ifdef CONFIG_NX_CLIPCACHE
+struct nxbe_vislist_s
+{
+  struct nxbe_clipops_s     cops;
+  FAR struct nxbe_window_s *wnd;
+  bool                      failed;
+};
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -151,6 +163,97 @@ static inline bool nxbe_poprectangle(struct nxbe_clipstack_s *stack,
   return false;
 }
 
+/****************************************************************************
+ * Name: nxbe_addvisible
+ *
+ * Descripton:
+ *   Called from nxbe_clipper() to add one visible rectangle to the visible
+ *   region of a window.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_CLIPCACHE
+static void nxbe_addvisible(FAR struct nxbe_clipops_s *cops,
+                            FAR struct nxbe_plane_s *plane,
+                            FAR const struct nxgl_rect_s *rect)
+{
+  FAR struct nxbe_vislist_s *info = (FAR struct nxbe_vislist_s *)cops;
+  FAR struct nxbe_window_s *wnd = info->wnd;
+
+  /* Check if there is room in the list to hold another rectangle */
+
+  if (wnd->nvisible >= wnd->mxvisible)
+    {
+      /* No then we will need to reallocate the list to hold more */
+
+      int mxvisible = wnd->mxvisible ? 2 * wnd->mxvisible : NX_INITIAL_VISSIZE;
+      struct nxgl_rect_s *newlist;
+
+      newlist = krealloc(wnd->vislist, sizeof(struct nxgl_rect_s) * mxvisible);
+      if (!newlist)
+        {
+          gdbg("Failed to reallocate visible list\n");
+          info->failed = true;
+          return;
+        }
+
+      wnd->vislist   = newlist;
+      wnd->mxvisible = mxvisible;
+    }
+
+  nxgl_rectcopy(&wnd->vislist[wnd->nvisible], rect);
+  wnd->nvisible++;
+}
+#endif
+
+/****************************************************************************
+ * Name: nxbe_updatevisible
+ *
+ * Descripton:
+ *   Recompute the visible region of a window if it is no longer valid.
+ *   Returns false if the region could not be computed.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_CLIPCACHE
+static bool nxbe_updatevisible(FAR struct nxbe_window_s *wnd)
+{
+  struct nxbe_vislist_s info;
+  struct nxgl_rect_s bounds;
+
+  if (wnd->visgen == wnd->be->clipgen)
+    {
+      return true;
+    }
+
+  /* Collect the parts of the window on the display that are not obscured
+   * by any window above.
+   */
+
+  info.cops.visible  = nxbe_addvisible;
+  info.cops.obscured = nxbe_clipnull;
+  info.wnd           = wnd;
+  info.failed        = false;
+
+  wnd->nvisible = 0;
+  nxgl_rectintersect(&bounds, &wnd->bounds, &wnd->be->bkgd.bounds);
+  if (!nxgl_nullrect(&bounds))
+    {
+      nxbe_clipper(wnd->above, &bounds, NX_CLIPORDER_DEFAULT,
+                   &info.cops, &wnd->be->plane[0]);
+    }
+
+  if (info.failed)
+    {
+      wnd->visgen = 0;
+      return false;
+    }
+
+  wnd->visgen = wnd->be->clipgen;
+  return true;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -264,6 +367,53 @@ void nxbe_clipper(FAR struct nxbe_window_s *wnd,
     }
 }
 
+/****************************************************************************
+ * Name: nxbe_clipwindow
+ *
+ * Descripton:
+ *   Clip a rectangle to the visible region of a window and call the visible
+ *   callback for each visible part.
+ *
+ * Input Parameters:
+ *   wnd   - The window to be clipped.
+ *   dest  - The region of concern (in absolute screen coordinates)
+ *   cops  - The callbacks to handle visible parts of the rectangle.
+ *   plane - The raster operations to be used by the callback functions.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxbe_clipwindow(FAR struct nxbe_window_s *wnd,
+                     FAR const struct nxgl_rect_s *dest,
+                     FAR struct nxbe_clipops_s *cops,
+                     FAR struct nxbe_plane_s *plane)
+{
+#ifdef CONFIG_NX_CLIPCACHE
+  struct nxgl_rect_s rect;
+  int i;
+
+  /* Use the cached visible region unless it could not be computed */
+
+  if (nxbe_updatevisible(wnd))
+    {
+      for (i = 0; i < wnd->nvisible; i++)
+        {
+          nxgl_rectintersect(&rect, dest, &wnd->vislist[i]);
+          if (!nxgl_nullrect(&rect))
+            {
+              cops->visible(cops, plane, &rect);
+            }
+        }
+
+      return;
+    }
+#endif
+
+  nxbe_clipper(wnd->above, dest, NX_CLIPORDER_DEFAULT, cops, plane);
+}
+
 /****************************************************************************
  * Name: nxbe_clipnull
  *
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe_closewindow.c
  *
- *   Copyright (C) 2008-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -43,6 +43,7 @@
 #include <assert.h>
 #include <debug.h>
 
+#include <nuttx/kmalloc.h>
 #include <nuttx/nx/nxglib.h>
 #include "nxbe.h"
 
@@ -126,11 +127,27 @@ void nxbe_closewindow(struct nxbe_window_s *wnd)
    */
 
   wnd->below->above = wnd->above;
+  NXBE_CLIPCHANGED(be);
 
   /* Redraw the windows that were below us (and may now be exposed) */
 
   nxbe_redrawbelow(be, wnd->below, &wnd->bounds);
 
+#ifdef CONFIG_NX_BACKINGSTORE
+  /* Free the backing store */
+
+  (void)nxbe_backingstore(wnd, false);
+#endif
+
+#ifdef CONFIG_NX_CLIPCACHE
+  /* Free the cached visible region */
+
+  if (wnd->vislist)
+    {
+      kfree(wnd->vislist);
+    }
+#endif
+
   /* Then discard the window structure */
 
   free(wnd);
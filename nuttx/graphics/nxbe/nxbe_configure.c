@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe_configure.c
  *
- *   Copyright (C) 2008-2010 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2010, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -40,6 +40,7 @@
 #include <nuttx/config.h>
 
 #include <stddef.h>
+#include <string.h>
 #include <errno.h>
 #include <debug.h>
 
@@ -112,6 +113,14 @@ int nxbe_configure(FAR NX_DRIVERTYPE *dev, FAR struct nxbe_state_s *be)
 
   for (i = 0; i < be->vinfo.nplanes; i++)
     {
+#ifdef CONFIG_NX_LCDDRIVER
+      /* LCD drivers that do not provide the optional putarea() and
+       * fillarea() methods may leave them unassigned.
+       */
+
+      memset(&be->plane[i].pinfo, 0, sizeof(struct lcd_planeinfo_s));
+#endif
+
       ret = dev->getplaneinfo(dev, i, &be->plane[i].pinfo);
       if (ret < 0)
         {
@@ -135,6 +144,9 @@ int nxbe_configure(FAR NX_DRIVERTYPE *dev, FAR struct nxbe_state_s *be)
           be->plane[i].filltrapezoid = nxgl_filltrapezoid_1bpp;
           be->plane[i].moverectangle = nxgl_moverectangle_1bpp;
           be->plane[i].copyrectangle = nxgl_copyrectangle_1bpp;
+#ifdef CONFIG_NX_BLEND
+          be->plane[i].blendrectangle = NULL;
+#endif
         }
       else
 #endif
@@ -147,6 +159,9 @@ int nxbe_configure(FAR NX_DRIVERTYPE *dev, FAR struct nxbe_state_s *be)
           be->plane[i].filltrapezoid = nxgl_filltrapezoid_2bpp;
           be->plane[i].moverectangle = nxgl_moverectangle_2bpp;
           be->plane[i].copyrectangle = nxgl_copyrectangle_2bpp;
+#ifdef CONFIG_NX_BLEND
+          be->plane[i].blendrectangle = NULL;
+#endif
         }
       else
 #endif
@@ -159,6 +174,9 @@ int nxbe_configure(FAR NX_DRIVERTYPE *dev, FAR struct nxbe_state_s *be)
           be->plane[i].filltrapezoid = nxgl_filltrapezoid_4bpp;
           be->plane[i].moverectangle = nxgl_moverectangle_4bpp;
           be->plane[i].copyrectangle = nxgl_copyrectangle_4bpp;
+#ifdef CONFIG_NX_BLEND
+          be->plane[i].blendrectangle = NULL;
+#endif
         }
       else
 #endif
@@ -171,6 +189,9 @@ int nxbe_configure(FAR NX_DRIVERTYPE *dev, FAR struct nxbe_state_s *be)
           be->plane[i].filltrapezoid = nxgl_filltrapezoid_8bpp;
           be->plane[i].moverectangle = nxgl_moverectangle_8bpp;
           be->plane[i].copyrectangle = nxgl_copyrectangle_8bpp;
+#ifdef CONFIG_NX_BLEND
+          be->plane[i].blendrectangle = nxgl_blendrectangle_8bpp;
+#endif
         }
       else
 #endif
@@ -183,6 +204,9 @@ int nxbe_configure(FAR NX_DRIVERTYPE *dev, FAR struct nxbe_state_s *be)
           be->plane[i].filltrapezoid = nxgl_filltrapezoid_16bpp;
           be->plane[i].moverectangle = nxgl_moverectangle_16bpp;
           be->plane[i].copyrectangle = nxgl_copyrectangle_16bpp;
+#ifdef CONFIG_NX_BLEND
+          be->plane[i].blendrectangle = nxgl_blendrectangle_16bpp;
+#endif
         }
       else
 #endif
@@ -195,6 +219,9 @@ int nxbe_configure(FAR NX_DRIVERTYPE *dev, FAR struct nxbe_state_s *be)
           be->plane[i].filltrapezoid = nxgl_filltrapezoid_24bpp;
           be->plane[i].moverectangle = nxgl_moverectangle_24bpp;
           be->plane[i].copyrectangle = nxgl_copyrectangle_24bpp;
+#ifdef CONFIG_NX_BLEND
+          be->plane[i].blendrectangle = nxgl_blendrectangle_24bpp;
+#endif
         }
       else
 #endif
@@ -207,6 +234,9 @@ int nxbe_configure(FAR NX_DRIVERTYPE *dev, FAR struct nxbe_state_s *be)
           be->plane[i].filltrapezoid = nxgl_filltrapezoid_32bpp;
           be->plane[i].moverectangle = nxgl_moverectangle_32bpp;
           be->plane[i].copyrectangle = nxgl_copyrectangle_32bpp;
+#ifdef CONFIG_NX_BLEND
+          be->plane[i].blendrectangle = nxgl_blendrectangle_32bpp;
+#endif
         }
       else
 #endif
@@ -0,0 +1,240 @@
+/****************************************************************************
+ * graphics/nxbe/nxbe_damage.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <debug.h>
+
+#include <nuttx/nx/nxglib.h>
+
+#include "nxbe.h"
+#include "nxfe.h"
+
+#if CONFIG_NX_NDAMAGE > 0
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxbe_rectarea
+ *
+ * Description:
+ *   Return the number of pixels in a rectangle.
+ *
+ ****************************************************************************/
+
+static inline uint32_t nxbe_rectarea(FAR const struct nxgl_rect_s *rect)
+{
+  return (uint32_t)(rect->pt2.x - rect->pt1.x + 1) *
+         (uint32_t)(rect->pt2.y - rect->pt1.y + 1);
+}
+
+/****************************************************************************
+ * Name: nxbe_removedamage
+ *
+ * Description:
+ *   Remove one entry from the window's damage list.
+ *
+ ****************************************************************************/
+
+static inline void nxbe_removedamage(FAR struct nxbe_window_s *wnd, int ndx)
+{
+  wnd->ndamage--;
+  if (ndx < wnd->ndamage)
+    {
+      nxgl_rectcopy(&wnd->damage[ndx], &wnd->damage[wnd->ndamage]);
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxbe_damage
+ *
+ * Descripton:
+ *   Add the rectangular region (in absolute screen coordinates) to the
+ *   damage list of the specified window.  Overlapping and adjacent regions
+ *   are coalesced.  The client will be asked to redraw the region on the
+ *   next call to nxbe_flushdamage().
+ *
+ ****************************************************************************/
+
+void nxbe_damage(FAR struct nxbe_window_s *wnd,
+                 FAR const struct nxgl_rect_s *rect)
+{
+  struct nxgl_rect_s damage;
+  struct nxgl_rect_s merged;
+  uint32_t growth;
+  uint32_t mingrowth;
+  int minndx;
+  int i;
+
+  /* Save the damage in window-relative coordinates so that it remains
+   * valid if the window is repositioned before the damage is flushed.
+   */
+
+  nxgl_rectoffset(&damage, rect, -wnd->bounds.pt1.x, -wnd->bounds.pt1.y);
+
+  /* Merge the new region with each damaged region that it overlaps or
+   * abuts, provided that the union does not add more area than the two
+   * regions have in common.  A merged region may now qualify to be merged
+   * with an entry that was already examined, so start over after each
+   * merge.
+   */
+
+  i = 0;
+  while (i < wnd->ndamage)
+    {
+      nxgl_rectunion(&merged, &damage, &wnd->damage[i]);
+      if (nxbe_rectarea(&merged) <=
+          nxbe_rectarea(&damage) + nxbe_rectarea(&wnd->damage[i]))
+        {
+          nxgl_rectcopy(&damage, &merged);
+          nxbe_removedamage(wnd, i);
+          i = 0;
+        }
+      else
+        {
+          i++;
+        }
+    }
+
+  /* Is there space for a new entry in the damage list? */
+
+  if (wnd->ndamage < CONFIG_NX_NDAMAGE)
+    {
+      nxgl_rectcopy(&wnd->damage[wnd->ndamage], &damage);
+      wnd->ndamage++;
+      return;
+    }
+
+  /* No.. Merge the new region into the entry whose bounding box grows the
+   * least.  This may cause the client to redraw some regions that were not
+   * damaged, but never misses a region that was.
+   */
+
+  mingrowth = UINT32_MAX;
+  minndx    = 0;
+
+  for (i = 0; i < wnd->ndamage; i++)
+    {
+      nxgl_rectunion(&merged, &damage, &wnd->damage[i]);
+      growth = nxbe_rectarea(&merged) - nxbe_rectarea(&wnd->damage[i]);
+      if (growth < mingrowth)
+        {
+          mingrowth = growth;
+          minndx    = i;
+        }
+    }
+
+  nxgl_rectunion(&wnd->damage[minndx], &damage, &wnd->damage[minndx]);
+}
+
+/****************************************************************************
+ * Name: nxbe_flushdamage
+ *
+ * Descripton:
+ *   Send one redraw request for each damaged region of each window and
+ *   clear the damage lists.  This is called once after each server message
+ *   (multi-user mode) or each NX call (single user mode) that may damage
+ *   windows.
+ *
+ ****************************************************************************/
+
+void nxbe_flushdamage(FAR struct nxbe_state_s *be)
+{
+  FAR struct nxbe_window_s *wnd;
+  struct nxgl_rect_s damage[CONFIG_NX_NDAMAGE];
+  struct nxgl_rect_s rect;
+  int ndamage;
+  int i;
+
+  for (wnd = be->topwnd; wnd; wnd = wnd->below)
+    {
+      /* Take a copy of the damage list and clear it before issuing any
+       * redraw requests.  In single user mode, the redraw callback runs
+       * immediately and may damage windows again.
+       */
+
+      ndamage = wnd->ndamage;
+      for (i = 0; i < ndamage; i++)
+        {
+          nxgl_rectcopy(&damage[i], &wnd->damage[i]);
+        }
+
+      wnd->ndamage = 0;
+
+      for (i = 0; i < ndamage; i++)
+        {
+          /* Convert back to absolute screen coordinates and clip to the
+           * current size of the window
+           */
+
+          nxgl_rectoffset(&rect, &damage[i],
+                          wnd->bounds.pt1.x, wnd->bounds.pt1.y);
+          nxgl_rectintersect(&rect, &rect, &wnd->bounds);
+          if (!nxgl_nullrect(&rect))
+            {
+              nxfe_redrawreq(wnd, &rect);
+            }
+        }
+    }
+}
+
+#endif /* CONFIG_NX_NDAMAGE > 0 */
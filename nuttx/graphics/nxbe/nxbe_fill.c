@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe_fill.c
  *
- *   Copyright (C) 2008-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -73,7 +73,7 @@ struct nxbe_fill_s
  * Name: nxbe_clipfill
  *
  * Description:
- *  Called from nxbe_clipper() to performed the fill operation on visible portions
+ *  Called from nxbe_clipwindow() to performed the fill operation on visible portions
  *  of the rectangle.
  *
  ****************************************************************************/
@@ -132,6 +132,28 @@ void nxbe_fill(FAR struct nxbe_window_s *wnd,
    */
 
   nxgl_rectintersect(&remaining, &remaining, &wnd->bounds);
+
+#ifdef CONFIG_NX_BACKINGSTORE
+  /* Fill the whole region in the backing store, even the parts that are
+   * obscured or off the display.
+   */
+
+  if (NXBE_ISBACKED(wnd) && !nxgl_nullrect(&remaining))
+    {
+      struct nxgl_rect_s bsrect;
+
+      nxbe_bsrect(wnd, &bsrect, &remaining);
+#if CONFIG_NX_NPLANES > 1
+      for (i = 0; i < wnd->be->vinfo.nplanes; i++)
+#else
+      i = 0;
+#endif
+        {
+          wnd->be->plane[i].fillrectangle(&wnd->bs[i], &bsrect, color[i]);
+        }
+    }
+#endif
+
   nxgl_rectintersect(&remaining, &remaining, &wnd->be->bkgd.bounds);
 
   /* Then clip the bounding box due to other windows above this one.
@@ -150,8 +172,8 @@ void nxbe_fill(FAR struct nxbe_window_s *wnd,
           info.cops.obscured = nxbe_clipnull;
           info.color         = color[i];
 
-          nxbe_clipper(wnd->above, &remaining, NX_CLIPORDER_DEFAULT,
-                       &info.cops, &wnd->be->plane[i]);
+          nxbe_clipwindow(wnd, &remaining,
+                          &info.cops, &wnd->be->plane[i]);
         }
     }
 }
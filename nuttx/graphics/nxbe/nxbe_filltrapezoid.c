@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe_filltrapezoid.c
  *
- *   Copyright (C) 2008-2009, 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -75,7 +75,7 @@ struct nxbe_filltrap_s
  * Name: nxbe_clipfilltrapezoid
  *
  * Description:
- *  Called from nxbe_clipper() to performed the fill operation on visible portions
+ *  Called from nxbe_clipwindow() to performed the fill operation on visible portions
  *  of the rectangle.
  *
  ****************************************************************************/
@@ -150,6 +150,28 @@ void nxbe_filltrapezoid(FAR struct nxbe_window_s *wnd,
   /* Clip to the limits of the window and of the background screen */
 
   nxgl_rectintersect(&remaining, &remaining, &wnd->bounds);
+
+#ifdef CONFIG_NX_BACKINGSTORE
+  /* Render the whole trapezoid into the backing store (the original
+   * trapezoid is already in window-relative coordinates).
+   */
+
+  if (NXBE_ISBACKED(wnd) && !nxgl_nullrect(&remaining))
+    {
+      struct nxgl_rect_s bsrect;
+
+      nxbe_bsrect(wnd, &bsrect, &remaining);
+#if CONFIG_NX_NPLANES > 1
+      for (i = 0; i < wnd->be->vinfo.nplanes; i++)
+#else
+      i = 0;
+#endif
+        {
+          wnd->be->plane[i].filltrapezoid(&wnd->bs[i], trap, &bsrect, color[i]);
+        }
+    }
+#endif
+
   nxgl_rectintersect(&remaining, &remaining, &wnd->be->bkgd.bounds);
 
   if (!nxgl_nullrect(&remaining))
@@ -166,8 +188,8 @@ void nxbe_filltrapezoid(FAR struct nxbe_window_s *wnd,
 #endif
         {
           info.color = color[i];
-          nxbe_clipper(wnd->above, &remaining, NX_CLIPORDER_DEFAULT,
-                       &info.cops, &wnd->be->plane[i]);
+          nxbe_clipwindow(wnd, &remaining,
+                          &info.cops, &wnd->be->plane[i]);
         }
     }
 }
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe_fill.c
  *
- *   Copyright (C) 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -83,7 +83,9 @@ struct nxbe_fill_s
  *  Get the raw contents of graphic memory within a rectangular region. NOTE:
  *  Since raw graphic memory is returned, the returned memory content may be
  *  the memory of windows above this one and may not necessarily belong to
- *  this window unless you assure that this is the top window.
+ *  this window unless you assure that this is the top window.  If the
+ *  window has a backing store, the contents of the backing store are
+ *  returned instead.
  *
  * Input Parameters:
  *   wnd  - The window structure reference
@@ -122,6 +124,27 @@ void nxbe_getrectangle(FAR struct nxbe_window_s *wnd,
    */
 
   nxgl_rectintersect(&remaining, &remaining, &wnd->bounds);
+
+#ifdef CONFIG_NX_BACKINGSTORE
+  /* If the window has a backing store, then return the window's own
+   * content from the backing store, even where the window is obscured.
+   */
+
+  if (NXBE_ISBACKED(wnd))
+    {
+      if (!nxgl_nullrect(&remaining))
+        {
+          struct nxgl_rect_s bsrect;
+
+          nxbe_bsrect(wnd, &bsrect, &remaining);
+          wnd->be->plane[plane].getrectangle(&wnd->bs[plane], &bsrect,
+                                             dest, deststride);
+        }
+
+      return;
+    }
+#endif
+
   nxgl_rectintersect(&remaining, &remaining, &wnd->be->bkgd.bounds);
 
   /* The return the graphics memory at this location.  NOTE: Since raw
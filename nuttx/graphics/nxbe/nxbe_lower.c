@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe_lower.c
  *
- *   Copyright (C) 2008-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -118,6 +118,7 @@ void nxbe_lower(FAR struct nxbe_window_s *wnd)
   wnd->below     = &be->bkgd;
   wnd->above     = be->bkgd.above;
   be->bkgd.above = wnd;
+  NXBE_CLIPCHANGED(be);
 
   /* Redraw the windows that were below us (but now are above) */
 
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe_move.c
  *
- *   Copyright (C) 2008-2009, 2011-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -119,7 +119,7 @@ static void nxbe_clipmoveobscured(FAR struct nxbe_clipops_s *cops,
   struct nxgl_rect_s dst;
 
   nxgl_rectoffset(&dst, rect, info->offset.x, info->offset.y);
-  nxfe_redrawreq(info->wnd, &dst);
+  nxbe_damage(info->wnd, &dst);
 }
 
 /****************************************************************************
@@ -156,7 +156,7 @@ static void nxbe_clipmovedest(FAR struct nxbe_clipops_s *cops,
     {
       if (!nxgl_nullrect(&nonintersecting[i]))
         {
-          nxfe_redrawreq(dstdata->wnd, &nonintersecting[i]);
+          nxbe_damage(dstdata->wnd, &nonintersecting[i]);
         }
     }
 
@@ -178,6 +178,74 @@ static void nxbe_clipmovedest(FAR struct nxbe_clipops_s *cops,
    }
 }
 
+/****************************************************************************
+ * Name: nxbe_bsmove
+ *
+ * Description:
+ *  Move a rectangular region within a window that has a backing store.
+ *  The region is moved within the backing store and the visible parts of
+ *  the destination are then copied to the display, so no part of the
+ *  destination needs to be redrawn by the client.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_BACKINGSTORE
+static inline void nxbe_bsmove(FAR struct nxbe_window_s *wnd,
+                               FAR const struct nxgl_rect_s *rect,
+                               FAR const struct nxgl_point_s *offset)
+{
+  struct nxgl_rect_s bsbounds;
+  struct nxgl_rect_s srcrect;
+  struct nxgl_rect_s destrect;
+  struct nxgl_point_s destpos;
+  int i;
+
+  /* The backing store holds the entire window */
+
+  bsbounds.pt1.x = 0;
+  bsbounds.pt1.y = 0;
+  bsbounds.pt2.x = wnd->bounds.pt2.x - wnd->bounds.pt1.x;
+  bsbounds.pt2.y = wnd->bounds.pt2.y - wnd->bounds.pt1.y;
+
+  /* Only the part of the region that is moved from and to locations
+   * within the window can be moved.
+   */
+
+  nxgl_rectintersect(&srcrect, rect, &bsbounds);
+  nxgl_rectoffset(&destrect, &srcrect, offset->x, offset->y);
+  nxgl_rectintersect(&destrect, &destrect, &bsbounds);
+  if (nxgl_nullrect(&destrect))
+    {
+      return;
+    }
+
+  if (offset->x != 0 || offset->y != 0)
+    {
+      nxgl_rectoffset(&srcrect, &destrect, -offset->x, -offset->y);
+      destpos.x = destrect.pt1.x;
+      destpos.y = destrect.pt1.y;
+
+#if CONFIG_NX_NPLANES > 1
+      for (i = 0; i < wnd->be->vinfo.nplanes; i++)
+#else
+      i = 0;
+#endif
+        {
+          wnd->be->plane[i].moverectangle(&wnd->bs[i], &srcrect, &destpos);
+        }
+    }
+
+  /* Then update the visible parts of the destination on the display */
+
+  nxgl_rectoffset(&destrect, &destrect, wnd->bounds.pt1.x, wnd->bounds.pt1.y);
+  nxgl_rectintersect(&destrect, &destrect, &wnd->be->bkgd.bounds);
+  if (!nxgl_nullrect(&destrect))
+    {
+      nxbe_bsupdate(wnd, &destrect);
+    }
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -211,6 +279,14 @@ void nxbe_move(FAR struct nxbe_window_s *wnd, FAR const struct nxgl_rect_s *rect
     }
 #endif
 
+#ifdef CONFIG_NX_BACKINGSTORE
+  if (NXBE_ISBACKED(wnd))
+    {
+      nxbe_bsmove(wnd, rect, offset);
+      return;
+    }
+#endif
+
   /* Offset the rectangle by the window origin to create a bounding box */
 
   nxgl_rectoffset(&info.srcrect, rect, wnd->bounds.pt1.x, wnd->bounds.pt1.y);
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe_raise.c
  *
- *   Copyright (C) 2008-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -107,10 +107,23 @@ void nxbe_raise(FAR struct nxbe_window_s *wnd)
 
   be->topwnd->above  = wnd;
   be->topwnd         = wnd;
+  NXBE_CLIPCHANGED(be);
 
   /* This window is now at the top of the display, we know, therefore, that
    * it is not obscured by another window
    */
 
-  nxfe_redrawreq(wnd, &wnd->bounds);
+#ifdef CONFIG_NX_BACKINGSTORE
+  /* A window with a backing store is simply restored from the backing
+   * store.
+   */
+
+  if (NXBE_ISBACKED(wnd))
+    {
+      nxbe_redraw(be, wnd, &wnd->bounds);
+      return;
+    }
+#endif
+
+  nxbe_damage(wnd, &wnd->bounds);
 }
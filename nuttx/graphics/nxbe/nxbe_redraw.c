@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe_redraw.c
  *
- *   Copyright (C) 2008-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -84,7 +84,7 @@ static void nxbe_clipredraw(FAR struct nxbe_clipops_s *cops,
   FAR struct nxbe_window_s *wnd = ((struct nxbe_redraw_s *)cops)->wnd;
   if (wnd)
     {
-      nxfe_redrawreq(wnd, rect);
+      nxbe_damage(wnd, rect);
     }
 }
 
@@ -117,6 +117,18 @@ void nxbe_redraw(FAR struct nxbe_state_s *be,
   nxgl_rectintersect(&remaining, &remaining, &wnd->bounds);
   if (!nxgl_nullrect(&remaining))
     {
+#ifdef CONFIG_NX_BACKINGSTORE
+      /* If the window has a backing store, then restore the visible
+       * regions from the backing store.  The client need not be involved.
+       */
+
+      if (NXBE_ISBACKED(wnd))
+        {
+          nxbe_bsupdate(wnd, &remaining);
+          return;
+        }
+#endif
+
       /* Now, request to re-draw any visible rectangular regions not obscured
        * by windows above this one.
        */
@@ -128,12 +140,12 @@ void nxbe_redraw(FAR struct nxbe_state_s *be,
 #if CONFIG_NX_NPLANES > 1
       for (i = 0; i < be->vinfo.nplanes; i++)
         {
-          nxbe_clipper(wnd->above, &remaining, NX_CLIPORDER_DEFAULT,
-                       &info.cops, &be->plane[i]);
+          nxbe_clipwindow(wnd, &remaining,
+                          &info.cops, &be->plane[i]);
         }
 #else
-      nxbe_clipper(wnd->above, &remaining, NX_CLIPORDER_DEFAULT,
-                   &info.cops, &be->plane[0]);
+      nxbe_clipwindow(wnd, &remaining,
+                      &info.cops, &be->plane[0]);
 #endif
     }
 }
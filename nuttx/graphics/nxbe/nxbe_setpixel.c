@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe_setpixel.c
  *
- *   Copyright (C) 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -73,7 +73,7 @@ struct nxbe_setpixel_s
  * Name: nxbe_clipfill
  *
  * Description:
- *  Called from nxbe_clipper() to performed the fill operation on visible portions
+ *  Called from nxbe_clipwindow() to performed the fill operation on visible portions
  *  of the rectangle.
  *
  ****************************************************************************/
@@ -125,12 +125,32 @@ void nxbe_setpixel(FAR struct nxbe_window_s *wnd,
 
   nxgl_vectoradd(&rect.pt1, pos, &wnd->bounds.pt1);
 
-  /* Make sure that the point is within the limits of the window
-   * and of the background screen
-   */
+  /* Make sure that the point is within the limits of the window */
+
+  if (!nxgl_rectinside(&wnd->bounds, &rect.pt1))
+    {
+      return;
+    }
+
+#ifdef CONFIG_NX_BACKINGSTORE
+  /* Set the pixel in the backing store, whether it is visible or not */
+
+  if (NXBE_ISBACKED(wnd))
+    {
+#if CONFIG_NX_NPLANES > 1
+      for (i = 0; i < wnd->be->vinfo.nplanes; i++)
+#else
+      i = 0;
+#endif
+        {
+          wnd->be->plane[i].setpixel(&wnd->bs[i], pos, color[i]);
+        }
+    }
+#endif
+
+  /* And of the background screen */
 
-  if (!nxgl_rectinside(&wnd->bounds, &rect.pt1) ||
-      !nxgl_rectinside(&wnd->be->bkgd.bounds, &rect.pt1))
+  if (!nxgl_rectinside(&wnd->be->bkgd.bounds, &rect.pt1))
     {
       return;
     }
@@ -152,7 +172,7 @@ void nxbe_setpixel(FAR struct nxbe_window_s *wnd,
       info.cops.obscured = nxbe_clipnull;
       info.color         = color[i];
 
-      nxbe_clipper(wnd->above, &rect, NX_CLIPORDER_DEFAULT,
-                   &info.cops, &wnd->be->plane[i]);
+      nxbe_clipwindow(wnd, &rect,
+                      &info.cops, &wnd->be->plane[i]);
     }
 }
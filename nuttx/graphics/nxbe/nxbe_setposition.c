@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe_setposition.c
  *
- *   Copyright (C) 2008-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -98,6 +98,7 @@ void nxbe_setposition(FAR struct nxbe_window_s *wnd,
 
   nxgl_rectcopy(&before, &wnd->bounds);
   nxgl_rectoffset(&wnd->bounds, &rect, pos->x, pos->y);
+  NXBE_CLIPCHANGED(wnd->be);
 
   /* Get the union of the 'before' bounding box and the 'after' bounding
    * this union is the region of the display that must be updated.
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe_setsize.c
  *
- *   Copyright (C) 2008-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -101,6 +101,38 @@ void nxbe_setsize(FAR struct nxbe_window_s *wnd,
   /* Clip the new bounding box so that lies within the background screen */
 
   nxgl_rectintersect(&wnd->bounds, &wnd->bounds, &wnd->be->bkgd.bounds);
+  NXBE_CLIPCHANGED(wnd->be);
+
+#ifdef CONFIG_NX_BACKINGSTORE
+  /* Resize the backing store.  Newly exposed parts of the window are
+   * empty and must be redrawn by the client.
+   */
+
+  if ((wnd->flags & NXBE_WINDOW_BACKED) != 0)
+    {
+      struct nxgl_rect_s exposed[4];
+      int i;
+
+      nxbe_bsresize(wnd);
+
+      nxgl_rectintersect(&exposed[0], &wnd->bounds, &bounds);
+      if (nxgl_nullrect(&exposed[0]))
+        {
+          nxbe_damage(wnd, &wnd->bounds);
+        }
+      else
+        {
+          nxgl_nonintersecting(exposed, &wnd->bounds, &bounds);
+          for (i = 0; i < 4; i++)
+            {
+              if (!nxgl_nullrect(&exposed[i]))
+                {
+                  nxbe_damage(wnd, &exposed[i]);
+                }
+            }
+        }
+    }
+#endif
 
   /* We need to update the larger of the two rectangles.  That will be the
    * union of the before and after sizes.
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxbe/nxbe_redraw.c
  *
- *   Copyright (C) 2008-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -103,6 +103,7 @@ bool nxbe_visible(FAR struct nxbe_window_s *wnd,
                   FAR const struct nxgl_point_s *pos)
 {
   struct nxbe_visible_s info;
+  struct nxgl_rect_s rect;
 
   /* Check if the absolute position lies within the window */
 
@@ -120,15 +121,19 @@ bool nxbe_visible(FAR struct nxbe_window_s *wnd,
 
   /* The position within the window range, but the window is not at
    * the top.  We will have to work harder to determine if the point
-   * visible
+   * visible:  Clip a one pixel rectangle at the point.
    */
 
   info.cops.visible  = nxbe_clipvisible;
   info.cops.obscured = nxbe_clipnull;
   info.visible       = false;
 
-  nxbe_clipper(wnd->above, &wnd->bounds, NX_CLIPORDER_DEFAULT,
-               &info.cops, &wnd->be->plane[0]);
+  rect.pt1.x = pos->x;
+  rect.pt1.y = pos->y;
+  rect.pt2.x = pos->x;
+  rect.pt2.y = pos->y;
+
+  nxbe_clipwindow(wnd, &rect, &info.cops, &wnd->be->plane[0]);
 
   return info.visible;
 }
@@ -1,7 +1,7 @@
 /****************************************************************************
  * nuttx/graphics/nxconsole/nxcon_driver.c
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -244,8 +244,11 @@ static ssize_t nxcon_write(FAR struct file *filep, FAR const char *buffer,
       while (state == VT100_ABORT);
     }
 
-  /* Show the cursor at its new position */
+  /* Draw all of the new characters, then show the cursor at its new
+   * position
+   */
 
+  nxcon_flush(priv);
   nxcon_showcursor(priv);
   nxcon_sempost(priv);
   return (ssize_t)buflen;
@@ -0,0 +1,333 @@
+/****************************************************************************
+ * nuttx/graphics/nxconsole/nxcon_flush.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/nx/nx.h>
+#include <nuttx/nx/nxglib.h>
+#include <nuttx/nx/nxfonts.h>
+
+#include "nxcon_internal.h"
+
+/****************************************************************************
+ * Definitions
+ ****************************************************************************/
+
+#ifdef NXCON_RUNS
+#  define NXCON_BYTESPP     (CONFIG_NXCONSOLE_BPP >> 3)
+#  if CONFIG_NXCONSOLE_BPP == 8
+#    define NXCON_PIXEL_T   uint8_t
+#  elif CONFIG_NXCONSOLE_BPP == 16
+#    define NXCON_PIXEL_T   uint16_t
+#  else
+#    define NXCON_PIXEL_T   uint32_t
+#  endif
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxcon_fillspace
+ *
+ * Description:
+ *   Set a character cell of the run buffer to the background color.  This
+ *   is used for characters that have no glyph.
+ *
+ ****************************************************************************/
+
+#ifdef NXCON_RUNS
+static void nxcon_fillspace(FAR struct nxcon_state_s *priv,
+                            FAR uint8_t *dest, unsigned int width)
+{
+  FAR NXCON_PIXEL_T *ptr;
+  unsigned int col;
+  int row;
+
+  for (row = 0; row < priv->fheight; row++)
+    {
+      ptr = (FAR NXCON_PIXEL_T *)dest;
+      for (col = 0; col < width; col++)
+        {
+          *ptr++ = (NXCON_PIXEL_T)priv->wndo.wcolor[0];
+        }
+
+      dest += priv->runstride;
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: nxcon_fillrun
+ *
+ * Description:
+ *   Compose a run of adjacent characters on one line, starting with
+ *   character 'first', into the run buffer and send the run to the window
+ *   with a single bitmap operation.  The run ends at the first character
+ *   that is on a different line, that does not immediately follow the
+ *   previous character, that does not fit in the run buffer or (if 'dirty'
+ *   is true) that has already been drawn.
+ *
+ * Returned Value:
+ *   The index of the character following the run.
+ *
+ ****************************************************************************/
+
+#ifdef NXCON_RUNS
+static int nxcon_fillrun(FAR struct nxcon_state_s *priv,
+                         FAR const struct nxgl_rect_s *rect,
+                         int first, bool dirty)
+{
+  FAR const struct nxfonts_glyph_s *glyph;
+  FAR struct nxcon_bitmap_s *bm;
+  FAR const uint8_t *src;
+  FAR uint8_t *dest;
+  struct nxgl_rect_s bounds;
+  struct nxgl_rect_s intersection;
+  struct nxgl_point_s origin;
+  FAR const void *run;
+  unsigned int width;
+  int row;
+  int ret;
+  int i;
+
+  origin.x = priv->bm[first].pos.x;
+  origin.y = priv->bm[first].pos.y;
+  width    = 0;
+
+  for (i = first; i < priv->nchars; i++)
+    {
+      bm = &priv->bm[i];
+
+      /* Does this character continue the run? */
+
+      if (i > first &&
+          (bm->pos.y != origin.y || bm->pos.x != origin.x + (int)width ||
+           (dirty && !BM_ISDIRTY(bm))))
+        {
+          break;
+        }
+
+      /* Get the glyph.  Characters without a glyph are drawn as spaces */
+
+      glyph = NULL;
+      if (!BM_ISSPACE(bm))
+        {
+          glyph = nxf_cache_getglyph(priv->fcache, bm->code);
+        }
+
+      /* Stop if the character would not fit in the run buffer */
+
+      if (width + (glyph ? glyph->width : priv->spwidth) > priv->wndo.wsize.w)
+        {
+          break;
+        }
+
+      /* Copy the glyph (or a space) into the run buffer */
+
+      dest = priv->runbuffer + width * NXCON_BYTESPP;
+      if (glyph)
+        {
+          src = glyph->bitmap;
+          for (row = 0; row < glyph->height; row++)
+            {
+              memcpy(dest, src, glyph->width * NXCON_BYTESPP);
+              dest += priv->runstride;
+              src  += glyph->stride;
+            }
+
+          width += glyph->width;
+        }
+      else
+        {
+          nxcon_fillspace(priv, dest, priv->spwidth);
+          width += priv->spwidth;
+        }
+    }
+
+  /* Then put the whole run on the display */
+
+  if (i > first)
+    {
+      bounds.pt1.x = origin.x;
+      bounds.pt1.y = origin.y;
+      bounds.pt2.x = origin.x + width - 1;
+      bounds.pt2.y = origin.y + priv->fheight - 1;
+
+      if (rect)
+        {
+          nxgl_rectintersect(&intersection, rect, &bounds);
+        }
+      else
+        {
+          nxgl_rectcopy(&intersection, &bounds);
+        }
+
+      if (!nxgl_nullrect(&intersection))
+        {
+          run = (FAR const void *)priv->runbuffer;
+          ret = priv->ops->bitmap(priv, &intersection, &run, &origin,
+                                  (unsigned int)priv->runstride);
+          if (ret < 0)
+            {
+              gdbg("bitmap failed: %d\n", errno);
+            }
+        }
+    }
+  else
+    {
+      /* The first character did not fit.  This should not happen; just
+       * draw it by itself.
+       */
+
+      nxcon_fillchar(priv, rect, &priv->bm[first]);
+      i = first + 1;
+    }
+
+  return i;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxcon_fillchars
+ *
+ * Description:
+ *   Draw the characters that lie within a region of the window.
+ *   Adjacent characters on the same line are drawn together as one run.
+ *
+ * Input Parameters:
+ *   priv  - Driver data structure
+ *   rect  - The region to draw (NULL means the whole window)
+ *   dirty - true:  Draw only the characters that have not yet been drawn
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxcon_fillchars(FAR struct nxcon_state_s *priv,
+                     FAR const struct nxgl_rect_s *rect, bool dirty)
+{
+  FAR struct nxcon_bitmap_s *bm;
+  int first;
+  int next;
+
+  for (first = 0; first < priv->nchars; first = next)
+    {
+      bm = &priv->bm[first];
+
+      /* Skip over characters that don't need to be drawn.  That includes
+       * any lines that are completely outside of the region.
+       */
+
+      if ((dirty && !BM_ISDIRTY(bm)) ||
+          (rect && (bm->pos.y > rect->pt2.y ||
+                    bm->pos.y + priv->fheight <= rect->pt1.y)))
+        {
+          next = first + 1;
+          continue;
+        }
+
+#ifdef NXCON_RUNS
+      if (priv->runbuffer)
+        {
+          next = nxcon_fillrun(priv, rect, first, dirty);
+        }
+      else
+#endif
+        {
+          nxcon_fillchar(priv, rect, bm);
+          next = first + 1;
+        }
+
+      /* The characters are now on the display (unless they were clipped) */
+
+      if (!rect)
+        {
+          for (; first < next; first++)
+            {
+              priv->bm[first].flags &= ~BMFLAGS_DIRTY;
+            }
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: nxcon_flush
+ *
+ * Description:
+ *   Draw all of the characters that have been added to the window but not
+ *   yet drawn.  nxcon_putc() only adds characters;  they are drawn here
+ *   when the write completes.  Characters that scroll off of the display
+ *   before then are never drawn at all.
+ *
+ ****************************************************************************/
+
+void nxcon_flush(FAR struct nxcon_state_s *priv)
+{
+  nxcon_fillchars(priv, NULL, true);
+}
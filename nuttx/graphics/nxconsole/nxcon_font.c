@@ -1,7 +1,7 @@
 /****************************************************************************
  * nuttx/graphics/nxconsole/nxcon_font.c
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -44,34 +44,18 @@
 #include <errno.h>
 #include <debug.h>
 
-#include <nuttx/kmalloc.h>
-
 #include "nxcon_internal.h"
 
 /****************************************************************************
  * Definitions
  ****************************************************************************/
 
-/* Select renderer -- Some additional logic would be required to support
- * pixel depths that are not directly addressable (1,2,4, and 24).
+/* Glyphs are rendered by the NX font cache which, like the NX font
+ * renderers, does not support 24-bit pixels.
  */
 
-#if CONFIG_NXCONSOLE_BPP == 1
-#  define RENDERER nxf_convert_1bpp
-#elif CONFIG_NXCONSOLE_BPP == 2
-#  define RENDERER nxf_convert_2bpp
-#elif CONFIG_NXCONSOLE_BPP == 4
-#  define RENDERER nxf_convert_4bpp
-#elif CONFIG_NXCONSOLE_BPP == 8
-#  define RENDERER nxf_convert_8bpp
-#elif CONFIG_NXCONSOLE_BPP == 16
-#  define RENDERER nxf_convert_16bpp
-#elif CONFIG_NXCONSOLE_BPP == 24
-#  define RENDERER nxf_convert_24bpp
-#elif  CONFIG_NXCONSOLE_BPP == 32
-#  define RENDERER nxf_convert_32bpp
-#else
-#  error "Unsupported CONFIG_NXCONSOLE_BPP"
+#if CONFIG_NXCONSOLE_BPP == 24
+#  error "CONFIG_NXCONSOLE_BPP == 24 is not supported"
 #endif
 
 /****************************************************************************
@@ -94,239 +78,6 @@
  * Private Functions
  ****************************************************************************/
 
-/****************************************************************************
- * Name: nxcon_freeglyph
- ****************************************************************************/
-
-static void nxcon_freeglyph(FAR struct nxcon_glyph_s *glyph)
-{
-  if (glyph->bitmap)
-    {
-      kfree(glyph->bitmap);
-    }
-  memset(glyph, 0, sizeof(struct nxcon_glyph_s));
-}
-
-/****************************************************************************
- * Name: nxcon_allocglyph
- ****************************************************************************/
-
-static inline FAR struct nxcon_glyph_s *
-nxcon_allocglyph(FAR struct nxcon_state_s *priv)
-{
-  FAR struct nxcon_glyph_s *glyph = NULL;
-  FAR struct nxcon_glyph_s *luglyph = NULL;
-  uint8_t luusecnt;
-  int i;
-
-  /* Search through the glyph cache looking for an unused glyph.  Also, keep
-   * track of the least used glyph as well.  We need that if we have to replace
-   * a glyph in the cache.
-   */
-
-   for (i = 0; i < priv->maxglyphs; i++)
-    {
-      /* Is this glyph in use? */
-
-      glyph = &priv->glyph[i];
-      if (!glyph->usecnt)
-        {
-          /* No.. return this glyph with a use count of one */
-
-          glyph->usecnt = 1;
-          return glyph;
-        }
-
-      /* Yes.. check for the least recently used */
-
-      if (!luglyph || glyph->usecnt < luglyph->usecnt)
-        {
-          luglyph = glyph;
-        }
-    }
-
-  /* If we get here, the glyph cache is full.  We replace the least used
-   * glyph with the one we need now. (luglyph can't be NULL).
-   */
-   
-  luusecnt = luglyph->usecnt;
-  nxcon_freeglyph(luglyph);
-
-  /* But lets decrement all of the usecnts so that the new one one be so
-   * far behind in the counts as the older ones.
-   */
-
-  if (luusecnt > 1)
-    {
-       uint8_t decr = luusecnt - 1;
- 
-       for (i = 0; i < priv->maxglyphs; i++)
-        {
-          /* Is this glyph in use? */
-
-          glyph = &priv->glyph[i];
-          if (glyph->usecnt > decr)
-            {
-              glyph->usecnt -= decr;
-            }
-        }
-    }
-
-  /* Then return the least used glyph */
-
-  luglyph->usecnt = 1;
-  return luglyph;
-}
-
-/****************************************************************************
- * Name: nxcon_findglyph
- ****************************************************************************/
-
-static FAR struct nxcon_glyph_s *
-nxcon_findglyph(FAR struct nxcon_state_s *priv, uint8_t ch)
-{
-  int i;
-
-  /* First, try to find the glyph in the cache of pre-rendered glyphs */
-
-   for (i = 0; i < priv->maxglyphs; i++)
-    {
-      FAR struct nxcon_glyph_s *glyph = &priv->glyph[i];
-      if (glyph->usecnt > 0 && glyph->code == ch)
-        {
-          /* Increment the use count (unless it is already at the max) */
-
-          if (glyph->usecnt < MAX_USECNT)
-            {
-               glyph->usecnt++;
-            }
-
-          /* And return the glyph that we found */
-
-          return glyph;
-        }
-    }
-  return NULL;
-}
-
-/****************************************************************************
- * Name: nxcon_renderglyph
- ****************************************************************************/
-
-static inline FAR struct nxcon_glyph_s *
-nxcon_renderglyph(FAR struct nxcon_state_s *priv,
-                   FAR const struct nx_fontbitmap_s *fbm, uint8_t ch)
-{
-  FAR struct nxcon_glyph_s *glyph = NULL;
-  FAR nxgl_mxpixel_t *ptr;
-#if CONFIG_NXCONSOLE_BPP < 8
-  nxgl_mxpixel_t pixel;
-#endif
-  int bmsize;
-  int row;
-  int col;
-  int ret;
-
-  /* Allocate the glyph (always succeeds) */
-
-  glyph         = nxcon_allocglyph(priv);
-  glyph->code   = ch;
-
-  /* Get the dimensions of the glyph */
-
-  glyph->width  = fbm->metric.width + fbm->metric.xoffset;
-  glyph->height = fbm->metric.height + fbm->metric.yoffset;
-
-  /* Get the physical width of the glyph in bytes */
-
-  glyph->stride = (glyph->width * CONFIG_NXCONSOLE_BPP + 7) / 8;
-
-  /* Allocate memory to hold the glyph with its offsets */
-
-  bmsize        =  glyph->stride * glyph->height;
-  glyph->bitmap = (FAR uint8_t *)kmalloc(bmsize);
-
-  if (glyph->bitmap)
-    {
-      /* Initialize the glyph memory to the background color using the
-       * hard-coded bits-per-pixel (BPP).
-       *
-       * TODO:  The rest of NX is configured to support multiple devices
-       * with differing BPP.  They logic should be extended to support
-       * differing BPP's as well.
-       */
-
-#if CONFIG_NXCONSOLE_BPP < 8
-      pixel  = priv->wcolor[0];
-
-#  if CONFIG_NXCONSOLE_BPP == 1
-
-      /* Pack 1-bit pixels into a 2-bits */
-
-      pixel &= 0x01;
-      pixel  = (pixel) << 1 | pixel;
-
-#  endif
-#  if CONFIG_NXCONSOLE_BPP < 4
-
-      /* Pack 2-bit pixels into a nibble */
-
-      pixel &= 0x03;
-      pixel  = (pixel) << 2 | pixel;
-
-#  endif
-
-      /* Pack 4-bit nibbles into a byte */
-
-      pixel &= 0x0f;
-      pixel  = (pixel) << 4 | pixel;
-
-      ptr    = (FAR nxgl_mxpixel_t *)glyph->bitmap;
-      for (row = 0; row < glyph->height; row++)
-        {
-          for (col = 0; col < glyph->stride; col++)
-            {
-              /* Transfer the packed bytes into the buffer */
-
-              *ptr++ = pixel;
-            }
-        }
-
-#elif CONFIG_NXCONSOLE_BPP == 24
-# error "Additional logic is needed here for 24bpp support"
-
-#else /* CONFIG_NXCONSOLE_BPP = {8,16,32} */
-
-      ptr = (FAR nxgl_mxpixel_t *)glyph->bitmap;
-      for (row = 0; row < glyph->height; row++)
-        {
-          /* Just copy the color value into the glyph memory */
-
-          for (col = 0; col < glyph->width; col++)
-            {
-              *ptr++ = priv->wndo.wcolor[0];
-            }
-        }
-#endif
-
-      /* Then render the glyph into the allocated memory */
-
-      ret = RENDERER((FAR nxgl_mxpixel_t*)glyph->bitmap,
-                      glyph->height, glyph->width, glyph->stride,
-                      fbm, priv->wndo.fcolor[0]);
-      if (ret < 0)
-        {
-          /* Actually, the RENDERER never returns a failure */
-
-          gdbg("nxcon_renderglyph: RENDERER failed\n");
-          nxcon_freeglyph(glyph);
-          glyph = NULL;
-        }
-    }
-
-  return glyph;
-}
-
 /****************************************************************************
  * Name: nxcon_fontsize
  ****************************************************************************/
@@ -350,39 +101,6 @@ static int nxcon_fontsize(NXHANDLE hfont, uint8_t ch, FAR struct nxgl_size_s *si
   return ERROR;
 }
 
-/****************************************************************************
- * Name: nxcon_getglyph
- ****************************************************************************/
-
-static FAR struct nxcon_glyph_s *
-nxcon_getglyph(NXHANDLE hfont, FAR struct nxcon_state_s *priv, uint8_t ch)
-{
-  FAR struct nxcon_glyph_s *glyph;
-  FAR const struct nx_fontbitmap_s *fbm;
-
-  /* First, try to find the glyph in the cache of pre-rendered glyphs */
-
-  glyph = nxcon_findglyph(priv, ch);
-  if (glyph)
-    {
-      /* We found it in the cache .. return the cached glyph */
-
-      return glyph;
-    }
-
-  /* No, it is not cached... Does the code map to a font? */
-
-  fbm = nxf_getbitmap(hfont, ch);
-  if (fbm)
-    {
-      /* Yes.. render the glyph */
-
-      glyph = nxcon_renderglyph(priv, fbm, ch);
-    }
-
-  return glyph;
-}
-
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -392,7 +110,8 @@ nxcon_getglyph(NXHANDLE hfont, FAR struct nxcon_state_s *priv, uint8_t ch)
  *
  * Description:
  *   This is part of the nxcon_putc logic.  It creates and positions a
- *   the character and renders (or re-uses) a glyph for font.
+ *   the character and renders (or re-uses) a glyph for font.  The new
+ *   character is marked dirty;  it will be drawn by nxcon_flush().
  *
  ****************************************************************************/
 
@@ -400,7 +119,7 @@ FAR const struct nxcon_bitmap_s *
 nxcon_addchar(NXHANDLE hfont, FAR struct nxcon_state_s *priv, uint8_t ch)
 {
   FAR struct nxcon_bitmap_s *bm = NULL;
-  FAR struct nxcon_glyph_s *glyph;
+  FAR const struct nxfonts_glyph_s *glyph;
 
   /* Is there space for another character on the display? */
 
@@ -410,13 +129,13 @@ nxcon_addchar(NXHANDLE hfont, FAR struct nxcon_state_s *priv, uint8_t ch)
 
       bm        = &priv->bm[priv->nchars];
       bm->code  = ch;
-      bm->flags = 0;
+      bm->flags = BMFLAGS_DIRTY;
       bm->pos.x = priv->fpos.x;
       bm->pos.y = priv->fpos.y;
 
       /* Find (or create) the matching glyph */
 
-      glyph = nxcon_getglyph(hfont, priv, ch);
+      glyph = nxf_cache_getglyph(priv->fcache, ch);
       if (!glyph)
         {
           /* No, there is no font for this code.  Just mark this as a space. */
@@ -507,9 +226,9 @@ int nxcon_backspace(FAR struct nxcon_state_s *priv)
       ndx = priv->nchars - 1;
       bm  = &priv->bm[ndx];
 
-      /* Erase the character from the display */
+      /* Erase the character from the display (unless it was never drawn) */
 
-      ret = nxcon_hidechar(priv, bm);
+      ret = BM_ISDIRTY(bm) ? OK : nxcon_hidechar(priv, bm);
 
       /* The current position to the location where the last character was */
     
@@ -575,7 +294,7 @@ void nxcon_fillchar(FAR struct nxcon_state_s *priv,
                     FAR const struct nxgl_rect_s *rect,
                     FAR const struct nxcon_bitmap_s *bm)
 {
-  FAR struct nxcon_glyph_s *glyph;
+  FAR const struct nxfonts_glyph_s *glyph;
   struct nxgl_rect_s bounds;
   struct nxgl_rect_s intersection;
   struct nxgl_size_s fsize;
@@ -632,7 +351,7 @@ void nxcon_fillchar(FAR struct nxcon_state_s *priv,
 
       /* Find (or create) the glyph that goes with this font */
 
-      glyph = nxcon_getglyph(priv->font, priv, bm->code);
+      glyph = nxf_cache_getglyph(priv->fcache, bm->code);
       if (!glyph)
         {
           /* Shouldn't happen */
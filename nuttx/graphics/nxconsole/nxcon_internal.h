@@ -1,7 +1,7 @@
 /****************************************************************************
  * nuttx/graphics/nxconsole/nxcon_internal.h
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -43,6 +43,7 @@
 #include <nuttx/config.h>
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <semaphore.h>
 
 #include <nuttx/fs/fs.h>
@@ -59,11 +60,20 @@
 /* Bitmap flags */
 
 #define BMFLAGS_NOGLYPH    (1 << 0) /* No glyph available, use space */
+#define BMFLAGS_DIRTY      (1 << 1) /* Not yet drawn on the display */
 #define BM_ISSPACE(bm)     (((bm)->flags & BMFLAGS_NOGLYPH) != 0)
+#define BM_ISDIRTY(bm)     (((bm)->flags & BMFLAGS_DIRTY) != 0)
 
-/* Sizes and maximums */
+/* Adjacent characters on the same line are normally composed into a run
+ * buffer and sent to the window with one bitmap operation.  Glyphs can
+ * only be copied into the run buffer on byte boundaries.
+ */
 
-#define MAX_USECNT         255  /* Limit to range of a uint8_t */
+#if CONFIG_NXCONSOLE_BPP >= 8 && !defined(CONFIG_NXCONSOLE_NORUNS)
+#  define NXCON_RUNS 1
+#else
+#  undef NXCON_RUNS
+#endif
 
 /* Device path formats */
 
@@ -111,18 +121,6 @@ struct nxcon_operations_s
                 unsigned int stride);
 };
 
-/* Describes one cached glyph bitmap */
-
-struct nxcon_glyph_s
-{
-  uint8_t code;                        /* Character code */
-  uint8_t height;                      /* Height of this glyph (in rows) */
-  uint8_t width;                       /* Width of this glyph (in pixels) */
-  uint8_t stride;                      /* Width of the glyph row (in bytes) */
-  uint8_t usecnt;                      /* Use count */
-  FAR uint8_t *bitmap;                 /* Allocated bitmap memory */
-};
-
 /* Describes on character on the display */
 
 struct nxcon_bitmap_s
@@ -140,6 +138,7 @@ struct nxcon_state_s
   FAR void *handle;                         /* The window handle */
   FAR struct nxcon_window_s wndo;           /* Describes the window and font */
   NXHANDLE font;                            /* The current font handle */
+  FCACHE fcache;                            /* Cache of rendered glyphs */
   sem_t exclsem;                            /* Forces mutually exclusive access */
 #ifdef CONFIG_DEBUG
   pid_t holder;                             /* Deadlock avoidance */
@@ -151,7 +150,11 @@ struct nxcon_state_s
   uint8_t fheight;                          /* Max height of a font in pixels */
   uint8_t fwidth;                           /* Max width of a font in pixels */
   uint8_t spwidth;                          /* The width of a space */
-  uint8_t maxglyphs;                        /* Size of the glyph[] array */
+
+#ifdef NXCON_RUNS
+  uint16_t runstride;                       /* Width of the run buffer in bytes */
+  FAR uint8_t *runbuffer;                   /* Holds one line of rendered characters */
+#endif
 
   uint16_t maxchars;                        /* Size of the bm[] array */
   uint16_t nchars;                          /* Number of chars in the bm[] array */
@@ -168,10 +171,6 @@ struct nxcon_state_s
   struct nxcon_bitmap_s cursor;
   struct nxcon_bitmap_s bm[CONFIG_NXCONSOLE_MXCHARS];
 
-  /* Glyph cache data storage */
-
-  struct nxcon_glyph_s  glyph[CONFIG_NXCONSOLE_CACHESIZE];
-
   /* Keyboard input support */
 
 #ifdef CONFIG_NXCONSOLE_NXKBDIN
@@ -242,6 +241,9 @@ int nxcon_hidechar(FAR struct nxcon_state_s *priv,
 int nxcon_backspace(FAR struct nxcon_state_s *priv);
 void nxcon_fillchar(FAR struct nxcon_state_s *priv,
     FAR const struct nxgl_rect_s *rect, FAR const struct nxcon_bitmap_s *bm);
+void nxcon_fillchars(FAR struct nxcon_state_s *priv,
+    FAR const struct nxgl_rect_s *rect, bool dirty);
+void nxcon_flush(FAR struct nxcon_state_s *priv);
 
 void nxcon_putc(FAR struct nxcon_state_s *priv, uint8_t ch);
 void nxcon_showcursor(FAR struct nxcon_state_s *priv);
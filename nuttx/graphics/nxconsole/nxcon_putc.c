@@ -1,7 +1,7 @@
 /****************************************************************************
  * nuttx/graphics/nxconsole/nxcon_putc.c
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -71,13 +71,13 @@
  * Name: nxcon_putc
  *
  * Description:
- *   Render the specified character at the current display position.
+ *   Add the specified character at the current display position.  The
+ *   character is not drawn until nxcon_flush() is called.
  *
  ****************************************************************************/
 
 void nxcon_putc(FAR struct nxcon_state_s *priv, uint8_t ch)
 {
-  FAR const struct nxcon_bitmap_s *bm;
   int lineheight;
 
   /* Ignore carriage returns */
@@ -138,15 +138,11 @@ void nxcon_putc(FAR struct nxcon_state_s *priv, uint8_t ch)
       nxcon_scroll(priv, lineheight);
     }
 
-  /* Find the glyph associated with the character and render it onto the
-   * display.
+  /* Find the glyph associated with the character.  The character will be
+   * drawn on the display by nxcon_flush().
    */
 
-  bm = nxcon_addchar(priv->font, priv, ch);
-  if (bm)
-    {
-      nxcon_fillchar(priv, NULL, bm);
-    }
+  (void)nxcon_addchar(priv->font, priv, ch);
 }
 
 /****************************************************************************
@@ -1,7 +1,7 @@
 /****************************************************************************
- * nuttx/graphics/nxconsole/nxcon_bkgd.c
+ * nuttx/graphics/nxconsole/nxcon_redraw.c
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -102,7 +102,6 @@ void nxcon_redraw(NXCONSOLE handle, FAR const struct nxgl_rect_s *rect, bool mor
 {
   FAR struct nxcon_state_s *priv;
   int ret;
-  int i;
 
   DEBUGASSERT(handle && rect);
   gvdbg("rect={(%d,%d),(%d,%d)} more=%s\n",
@@ -140,13 +139,10 @@ void nxcon_redraw(NXCONSOLE handle, FAR const struct nxgl_rect_s *rect, bool mor
       gdbg("fill failed: %d\n", errno);
     }
 
-  /* Then redraw each character on the display (Only the characters within
+  /* Then redraw the characters on the display (Only the characters within
    * the rectangle will actually be redrawn).
    */
 
-  for (i = 0; i < priv->nchars; i++)
-    {
-      nxcon_fillchar(priv, rect, &priv->bm[i]);
-    }
+  nxcon_fillchars(priv, rect, false);
   ret = nxcon_sempost(priv);
 }
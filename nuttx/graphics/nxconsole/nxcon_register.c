@@ -1,7 +1,7 @@
 /****************************************************************************
  * nuttx/graphics/nxconsole/nxcon_register.c
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -133,7 +133,28 @@ FAR struct nxcon_state_s *
 
   /* Set up the font glyph bitmap cache */
 
-  priv->maxglyphs = CONFIG_NXCONSOLE_CACHESIZE;
+  priv->fcache = nxf_cache_connect(priv->font, wndo->fcolor[0],
+                                   wndo->wcolor[0], CONFIG_NXCONSOLE_BPP,
+                                   CONFIG_NXCONSOLE_CACHESIZE);
+  if (!priv->fcache)
+    {
+      gdbg("Failed to create the font cache: %d\n", errno);
+      goto errout;
+    }
+
+#ifdef NXCON_RUNS
+  /* Allocate the buffer used to compose runs of characters.  It holds one
+   * line of text that is as wide as the window.  If it cannot be allocated,
+   * characters will be drawn one at a time.
+   */
+
+  priv->runstride = (wndo->wsize.w * CONFIG_NXCONSOLE_BPP + 7) >> 3;
+  priv->runbuffer = (FAR uint8_t *)kmalloc(priv->runstride * priv->fheight);
+  if (!priv->runbuffer)
+    {
+      gdbg("Failed to allocate the run buffer\n");
+    }
+#endif
 
   /* Set the initial display position */
 
@@ -1,7 +1,7 @@
 /****************************************************************************
  * nuttx/graphics/nxconsole/nxcon_scroll.c
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -91,11 +91,9 @@
 static inline void nxcon_movedisplay(FAR struct nxcon_state_s *priv,
                                      int bottom, int scrollheight)
 {
-  FAR struct nxcon_bitmap_s *bm;
   struct nxgl_rect_s rect;
   nxgl_coord_t row;
   int ret;
-  int i;
 
   /* Move each row, one at a time.  They could all be moved at once (by calling
    * nxcon_redraw), but the since the region is cleared, then re-written, the
@@ -123,14 +121,7 @@ static inline void nxcon_movedisplay(FAR struct nxcon_state_s *priv,
 
       /* Fill each character that might lie within in the bounding box */
 
-      for (i = 0; i < priv->nchars; i++)
-        {
-          bm = &priv->bm[i];
-          if (bm->pos.y <= rect.pt2.y && bm->pos.y + priv->fheight >= rect.pt1.y)
-            {
-              nxcon_fillchar(priv, &rect, bm);
-            }
-        }
+      nxcon_fillchars(priv, &rect, false);
     }
 
   /* Finally, clear the bottom part of the display */
@@ -188,46 +179,42 @@ static inline void nxcon_movedisplay(FAR struct nxcon_state_s *priv,
 
 void nxcon_scroll(FAR struct nxcon_state_s *priv, int scrollheight)
 {
+  FAR struct nxcon_bitmap_s *bm;
   int i;
   int j;
 
-  /* Adjust the vertical position of each character */
+  /* Adjust the vertical position of each character, discarding the ones
+   * that scroll off of the top of the display.  The remaining characters
+   * are packed to the beginning of the array in one pass.
+   */
 
-  for (i = 0; i < priv->nchars; )
+  for (i = 0, j = 0; i < priv->nchars; i++)
     {
-      FAR struct nxcon_bitmap_s *bm = &priv->bm[i];
+      bm = &priv->bm[i];
 
       /* Has any part of this character scrolled off the screen? */
 
-      if (bm->pos.y < scrollheight + CONFIG_NXCONSOLE_LINESEPARATION)
+      if (bm->pos.y >= scrollheight + CONFIG_NXCONSOLE_LINESEPARATION)
         {
-          /* Yes... Delete the character by moving all of the data */
+          /* No.. just decrement its vertical position (moving it "up" the
+           * display by one line) and keep it.  Characters that have not
+           * yet been drawn are still dirty and will be drawn in their new
+           * position.
+           */
 
-          for (j = i; j < priv->nchars-1; j++)
+          bm->pos.y -= scrollheight;
+          if (j != i)
             {
-              memcpy(&priv->bm[j], &priv->bm[j+1], sizeof(struct nxcon_bitmap_s));
+              memcpy(&priv->bm[j], bm, sizeof(struct nxcon_bitmap_s));
             }
 
-          /* Decrement the number of cached characters ('i' is not incremented
-           * in this case because it already points to the next character)
-           */
-
-          priv->nchars--;
+          j++;
         }
+    }
 
-      /* No.. just decrement its vertical position (moving it "up" the
-       * display by one line).
-       */
+  /* Retain only the characters that are still on the display */
 
-      else
-        {
-          bm->pos.y -= scrollheight;
-
-          /* We are keeping this one so increment to the next character */
- 
-          i++;
-        }
-    }
+  priv->nchars = j;
 
   /* And move the next display position up by one line as well */
 
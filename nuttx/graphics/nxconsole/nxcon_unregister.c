@@ -1,7 +1,7 @@
 /****************************************************************************
  * nuttx/graphics/nxconsole/nxcon_unregister.c
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -89,7 +89,6 @@ void nxcon_unregister(NXCONSOLE handle)
 {
   FAR struct nxcon_state_s *priv;
   char devname[NX_DEVNAME_SIZE];
-  int i;
 
   DEBUGASSERT(handle);
 
@@ -101,16 +100,18 @@ void nxcon_unregister(NXCONSOLE handle)
   sem_destroy(&priv->waitsem);
 #endif
 
-  /* Free all allocated glyph bitmap */
+  /* Free all rendered glyphs */
 
-  for (i = 0; i < CONFIG_NXCONSOLE_CACHESIZE; i++)
+  nxf_cache_disconnect(priv->fcache);
+
+#ifdef NXCON_RUNS
+  /* Free the run buffer */
+
+  if (priv->runbuffer)
     {
-      FAR struct nxcon_glyph_s *glyph = &priv->glyph[i];
-      if (glyph->bitmap)
-        {
-          kfree(glyph->bitmap);
-        }
+      kfree(priv->runbuffer);
     }
+#endif
 
   /* Unregister the driver */
 
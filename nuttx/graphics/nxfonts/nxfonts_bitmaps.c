@@ -82,6 +82,8 @@
 #  include "nxfonts_sans20x27b.h"
 #elif NXFONTS_FONTID == 18
 #  include "nxfonts_mono5x8.h"
+#elif NXFONTS_FONTID == 19
+#  include "nxfonts_sans20x24aa.h"
 #else
 #  error "No font ID specified"
 #endif
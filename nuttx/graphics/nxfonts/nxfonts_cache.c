@@ -0,0 +1,392 @@
+/****************************************************************************
+ * graphics/nxfonts/nxfonts_cache.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT}
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING}
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/kmalloc.h>
+#include <nuttx/nx/nxfonts.h>
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This describes one font cache.  The glyphs are kept in a singly linked
+ * list with the most recently used glyph at the head.
+ */
+
+struct nxfonts_fcache_s
+{
+  FAR struct nxfonts_glyph_s *head; /* Most recently used glyph */
+  NXHANDLE font;                    /* The font used to render the glyphs */
+  nxgl_mxpixel_t fgcolor;           /* Color of the set pixels */
+  nxgl_mxpixel_t bgcolor;           /* Color of the background */
+  uint8_t bpp;                      /* Bits per pixel */
+  uint8_t height;                   /* Height of every glyph (font height) */
+  uint8_t maxglyphs;                /* Maximum number of glyphs retained */
+  uint8_t nglyphs;                  /* Number of glyphs in the cache */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxf_fillglyph
+ *
+ * Description:
+ *   Initialize the glyph memory to the background color.
+ *
+ ****************************************************************************/
+
+static void nxf_fillglyph(FAR struct nxfonts_fcache_s *priv,
+                          FAR struct nxfonts_glyph_s *glyph)
+{
+  unsigned int npixels;
+  uint8_t pixel;
+
+  if (priv->bpp <= 8)
+    {
+      /* Replicate pixels smaller than one byte throughout the byte */
+
+      pixel = (uint8_t)priv->bgcolor;
+      if (priv->bpp == 1)
+        {
+          pixel &= 0x01;
+          pixel  = pixel << 1 | pixel;
+        }
+
+      if (priv->bpp <= 2)
+        {
+          pixel &= 0x03;
+          pixel  = pixel << 2 | pixel;
+        }
+
+      if (priv->bpp <= 4)
+        {
+          pixel &= 0x0f;
+          pixel  = pixel << 4 | pixel;
+        }
+
+      memset(glyph->bitmap, pixel, glyph->stride * glyph->height);
+    }
+  else if (priv->bpp == 16)
+    {
+      FAR uint16_t *ptr = (FAR uint16_t *)glyph->bitmap;
+
+      for (npixels = glyph->width * glyph->height; npixels > 0; npixels--)
+        {
+          *ptr++ = (uint16_t)priv->bgcolor;
+        }
+    }
+  else /* if (priv->bpp == 32) */
+    {
+      FAR uint32_t *ptr = (FAR uint32_t *)glyph->bitmap;
+
+      for (npixels = glyph->width * glyph->height; npixels > 0; npixels--)
+        {
+          *ptr++ = (uint32_t)priv->bgcolor;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: nxf_renderglyph
+ *
+ * Description:
+ *   Allocate and render a new glyph.
+ *
+ ****************************************************************************/
+
+static FAR struct nxfonts_glyph_s *
+nxf_renderglyph(FAR struct nxfonts_fcache_s *priv,
+                FAR const struct nx_fontbitmap_s *fbm, uint16_t ch)
+{
+  FAR struct nxfonts_glyph_s *glyph;
+  uint16_t stride;
+  uint8_t width;
+  int ret;
+
+  /* Get the dimensions of the glyph.  The glyph memory follows the glyph
+   * structure (which is padded to the alignment of a pointer).
+   */
+
+  width  = fbm->metric.width + fbm->metric.xoffset;
+  stride = (width * priv->bpp + 7) >> 3;
+
+  glyph = (FAR struct nxfonts_glyph_s *)
+    kmalloc(sizeof(struct nxfonts_glyph_s) + stride * priv->height);
+
+  if (!glyph)
+    {
+      gdbg("Failed to allocate glyph %d\n", ch);
+      return NULL;
+    }
+
+  glyph->flink  = NULL;
+  glyph->bitmap = (FAR uint8_t *)&glyph[1];
+  glyph->code   = ch;
+  glyph->stride = stride;
+  glyph->height = priv->height;
+  glyph->width  = width;
+
+  /* Fill the glyph with the background color, then render the character */
+
+  nxf_fillglyph(priv, glyph);
+
+  switch (priv->bpp)
+    {
+      case 1:
+        ret = nxf_convert_1bpp(glyph->bitmap, glyph->height, width, stride,
+                               fbm, priv->fgcolor);
+        break;
+
+      case 2:
+        ret = nxf_convert_2bpp(glyph->bitmap, glyph->height, width, stride,
+                               fbm, priv->fgcolor);
+        break;
+
+      case 4:
+        ret = nxf_convert_4bpp(glyph->bitmap, glyph->height, width, stride,
+                               fbm, priv->fgcolor);
+        break;
+
+      case 8:
+        ret = nxf_convert_8bpp(glyph->bitmap, glyph->height, width, stride,
+                               fbm, priv->fgcolor);
+        break;
+
+      case 16:
+        ret = nxf_convert_16bpp((FAR uint16_t *)glyph->bitmap, glyph->height,
+                                width, stride, fbm, priv->fgcolor);
+        break;
+
+      default: /* 32 */
+        ret = nxf_convert_32bpp((FAR uint32_t *)glyph->bitmap, glyph->height,
+                                width, stride, fbm, priv->fgcolor);
+        break;
+    }
+
+  if (ret < 0)
+    {
+      /* Actually, the renderers never fail */
+
+      kfree(glyph);
+      return NULL;
+    }
+
+  return glyph;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxf_cache_connect
+ *
+ * Description:
+ *   Create a cache of rendered glyphs for one font, color pair, and pixel
+ *   depth.
+ *
+ ****************************************************************************/
+
+FCACHE nxf_cache_connect(NXHANDLE hfont, nxgl_mxpixel_t fgcolor,
+                         nxgl_mxpixel_t bgcolor, int bpp, int maxglyphs)
+{
+  FAR struct nxfonts_fcache_s *priv;
+  FAR const struct nx_font_s *fontset;
+
+  /* 24-bit pixels are not supported by the font renderers */
+
+  if (!hfont || maxglyphs < 1 ||
+      (bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8 && bpp != 16 &&
+       bpp != 32))
+    {
+      set_errno(EINVAL);
+      return NULL;
+    }
+
+  priv = (FAR struct nxfonts_fcache_s *)
+    kzalloc(sizeof(struct nxfonts_fcache_s));
+
+  if (!priv)
+    {
+      set_errno(ENOMEM);
+      return NULL;
+    }
+
+  fontset         = nxf_getfontset(hfont);
+  priv->font      = hfont;
+  priv->fgcolor   = fgcolor;
+  priv->bgcolor   = bgcolor;
+  priv->bpp       = bpp;
+  priv->height    = fontset->mxheight;
+  priv->maxglyphs = maxglyphs > 255 ? 255 : maxglyphs;
+
+  return (FCACHE)priv;
+}
+
+/****************************************************************************
+ * Name: nxf_cache_disconnect
+ *
+ * Description:
+ *   Free a font cache and all of the glyphs that it holds.
+ *
+ ****************************************************************************/
+
+void nxf_cache_disconnect(FCACHE fhandle)
+{
+  FAR struct nxfonts_fcache_s *priv = (FAR struct nxfonts_fcache_s *)fhandle;
+  FAR struct nxfonts_glyph_s *glyph;
+  FAR struct nxfonts_glyph_s *next;
+
+  if (priv)
+    {
+      for (glyph = priv->head; glyph; glyph = next)
+        {
+          next = glyph->flink;
+          kfree(glyph);
+        }
+
+      kfree(priv);
+    }
+}
+
+/****************************************************************************
+ * Name: nxf_cache_getglyph
+ *
+ * Description:
+ *   Return the rendered glyph of a character from the cache, rendering it
+ *   if necessary.
+ *
+ ****************************************************************************/
+
+FAR const struct nxfonts_glyph_s *nxf_cache_getglyph(FCACHE fhandle,
+                                                     uint16_t ch)
+{
+  FAR struct nxfonts_fcache_s *priv = (FAR struct nxfonts_fcache_s *)fhandle;
+  FAR const struct nx_fontbitmap_s *fbm;
+  FAR struct nxfonts_glyph_s *glyph;
+  FAR struct nxfonts_glyph_s *prev;
+  FAR struct nxfonts_glyph_s *last;
+
+  DEBUGASSERT(priv);
+
+  /* Search the cache, remembering the glyph before the current one and
+   * the glyph before the last one (the least recently used).
+   */
+
+  for (prev = NULL, last = NULL, glyph = priv->head;
+       glyph;
+       last = prev, prev = glyph, glyph = glyph->flink)
+    {
+      if (glyph->code == ch)
+        {
+          /* Found it.  Move it to the head of the list (if it is not
+           * already there).
+           */
+
+          if (prev)
+            {
+              prev->flink  = glyph->flink;
+              glyph->flink = priv->head;
+              priv->head   = glyph;
+            }
+
+          return glyph;
+        }
+    }
+
+  /* Not cached... Does the code map to a glyph in the font? */
+
+  fbm = nxf_getbitmap(priv->font, ch);
+  if (!fbm)
+    {
+      return NULL;
+    }
+
+  /* Yes.. If the cache is full, free the least recently used glyph (prev
+   * now refers to the tail of the list).
+   */
+
+  if (priv->nglyphs >= priv->maxglyphs)
+    {
+      if (last)
+        {
+          last->flink = NULL;
+        }
+      else
+        {
+          priv->head = NULL;
+        }
+
+      kfree(prev);
+      priv->nglyphs--;
+    }
+
+  /* Render the new glyph and add it at the head of the list */
+
+  glyph = nxf_renderglyph(priv, fbm, ch);
+  if (glyph)
+    {
+      glyph->flink = priv->head;
+      priv->head   = glyph;
+      priv->nglyphs++;
+    }
+
+  return glyph;
+}
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxfonts/nxfonts_convert.c
  *
- *   Copyright (C) 2008-2010 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2010, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -40,6 +40,7 @@
 #include <nuttx/config.h>
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <debug.h>
 
@@ -136,7 +137,8 @@
  * Name: nxf_convert_*bpp
  *
  * Description:
- *   Convert the 1BPP font to a new pixel depth
+ *   Convert the 1BPP font to a new pixel depth.  Pixels of anti-aliased
+ *   glyphs are drawn if they are at least half covered.
  *
  * Input Parameters:
  *   dest   - The destination buffer provided by the caller.
@@ -160,11 +162,10 @@ int NXF_FUNCNAME(nxf_convert,NXFONTS_SUFFIX)
   FAR uint8_t *line;
   FAR NXF_PIXEL_T *dptr;
   FAR const uint8_t *sptr;
-  uint8_t bmbyte;
-  int bmbit;
+  unsigned int bmstride;
+  bool aa;
   int row;
   int col;
-  int bmndx;
 
 #if NXFONTS_BITSPERPIXEL < 8
   NXF_PIXEL_T mpixel;
@@ -182,9 +183,13 @@ int NXF_FUNCNAME(nxf_convert,NXFONTS_SUFFIX)
   height = ngl_min(bm->metric.height, height - bm->metric.yoffset);
   width  = ngl_min(bm->metric.width, width - bm->metric.xoffset);
 
-  /* Render each row of the glyph */
+  /* Render each row of the glyph.  Each row of the glyph bitmap begins on
+   * a byte boundary, even if the glyph is clipped on the right.
+   */
 
-  sptr = bm->bitmap;
+  sptr     = bm->bitmap;
+  bmstride = NXFONT_STRIDE(bm->metric);
+  aa       = bm->metric.aa;
 #if NXFONTS_BITSPERPIXEL < 8
   mpixel = NXF_MULTIPIXEL(color);
 
@@ -194,42 +199,36 @@ int NXF_FUNCNAME(nxf_convert,NXFONTS_SUFFIX)
     {
       /* Process each byte in the glyph row */
 
-      col   = 0;
       dptr  = (FAR NXF_PIXEL_T*)line;
       pixel = *dptr;
       mask  = NXF_INITMASK;
       nbits = 0;
 
-      for (bmndx = 0; bmndx < bm->metric.stride && col < width; bmndx++)
-        {
-          bmbyte = *sptr++;
+      /* Process each pixel in the glyph row */
 
-          /* Process each bit in one byte */
+      for (col = 0; col < width; col++)
+        {
+          /* Is the pixel set (or at least half covered)? */
 
-          for (bmbit = 7; bmbit >= 0 && col < width; bmbit--, col++)
+          if (nxf_coverage(sptr, col, aa) >= 8)
             {
-              /* Is the bit set? */
-
-              if (bmbyte & (1 << bmbit))
-                {
-                  /* Yes.. set the bit to 'color' in the output */
+              /* Yes.. set the bit to 'color' in the output */
 
-                  pixel = ((pixel & ~mask) | (mpixel & mask));
-                }
+              pixel = ((pixel & ~mask) | (mpixel & mask));
+            }
 
 #ifdef CONFIG_NX_PACKEDMSFIRST
-              mask >>= NXFONTS_BITSPERPIXEL;
+          mask >>= NXFONTS_BITSPERPIXEL;
 #else
-              mask <<= NXFONTS_BITSPERPIXEL;
+          mask <<= NXFONTS_BITSPERPIXEL;
 #endif
-              nbits += NXFONTS_BITSPERPIXEL;
-              if (nbits >= 8)
-                {
-                  *dptr++ = pixel;
-                  pixel = *dptr;
-                  mask  = NXF_INITMASK;
-                  nbits = 0;
-                }
+          nbits += NXFONTS_BITSPERPIXEL;
+          if (nbits >= 8)
+            {
+              *dptr++ = pixel;
+              pixel = *dptr;
+              mask  = NXF_INITMASK;
+              nbits = 0;
             }
         }
 
@@ -245,45 +244,41 @@ int NXF_FUNCNAME(nxf_convert,NXFONTS_SUFFIX)
       /* Point to the beginning of the next row */
 
       line += stride;
+      sptr += bmstride;
     }
 #else
   /* Handle each row in both the input and output */
 
   for (row = 0; row < height; row++)
     {
-      /* Process each byte in the glyph */
+      /* Process each pixel in the glyph row */
 
-      col  = 0;
       dptr = (FAR NXF_PIXEL_T*)line;
 
-      for (bmndx = 0; bmndx < bm->metric.stride && col < width; bmndx++)
+      for (col = 0; col < width; col++)
         {
-          bmbyte = *sptr++;
-
-          /* Process each bit in the byte */
+          /* Is the pixel set (or at least half covered)? */
 
-          for (bmbit = 7; bmbit >= 0 && col < width; bmbit--, col++)
-           {
-              /* Is the bit set? */
-
-              if (bmbyte & (1 << bmbit))
-                {
-                  /* Yes.. set the bit to 'color' in the output */
+          if (nxf_coverage(sptr, col, aa) >= 8)
+            {
+              /* Yes.. set the pixel to 'color' in the output */
 
-                  *dptr++ = color;
-                }
-              else
-                {
-                  /* No... keep the background color in the output */
+              *dptr++ = color;
+            }
+          else
+            {
+              /* No... keep the background color in the output */
 
-                  dptr++;
-                }
+              dptr++;
             }
         }
 
-      /* Advance to the beginning of the next line in the destination */
+      /* Advance to the beginning of the next line in the destination and
+       * in the glyph
+       */
 
       line += stride;
+      sptr += bmstride;
     }
 #endif
   return OK;
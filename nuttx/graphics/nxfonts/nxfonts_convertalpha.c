@@ -0,0 +1,144 @@
+/****************************************************************************
+ * graphics/nxfonts/nxfonts_convertalpha.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT}
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING}
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <debug.h>
+
+#include <nuttx/nx/nxglib.h>
+#include <nuttx/nx/nxfonts.h>
+
+#include "nxfonts_internal.h"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxf_convertalpha
+ *
+ * Description:
+ *   Convert a glyph to an 8-bit per pixel alpha map for use with
+ *   nx_blendbitmap():  Set bits of 1-bit glyphs become 255; the 4-bit
+ *   coverage values of anti-aliased glyphs are scaled to 0-255.  The
+ *   glyph is merged into the alpha map (keeping the larger alpha value) so
+ *   that a string of possibly overlapping glyphs may be converted into one
+ *   map.
+ *
+ * Input Parameters:
+ *   dest   - The destination alpha map provided by the caller.
+ *   height - The max height of the returned char in rows
+ *   width  - The max width of the returned char in pixels
+ *   stride - The width of the destination alpha map in bytes
+ *   bm     - Describes the character glyph to convert
+ *
+ * Returned Value:
+ *  OK on Success, ERROR: on failure with errno set appropriately.
+ *  (never fails)
+ *
+ ****************************************************************************/
+
+int nxf_convertalpha(FAR uint8_t *dest, uint16_t height, uint16_t width,
+                     uint16_t stride, FAR const struct nx_fontbitmap_s *bm)
+{
+  FAR uint8_t *line;
+  FAR const uint8_t *sptr;
+  unsigned int bmstride;
+  uint8_t alpha;
+  bool aa;
+  int row;
+  int col;
+
+  /* Get the starting position */
+
+  line = dest + bm->metric.yoffset * stride + bm->metric.xoffset;
+
+  /* Clip the glyph to the alpha map */
+
+  height   = ngl_min(bm->metric.height, height - bm->metric.yoffset);
+  width    = ngl_min(bm->metric.width, width - bm->metric.xoffset);
+
+  /* Convert each row of the glyph.  Coverage values 0-15 are scaled to
+   * alpha values 0-255 by multiplying by 17 (0x11).
+   */
+
+  sptr     = bm->bitmap;
+  bmstride = NXFONT_STRIDE(bm->metric);
+  aa       = bm->metric.aa;
+
+  for (row = 0; row < height; row++)
+    {
+      for (col = 0; col < width; col++)
+        {
+          alpha = nxf_coverage(sptr, col, aa) * 17;
+          if (alpha > line[col])
+            {
+              line[col] = alpha;
+            }
+        }
+
+      line += stride;
+      sptr += bmstride;
+    }
+
+  return OK;
+}
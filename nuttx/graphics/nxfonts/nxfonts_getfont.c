@@ -92,6 +92,12 @@ extern const struct nx_fontpackage_s g_sans28x37_package;
 extern const struct nx_fontpackage_s g_sans39x48_package;
 #endif
 
+/* SANS-ANTI-ALIASED */
+
+#ifdef CONFIG_NXFONT_SANS20X24AA
+extern const struct nx_fontpackage_s g_sans20x24aa_package;
+#endif
+
 /* SANS-BOLD */
 
 #ifdef CONFIG_NXFONT_SANS17X23B
@@ -177,6 +183,12 @@ static FAR const struct nx_fontpackage_s *g_fontpackages[] =
   &g_sans39x48_package,
 #endif
 
+/* SANS-ANTI-ALIASED */
+
+#ifdef CONFIG_NXFONT_SANS20X24AA
+  &g_sans20x24aa_package,
+#endif
+
 /* SANS-BOLD */
 
 #ifdef CONFIG_NXFONT_SANS17X23B
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxfonts/nxfonts_internal.h
  *
- *   Copyright (C) 2008-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -42,6 +42,9 @@
 
 #include <nuttx/config.h>
 
+#include <stdint.h>
+#include <stdbool.h>
+
 #include <nuttx/nx/nxfonts.h>
 
 /****************************************************************************
@@ -85,4 +88,27 @@ EXTERN struct nx_font_s g_fonts;
 }
 #endif
 
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxf_coverage
+ *
+ * Description:
+ *   Return the coverage of the pixel at column col of one row of a glyph
+ *   bitmap in the range 0-15.  Pixels of 1-bit glyphs are either 0 or 15.
+ *
+ ****************************************************************************/
+
+static inline uint8_t nxf_coverage(FAR const uint8_t *row, int col, bool aa)
+{
+  if (aa)
+    {
+      return (col & 1) ? (row[col >> 1] & 0x0f) : (row[col >> 1] >> 4);
+    }
+
+  return (row[col >> 3] & (0x80 >> (col & 7))) ? 15 : 0;
+}
+
 #endif /* __GRAPHICS_NXFONTS_NXFONTS_INTERNAL_H */
@@ -0,0 +1,854 @@
+/****************************************************************************
+ * graphics/nxfonts/nxfonts_sans20x24aa.h
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT}
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING}
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __GRAPHICS_NXFONTS_NXFONTS_SANS20X24AA_H
+#define __GRAPHICS_NXFONTS_NXFONTS_SANS20X24AA_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/* Font ID */
+
+#define NXFONT_ID         FONTID_SANS20X24AA
+
+/* This is an anti-aliased font:  Each glyph pixel is a 4-bit coverage value.
+ * The glyphs were generated with "bdf-converter -a" from the 39x48 sans
+ * serif font (nxfonts_sans39x48.h) used as a double resolution master.
+ */
+
+/* Ranges of 7-bit and 8-bit fonts */
+
+#define NXFONT_MIN7BIT    33
+#define NXFONT_MAX7BIT    126
+
+#define NXFONT_MIN8BIT    161
+#define NXFONT_MAX8BIT    255
+
+/* Maximum height and width of any glyph in the set */
+
+#define NXFONT_MAXHEIGHT  24
+#define NXFONT_MAXWIDTH   20
+
+/* The width of a space */
+
+#define NXFONT_SPACEWIDTH 5
+
+/* exclam (33) */
+#define NXFONT_METRICS_33 {0, 2, 13, 2, 6, 1}
+#define NXFONT_BITMAP_33 {0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb4, 0x40, 0x84, 0xf8, 0x84}
+
+/* quotedbl (34) */
+#define NXFONT_METRICS_34 {0, 4, 4, 1, 7, 1}
+#define NXFONT_BITMAP_34 {0xf8, 0x8f, 0xf8, 0x8f, 0xf8, 0x8f, 0x80, 0x8}
+
+/* numbersign (35) */
+#define NXFONT_METRICS_35 {0, 9, 12, 0, 7, 1}
+#define NXFONT_BITMAP_35 {0x0, 0x8, 0xf0, 0xf, 0x80, 0x0, 0x8, 0x80, 0xf, 0x0, 0x0, 0xf, 0x80, 0x8f, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf0, 0x8, 0xbf, 0x88, 0xfb, 0x80, 0x0, 0x8b, 0x0, 0xf4, 0x0, 0x0, 0xf8, 0x8, 0xf0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x4b, 0xf8, 0x8f, 0xb8, 0x40, 0x8, 0xb0, 0xf, 0x40, 0x0, 0xb, 0x80, 0x4f, 0x0, 0x0, 0x8, 0x40, 0x48, 0x0, 0x0}
+
+/* dollar (36) */
+#define NXFONT_METRICS_36 {0, 9, 16, 0, 5, 1}
+#define NXFONT_BITMAP_36 {0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0x48, 0xf8, 0x40, 0x0, 0x4, 0xfb, 0xfb, 0xf4, 0x0, 0xf, 0x80, 0xf0, 0x8f, 0x0, 0x8f, 0x0, 0xf0, 0x48, 0x0, 0x4f, 0x40, 0xf0, 0x0, 0x0, 0xb, 0xfb, 0xf4, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb4, 0x0, 0x0, 0x0, 0xf8, 0xff, 0x0, 0x0, 0x0, 0xf0, 0x4f, 0x80, 0x8f, 0x0, 0xf0, 0xf, 0x80, 0xf, 0x80, 0xf0, 0x8f, 0x0, 0x8, 0xfb, 0xfb, 0xf4, 0x0, 0x0, 0x48, 0xf8, 0x40, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0}
+
+/* percent (37) */
+#define NXFONT_METRICS_37 {0, 14, 13, 0, 6, 1}
+#define NXFONT_BITMAP_37 {0x0, 0x0, 0x0, 0x0, 0x4, 0x40, 0x0, 0x8, 0xff, 0xb0, 0x0, 0xf, 0x40, 0x0, 0x4f, 0x44, 0xb8, 0x0, 0x8b, 0x0, 0x0, 0x88, 0x0, 0x8f, 0x0, 0xf4, 0x0, 0x0, 0x8b, 0x0, 0x8b, 0x8, 0xb0, 0x0, 0x0, 0xf, 0xbb, 0xf4, 0xf, 0x40, 0x0, 0x0, 0x0, 0x88, 0x40, 0x8b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf4, 0xb, 0xff, 0x80, 0x0, 0x0, 0x8, 0xb0, 0x8b, 0x44, 0xf4, 0x0, 0x0, 0xf, 0x40, 0xf8, 0x0, 0x88, 0x0, 0x0, 0x8b, 0x0, 0xb8, 0x0, 0xb8, 0x0, 0x0, 0xf4, 0x0, 0x4f, 0x8b, 0xf0, 0x0, 0x4, 0x80, 0x0, 0x4, 0x88, 0x0}
+
+/* ampersand (38) */
+#define NXFONT_METRICS_38 {0, 9, 12, 1, 7, 1}
+#define NXFONT_BITMAP_38 {0x0, 0xbf, 0xf4, 0x0, 0x0, 0xb, 0xf4, 0x4f, 0x40, 0x0, 0xf, 0x80, 0xf, 0x80, 0x0, 0xb, 0xf4, 0xbf, 0x0, 0x0, 0x0, 0xbf, 0xf4, 0x0, 0x0, 0x8, 0xff, 0xb0, 0x0, 0x0, 0x8f, 0x44, 0xf4, 0x8f, 0x0, 0xf8, 0x0, 0xbf, 0xb8, 0x0, 0xf8, 0x0, 0xb, 0xf0, 0x0, 0xbf, 0x40, 0x4f, 0xfb, 0x0, 0x4f, 0xff, 0xfb, 0x4f, 0xb0, 0x0, 0x88, 0x0, 0x0, 0x0}
+
+/* quotesingle (39) */
+#define NXFONT_METRICS_39 {0, 2, 4, 1, 7, 1}
+#define NXFONT_BITMAP_39 {0xf8, 0xf8, 0xf8, 0xb4}
+
+/* parenleft (40) */
+#define NXFONT_METRICS_40 {0, 4, 16, 1, 6, 1}
+#define NXFONT_BITMAP_40 {0x0, 0x44, 0x0, 0xf0, 0x8, 0x80, 0xf, 0x40, 0x8f, 0x0, 0x8b, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xb8, 0x0, 0x8f, 0x0, 0x4f, 0x0, 0xb, 0x80, 0x4, 0xb0, 0x0, 0xb4}
+
+/* parenright (41) */
+#define NXFONT_METRICS_41 {0, 4, 16, 0, 6, 1}
+#define NXFONT_BITMAP_41 {0x44, 0x0, 0xf, 0x0, 0x8, 0x80, 0x4, 0xf0, 0x0, 0xf8, 0x0, 0xb8, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x88, 0x0, 0xf8, 0x0, 0xf0, 0x8, 0xb0, 0xf, 0x40, 0x4b, 0x0}
+
+/* asterisk (42) */
+#define NXFONT_METRICS_42 {0, 6, 6, 0, 5, 1}
+#define NXFONT_BITMAP_42 {0x0, 0x44, 0x0, 0x4, 0x88, 0x40, 0x4f, 0xbb, 0xf4, 0x4, 0xff, 0x40, 0xb, 0xbb, 0xb0, 0x4b, 0x0, 0xb4}
+
+/* plus (43) */
+#define NXFONT_METRICS_43 {0, 9, 8, 0, 10, 1}
+#define NXFONT_BITMAP_43 {0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x48, 0x88, 0xfb, 0x88, 0x80, 0x8f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0}
+
+/* comma (44) */
+#define NXFONT_METRICS_44 {0, 2, 5, 1, 16, 1}
+#define NXFONT_BITMAP_44 {0x48, 0x8f, 0x4b, 0xf, 0x84}
+
+/* hyphen (45) */
+#define NXFONT_METRICS_45 {0, 5, 2, 0, 13, 1}
+#define NXFONT_BITMAP_45 {0x48, 0x88, 0x40, 0x48, 0x88, 0x40}
+
+/* period (46) */
+#define NXFONT_METRICS_46 {0, 2, 3, 1, 16, 1}
+#define NXFONT_BITMAP_46 {0x48, 0x8f, 0x48}
+
+/* slash (47) */
+#define NXFONT_METRICS_47 {0, 5, 13, 0, 6, 1}
+#define NXFONT_BITMAP_47 {0x0, 0x4, 0x40, 0x0, 0x8, 0x80, 0x0, 0xf, 0x0, 0x0, 0x4b, 0x0, 0x0, 0x88, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xb0, 0x0, 0x8, 0x80, 0x0, 0xb, 0x40, 0x0, 0xf, 0x0, 0x0, 0x88, 0x0, 0x0, 0xb4, 0x0, 0x0, 0x80, 0x0, 0x0}
+
+/* zero (48) */
+#define NXFONT_METRICS_48 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_48 {0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0xff, 0xb0, 0xb, 0xf4, 0xb, 0xf4, 0xf, 0x80, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0xf, 0x80, 0x0, 0xf8, 0xb, 0xb4, 0xb, 0xf4, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x8, 0x84, 0x0}
+
+/* one (49) */
+#define NXFONT_METRICS_49 {0, 5, 13, 1, 6, 1}
+#define NXFONT_BITMAP_49 {0x0, 0x4, 0x40, 0x0, 0xf, 0x80, 0x4, 0xbf, 0x80, 0x8f, 0xff, 0x80, 0x0, 0xf, 0x80, 0x0, 0xf, 0x80, 0x0, 0xf, 0x80, 0x0, 0xf, 0x80, 0x0, 0xf, 0x80, 0x0, 0xf, 0x80, 0x0, 0xf, 0x80, 0x0, 0xf, 0x80, 0x0, 0x8, 0x40}
+
+/* two (50) */
+#define NXFONT_METRICS_50 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_50 {0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0xff, 0xb0, 0xf, 0xb0, 0x4, 0xf8, 0x8f, 0x40, 0x0, 0x8f, 0x48, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0xb, 0xfb, 0x0, 0x4, 0xfb, 0x40, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x48, 0x88, 0x88, 0x88}
+
+/* three (51) */
+#define NXFONT_METRICS_51 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_51 {0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0xff, 0xb0, 0xb, 0xb0, 0x4, 0xf4, 0xf, 0x80, 0x0, 0xf8, 0x8, 0x40, 0x0, 0xf8, 0x0, 0x4, 0x8b, 0xf0, 0x0, 0x8, 0xff, 0xb0, 0x0, 0x0, 0x4, 0xfb, 0x48, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0xf, 0xb0, 0x4, 0xf8, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x8, 0x84, 0x0}
+
+/* four (52) */
+#define NXFONT_METRICS_52 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_52 {0x0, 0x0, 0x4, 0x40, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0xbf, 0x80, 0x0, 0xb, 0xbf, 0x80, 0x0, 0x4f, 0x4f, 0x80, 0x0, 0xf8, 0xf, 0x80, 0xb, 0xb0, 0xf, 0x80, 0x4f, 0x40, 0xf, 0x80, 0xfb, 0x88, 0x8f, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x8, 0x40}
+
+/* five (53) */
+#define NXFONT_METRICS_53 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_53 {0x4, 0x88, 0x88, 0x84, 0x8, 0xff, 0xff, 0xf8, 0x8, 0xf0, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x0, 0xf, 0x88, 0x84, 0x0, 0xf, 0xff, 0xff, 0xb0, 0xf, 0xb0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0xbf, 0x4f, 0xb0, 0x8, 0xf8, 0xb, 0xff, 0xff, 0xb0, 0x0, 0x48, 0x80, 0x0}
+
+/* six (54) */
+#define NXFONT_METRICS_54 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_54 {0x0, 0x4, 0x84, 0x0, 0x0, 0xbf, 0xff, 0xb0, 0x8, 0xf4, 0x4, 0xf4, 0xf, 0x80, 0x0, 0x84, 0xf, 0x40, 0x0, 0x0, 0x8f, 0x4b, 0xfb, 0x40, 0x8f, 0xf8, 0x8b, 0xf4, 0x8f, 0x80, 0x0, 0xbb, 0x8f, 0x0, 0x0, 0x8f, 0xf, 0x40, 0x0, 0x8f, 0xb, 0xb0, 0x4, 0xf8, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x8, 0x84, 0x0}
+
+/* seven (55) */
+#define NXFONT_METRICS_55 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_55 {0x48, 0x88, 0x88, 0x88, 0x8f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xbb, 0x0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x84, 0x0, 0x0}
+
+/* eight (56) */
+#define NXFONT_METRICS_56 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_56 {0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0xff, 0xb0, 0xb, 0xb0, 0x4, 0xf8, 0xf, 0x80, 0x0, 0xf8, 0xf, 0xb0, 0x4, 0xf8, 0x4, 0xfb, 0x8f, 0xb0, 0x4, 0xbf, 0xff, 0x80, 0xf, 0xb0, 0x4, 0xf8, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0x4f, 0xb0, 0x4, 0xf8, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x8, 0x84, 0x0}
+
+/* nine (57) */
+#define NXFONT_METRICS_57 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_57 {0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0xff, 0xb0, 0xf, 0xb0, 0xb, 0xf8, 0x8f, 0x40, 0x0, 0xfb, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0xbf, 0x4f, 0x40, 0x4, 0xff, 0xb, 0xff, 0xff, 0xbf, 0x0, 0x48, 0x84, 0x8f, 0x48, 0x0, 0x0, 0xf8, 0x4f, 0xb0, 0xb, 0xf4, 0x8, 0xff, 0xff, 0x40, 0x0, 0x48, 0x80, 0x0}
+
+/* colon (58) */
+#define NXFONT_METRICS_58 {0, 2, 10, 2, 9, 1}
+#define NXFONT_BITMAP_58 {0x84, 0xf8, 0x84, 0x0, 0x0, 0x0, 0x0, 0x84, 0xf8, 0x84}
+
+/* semicolon (59) */
+#define NXFONT_METRICS_59 {0, 2, 11, 2, 10, 1}
+#define NXFONT_BITMAP_59 {0xf8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x84, 0xf8, 0x88, 0x88, 0xb0}
+
+/* less (60) */
+#define NXFONT_METRICS_60 {0, 8, 9, 1, 10, 1}
+#define NXFONT_BITMAP_60 {0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x8, 0xff, 0x0, 0x4b, 0xfb, 0x80, 0x8b, 0xfb, 0x40, 0x0, 0xff, 0x0, 0x0, 0x0, 0x8b, 0xfb, 0x40, 0x0, 0x0, 0x4b, 0xfb, 0x80, 0x0, 0x0, 0x48, 0xff, 0x0, 0x0, 0x0, 0x8}
+
+/* equal (61) */
+#define NXFONT_METRICS_61 {0, 8, 5, 1, 12, 1}
+#define NXFONT_BITMAP_61 {0xff, 0xff, 0xff, 0xf8, 0x88, 0x88, 0x88, 0x84, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf8, 0x88, 0x88, 0x88, 0x84}
+
+/* greater (62) */
+#define NXFONT_METRICS_62 {0, 9, 9, 0, 10, 1}
+#define NXFONT_BITMAP_62 {0x44, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xb8, 0x0, 0x0, 0x0, 0x4, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x40, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x8f, 0xf8, 0x40, 0x4, 0x8f, 0xf8, 0x0, 0x0, 0x8f, 0xb8, 0x0, 0x0, 0x0, 0x44, 0x0, 0x0, 0x0, 0x0}
+
+/* question (63) */
+#define NXFONT_METRICS_63 {0, 7, 13, 1, 6, 1}
+#define NXFONT_BITMAP_63 {0x4, 0xbf, 0xf8, 0x0, 0x4f, 0xb8, 0x8f, 0x80, 0xbf, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x4, 0xf8, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x8, 0x40, 0x0, 0x0, 0x8, 0x40, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x8, 0x40, 0x0}
+
+/* at (64) */
+#define NXFONT_METRICS_64 {0, 15, 15, 0, 6, 1}
+#define NXFONT_BITMAP_64 {0x0, 0x0, 0x4, 0x8f, 0xfb, 0x80, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xb8, 0x8b, 0xff, 0x80, 0x0, 0x0, 0x4f, 0xb4, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x8, 0xf0, 0x0, 0xbf, 0xf4, 0xb8, 0xb, 0xb0, 0xf, 0x80, 0xb, 0xb4, 0x4f, 0xf8, 0x8, 0xf0, 0x4f, 0x0, 0x8f, 0x0, 0x8, 0xf0, 0x0, 0xf0, 0x8f, 0x0, 0xfb, 0x0, 0xb, 0xb0, 0x4, 0xf0, 0x8f, 0x0, 0xf8, 0x0, 0xf, 0x80, 0xb, 0xb0, 0x8f, 0x0, 0xfb, 0x0, 0x8f, 0x0, 0x4f, 0x40, 0xf, 0x80, 0x8f, 0xbb, 0xbf, 0xbb, 0xf4, 0x0, 0xb, 0xf4, 0x4, 0x88, 0x8, 0x88, 0x40, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xf8, 0x0, 0x8, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x80, 0x0, 0x0}
+
+/* A (65) */
+#define NXFONT_METRICS_65 {0, 11, 13, 0, 6, 1}
+#define NXFONT_BITMAP_65 {0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xb0, 0xbf, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x8f, 0x40, 0x0, 0x0, 0x8f, 0x40, 0x4f, 0x80, 0x0, 0x0, 0xff, 0x88, 0x8f, 0xf0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x8, 0xf4, 0x0, 0x4, 0xf8, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xff, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x8f, 0x40, 0x48, 0x40, 0x0, 0x0, 0x48, 0x40}
+
+/* B (66) */
+#define NXFONT_METRICS_66 {0, 9, 13, 1, 6, 1}
+#define NXFONT_BITMAP_66 {0x8f, 0xff, 0xff, 0xb4, 0x0, 0x8f, 0x88, 0x8b, 0xff, 0x0, 0x8f, 0x0, 0x0, 0x8f, 0x80, 0x8f, 0x0, 0x0, 0xf, 0x80, 0x8f, 0x0, 0x0, 0x8f, 0x40, 0x8f, 0x88, 0x8b, 0xfb, 0x0, 0x8f, 0xff, 0xff, 0xfb, 0x0, 0x8f, 0x0, 0x0, 0x8f, 0xb0, 0x8f, 0x0, 0x0, 0x8, 0xf0, 0x8f, 0x0, 0x0, 0x8, 0xf0, 0x8f, 0x0, 0x0, 0x4f, 0xb0, 0x8f, 0xff, 0xff, 0xff, 0x0, 0x48, 0x88, 0x88, 0x80, 0x0}
+
+/* C (67) */
+#define NXFONT_METRICS_67 {0, 10, 13, 1, 6, 1}
+#define NXFONT_BITMAP_67 {0x0, 0x4b, 0xff, 0xf8, 0x0, 0x4, 0xff, 0x88, 0xbf, 0xb0, 0xf, 0xb0, 0x0, 0x4, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x40, 0x0, 0x0, 0xfb, 0xf, 0xf8, 0x0, 0x4b, 0xf4, 0x4, 0xbf, 0xff, 0xfb, 0x40, 0x0, 0x4, 0x88, 0x40, 0x0}
+
+/* D (68) */
+#define NXFONT_METRICS_68 {0, 10, 13, 1, 6, 1}
+#define NXFONT_BITMAP_68 {0x8f, 0xff, 0xff, 0xb4, 0x0, 0x8f, 0x88, 0x88, 0xff, 0x40, 0x8f, 0x0, 0x0, 0x4f, 0xb0, 0x8f, 0x0, 0x0, 0x8, 0xf0, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x8, 0xf4, 0x8f, 0x0, 0x0, 0xb, 0xf0, 0x8f, 0x0, 0x0, 0xbf, 0x40, 0x8f, 0xff, 0xff, 0xfb, 0x0, 0x48, 0x88, 0x88, 0x40, 0x0}
+
+/* E (69) */
+#define NXFONT_METRICS_69 {0, 9, 13, 1, 6, 1}
+#define NXFONT_BITMAP_69 {0x8f, 0xff, 0xff, 0xff, 0x80, 0x8f, 0x88, 0x88, 0x88, 0x40, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x88, 0x88, 0x88, 0x40, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0, 0x48, 0x88, 0x88, 0x88, 0x80}
+
+/* F (70) */
+#define NXFONT_METRICS_70 {0, 9, 13, 1, 6, 1}
+#define NXFONT_BITMAP_70 {0x8f, 0xff, 0xff, 0xff, 0x80, 0x8f, 0x88, 0x88, 0x88, 0x40, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x88, 0x88, 0x84, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0x0}
+
+/* G (71) */
+#define NXFONT_METRICS_71 {0, 12, 13, 0, 6, 1}
+#define NXFONT_BITMAP_71 {0x0, 0x4, 0xbf, 0xff, 0x80, 0x0, 0x0, 0xbf, 0xf8, 0x8b, 0xfb, 0x40, 0x8, 0xfb, 0x0, 0x0, 0x4f, 0xb0, 0xf, 0xb0, 0x0, 0x0, 0x8, 0xf0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x8f, 0xff, 0xf8, 0x8f, 0x0, 0x0, 0x48, 0x88, 0xf8, 0x4f, 0x80, 0x0, 0x0, 0x0, 0xf8, 0xb, 0xf0, 0x0, 0x0, 0x8, 0xf8, 0x4, 0xfb, 0x40, 0x0, 0xbf, 0xf8, 0x0, 0x4f, 0xff, 0xff, 0xb4, 0xf8, 0x0, 0x0, 0x88, 0x84, 0x0, 0x84}
+
+/* H (72) */
+#define NXFONT_METRICS_72 {0, 10, 13, 1, 6, 1}
+#define NXFONT_BITMAP_72 {0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x88, 0x88, 0x88, 0xf8, 0x8f, 0xff, 0xff, 0xff, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x48, 0x0, 0x0, 0x0, 0x84}
+
+/* I (73) */
+#define NXFONT_METRICS_73 {0, 2, 13, 1, 6, 1}
+#define NXFONT_BITMAP_73 {0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x48}
+
+/* J (74) */
+#define NXFONT_METRICS_74 {0, 7, 13, 0, 6, 1}
+#define NXFONT_BITMAP_74 {0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x8, 0xf0, 0x8f, 0x0, 0x8, 0xf0, 0x8f, 0x0, 0x8, 0xf0, 0x4f, 0xb0, 0x4f, 0xb0, 0xb, 0xff, 0xff, 0x40, 0x0, 0x88, 0x80, 0x0}
+
+/* K (75) */
+#define NXFONT_METRICS_75 {0, 11, 13, 1, 6, 1}
+#define NXFONT_BITMAP_75 {0x8f, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x8f, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x8f, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x8f, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x8f, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xbf, 0xf4, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0xfb, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x4f, 0x80, 0x0, 0x0, 0x8f, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x8f, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x8f, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x48, 0x0, 0x0, 0x0, 0x88, 0x40}
+
+/* L (76) */
+#define NXFONT_METRICS_76 {0, 8, 13, 1, 6, 1}
+#define NXFONT_BITMAP_76 {0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x48, 0x88, 0x88, 0x84}
+
+/* M (77) */
+#define NXFONT_METRICS_77 {0, 11, 13, 1, 6, 1}
+#define NXFONT_BITMAP_77 {0x8f, 0x80, 0x0, 0x0, 0xf, 0xf0, 0x8f, 0xf0, 0x0, 0x0, 0x8f, 0xf0, 0x8f, 0xf8, 0x0, 0x0, 0xff, 0xf0, 0x8f, 0xb8, 0x0, 0x0, 0xfb, 0xf0, 0x8f, 0x8f, 0x0, 0x8, 0xf8, 0xf0, 0x8f, 0xf, 0x40, 0xb, 0x88, 0xf0, 0x8f, 0xb, 0x80, 0xf, 0x48, 0xf0, 0x8f, 0x8, 0xf0, 0x8f, 0x8, 0xf0, 0x8f, 0x4, 0xf0, 0x8b, 0x8, 0xf0, 0x8f, 0x0, 0xf8, 0xf8, 0x8, 0xf0, 0x8f, 0x0, 0x8b, 0xf0, 0x8, 0xf0, 0x8f, 0x0, 0x4f, 0xb0, 0x8, 0xf0, 0x48, 0x0, 0x8, 0x40, 0x4, 0x80}
+
+/* N (78) */
+#define NXFONT_METRICS_78 {0, 10, 13, 1, 6, 1}
+#define NXFONT_BITMAP_78 {0xff, 0x0, 0x0, 0x0, 0xf8, 0xff, 0xb0, 0x0, 0x0, 0xf8, 0xff, 0xf4, 0x0, 0x0, 0xf8, 0xf8, 0xbf, 0x0, 0x0, 0xf8, 0xf8, 0x4f, 0xb0, 0x0, 0xf8, 0xf8, 0xb, 0xf4, 0x0, 0xf8, 0xf8, 0x0, 0xfb, 0x0, 0xf8, 0xf8, 0x0, 0x4f, 0x80, 0xf8, 0xf8, 0x0, 0xb, 0xf0, 0xf8, 0xf8, 0x0, 0x4, 0xfb, 0xf8, 0xf8, 0x0, 0x0, 0x8f, 0xf8, 0xf8, 0x0, 0x0, 0xb, 0xf8, 0x84, 0x0, 0x0, 0x4, 0x84}
+
+/* O (79) */
+#define NXFONT_METRICS_79 {0, 12, 13, 0, 6, 1}
+#define NXFONT_BITMAP_79 {0x0, 0x4, 0xbf, 0xff, 0x80, 0x0, 0x0, 0xbf, 0xb8, 0x48, 0xff, 0x40, 0x8, 0xfb, 0x0, 0x0, 0x4f, 0xf0, 0xf, 0xb0, 0x0, 0x0, 0x4, 0xf8, 0x8f, 0x40, 0x0, 0x0, 0x0, 0xbf, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x80, 0x0, 0x0, 0x0, 0xff, 0xb, 0xf4, 0x0, 0x0, 0xb, 0xf4, 0x4, 0xff, 0x40, 0x0, 0xbf, 0xb0, 0x0, 0x4b, 0xff, 0xbf, 0xf8, 0x0, 0x0, 0x0, 0x48, 0x88, 0x0, 0x0}
+
+/* P (80) */
+#define NXFONT_METRICS_80 {0, 9, 13, 1, 6, 1}
+#define NXFONT_BITMAP_80 {0x8f, 0xff, 0xff, 0xf8, 0x0, 0x8f, 0x88, 0x88, 0xbf, 0x80, 0x8f, 0x0, 0x0, 0xb, 0xf0, 0x8f, 0x0, 0x0, 0x8, 0xf0, 0x8f, 0x0, 0x0, 0x8, 0xf0, 0x8f, 0x0, 0x0, 0x4f, 0xb0, 0x8f, 0xff, 0xff, 0xff, 0x40, 0x8f, 0x88, 0x88, 0x80, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0x0}
+
+/* Q (81) */
+#define NXFONT_METRICS_81 {0, 12, 13, 0, 6, 1}
+#define NXFONT_BITMAP_81 {0x0, 0x4, 0xbf, 0xff, 0x80, 0x0, 0x0, 0xbf, 0xb8, 0x48, 0xff, 0x40, 0x8, 0xfb, 0x0, 0x0, 0x4f, 0xf0, 0xf, 0xb0, 0x0, 0x0, 0x4, 0xf8, 0x8f, 0x40, 0x0, 0x0, 0x0, 0xbf, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x80, 0x0, 0x4, 0x0, 0xff, 0xb, 0xf4, 0x0, 0xf, 0xb8, 0xf4, 0x4, 0xff, 0x40, 0x4, 0xff, 0xb0, 0x0, 0x4b, 0xff, 0xbf, 0xfb, 0xf4, 0x0, 0x0, 0x48, 0x88, 0x0, 0xbb}
+
+/* R (82) */
+#define NXFONT_METRICS_82 {0, 10, 13, 1, 6, 1}
+#define NXFONT_BITMAP_82 {0x8f, 0xff, 0xff, 0xfb, 0x40, 0x8f, 0x88, 0x88, 0x8f, 0xf0, 0x8f, 0x0, 0x0, 0x4, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x4, 0xf8, 0x8f, 0x0, 0x0, 0x4b, 0xf0, 0x8f, 0xff, 0xff, 0xff, 0x40, 0x8f, 0x88, 0x88, 0xbf, 0xb0, 0x8f, 0x0, 0x0, 0xb, 0xf0, 0x8f, 0x0, 0x0, 0x8, 0xf8, 0x8f, 0x0, 0x0, 0x4, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x48, 0x0, 0x0, 0x0, 0x88}
+
+/* S (83) */
+#define NXFONT_METRICS_83 {0, 10, 13, 0, 6, 1}
+#define NXFONT_BITMAP_83 {0x0, 0x4b, 0xff, 0xf8, 0x0, 0x4, 0xfb, 0x88, 0xbf, 0xb0, 0xb, 0xb0, 0x0, 0x4, 0xf8, 0xf, 0x80, 0x0, 0x0, 0x84, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfb, 0x80, 0x0, 0x0, 0x8, 0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x48, 0xfb, 0x48, 0x0, 0x0, 0x0, 0x8f, 0x4f, 0x80, 0x0, 0x0, 0xbf, 0xb, 0xf8, 0x0, 0x8, 0xf8, 0x4, 0xbf, 0xff, 0xff, 0x80, 0x0, 0x4, 0x88, 0x80, 0x0}
+
+/* T (84) */
+#define NXFONT_METRICS_84 {0, 10, 13, 0, 6, 1}
+#define NXFONT_BITMAP_84 {0xff, 0xff, 0xff, 0xff, 0xf8, 0x88, 0x88, 0xfb, 0x88, 0x84, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x84, 0x0, 0x0}
+
+/* U (85) */
+#define NXFONT_METRICS_85 {0, 10, 13, 1, 6, 1}
+#define NXFONT_BITMAP_85 {0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x40, 0x0, 0x4, 0xf8, 0xf, 0xf4, 0x0, 0x4f, 0xf0, 0x4, 0xff, 0xff, 0xff, 0x40, 0x0, 0x4, 0x88, 0x40, 0x0}
+
+/* V (86) */
+#define NXFONT_METRICS_86 {0, 10, 13, 0, 6, 1}
+#define NXFONT_BITMAP_86 {0x8f, 0x80, 0x0, 0x0, 0xff, 0x4f, 0x80, 0x0, 0x0, 0xfb, 0xf, 0xf0, 0x0, 0x8, 0xf8, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x4, 0xf8, 0x0, 0xf, 0xb0, 0x0, 0xfb, 0x0, 0x4f, 0x80, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x0, 0x4f, 0x80, 0xbb, 0x0, 0x0, 0xf, 0xb0, 0xf8, 0x0, 0x0, 0x8, 0xf8, 0xf0, 0x0, 0x0, 0x4, 0xfb, 0xb0, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0}
+
+/* W (87) */
+#define NXFONT_METRICS_87 {0, 15, 13, 0, 6, 1}
+#define NXFONT_BITMAP_87 {0x8f, 0x80, 0x0, 0xf, 0x80, 0x0, 0xf, 0xf0, 0x4f, 0x80, 0x0, 0x8f, 0xf0, 0x0, 0xf, 0xb0, 0xf, 0xb0, 0x0, 0xbb, 0xf4, 0x0, 0x4f, 0x80, 0xb, 0xf0, 0x0, 0xf8, 0xf8, 0x0, 0x8f, 0x40, 0x8, 0xf0, 0x4, 0xf4, 0xbb, 0x0, 0x8f, 0x0, 0x4, 0xf8, 0x8, 0xf0, 0x8f, 0x0, 0xfb, 0x0, 0x0, 0xf8, 0xb, 0x80, 0x4f, 0x40, 0xf8, 0x0, 0x0, 0xbb, 0xf, 0x80, 0xf, 0x84, 0xf4, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x8, 0xf8, 0xf0, 0x0, 0x0, 0x4f, 0xbf, 0x0, 0x8, 0xfb, 0xf0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x48, 0x0, 0x0}
+
+/* X (88) */
+#define NXFONT_METRICS_88 {0, 11, 13, 0, 6, 1}
+#define NXFONT_BITMAP_88 {0x4f, 0xf0, 0x0, 0x0, 0xbf, 0x40, 0x4, 0xf8, 0x0, 0x8, 0xf8, 0x0, 0x0, 0xbf, 0x40, 0xf, 0xb0, 0x0, 0x0, 0x4f, 0xb0, 0xbf, 0x40, 0x0, 0x0, 0x8, 0xf8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0xf4, 0x0, 0x0, 0x0, 0xf, 0xb0, 0xbf, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x4f, 0xb0, 0x0, 0x4, 0xfb, 0x0, 0xb, 0xf4, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xff, 0x0, 0x48, 0x40, 0x0, 0x0, 0x48, 0x40}
+
+/* Y (89) */
+#define NXFONT_METRICS_89 {0, 11, 13, 0, 6, 1}
+#define NXFONT_BITMAP_89 {0xbf, 0x40, 0x0, 0x0, 0xbf, 0x40, 0x4f, 0xb0, 0x0, 0x4, 0xf8, 0x0, 0x8, 0xf4, 0x0, 0xb, 0xf0, 0x0, 0x0, 0xfb, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x4f, 0x80, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xf8, 0xf4, 0x0, 0x0, 0x0, 0x4, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0}
+
+/* Z (90) */
+#define NXFONT_METRICS_90 {0, 10, 13, 0, 6, 1}
+#define NXFONT_BITMAP_90 {0xf, 0xff, 0xff, 0xff, 0xf8, 0x8, 0x88, 0x88, 0x8f, 0xf4, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf8, 0x48, 0x88, 0x88, 0x88, 0x84}
+
+/* bracketleft (91) */
+#define NXFONT_METRICS_91 {0, 3, 16, 1, 6, 1}
+#define NXFONT_BITMAP_91 {0xff, 0xf0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xff, 0xf0}
+
+/* backslash (92) */
+#define NXFONT_METRICS_92 {0, 5, 13, 0, 6, 1}
+#define NXFONT_BITMAP_92 {0x80, 0x0, 0x0, 0xb4, 0x0, 0x0, 0x88, 0x0, 0x0, 0xf, 0x0, 0x0, 0xb, 0x0, 0x0, 0x8, 0x80, 0x0, 0x4, 0xb0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x88, 0x0, 0x0, 0x48, 0x0, 0x0, 0xf, 0x0, 0x0, 0xb, 0x40, 0x0, 0x4, 0x40}
+
+/* bracketright (93) */
+#define NXFONT_METRICS_93 {0, 4, 16, 0, 6, 1}
+#define NXFONT_BITMAP_93 {0x8f, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x8f, 0xf8}
+
+/* asciicircum (94) */
+#define NXFONT_METRICS_94 {0, 7, 7, 0, 6, 1}
+#define NXFONT_BITMAP_94 {0x0, 0x8, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0xf8, 0xf0, 0x0, 0x4, 0xf0, 0xf4, 0x0, 0xb, 0x80, 0x8b, 0x0, 0xf, 0x0, 0xf, 0x0, 0x8b, 0x0, 0xb, 0x80}
+
+/* underscore (95) */
+#define NXFONT_METRICS_95 {0, 9, 2, 0, 20, 1}
+#define NXFONT_BITMAP_95 {0x88, 0x88, 0x88, 0x88, 0x80, 0x88, 0x88, 0x88, 0x88, 0x80}
+
+/* grave (96) */
+#define NXFONT_METRICS_96 {0, 4, 3, 0, 6, 1}
+#define NXFONT_BITMAP_96 {0x8f, 0x40, 0xb, 0xb0, 0x0, 0x84}
+
+/* a (97) */
+#define NXFONT_METRICS_97 {0, 9, 10, 0, 9, 1}
+#define NXFONT_BITMAP_97 {0x0, 0x48, 0x88, 0x0, 0x0, 0x8, 0xfb, 0x8f, 0xf0, 0x0, 0xf, 0x80, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x88, 0xff, 0xf8, 0x0, 0xf, 0xf8, 0x0, 0xf8, 0x0, 0x8f, 0x40, 0x0, 0xf8, 0x0, 0x8f, 0x0, 0xb, 0xf8, 0x0, 0xf, 0xf8, 0xfb, 0xff, 0x40, 0x4, 0x88, 0x80, 0x48, 0x40}
+
+/* b (98) */
+#define NXFONT_METRICS_98 {0, 8, 13, 1, 6, 1}
+#define NXFONT_BITMAP_98 {0xf8, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0xf8, 0x8, 0x84, 0x0, 0xfb, 0xff, 0xff, 0x40, 0xff, 0x40, 0xb, 0xf0, 0xfb, 0x0, 0x4, 0xf8, 0xf8, 0x0, 0x0, 0xf8, 0xf8, 0x0, 0x0, 0xf8, 0xfb, 0x0, 0x4, 0xf8, 0xff, 0x80, 0xb, 0xf0, 0xfb, 0xff, 0xff, 0x40, 0x84, 0x48, 0x84, 0x0}
+
+/* c (99) */
+#define NXFONT_METRICS_99 {0, 8, 10, 0, 9, 1}
+#define NXFONT_BITMAP_99 {0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0xff, 0xb0, 0xb, 0xb0, 0x4, 0xf8, 0x4f, 0x40, 0x0, 0x84, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0xf8, 0xf, 0xb0, 0x4, 0xf4, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x8, 0x84, 0x0}
+
+/* d (100) */
+#define NXFONT_METRICS_100 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_100 {0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x8, 0x84, 0x8f, 0x4, 0xff, 0xff, 0xbf, 0xf, 0xb4, 0x4, 0xff, 0x8f, 0x40, 0x0, 0xbf, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x40, 0x0, 0xbf, 0x4f, 0xb0, 0x4, 0xff, 0xb, 0xff, 0xff, 0xbf, 0x0, 0x48, 0x84, 0x48}
+
+/* e (101) */
+#define NXFONT_METRICS_101 {0, 8, 10, 1, 9, 1}
+#define NXFONT_BITMAP_101 {0x0, 0x48, 0x80, 0x0, 0xb, 0xff, 0xff, 0x40, 0x8f, 0x40, 0xb, 0xf0, 0xfb, 0x0, 0x0, 0xf8, 0xfb, 0x88, 0x88, 0xf8, 0xfb, 0x88, 0x88, 0x84, 0xfb, 0x0, 0x0, 0x84, 0x8f, 0x40, 0xb, 0xf4, 0xb, 0xff, 0xff, 0x40, 0x0, 0x48, 0x80, 0x0}
+
+/* f (102) */
+#define NXFONT_METRICS_102 {0, 5, 13, 0, 6, 1}
+#define NXFONT_BITMAP_102 {0x0, 0xbf, 0x80, 0x8, 0xf4, 0x0, 0x8, 0xf0, 0x0, 0x4b, 0xf8, 0x40, 0x8f, 0xff, 0x80, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x4, 0x80, 0x0}
+
+/* g (103) */
+#define NXFONT_METRICS_103 {0, 8, 13, 0, 9, 1}
+#define NXFONT_BITMAP_103 {0x0, 0x8, 0x84, 0x48, 0x4, 0xff, 0xff, 0xbf, 0xf, 0xb4, 0x4, 0xff, 0x8f, 0x40, 0x0, 0xbf, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x40, 0x0, 0xbf, 0xf, 0xb0, 0x8, 0xff, 0x4, 0xff, 0xff, 0xbf, 0x0, 0x8, 0x80, 0x8f, 0x8f, 0x0, 0x0, 0xbb, 0x4f, 0xb4, 0x8, 0xf4, 0x4, 0xff, 0xff, 0x80}
+
+/* h (104) */
+#define NXFONT_METRICS_104 {0, 7, 13, 1, 6, 1}
+#define NXFONT_BITMAP_104 {0xf8, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0xf8, 0x8, 0x84, 0x0, 0xfb, 0xff, 0xff, 0x40, 0xff, 0x40, 0xb, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0x84, 0x0, 0x4, 0x80}
+
+/* i (105) */
+#define NXFONT_METRICS_105 {0, 2, 13, 1, 6, 1}
+#define NXFONT_BITMAP_105 {0xf8, 0xf8, 0x0, 0x84, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x84}
+
+/* j (106) */
+#define NXFONT_METRICS_106 {0, 3, 16, 0, 6, 1}
+#define NXFONT_BITMAP_106 {0x8, 0xf0, 0x8, 0xf0, 0x0, 0x0, 0x4, 0x80, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0xb, 0xf0, 0xff, 0xb0}
+
+/* k (107) */
+#define NXFONT_METRICS_107 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_107 {0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x8, 0x80, 0x8f, 0x0, 0xbf, 0x40, 0x8f, 0xb, 0xf4, 0x0, 0x8f, 0xbf, 0x80, 0x0, 0x8f, 0xfb, 0xb0, 0x0, 0x8f, 0x44, 0xf8, 0x0, 0x8f, 0x0, 0xbf, 0x0, 0x8f, 0x0, 0x4f, 0xb0, 0x8f, 0x0, 0x8, 0xf4, 0x48, 0x0, 0x0, 0x88}
+
+/* l (108) */
+#define NXFONT_METRICS_108 {0, 2, 13, 1, 6, 1}
+#define NXFONT_BITMAP_108 {0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x84}
+
+/* m (109) */
+#define NXFONT_METRICS_109 {0, 12, 10, 1, 9, 1}
+#define NXFONT_BITMAP_109 {0x84, 0x8, 0x80, 0x0, 0x88, 0x0, 0xfb, 0xff, 0xff, 0x4f, 0xff, 0xf0, 0xff, 0x40, 0x4f, 0xf4, 0x4, 0xf8, 0xf8, 0x0, 0xf, 0x80, 0x0, 0xf8, 0xf8, 0x0, 0xf, 0x80, 0x0, 0xf8, 0xf8, 0x0, 0xf, 0x80, 0x0, 0xf8, 0xf8, 0x0, 0xf, 0x80, 0x0, 0xf8, 0xf8, 0x0, 0xf, 0x80, 0x0, 0xf8, 0xf8, 0x0, 0xf, 0x80, 0x0, 0xf8, 0x84, 0x0, 0x8, 0x40, 0x0, 0x84}
+
+/* n (110) */
+#define NXFONT_METRICS_110 {0, 7, 10, 1, 9, 1}
+#define NXFONT_BITMAP_110 {0x84, 0x8, 0x84, 0x0, 0xfb, 0xff, 0xff, 0x80, 0xff, 0x40, 0xb, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0x84, 0x0, 0x4, 0x80}
+
+/* o (111) */
+#define NXFONT_METRICS_111 {0, 8, 10, 0, 9, 1}
+#define NXFONT_BITMAP_111 {0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0xff, 0xb0, 0xf, 0xb0, 0x4, 0xf8, 0x8f, 0x40, 0x0, 0xbf, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x40, 0x0, 0xbf, 0xf, 0xb0, 0x4, 0xf8, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x8, 0x84, 0x0}
+
+/* p (112) */
+#define NXFONT_METRICS_112 {0, 8, 13, 1, 9, 1}
+#define NXFONT_BITMAP_112 {0x0, 0x8, 0x80, 0x0, 0xfb, 0xff, 0xff, 0x40, 0xff, 0x40, 0xb, 0xf0, 0xfb, 0x0, 0x4, 0xf8, 0xf8, 0x0, 0x0, 0xf8, 0xf8, 0x0, 0x0, 0xf8, 0xfb, 0x0, 0x4, 0xf8, 0xff, 0x40, 0xb, 0xf0, 0xfb, 0xff, 0xff, 0x40, 0xf8, 0x48, 0x84, 0x0, 0xf8, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0}
+
+/* q (113) */
+#define NXFONT_METRICS_113 {0, 8, 13, 0, 9, 1}
+#define NXFONT_BITMAP_113 {0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0xff, 0xbf, 0xf, 0xb4, 0x4, 0xff, 0x8f, 0x40, 0x0, 0xbf, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x40, 0x0, 0xbf, 0xf, 0xb0, 0x4, 0xff, 0x4, 0xff, 0xff, 0xbf, 0x0, 0x48, 0x84, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f}
+
+/* r (114) */
+#define NXFONT_METRICS_114 {0, 4, 10, 1, 9, 1}
+#define NXFONT_BITMAP_114 {0x84, 0x48, 0xfb, 0xff, 0xff, 0x80, 0xfb, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0xf8, 0x0, 0x84, 0x0}
+
+/* s (115) */
+#define NXFONT_METRICS_115 {0, 7, 10, 1, 9, 1}
+#define NXFONT_BITMAP_115 {0x0, 0x88, 0x40, 0x0, 0x4f, 0xff, 0xf8, 0x0, 0xbb, 0x0, 0xbf, 0x0, 0xbb, 0x0, 0x0, 0x0, 0x4f, 0xfb, 0x80, 0x0, 0x0, 0x48, 0xff, 0x0, 0x84, 0x0, 0x4f, 0x80, 0xfb, 0x0, 0x4f, 0x40, 0x8f, 0xff, 0xfb, 0x0, 0x4, 0x88, 0x40, 0x0}
+
+/* t (116) */
+#define NXFONT_METRICS_116 {0, 5, 12, 0, 7, 1}
+#define NXFONT_BITMAP_116 {0x4, 0x80, 0x0, 0x8, 0xf0, 0x0, 0x4b, 0xf8, 0x40, 0x8f, 0xff, 0x80, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xfb, 0x40, 0x0, 0x88, 0x40}
+
+/* u (117) */
+#define NXFONT_METRICS_117 {0, 7, 10, 1, 9, 1}
+#define NXFONT_BITMAP_117 {0x84, 0x0, 0x4, 0x80, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xfb, 0x0, 0x4f, 0xf0, 0x8f, 0xff, 0xfb, 0xf0, 0x4, 0x88, 0x4, 0x80}
+
+/* v (118) */
+#define NXFONT_METRICS_118 {0, 8, 10, 0, 9, 1}
+#define NXFONT_BITMAP_118 {0x84, 0x0, 0x0, 0x84, 0xbb, 0x0, 0x4, 0xf4, 0x8f, 0x0, 0x8, 0xf0, 0xf, 0x80, 0xf, 0x80, 0xb, 0xb0, 0x4f, 0x40, 0x8, 0xf0, 0x8f, 0x0, 0x0, 0xf8, 0xf8, 0x0, 0x0, 0xbb, 0xf4, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x8, 0x40, 0x0}
+
+/* w (119) */
+#define NXFONT_METRICS_119 {0, 12, 10, 0, 9, 1}
+#define NXFONT_BITMAP_119 {0x84, 0x0, 0x8, 0x40, 0x0, 0x84, 0xbb, 0x0, 0x4f, 0xb0, 0x4, 0xf4, 0x8f, 0x0, 0x8b, 0xf0, 0x8, 0xf0, 0xf, 0x80, 0xf8, 0xf8, 0xb, 0xb0, 0xf, 0x80, 0xf4, 0xb8, 0xf, 0x80, 0x8, 0xb4, 0xf0, 0x8b, 0x4f, 0x0, 0x8, 0xf8, 0xf0, 0x8f, 0x8f, 0x0, 0x0, 0xfb, 0x80, 0xf, 0xb8, 0x0, 0x0, 0xbf, 0x40, 0xb, 0xf4, 0x0, 0x0, 0x48, 0x0, 0x4, 0x80, 0x0}
+
+/* x (120) */
+#define NXFONT_METRICS_120 {0, 8, 10, 0, 9, 1}
+#define NXFONT_BITMAP_120 {0x88, 0x0, 0x4, 0x84, 0x4f, 0x80, 0xb, 0xb0, 0xb, 0xf0, 0x8f, 0x0, 0x0, 0xfb, 0xf8, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x8f, 0xf0, 0x0, 0x4, 0xfb, 0xf8, 0x0, 0xb, 0xb0, 0x8f, 0x40, 0x4f, 0x40, 0xb, 0xb0, 0x88, 0x0, 0x4, 0x84}
+
+/* y (121) */
+#define NXFONT_METRICS_121 {0, 8, 13, 0, 9, 1}
+#define NXFONT_BITMAP_121 {0x48, 0x0, 0x0, 0x84, 0x8f, 0x40, 0x4, 0xf4, 0xf, 0x80, 0x8, 0xf0, 0xb, 0xb0, 0xf, 0x80, 0x8, 0xf0, 0x4f, 0x40, 0x4, 0xf8, 0x8f, 0x0, 0x0, 0xf8, 0xf8, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0}
+
+/* z (122) */
+#define NXFONT_METRICS_122 {0, 8, 10, 0, 9, 1}
+#define NXFONT_BITMAP_122 {0x8, 0x88, 0x88, 0x80, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0xbb, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x4, 0xf8, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x48, 0x88, 0x88, 0x84}
+
+/* braceleft (123) */
+#define NXFONT_METRICS_123 {0, 5, 16, 0, 6, 1}
+#define NXFONT_BITMAP_123 {0x0, 0xbf, 0x80, 0x0, 0xf4, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x4f, 0x40, 0x0, 0x4f, 0x40, 0x0, 0x8, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0xbf, 0x80}
+
+/* bar (124) */
+#define NXFONT_METRICS_124 {0, 2, 16, 1, 6, 1}
+#define NXFONT_BITMAP_124 {0x44, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88}
+
+/* braceright (125) */
+#define NXFONT_METRICS_125 {0, 5, 16, 0, 6, 1}
+#define NXFONT_BITMAP_125 {0x8f, 0xb0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x4f, 0x40, 0x0, 0xf8, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x4, 0xf0, 0x0, 0x8f, 0xb0, 0x0}
+
+/* asciitilde (126) */
+#define NXFONT_METRICS_126 {0, 7, 3, 1, 11, 1}
+#define NXFONT_BITMAP_126 {0x4b, 0xb0, 0x0, 0x80, 0xb8, 0xbf, 0x84, 0xf0, 0x80, 0x4, 0xff, 0x40}
+
+/* exclamdown (161) */
+#define NXFONT_METRICS_161 {0, 2, 13, 2, 9, 1}
+#define NXFONT_BITMAP_161 {0x84, 0xf8, 0x84, 0x40, 0xb4, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8}
+
+/* cent (162) */
+#define NXFONT_METRICS_162 {0, 7, 13, 1, 8, 1}
+#define NXFONT_BITMAP_162 {0x0, 0x0, 0x48, 0x0, 0x0, 0x48, 0xb4, 0x0, 0xb, 0xf8, 0xff, 0x40, 0x8f, 0x40, 0x8b, 0xf0, 0xbb, 0x4, 0x84, 0x80, 0xf8, 0x8, 0x0, 0x0, 0xf8, 0xf, 0x0, 0x0, 0xf8, 0x8, 0x4, 0xf0, 0x8f, 0xb4, 0xb, 0xf0, 0xb, 0xf8, 0xbf, 0x40, 0x0, 0xb8, 0x84, 0x0, 0x8, 0x40, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0}
+
+/* sterling (163) */
+#define NXFONT_METRICS_163 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_163 {0x0, 0x4, 0x84, 0x0, 0x0, 0xbf, 0xff, 0xf4, 0xb, 0xf4, 0x4, 0xfb, 0xf, 0x80, 0x0, 0x8f, 0xf, 0x80, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x8f, 0xff, 0xf8, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0xb, 0xb4, 0x80, 0x8, 0x8f, 0xff, 0xff, 0xff, 0x8, 0x0, 0x8, 0x84}
+
+/* currency (164) */
+#define NXFONT_METRICS_164 {0, 7, 7, 1, 9, 1}
+#define NXFONT_BITMAP_164 {0x48, 0x8, 0x4, 0x40, 0x4f, 0xff, 0xff, 0x80, 0xf, 0x40, 0x4f, 0x0, 0x8f, 0x0, 0xf, 0x80, 0x4f, 0x0, 0xf, 0x40, 0xf, 0xb8, 0xbf, 0x40, 0x8f, 0x8f, 0x8b, 0x80}
+
+/* yen (165) */
+#define NXFONT_METRICS_165 {0, 9, 13, 0, 6, 1}
+#define NXFONT_BITMAP_165 {0x48, 0x0, 0x0, 0x8, 0x40, 0x4f, 0x40, 0x0, 0x4f, 0x40, 0xb, 0xb0, 0x0, 0xbb, 0x0, 0x4, 0xf4, 0x4, 0xf4, 0x0, 0x0, 0xbb, 0xb, 0xb0, 0x0, 0x0, 0x4f, 0x8f, 0x40, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x8, 0x88, 0xfb, 0x88, 0x0, 0x8, 0x88, 0xfb, 0x88, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x84, 0x0, 0x0}
+
+/* brokenbar (166) */
+#define NXFONT_METRICS_166 {0, 2, 16, 1, 6, 1}
+#define NXFONT_BITMAP_166 {0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x0, 0x0, 0x44, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88}
+
+/* section (167) */
+#define NXFONT_METRICS_167 {0, 8, 16, 0, 6, 1}
+#define NXFONT_BITMAP_167 {0x0, 0x4b, 0xfb, 0x40, 0x0, 0xfb, 0x8f, 0xf0, 0x8, 0xf0, 0x4, 0xf8, 0x8, 0xf4, 0x0, 0x84, 0x0, 0xff, 0x80, 0x0, 0xb, 0xb8, 0xff, 0x40, 0x8f, 0x0, 0x4f, 0xf4, 0x8f, 0x0, 0x0, 0xfb, 0xf, 0xb4, 0x0, 0x8f, 0x4, 0xff, 0x40, 0xbb, 0x0, 0x4b, 0xf8, 0xf4, 0x0, 0x0, 0xbf, 0x80, 0x8, 0x40, 0xb, 0xf0, 0xf, 0xb0, 0x8, 0xf0, 0x8, 0xf8, 0x8f, 0x80, 0x0, 0x8f, 0xf8, 0x0}
+
+/* dieresis (168) */
+#define NXFONT_METRICS_168 {0, 5, 2, 0, 6, 1}
+#define NXFONT_BITMAP_168 {0x8f, 0xf, 0x80, 0x48, 0x8, 0x40}
+
+/* copyright (169) */
+#define NXFONT_METRICS_169 {0, 12, 13, 0, 6, 1}
+#define NXFONT_BITMAP_169 {0x0, 0x8, 0xff, 0xfb, 0x40, 0x0, 0x0, 0xb8, 0x0, 0x4, 0xbb, 0x0, 0xb, 0x40, 0x48, 0x84, 0x4, 0xb0, 0x88, 0x4, 0xf8, 0x8b, 0xb0, 0x88, 0xf0, 0xf, 0x40, 0x0, 0x80, 0xf, 0xb0, 0x8b, 0x0, 0x0, 0x0, 0xb, 0x80, 0x88, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x8b, 0x0, 0x0, 0x0, 0xb, 0xb4, 0xb, 0xb4, 0x4, 0xf0, 0x4b, 0x4b, 0x0, 0x8f, 0xfb, 0x40, 0xb4, 0x8, 0xb0, 0x0, 0x0, 0xb, 0x80, 0x0, 0x4f, 0x88, 0x8b, 0xb4, 0x0, 0x0, 0x0, 0x88, 0x84, 0x0, 0x0}
+
+/* ordfeminine (170) */
+#define NXFONT_METRICS_170 {0, 6, 8, 0, 6, 1}
+#define NXFONT_BITMAP_170 {0xb, 0xbf, 0xb0, 0x8, 0x0, 0xf0, 0x8, 0x8f, 0xf0, 0x8b, 0x0, 0xf0, 0x8b, 0xb, 0xf0, 0x8, 0x84, 0x84, 0x48, 0x88, 0x84, 0x48, 0x88, 0x84}
+
+/* guillemotleft (171) */
+#define NXFONT_METRICS_171 {0, 7, 5, 1, 11, 1}
+#define NXFONT_BITMAP_171 {0x0, 0x84, 0x8, 0x40, 0xb, 0xb0, 0xbb, 0x0, 0x8b, 0x8, 0xb0, 0x0, 0x4f, 0x44, 0xf4, 0x0, 0x4, 0xf4, 0x4f, 0x40}
+
+/* logicalnot (172) */
+#define NXFONT_METRICS_172 {0, 9, 5, 0, 12, 1}
+#define NXFONT_BITMAP_172 {0x48, 0x88, 0x88, 0x88, 0x40, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0xf, 0x80}
+
+/* hyphen (173) */
+#define NXFONT_METRICS_173 {0, 5, 2, 0, 13, 1}
+#define NXFONT_BITMAP_173 {0x48, 0x88, 0x40, 0x48, 0x88, 0x40}
+
+/* registered (174) */
+#define NXFONT_METRICS_174 {0, 12, 13, 0, 6, 1}
+#define NXFONT_BITMAP_174 {0x0, 0x8, 0xbf, 0xfb, 0x40, 0x0, 0x0, 0xb8, 0x0, 0x4, 0xbb, 0x0, 0xb, 0x40, 0x0, 0x0, 0x4, 0xb0, 0x88, 0x8, 0xff, 0xff, 0x40, 0x88, 0xf0, 0x8, 0x80, 0x4, 0xf0, 0xf, 0xb0, 0x8, 0x80, 0x4, 0xb0, 0xb, 0x80, 0x8, 0xff, 0xf8, 0x0, 0x8, 0xb0, 0x8, 0x80, 0xb8, 0x0, 0xb, 0xb4, 0x8, 0x80, 0xb, 0x40, 0x4b, 0x4b, 0x4, 0x40, 0x4, 0x80, 0xb4, 0x8, 0xb0, 0x0, 0x0, 0xb, 0x80, 0x0, 0x4f, 0x88, 0x8b, 0xb4, 0x0, 0x0, 0x0, 0x48, 0x84, 0x0, 0x0}
+
+/* macron (175) */
+#define NXFONT_METRICS_175 {0, 5, 2, 0, 6, 1}
+#define NXFONT_BITMAP_175 {0x48, 0x88, 0x80, 0x48, 0x88, 0x80}
+
+/* degree (176) */
+#define NXFONT_METRICS_176 {0, 5, 5, 1, 6, 1}
+#define NXFONT_BITMAP_176 {0x8, 0x84, 0x0, 0xbb, 0x8f, 0x40, 0xf0, 0x8, 0x80, 0xf4, 0xb, 0x80, 0x4f, 0xfb, 0x0}
+
+/* plusminus (177) */
+#define NXFONT_METRICS_177 {0, 9, 11, 0, 8, 1}
+#define NXFONT_BITMAP_177 {0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x48, 0x88, 0xfb, 0x88, 0x80, 0x8f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0, 0x48, 0x88, 0x88, 0x88, 0x80}
+
+/* twosuperior (178) */
+#define NXFONT_METRICS_178 {0, 5, 8, 0, 6, 1}
+#define NXFONT_BITMAP_178 {0x0, 0x88, 0x0, 0xf, 0x8b, 0x80, 0x88, 0x0, 0xf0, 0x0, 0x4, 0xb0, 0x0, 0x8f, 0x40, 0xb, 0xb0, 0x0, 0x8b, 0x0, 0x0, 0x8f, 0xff, 0xf0}
+
+/* threesuperior (179) */
+#define NXFONT_METRICS_179 {0, 5, 8, 0, 6, 1}
+#define NXFONT_BITMAP_179 {0x4, 0x88, 0x0, 0x4f, 0x8b, 0xb0, 0x88, 0x0, 0xf0, 0x0, 0x4b, 0xb0, 0x0, 0x4b, 0xb0, 0x44, 0x0, 0xf0, 0x8b, 0x4, 0xf0, 0xb, 0xff, 0x40}
+
+/* acute (180) */
+#define NXFONT_METRICS_180 {0, 4, 3, 1, 5, 1}
+#define NXFONT_BITMAP_180 {0x4, 0xfb, 0xb, 0xb0, 0x48, 0x0}
+
+/* mu (181) */
+#define NXFONT_METRICS_181 {0, 7, 13, 1, 9, 1}
+#define NXFONT_BITMAP_181 {0x84, 0x0, 0x4, 0x80, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xfb, 0x0, 0x4f, 0xf0, 0xff, 0xff, 0xfb, 0xf0, 0xfb, 0x88, 0x4, 0x80, 0xf8, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x84, 0x0, 0x0, 0x0}
+
+/* paragraph (182) */
+#define NXFONT_METRICS_182 {0, 9, 15, 0, 6, 1}
+#define NXFONT_BITMAP_182 {0x0, 0x8f, 0xff, 0xff, 0x80, 0x8, 0xff, 0xf0, 0x88, 0x0, 0xf, 0xff, 0xf0, 0x88, 0x0, 0x8f, 0xff, 0xf0, 0x88, 0x0, 0x8f, 0xff, 0xf0, 0x88, 0x0, 0xf, 0xff, 0xf0, 0x88, 0x0, 0x8, 0xff, 0xf0, 0x88, 0x0, 0x0, 0x8b, 0xf0, 0x88, 0x0, 0x0, 0x0, 0xf0, 0x88, 0x0, 0x0, 0x0, 0xf0, 0x88, 0x0, 0x0, 0x0, 0xf0, 0x88, 0x0, 0x0, 0x0, 0xf0, 0x88, 0x0, 0x0, 0x0, 0xf0, 0x88, 0x0, 0x0, 0x0, 0xf0, 0x88, 0x0, 0x0, 0x0, 0xf0, 0x88, 0x0}
+
+/* periodcentered (183) */
+#define NXFONT_METRICS_183 {0, 3, 2, 1, 11, 1}
+#define NXFONT_BITMAP_183 {0x4f, 0x40, 0x4f, 0x40}
+
+/* cedilla (184) */
+#define NXFONT_METRICS_184 {0, 4, 4, 1, 18, 1}
+#define NXFONT_BITMAP_184 {0x4, 0x40, 0xb, 0xb0, 0x0, 0xb8, 0xb8, 0xf4}
+
+/* onesuperior (185) */
+#define NXFONT_METRICS_185 {0, 3, 8, 1, 6, 1}
+#define NXFONT_BITMAP_185 {0x4, 0x40, 0x8f, 0x80, 0x8b, 0x80, 0x8, 0x80, 0x8, 0x80, 0x8, 0x80, 0x8, 0x80, 0x8, 0x80}
+
+/* ordmasculine (186) */
+#define NXFONT_METRICS_186 {0, 6, 8, 0, 6, 1}
+#define NXFONT_BITMAP_186 {0x8, 0xff, 0x80, 0x4f, 0x0, 0xf4, 0x88, 0x0, 0x88, 0x88, 0x0, 0x88, 0x4f, 0x0, 0xf4, 0x8, 0xff, 0x80, 0x48, 0x88, 0x84, 0x48, 0x88, 0x84}
+
+/* guillemotright (187) */
+#define NXFONT_METRICS_187 {0, 7, 5, 1, 11, 1}
+#define NXFONT_BITMAP_187 {0x48, 0x4, 0x80, 0x0, 0xb, 0xb0, 0xbb, 0x0, 0x0, 0xb8, 0xb, 0x80, 0x4, 0xf4, 0x4f, 0x40, 0x4f, 0x44, 0xf4, 0x0}
+
+/* onequarter (188) */
+#define NXFONT_METRICS_188 {0, 13, 13, 0, 6, 1}
+#define NXFONT_BITMAP_188 {0x0, 0x80, 0x0, 0x0, 0xb, 0x80, 0x0, 0x4b, 0xf0, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x48, 0xf0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0, 0xf0, 0x0, 0xb8, 0x0, 0x8, 0x0, 0x0, 0xf0, 0x4, 0xf0, 0x0, 0xbf, 0x0, 0x0, 0xf0, 0xf, 0x40, 0xb, 0xbf, 0x0, 0x0, 0x0, 0xbb, 0x0, 0x4b, 0xf, 0x0, 0x0, 0x4, 0xf0, 0x4, 0xf4, 0xf, 0x0, 0x0, 0xb, 0x80, 0x8, 0xff, 0xff, 0xf0, 0x0, 0x4f, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x44, 0x0, 0x0, 0x0, 0x8, 0x0}
+
+/* onehalf (189) */
+#define NXFONT_METRICS_189 {0, 13, 13, 0, 6, 1}
+#define NXFONT_BITMAP_189 {0x0, 0x80, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x4b, 0xf0, 0x0, 0x0, 0xb4, 0x0, 0x0, 0x48, 0xf0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x4f, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0xb8, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x4, 0xf0, 0x4, 0x84, 0x0, 0x0, 0xf0, 0xb, 0x80, 0x8b, 0x8b, 0xb0, 0x0, 0xf0, 0x4b, 0x0, 0xf0, 0x0, 0xf0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x8, 0xb0, 0x0, 0x4, 0xbb, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0xb8, 0x0, 0x0, 0xfb, 0x88, 0x80, 0x0, 0x80, 0x0, 0x0, 0x88, 0x88, 0x80}
+
+/* threequarters (190) */
+#define NXFONT_METRICS_190 {0, 13, 13, 0, 6, 1}
+#define NXFONT_BITMAP_190 {0x4, 0x88, 0x0, 0x0, 0x0, 0x48, 0x0, 0xf, 0x8b, 0xb0, 0x0, 0x0, 0xb4, 0x0, 0x88, 0x0, 0xf0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x4b, 0xb0, 0x0, 0x4f, 0x0, 0x0, 0x0, 0x48, 0xf4, 0x0, 0xb4, 0x0, 0x0, 0x44, 0x0, 0x88, 0x8, 0xb0, 0x8, 0x0, 0x4b, 0x0, 0xb8, 0x4f, 0x40, 0xbf, 0x0, 0x8, 0xff, 0x80, 0xb4, 0xb, 0xbf, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x4b, 0xf, 0x0, 0x0, 0x0, 0x4f, 0x4, 0xf4, 0xf, 0x0, 0x0, 0x0, 0xf4, 0x8, 0xff, 0xff, 0xf0, 0x0, 0xb, 0x80, 0x0, 0x0, 0xf, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8, 0x0}
+
+/* questiondown (191) */
+#define NXFONT_METRICS_191 {0, 8, 13, 1, 9, 1}
+#define NXFONT_BITMAP_191 {0x0, 0x4, 0x80, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x8f, 0x0, 0x0, 0xf8, 0x8f, 0x40, 0x4, 0xf8, 0xf, 0xf8, 0x8f, 0xb0, 0x4, 0x8f, 0xf8, 0x0}
+
+/* Agrave (192) */
+#define NXFONT_METRICS_192 {0, 11, 16, 0, 3, 1}
+#define NXFONT_BITMAP_192 {0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xb0, 0xbf, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x8f, 0x40, 0x0, 0x0, 0x8f, 0x0, 0x4f, 0x80, 0x0, 0x0, 0xff, 0x88, 0x8f, 0xf0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x8, 0xf4, 0x0, 0x4, 0xf8, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xff, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x8f, 0x40, 0x48, 0x40, 0x0, 0x0, 0x48, 0x40}
+
+/* Aacute (193) */
+#define NXFONT_METRICS_193 {0, 11, 16, 0, 3, 1}
+#define NXFONT_BITMAP_193 {0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xb0, 0xbf, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x8f, 0x40, 0x0, 0x0, 0x8f, 0x40, 0x4f, 0x80, 0x0, 0x0, 0xff, 0x88, 0x8f, 0xf0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf4, 0x0, 0xb, 0xf4, 0x0, 0x4, 0xf8, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xff, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x8f, 0x40, 0x48, 0x40, 0x0, 0x0, 0x48, 0x40}
+
+/* Acircumflex (194) */
+#define NXFONT_METRICS_194 {0, 11, 16, 0, 3, 1}
+#define NXFONT_BITMAP_194 {0x0, 0x0, 0x4b, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfb, 0xb0, 0x0, 0x0, 0x0, 0x8, 0x40, 0x84, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xb0, 0xbf, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x8f, 0x40, 0x0, 0x0, 0x8f, 0x40, 0x4f, 0x80, 0x0, 0x0, 0xff, 0x88, 0x8f, 0xf0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x8, 0xf4, 0x0, 0x4, 0xf8, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xff, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x8f, 0x40, 0x48, 0x40, 0x0, 0x0, 0x48, 0x40}
+
+/* Atilde (195) */
+#define NXFONT_METRICS_195 {0, 11, 16, 0, 3, 1}
+#define NXFONT_BITMAP_195 {0x0, 0x0, 0x84, 0x8, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x8, 0x4, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xb0, 0xbf, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x8f, 0x40, 0x0, 0x0, 0x8f, 0x40, 0x4f, 0x80, 0x0, 0x0, 0xff, 0x88, 0x8f, 0xf0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x8, 0xf4, 0x0, 0x4, 0xf8, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xff, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x8f, 0x40, 0x48, 0x40, 0x0, 0x0, 0x48, 0x40}
+
+/* Adieresis (196) */
+#define NXFONT_METRICS_196 {0, 11, 16, 0, 3, 1}
+#define NXFONT_BITMAP_196 {0x0, 0x4, 0x80, 0x84, 0x0, 0x0, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xb0, 0xbf, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x8f, 0x40, 0x0, 0x0, 0x8f, 0x40, 0x4f, 0x80, 0x0, 0x0, 0xff, 0x88, 0x8f, 0xf0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x8, 0xf4, 0x0, 0x4, 0xf8, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xff, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x8f, 0x40, 0x48, 0x40, 0x0, 0x0, 0x48, 0x40}
+
+/* Aring (197) */
+#define NXFONT_METRICS_197 {0, 11, 16, 0, 3, 1}
+#define NXFONT_BITMAP_197 {0x0, 0x0, 0xb8, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb8, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x48, 0x40, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xb0, 0xbf, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x8f, 0x40, 0x0, 0x0, 0x8f, 0x0, 0x4f, 0x80, 0x0, 0x0, 0xff, 0x88, 0x8f, 0xf0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x8, 0xf4, 0x0, 0x4, 0xf8, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xff, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x8f, 0x40, 0x48, 0x40, 0x0, 0x0, 0x48, 0x40}
+
+/* AE (198) */
+#define NXFONT_METRICS_198 {0, 15, 13, 0, 6, 1}
+#define NXFONT_BITMAP_198 {0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x8f, 0x8b, 0xf8, 0x88, 0x88, 0x80, 0x0, 0x0, 0xf8, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x80, 0x8, 0xf8, 0x88, 0x88, 0x40, 0x0, 0x8f, 0x40, 0x8, 0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0x88, 0x8b, 0xf0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf0, 0x48, 0x0, 0x0, 0x4, 0x88, 0x88, 0x88, 0x80}
+
+/* Ccedilla (199) */
+#define NXFONT_METRICS_199 {0, 10, 16, 1, 6, 1}
+#define NXFONT_BITMAP_199 {0x0, 0x4b, 0xff, 0xb4, 0x0, 0x4, 0xff, 0x88, 0xbf, 0x80, 0x4f, 0xb0, 0x0, 0xb, 0xf4, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0x48, 0xbf, 0x0, 0x0, 0x0, 0xbf, 0x8f, 0x40, 0x0, 0x4, 0xf8, 0xb, 0xf8, 0x0, 0x4f, 0xf0, 0x0, 0xbf, 0xff, 0xfb, 0x40, 0x0, 0x4, 0xbb, 0x40, 0x0, 0x0, 0x0, 0xbb, 0x0, 0x0, 0x0, 0x0, 0xb, 0x80, 0x0, 0x0, 0xb, 0x8f, 0x40, 0x0}
+
+/* Egrave (200) */
+#define NXFONT_METRICS_200 {0, 9, 16, 1, 3, 1}
+#define NXFONT_BITMAP_200 {0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x8f, 0x88, 0x88, 0x88, 0x40, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x88, 0x88, 0x88, 0x40, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0, 0x48, 0x88, 0x88, 0x88, 0x80}
+
+/* Eacute (201) */
+#define NXFONT_METRICS_201 {0, 9, 16, 1, 3, 1}
+#define NXFONT_BITMAP_201 {0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0xbb, 0x0, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x8f, 0x88, 0x88, 0x88, 0x40, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x88, 0x88, 0x88, 0x40, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0, 0x48, 0x88, 0x88, 0x88, 0x80}
+
+/* Ecircumflex (202) */
+#define NXFONT_METRICS_202 {0, 9, 16, 1, 3, 1}
+#define NXFONT_BITMAP_202 {0x0, 0x0, 0xb4, 0x0, 0x0, 0x0, 0xb, 0xbf, 0x40, 0x0, 0x0, 0x48, 0x4, 0x80, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x8f, 0x88, 0x88, 0x88, 0x40, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x88, 0x88, 0x88, 0x40, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0, 0x48, 0x88, 0x88, 0x88, 0x80}
+
+/* Edieresis (203) */
+#define NXFONT_METRICS_203 {0, 9, 16, 1, 3, 1}
+#define NXFONT_BITMAP_203 {0x0, 0x84, 0x4, 0x80, 0x0, 0x0, 0xf8, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x8f, 0x88, 0x88, 0x88, 0x40, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x88, 0x88, 0x88, 0x40, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0, 0x48, 0x88, 0x88, 0x88, 0x80}
+
+/* Igrave (204) */
+#define NXFONT_METRICS_204 {0, 4, 16, 0, 3, 1}
+#define NXFONT_BITMAP_204 {0xbf, 0x40, 0xb, 0xb0, 0x0, 0x84, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x4, 0x80}
+
+/* Iacute (205) */
+#define NXFONT_METRICS_205 {0, 4, 16, 1, 3, 1}
+#define NXFONT_BITMAP_205 {0xb, 0xf4, 0x4f, 0x40, 0x84, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x48, 0x0}
+
+/* Icircumflex (206) */
+#define NXFONT_METRICS_206 {0, 5, 16, 0, 3, 1}
+#define NXFONT_BITMAP_206 {0x4, 0xb0, 0x0, 0x4f, 0xbb, 0x0, 0x84, 0x8, 0x40, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x4, 0x80, 0x0}
+
+/* Idieresis (207) */
+#define NXFONT_METRICS_207 {0, 5, 16, 0, 3, 1}
+#define NXFONT_BITMAP_207 {0x84, 0x8, 0x40, 0xf8, 0xf, 0x80, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x4, 0x80, 0x0}
+
+/* Eth (208) */
+#define NXFONT_METRICS_208 {0, 11, 13, 0, 6, 1}
+#define NXFONT_BITMAP_208 {0x8, 0xff, 0xff, 0xfb, 0x40, 0x0, 0x8, 0xf8, 0x88, 0x8f, 0xf4, 0x0, 0x8, 0xf0, 0x0, 0x0, 0xfb, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x8f, 0x0, 0x8, 0xf0, 0x0, 0x0, 0xf, 0x80, 0x8b, 0xf8, 0x80, 0x0, 0xf, 0x80, 0x8b, 0xf8, 0x80, 0x0, 0xf, 0x80, 0x8, 0xf0, 0x0, 0x0, 0xf, 0x80, 0x8, 0xf0, 0x0, 0x0, 0x8f, 0x40, 0x8, 0xf0, 0x0, 0x0, 0xbf, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf4, 0x0, 0x8, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x4, 0x88, 0x88, 0x84, 0x0, 0x0}
+
+/* Ntilde (209) */
+#define NXFONT_METRICS_209 {0, 10, 16, 1, 3, 1}
+#define NXFONT_BITMAP_209 {0x0, 0x4, 0x80, 0x44, 0x0, 0x0, 0x4f, 0xff, 0xf4, 0x0, 0x0, 0x44, 0x8, 0x40, 0x0, 0xff, 0x40, 0x0, 0x0, 0xf8, 0xff, 0xb0, 0x0, 0x0, 0xf8, 0xff, 0xf4, 0x0, 0x0, 0xf8, 0xf8, 0xbf, 0x0, 0x0, 0xf8, 0xf8, 0x4f, 0xb0, 0x0, 0xf8, 0xf8, 0xb, 0xf4, 0x0, 0xf8, 0xf8, 0x0, 0xfb, 0x0, 0xf8, 0xf8, 0x0, 0x4f, 0x80, 0xf8, 0xf8, 0x0, 0xb, 0xf0, 0xf8, 0xf8, 0x0, 0x4, 0xfb, 0xf8, 0xf8, 0x0, 0x0, 0x8f, 0xf8, 0xf8, 0x0, 0x0, 0xb, 0xf8, 0x84, 0x0, 0x0, 0x4, 0x84}
+
+/* Ograve (210) */
+#define NXFONT_METRICS_210 {0, 12, 16, 0, 3, 1}
+#define NXFONT_BITMAP_210 {0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xff, 0x80, 0x0, 0x0, 0xbf, 0xb8, 0x88, 0xff, 0x40, 0x8, 0xfb, 0x0, 0x0, 0x4f, 0xf0, 0xf, 0xb0, 0x0, 0x0, 0x4, 0xf8, 0x4f, 0x80, 0x0, 0x0, 0x0, 0xfb, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x40, 0x0, 0x0, 0x0, 0xbf, 0x4f, 0x80, 0x0, 0x0, 0x0, 0xfb, 0xb, 0xf4, 0x0, 0x0, 0xb, 0xf4, 0x4, 0xff, 0x40, 0x0, 0xbf, 0xb0, 0x0, 0x4b, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x48, 0x88, 0x0, 0x0}
+
+/* Oacute (211) */
+#define NXFONT_METRICS_211 {0, 12, 16, 0, 3, 1}
+#define NXFONT_BITMAP_211 {0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8, 0x40, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xff, 0x80, 0x0, 0x0, 0xbf, 0xb8, 0x88, 0xff, 0x40, 0x8, 0xfb, 0x0, 0x0, 0x4f, 0xf0, 0xf, 0xb0, 0x0, 0x0, 0x4, 0xf8, 0x4f, 0x80, 0x0, 0x0, 0x0, 0xfb, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x40, 0x0, 0x0, 0x0, 0xbf, 0x4f, 0x80, 0x0, 0x0, 0x0, 0xfb, 0xb, 0xf4, 0x0, 0x0, 0xb, 0xf4, 0x4, 0xff, 0x40, 0x0, 0xbf, 0xb0, 0x0, 0x4b, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x48, 0x88, 0x0, 0x0}
+
+/* Ocircumflex (212) */
+#define NXFONT_METRICS_212 {0, 12, 16, 0, 3, 1}
+#define NXFONT_BITMAP_212 {0x0, 0x0, 0x4, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x84, 0x8, 0x40, 0x0, 0x0, 0x4, 0xbf, 0xff, 0x80, 0x0, 0x0, 0xbf, 0xb8, 0x88, 0xff, 0x40, 0x8, 0xfb, 0x0, 0x0, 0x4f, 0xf0, 0xf, 0xb0, 0x0, 0x0, 0x4, 0xf8, 0x4f, 0x80, 0x0, 0x0, 0x0, 0xfb, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x40, 0x0, 0x0, 0x0, 0xbf, 0x4f, 0x80, 0x0, 0x0, 0x0, 0xfb, 0xb, 0xf4, 0x0, 0x0, 0xb, 0xf4, 0x4, 0xff, 0x40, 0x0, 0xbf, 0xb0, 0x0, 0x4b, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x48, 0x88, 0x0, 0x0}
+
+/* Otilde (213) */
+#define NXFONT_METRICS_213 {0, 12, 16, 0, 3, 1}
+#define NXFONT_BITMAP_213 {0x0, 0x0, 0x8, 0x40, 0x80, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x80, 0x48, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xff, 0x80, 0x0, 0x0, 0xbf, 0xb8, 0x88, 0xff, 0x40, 0x8, 0xfb, 0x0, 0x0, 0x4f, 0xf0, 0xf, 0xb0, 0x0, 0x0, 0x4, 0xf8, 0x4f, 0x80, 0x0, 0x0, 0x0, 0xfb, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x40, 0x0, 0x0, 0x0, 0xbf, 0x4f, 0x80, 0x0, 0x0, 0x0, 0xfb, 0xb, 0xf4, 0x0, 0x0, 0xb, 0xf4, 0x4, 0xff, 0x40, 0x0, 0xbf, 0xb0, 0x0, 0x4b, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x48, 0x88, 0x0, 0x0}
+
+/* Odieresis (214) */
+#define NXFONT_METRICS_214 {0, 12, 15, 0, 4, 1}
+#define NXFONT_BITMAP_214 {0x0, 0x0, 0xf8, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x84, 0x4, 0x80, 0x0, 0x0, 0x4, 0xbf, 0xff, 0x80, 0x0, 0x0, 0xbf, 0xb8, 0x88, 0xff, 0x40, 0x8, 0xfb, 0x0, 0x0, 0x4f, 0xf0, 0xf, 0xb0, 0x0, 0x0, 0x4, 0xf8, 0x4f, 0x80, 0x0, 0x0, 0x0, 0xfb, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x40, 0x0, 0x0, 0x0, 0xbf, 0x4f, 0x80, 0x0, 0x0, 0x0, 0xfb, 0xb, 0xf4, 0x0, 0x0, 0xb, 0xf4, 0x4, 0xff, 0x40, 0x0, 0xbf, 0xb0, 0x0, 0x4b, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x48, 0x88, 0x0, 0x0}
+
+/* multiply (215) */
+#define NXFONT_METRICS_215 {0, 8, 8, 1, 10, 1}
+#define NXFONT_BITMAP_215 {0x40, 0x0, 0x0, 0x40, 0xfb, 0x0, 0x4, 0xf8, 0x4f, 0xb0, 0x4f, 0xb0, 0x4, 0xff, 0xfb, 0x0, 0x0, 0x8f, 0xf0, 0x0, 0x4, 0xfb, 0xfb, 0x0, 0x4f, 0xb0, 0x4f, 0xb0, 0xbb, 0x0, 0x4, 0xf4}
+
+/* Oslash (216) */
+#define NXFONT_METRICS_216 {0, 12, 13, 0, 6, 1}
+#define NXFONT_BITMAP_216 {0x0, 0x4, 0xbf, 0xff, 0x80, 0x4b, 0x0, 0xbf, 0xb8, 0x88, 0xff, 0xb0, 0x8, 0xfb, 0x0, 0x0, 0x8f, 0xf0, 0xf, 0xb0, 0x0, 0x4, 0xb4, 0xf8, 0x4f, 0x80, 0x0, 0xf, 0x0, 0xfb, 0x8f, 0x0, 0x0, 0xb4, 0x0, 0x8f, 0x8f, 0x0, 0xb, 0x40, 0x0, 0x8f, 0x8f, 0x0, 0xb4, 0x0, 0x0, 0xbf, 0x4f, 0x8b, 0x40, 0x0, 0x0, 0xfb, 0xb, 0xf8, 0x0, 0x0, 0xb, 0xf4, 0x8, 0xff, 0x40, 0x0, 0xbf, 0xb0, 0x4b, 0x4b, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x48, 0x88, 0x0, 0x0}
+
+/* Ugrave (217) */
+#define NXFONT_METRICS_217 {0, 10, 16, 1, 3, 1}
+#define NXFONT_BITMAP_217 {0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x8, 0x40, 0x0, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x40, 0x0, 0x4, 0xf8, 0xf, 0xf4, 0x0, 0x4f, 0xf0, 0x4, 0xff, 0xff, 0xff, 0x40, 0x0, 0x4, 0x88, 0x40, 0x0}
+
+/* Uacute (218) */
+#define NXFONT_METRICS_218 {0, 10, 16, 1, 3, 1}
+#define NXFONT_BITMAP_218 {0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0xbb, 0x0, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x40, 0x0, 0x4, 0xf8, 0xf, 0xf4, 0x0, 0x4f, 0xf0, 0x4, 0xff, 0xff, 0xff, 0x40, 0x0, 0x4, 0x88, 0x40, 0x0}
+
+/* Ucircumflex (219) */
+#define NXFONT_METRICS_219 {0, 10, 16, 1, 3, 1}
+#define NXFONT_BITMAP_219 {0x0, 0x0, 0x4b, 0x0, 0x0, 0x0, 0x4, 0xfb, 0xb0, 0x0, 0x0, 0x8, 0x40, 0x84, 0x0, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x40, 0x0, 0x4, 0xf8, 0xf, 0xf4, 0x0, 0x4f, 0xf0, 0x4, 0xff, 0xff, 0xff, 0x40, 0x0, 0x4, 0x88, 0x40, 0x0}
+
+/* Udieresis (220) */
+#define NXFONT_METRICS_220 {0, 10, 16, 1, 3, 1}
+#define NXFONT_BITMAP_220 {0x0, 0x48, 0x0, 0x84, 0x0, 0x0, 0x8f, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x0, 0xf8, 0x8f, 0x40, 0x0, 0x4, 0xf8, 0xf, 0xf4, 0x0, 0x4f, 0xf0, 0x4, 0xff, 0xff, 0xff, 0x40, 0x0, 0x4, 0x88, 0x40, 0x0}
+
+/* Yacute (221) */
+#define NXFONT_METRICS_221 {0, 10, 16, 0, 3, 1}
+#define NXFONT_BITMAP_221 {0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0, 0x84, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0xbf, 0xf, 0xb0, 0x0, 0x4, 0xf8, 0x8, 0xf4, 0x0, 0xb, 0xf0, 0x0, 0xfb, 0x0, 0x8f, 0x80, 0x0, 0x4f, 0x80, 0xfb, 0x0, 0x0, 0xb, 0xf8, 0xf4, 0x0, 0x0, 0x4, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0}
+
+/* Thorn (222) */
+#define NXFONT_METRICS_222 {0, 9, 13, 1, 6, 1}
+#define NXFONT_BITMAP_222 {0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x88, 0x88, 0x80, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x40, 0x8f, 0x0, 0x0, 0x4f, 0x80, 0x8f, 0x0, 0x0, 0xb, 0xf0, 0x8f, 0x0, 0x0, 0xb, 0xf0, 0x8f, 0x0, 0x0, 0x4f, 0x80, 0x8f, 0xff, 0xff, 0xfb, 0x0, 0x8f, 0x88, 0x88, 0x80, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0x0}
+
+/* germandbls (223) */
+#define NXFONT_METRICS_223 {0, 7, 13, 2, 6, 1}
+#define NXFONT_BITMAP_223 {0x8, 0xff, 0xb4, 0x0, 0x8f, 0xb8, 0xff, 0x0, 0xfb, 0x0, 0x4f, 0x80, 0xf8, 0x0, 0xf, 0x80, 0xf8, 0x0, 0xbf, 0x40, 0xf8, 0xf, 0xf8, 0x0, 0xf8, 0x8, 0xbf, 0x40, 0xf8, 0x0, 0xb, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x4f, 0x80, 0xf8, 0x8f, 0xfb, 0x0, 0x84, 0x48, 0x40, 0x0}
+
+/* agrave (224) */
+#define NXFONT_METRICS_224 {0, 9, 13, 0, 6, 1}
+#define NXFONT_BITMAP_224 {0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0x48, 0x88, 0x0, 0x0, 0x8, 0xfb, 0x8f, 0xf4, 0x0, 0xf, 0x80, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x88, 0xbf, 0xf8, 0x0, 0xf, 0xf8, 0x80, 0xf8, 0x0, 0x8f, 0x40, 0x0, 0xf8, 0x0, 0x8f, 0x0, 0xb, 0xf8, 0x0, 0xf, 0xf8, 0xfb, 0xfb, 0x40, 0x4, 0x88, 0x80, 0x48, 0x40}
+
+/* aacute (225) */
+#define NXFONT_METRICS_225 {0, 9, 13, 0, 6, 1}
+#define NXFONT_BITMAP_225 {0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x8, 0x40, 0x0, 0x0, 0x0, 0x48, 0x88, 0x0, 0x0, 0x8, 0xfb, 0x8f, 0xf4, 0x0, 0xf, 0x80, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x88, 0xbf, 0xf8, 0x0, 0xf, 0xf8, 0x80, 0xf8, 0x0, 0x8f, 0x40, 0x0, 0xf8, 0x0, 0x8f, 0x0, 0xb, 0xf8, 0x0, 0xf, 0xf8, 0xbb, 0xfb, 0x40, 0x4, 0x88, 0x80, 0x48, 0x40}
+
+/* acircumflex (226) */
+#define NXFONT_METRICS_226 {0, 9, 13, 0, 6, 1}
+#define NXFONT_BITMAP_226 {0x0, 0x4, 0xb0, 0x0, 0x0, 0x0, 0x4f, 0xbb, 0x0, 0x0, 0x0, 0x84, 0x8, 0x40, 0x0, 0x0, 0x48, 0x88, 0x0, 0x0, 0x8, 0xfb, 0x8f, 0xf4, 0x0, 0xf, 0x80, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x88, 0xbf, 0xf8, 0x0, 0xf, 0xf8, 0x80, 0xf8, 0x0, 0x8f, 0x40, 0x0, 0xf8, 0x0, 0x8f, 0x0, 0xb, 0xf8, 0x0, 0xf, 0xf8, 0xbb, 0xfb, 0x40, 0x4, 0x88, 0x80, 0x48, 0x40}
+
+/* atilde (227) */
+#define NXFONT_METRICS_227 {0, 9, 13, 0, 6, 1}
+#define NXFONT_BITMAP_227 {0x0, 0x8, 0x40, 0x80, 0x0, 0x0, 0xbf, 0xff, 0xb0, 0x0, 0x0, 0x80, 0x48, 0x0, 0x0, 0x0, 0x48, 0x88, 0x0, 0x0, 0x8, 0xfb, 0x8f, 0xf4, 0x0, 0xf, 0x80, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x88, 0xbf, 0xf8, 0x0, 0xf, 0xf8, 0x80, 0xf8, 0x0, 0x8f, 0x40, 0x0, 0xf8, 0x0, 0x8f, 0x0, 0xb, 0xf8, 0x0, 0xf, 0xf8, 0xbb, 0xfb, 0x40, 0x4, 0x88, 0x80, 0x48, 0x40}
+
+/* adieresis (228) */
+#define NXFONT_METRICS_228 {0, 9, 12, 0, 7, 1}
+#define NXFONT_BITMAP_228 {0x0, 0x8f, 0xf, 0x80, 0x0, 0x0, 0x48, 0x8, 0x40, 0x0, 0x0, 0x48, 0x88, 0x0, 0x0, 0x8, 0xfb, 0xbf, 0xf4, 0x0, 0xf, 0x80, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x88, 0xbf, 0xf8, 0x0, 0xf, 0xf8, 0x80, 0xf8, 0x0, 0x8f, 0x40, 0x0, 0xf8, 0x0, 0x8f, 0x0, 0xb, 0xf8, 0x0, 0xf, 0xf8, 0xfb, 0xfb, 0x40, 0x4, 0x88, 0x80, 0x48, 0x40}
+
+/* aring (229) */
+#define NXFONT_METRICS_229 {0, 9, 13, 0, 6, 1}
+#define NXFONT_BITMAP_229 {0x0, 0xb, 0xb4, 0x0, 0x0, 0x0, 0x8, 0x8, 0x0, 0x0, 0x0, 0xb, 0xb4, 0x0, 0x0, 0x0, 0x48, 0x88, 0x0, 0x0, 0x8, 0xfb, 0x8f, 0xf4, 0x0, 0xf, 0x80, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x88, 0xbf, 0xf8, 0x0, 0xf, 0xf8, 0x80, 0xf8, 0x0, 0x8f, 0x40, 0x0, 0xf8, 0x0, 0x8f, 0x0, 0xb, 0xf8, 0x0, 0xf, 0xf8, 0xbb, 0xfb, 0x40, 0x4, 0x88, 0x80, 0x48, 0x40}
+
+/* ae (230) */
+#define NXFONT_METRICS_230 {0, 14, 10, 0, 9, 1}
+#define NXFONT_BITMAP_230 {0x0, 0x8, 0x84, 0x0, 0x48, 0x80, 0x0, 0x4, 0xfb, 0x8f, 0xb8, 0xf8, 0xbf, 0x40, 0xf, 0x80, 0x4, 0xff, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0xf8, 0x0, 0x48, 0xbf, 0xfb, 0x88, 0x88, 0xf8, 0xb, 0xff, 0x88, 0xff, 0xff, 0xff, 0xf8, 0x8f, 0x40, 0x0, 0xf8, 0x0, 0x0, 0x84, 0x8f, 0x0, 0x8, 0xff, 0x0, 0x4, 0xf4, 0x4f, 0xf8, 0xbf, 0x4f, 0xf8, 0xbf, 0x80, 0x4, 0x88, 0x80, 0x0, 0x88, 0x84, 0x0}
+
+/* ccedilla (231) */
+#define NXFONT_METRICS_231 {0, 8, 13, 0, 9, 1}
+#define NXFONT_BITMAP_231 {0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0xff, 0xb0, 0xb, 0xb0, 0x4, 0xf4, 0x4f, 0x40, 0x0, 0x84, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0xf8, 0xf, 0xb0, 0xb, 0xf0, 0x4, 0xff, 0xff, 0x40, 0x0, 0xb, 0xb0, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x0, 0xb8, 0xf4, 0x0}
+
+/* egrave (232) */
+#define NXFONT_METRICS_232 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_232 {0x0, 0xbf, 0x40, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x0, 0x0, 0x84, 0x0, 0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0x8f, 0xb0, 0xf, 0xb0, 0x0, 0xf8, 0x8f, 0x40, 0x0, 0x8f, 0x8f, 0x88, 0x88, 0xbf, 0x8f, 0x88, 0x88, 0x88, 0x8f, 0x0, 0x0, 0x48, 0xf, 0xb0, 0x0, 0xbb, 0x4, 0xfb, 0x8f, 0xb4, 0x0, 0x48, 0x88, 0x0}
+
+/* eacute (233) */
+#define NXFONT_METRICS_233 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_233 {0x0, 0x4, 0xfb, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0x8, 0x84, 0x0, 0x4, 0xfb, 0x8f, 0xb0, 0xf, 0xb0, 0x0, 0xf8, 0x8f, 0x40, 0x0, 0x8f, 0x8f, 0x88, 0x88, 0xbf, 0x8f, 0x88, 0x88, 0x88, 0x8f, 0x0, 0x0, 0x48, 0xf, 0xb0, 0x0, 0xbb, 0x4, 0xfb, 0x8f, 0xb4, 0x0, 0x48, 0x88, 0x0}
+
+/* ecircumflex (234) */
+#define NXFONT_METRICS_234 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_234 {0x0, 0x4, 0xb0, 0x0, 0x0, 0x4f, 0xbb, 0x0, 0x0, 0x84, 0x8, 0x40, 0x0, 0x8, 0x84, 0x0, 0x4, 0xfb, 0x8f, 0xb0, 0xf, 0xb0, 0x0, 0xf8, 0x8f, 0x40, 0x0, 0x8f, 0x8f, 0x88, 0x88, 0xbf, 0x8f, 0x88, 0x88, 0x88, 0x8f, 0x0, 0x0, 0x48, 0xf, 0xb0, 0x0, 0xbb, 0x4, 0xfb, 0x8f, 0xb4, 0x0, 0x8, 0x84, 0x0}
+
+/* edieresis (235) */
+#define NXFONT_METRICS_235 {0, 8, 12, 0, 7, 1}
+#define NXFONT_BITMAP_235 {0x0, 0xf8, 0xf, 0x80, 0x0, 0x84, 0x8, 0x40, 0x0, 0x8, 0x84, 0x0, 0x4, 0xfb, 0x8f, 0xb0, 0xf, 0xb0, 0x0, 0xf8, 0x8f, 0x40, 0x0, 0x8f, 0x8f, 0x88, 0x88, 0xbf, 0x8f, 0x88, 0x88, 0x88, 0x8f, 0x0, 0x0, 0x48, 0xf, 0xb0, 0x0, 0xbb, 0x4, 0xfb, 0x8f, 0xb4, 0x0, 0x8, 0x84, 0x0}
+
+/* igrave (236) */
+#define NXFONT_METRICS_236 {0, 4, 13, 0, 6, 1}
+#define NXFONT_BITMAP_236 {0xbf, 0x40, 0xb, 0xb0, 0x0, 0x84, 0x4, 0x80, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x8, 0xf0, 0x4, 0x80}
+
+/* iacute (237) */
+#define NXFONT_METRICS_237 {0, 4, 13, 1, 6, 1}
+#define NXFONT_BITMAP_237 {0xb, 0xf4, 0x4f, 0x40, 0x84, 0x0, 0x48, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x8f, 0x0, 0x48, 0x0}
+
+/* icircumflex (238) */
+#define NXFONT_METRICS_238 {0, 5, 13, 0, 6, 1}
+#define NXFONT_BITMAP_238 {0x4, 0xb0, 0x0, 0x4f, 0xbb, 0x0, 0x84, 0x8, 0x40, 0x4, 0x80, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x4, 0x80, 0x0}
+
+/* idieresis (239) */
+#define NXFONT_METRICS_239 {0, 5, 12, 0, 7, 1}
+#define NXFONT_BITMAP_239 {0x8f, 0xf, 0x80, 0x48, 0x8, 0x40, 0x4, 0x80, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x8, 0xf0, 0x0, 0x4, 0x80, 0x0}
+
+/* eth (240) */
+#define NXFONT_METRICS_240 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_240 {0xb, 0xf4, 0x4b, 0x0, 0x0, 0xbf, 0xf4, 0x0, 0x4, 0xfb, 0xf4, 0x0, 0x0, 0x48, 0xff, 0x40, 0x4, 0xff, 0xff, 0xf0, 0xf, 0xb0, 0x4, 0xf8, 0x4f, 0x40, 0x0, 0xbb, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0x4f, 0x40, 0x0, 0xbb, 0xf, 0xb0, 0x4, 0xf8, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x8, 0x84, 0x0}
+
+/* ntilde (241) */
+#define NXFONT_METRICS_241 {0, 7, 13, 1, 6, 1}
+#define NXFONT_BITMAP_241 {0x0, 0x84, 0x8, 0x0, 0xb, 0xff, 0xfb, 0x0, 0x8, 0x4, 0x80, 0x0, 0x0, 0x8, 0x80, 0x0, 0xfb, 0xff, 0xff, 0x40, 0xff, 0x40, 0xb, 0xf0, 0xfb, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0x84, 0x0, 0x4, 0x80}
+
+/* ograve (242) */
+#define NXFONT_METRICS_242 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_242 {0x0, 0xbf, 0x40, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x0, 0x0, 0x84, 0x0, 0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0xff, 0xb0, 0xf, 0xb0, 0x4, 0xf8, 0x4f, 0x40, 0x0, 0xbb, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0x4f, 0x40, 0x0, 0xbb, 0xf, 0xb0, 0x4, 0xf8, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x8, 0x84, 0x0}
+
+/* oacute (243) */
+#define NXFONT_METRICS_243 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_243 {0x0, 0x4, 0xfb, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0xff, 0xb0, 0xf, 0xb0, 0x4, 0xf8, 0x4f, 0x40, 0x0, 0xbb, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0x4f, 0x40, 0x0, 0xbb, 0xf, 0xb0, 0x4, 0xf8, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x8, 0x84, 0x0}
+
+/* ocircumflex (244) */
+#define NXFONT_METRICS_244 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_244 {0x0, 0x4, 0xb0, 0x0, 0x0, 0x4f, 0xbb, 0x0, 0x0, 0x84, 0x8, 0x40, 0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0xff, 0xb0, 0xf, 0xb0, 0x4, 0xf8, 0x4f, 0x40, 0x0, 0xbb, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0x4f, 0x40, 0x0, 0xbb, 0xf, 0xb0, 0x4, 0xf8, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x8, 0x84, 0x0}
+
+/* otilde (245) */
+#define NXFONT_METRICS_245 {0, 8, 13, 0, 6, 1}
+#define NXFONT_BITMAP_245 {0x0, 0x48, 0x4, 0x40, 0x4, 0xff, 0xff, 0x40, 0x4, 0x40, 0x84, 0x0, 0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0xff, 0xb0, 0xf, 0xb0, 0x4, 0xf8, 0x4f, 0x40, 0x0, 0xbb, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0x4f, 0x40, 0x0, 0xbb, 0xf, 0xb0, 0x4, 0xf8, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x8, 0x84, 0x0}
+
+/* odieresis (246) */
+#define NXFONT_METRICS_246 {0, 8, 12, 0, 7, 1}
+#define NXFONT_BITMAP_246 {0x0, 0xf8, 0xf, 0x80, 0x0, 0x84, 0x8, 0x40, 0x0, 0x8, 0x84, 0x0, 0x4, 0xff, 0xff, 0xb0, 0xf, 0xb0, 0x4, 0xf8, 0x4f, 0x40, 0x0, 0xbb, 0x8f, 0x0, 0x0, 0x8f, 0x8f, 0x0, 0x0, 0x8f, 0x4f, 0x40, 0x0, 0xbb, 0xf, 0xb0, 0x4, 0xf8, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x8, 0x84, 0x0}
+
+/* divide (247) */
+#define NXFONT_METRICS_247 {0, 8, 8, 1, 10, 1}
+#define NXFONT_BITMAP_247 {0x0, 0x8, 0x40, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0x88, 0x88, 0x84, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x40, 0x0, 0x0, 0xf, 0x80, 0x0}
+
+/* oslash (248) */
+#define NXFONT_METRICS_248 {0, 8, 10, 1, 9, 1}
+#define NXFONT_BITMAP_248 {0x0, 0x48, 0x80, 0x8, 0xb, 0xff, 0xff, 0xb4, 0x8f, 0x40, 0x4b, 0xb0, 0xbb, 0x0, 0x4b, 0xf4, 0xf8, 0x4, 0xb0, 0xf8, 0xf8, 0x4b, 0x0, 0xf8, 0xbb, 0xb0, 0x4, 0xf4, 0x4f, 0x40, 0xb, 0xf0, 0xbb, 0xff, 0xff, 0x40, 0x40, 0x48, 0x80, 0x0}
+
+/* ugrave (249) */
+#define NXFONT_METRICS_249 {0, 7, 13, 1, 6, 1}
+#define NXFONT_BITMAP_249 {0x4, 0xfb, 0x0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x4, 0x80, 0x0, 0x84, 0x0, 0x4, 0x80, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0xb, 0xf0, 0xfb, 0x0, 0x8f, 0xf0, 0x4f, 0xff, 0xfb, 0xf0, 0x0, 0x88, 0x0, 0x0}
+
+/* uacute (250) */
+#define NXFONT_METRICS_250 {0, 7, 13, 1, 6, 1}
+#define NXFONT_BITMAP_250 {0x0, 0xb, 0xf4, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x84, 0x0, 0x0, 0x84, 0x0, 0x4, 0x80, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0xb, 0xf0, 0xfb, 0x0, 0x8f, 0xf0, 0x4f, 0xff, 0xfb, 0xf0, 0x0, 0x88, 0x0, 0x0}
+
+/* ucircumflex (251) */
+#define NXFONT_METRICS_251 {0, 7, 13, 1, 6, 1}
+#define NXFONT_BITMAP_251 {0x0, 0xb, 0x40, 0x0, 0x0, 0xbb, 0xf4, 0x0, 0x4, 0x80, 0x48, 0x0, 0x84, 0x0, 0x4, 0x80, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0xb, 0xf0, 0xfb, 0x0, 0x8f, 0xf0, 0x4f, 0xff, 0xfb, 0xf0, 0x0, 0x88, 0x0, 0x0}
+
+/* udieresis (252) */
+#define NXFONT_METRICS_252 {0, 7, 12, 1, 7, 1}
+#define NXFONT_BITMAP_252 {0x8, 0xf0, 0xf8, 0x0, 0x4, 0x80, 0x84, 0x0, 0x84, 0x0, 0x4, 0x80, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0xb, 0xf0, 0xfb, 0x0, 0x8f, 0xf0, 0x4f, 0xff, 0xfb, 0xf0, 0x0, 0x88, 0x0, 0x0}
+
+/* yacute (253) */
+#define NXFONT_METRICS_253 {0, 8, 16, 0, 6, 1}
+#define NXFONT_BITMAP_253 {0x0, 0x0, 0xbf, 0x40, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x8, 0x40, 0x0, 0x48, 0x0, 0x0, 0x84, 0x8f, 0x0, 0x4, 0xf8, 0xf, 0x80, 0x8, 0xf0, 0xf, 0xb0, 0xb, 0xb0, 0x8, 0xf0, 0x4f, 0x80, 0x4, 0xf8, 0x8f, 0x0, 0x0, 0xf8, 0xf8, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0xf, 0xb4, 0x0, 0x0}
+
+/* thorn (254) */
+#define NXFONT_METRICS_254 {0, 8, 16, 1, 6, 1}
+#define NXFONT_BITMAP_254 {0xf8, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0xf8, 0x48, 0x84, 0x0, 0xfb, 0xff, 0xff, 0x40, 0xff, 0x40, 0xb, 0xf0, 0xfb, 0x0, 0x4, 0xf8, 0xf8, 0x0, 0x0, 0xf8, 0xf8, 0x0, 0x0, 0xf8, 0xfb, 0x0, 0x4, 0xf4, 0xff, 0x40, 0xb, 0xf0, 0xfb, 0xff, 0xff, 0x40, 0xf8, 0x8, 0x80, 0x0, 0xf8, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x84, 0x0, 0x0, 0x0}
+
+/* ydieresis (255) */
+#define NXFONT_METRICS_255 {0, 8, 15, 0, 7, 1}
+#define NXFONT_BITMAP_255 {0x0, 0xf8, 0xf, 0x80, 0x0, 0x84, 0x8, 0x40, 0x48, 0x0, 0x0, 0x84, 0x8f, 0x0, 0x4, 0xf8, 0xf, 0x80, 0x8, 0xf0, 0xf, 0xb0, 0xf, 0xb0, 0x8, 0xf0, 0x4f, 0x80, 0x4, 0xf8, 0x8f, 0x0, 0x0, 0xf8, 0xf8, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0xf, 0xb4, 0x0, 0x0}
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* __GRAPHICS_NXFONTS_NXFONTS_SANS20X24AA_H */
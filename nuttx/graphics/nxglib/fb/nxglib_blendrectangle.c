@@ -0,0 +1,164 @@
+/****************************************************************************
+ * graphics/nxglib/fb/nxglib_blendrectangle.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+
+#include <nuttx/fb.h>
+#include <nuttx/nx/nxglib.h>
+
+#include "nxglib_bitblit.h"
+#include "nxglib_blendrun.h"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxgl_blendrectangle_*bpp
+ *
+ * Descripton:
+ *   Alpha-blend a rectangular image or a solid color into the specific
+ *   position in the framebuffer memory.
+ *
+ ****************************************************************************/
+
+void NXGL_FUNCNAME(nxgl_blendrectangle,NXGLIB_SUFFIX)
+(FAR struct fb_planeinfo_s *pinfo, FAR const struct nxgl_rect_s *dest,
+ FAR const struct nxgl_blend_s *blend, FAR const struct nxgl_point_s *origin)
+{
+  FAR const uint8_t *sline = NULL;
+  FAR const uint8_t *aline = NULL;
+  FAR uint8_t *dline;
+  unsigned int width;
+  unsigned int deststride;
+  unsigned int rows;
+  nxgl_coord_t xoffset;
+  nxgl_coord_t yoffset;
+
+  /* A constant, fully transparent blend changes nothing */
+
+  if (!blend->alpha && blend->opacity == 0)
+    {
+      return;
+    }
+
+  /* Get the width of the framebuffer in bytes */
+
+  deststride = pinfo->stride;
+
+  /* Get the dimensions of the rectange to blend: width in pixels,
+   * height in rows
+   */
+
+  width   = dest->pt2.x - dest->pt1.x + 1;
+  rows    = dest->pt2.y - dest->pt1.y + 1;
+
+  /* Get the position of the rectangle in the source image and alpha map */
+
+  xoffset = dest->pt1.x - origin->x;
+  yoffset = dest->pt1.y - origin->y;
+
+  if (blend->image)
+    {
+      sline = (FAR const uint8_t*)blend->image + NXGL_SCALEX(xoffset) +
+              yoffset * blend->stride;
+    }
+
+  if (blend->alpha)
+    {
+      aline = blend->alpha + xoffset + yoffset * blend->astride;
+    }
+
+  dline = pinfo->fbmem + dest->pt1.y * deststride + NXGL_SCALEX(dest->pt1.x);
+
+  while (rows--)
+    {
+      if (!aline && blend->opacity == 255)
+        {
+          /* Fully opaque:  This is just a copy or a fill */
+
+          if (sline)
+            {
+              NXGL_MEMCPY(dline, sline, width);
+            }
+          else
+            {
+              NXGL_MEMSET(dline, (NXGL_PIXEL_T)blend->color, width);
+            }
+        }
+      else
+        {
+          NXGL_FUNCNAME(nxgl_blendrun,NXGLIB_SUFFIX)
+            (dline, sline, blend->color, aline, blend->opacity, width);
+        }
+
+      dline += deststride;
+      if (sline)
+        {
+          sline += blend->stride;
+        }
+
+      if (aline)
+        {
+          aline += blend->astride;
+        }
+    }
+}
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxglib/fb/nxglib_filltrapezoid.c
  *
- *   Copyright (C) 2008-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -262,7 +262,7 @@ void NXGL_FUNCNAME(nxgl_filltrapezoid,NXGLIB_SUFFIX)(
 
           if (lnlen > 0)
             {
-              NXGL_MEMSET(dest, (NXGL_PIXEL_T)color, lnlen);
+              NXGL_MEMSET(dest, mpixel, lnlen);
             }
 
 #else
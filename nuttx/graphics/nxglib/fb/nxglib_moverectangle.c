@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxglib/fb/nxglib_moverectangle.c
  *
- *   Copyright (C) 2008-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -193,8 +193,7 @@ void NXGL_FUNCNAME(nxgl_moverectangle,NXGLIB_SUFFIX)
    * source in framebuffer memory.
    */
 
-  if (offset->y < rect->pt1.y ||
-     (offset->y < rect->pt1.y && offset->x <= rect->pt1.x))
+  if (offset->y < rect->pt1.y)
     {
       /* Yes.. Copy the rectangle from top down (i.e., adding the stride
        * to move to the next, lower row) */
@@ -215,8 +214,26 @@ void NXGL_FUNCNAME(nxgl_moverectangle,NXGLIB_SUFFIX)
         }
     }
 
-  /* Case 2: No.. the destination position is above (or to the left of)
-   * the displayed source position
+#if NXGLIB_BITSPERPIXEL >= 8
+  /* Case 2: The source and destination lie on the same rows.  Each source
+   * row may then overlap its own destination row so the row copies must
+   * be overlap-safe.
+   */
+
+  else if (offset->y == rect->pt1.y)
+    {
+      while (rows--)
+        {
+          NXGL_MEMMOVE(dline, sline, width);
+
+          dline += stride;
+          sline += stride;
+        }
+    }
+#endif
+
+  /* Case 3: No.. the destination position is below the displayed source
+   * position
    */
 
   else
@@ -0,0 +1,217 @@
+/****************************************************************************
+ * graphics/nxglib/lcd/nxglib_blendrectangle.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+
+#include <nuttx/lcd/lcd.h>
+#include <nuttx/nx/nxglib.h>
+
+#include "nxglib_bitblit.h"
+#include "nxglib_blendrun.h"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxgl_blendrectangle_*bpp
+ *
+ * Descripton:
+ *   Alpha-blend a rectangular image or a solid color into the specific
+ *   position on the LCD.  Each row is read from the LCD into the run
+ *   buffer, blended, and written back.  If the LCD cannot be read
+ *   (CONFIG_NX_WRITEONLY), then only the runs of pixels that are more
+ *   opaque than transparent are written.
+ *
+ ****************************************************************************/
+
+void NXGL_FUNCNAME(nxgl_blendrectangle,NXGLIB_SUFFIX)
+(FAR struct lcd_planeinfo_s *pinfo, FAR const struct nxgl_rect_s *dest,
+ FAR const struct nxgl_blend_s *blend, FAR const struct nxgl_point_s *origin)
+{
+  FAR const uint8_t *sline = NULL;
+  FAR const uint8_t *aline = NULL;
+  unsigned int ncols;
+  unsigned int row;
+  nxgl_coord_t xoffset;
+  nxgl_coord_t yoffset;
+#ifdef CONFIG_NX_WRITEONLY
+  unsigned int start;
+  unsigned int col;
+#endif
+
+  /* A constant, fully transparent blend changes nothing */
+
+  if (!blend->alpha && blend->opacity == 0)
+    {
+      return;
+    }
+
+  /* Get the dimensions of the rectange to blend: width in pixels */
+
+  ncols   = dest->pt2.x - dest->pt1.x + 1;
+
+  /* Get the position of the rectangle in the source image and alpha map */
+
+  xoffset = dest->pt1.x - origin->x;
+  yoffset = dest->pt1.y - origin->y;
+
+  if (blend->image)
+    {
+      sline = (FAR const uint8_t*)blend->image + NXGL_SCALEX(xoffset) +
+              yoffset * blend->stride;
+    }
+
+  if (blend->alpha)
+    {
+      aline = blend->alpha + xoffset + yoffset * blend->astride;
+    }
+
+  /* Blend the image, one row at a time */
+
+  for (row = dest->pt1.y; row <= dest->pt2.y; row++)
+    {
+      if (!aline && blend->opacity == 255 && sline)
+        {
+          /* Fully opaque image data can be written directly from the image
+           * memory.
+           */
+
+          (void)pinfo->putrun(row, dest->pt1.x, sline, ncols);
+        }
+      else
+#ifndef CONFIG_NX_WRITEONLY
+        {
+          /* Read the run from the LCD (unless every pixel will be replaced),
+           * blend, and write it back.
+           */
+
+          if (aline || blend->opacity != 255)
+            {
+              (void)pinfo->getrun(row, dest->pt1.x, pinfo->buffer, ncols);
+            }
+
+          NXGL_FUNCNAME(nxgl_blendrun,NXGLIB_SUFFIX)
+            (pinfo->buffer, sline, blend->color, aline, blend->opacity,
+             ncols);
+
+          (void)pinfo->putrun(row, dest->pt1.x, pinfo->buffer, ncols);
+        }
+#else
+        {
+          /* The background cannot be read back.  Write each run of pixels
+           * whose alpha is at or above the threshold with the opaque source
+           * pixels; leave the rest untouched.
+           */
+
+          for (col = 0; col < ncols; )
+            {
+              while (col < ncols &&
+                     (aline ? nxgl_mulalpha(aline[col], blend->opacity) :
+                              blend->opacity) < NXGL_ALPHA_THRESHOLD)
+                {
+                  col++;
+                }
+
+              start = col;
+              while (col < ncols &&
+                     (aline ? nxgl_mulalpha(aline[col], blend->opacity) :
+                              blend->opacity) >= NXGL_ALPHA_THRESHOLD)
+                {
+                  col++;
+                }
+
+              if (col > start)
+                {
+                  if (sline)
+                    {
+                      (void)pinfo->putrun(row, dest->pt1.x + start,
+                                          sline + NXGL_SCALEX(start),
+                                          col - start);
+                    }
+                  else
+                    {
+                      NXGL_FUNCNAME(nxgl_blendrun,NXGLIB_SUFFIX)
+                        (pinfo->buffer, NULL, blend->color, NULL, 255,
+                         col - start);
+                      (void)pinfo->putrun(row, dest->pt1.x + start,
+                                          pinfo->buffer, col - start);
+                    }
+                }
+            }
+        }
+#endif
+
+      /* Then adjust the source pointers to refer to the next line in the
+       * source image and alpha map.
+       */
+
+      if (sline)
+        {
+          sline += blend->stride;
+        }
+
+      if (aline)
+        {
+          aline += blend->astride;
+        }
+    }
+}
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxglib/lcd/nxsglib_copyrectangle.c
  *
- *   Copyright (C) 2010-2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2010-2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -108,6 +108,21 @@ void NXGL_FUNCNAME(nxgl_copyrectangle,NXGLIB_SUFFIX)
   remainder = NXGL_REMAINDERX(xoffset);
 #endif
 
+  /* Let the LCD take the whole image at once, if it can.  The rows of the
+   * image must begin on byte boundaries.
+   */
+
+#if NXGLIB_BITSPERPIXEL < 8
+  if (remainder == 0 && pinfo->putarea &&
+#else
+  if (pinfo->putarea &&
+#endif
+      pinfo->putarea(dest->pt1.y, dest->pt1.x, dest->pt2.y - dest->pt1.y + 1,
+                     ncols, sline, srcstride) == OK)
+    {
+      return;
+    }
+
   /* Copy the image, one row at a time */
 
   for (row = dest->pt1.y; row <= dest->pt2.y; row++)
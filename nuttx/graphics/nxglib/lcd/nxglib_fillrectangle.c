@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxglib/lcd/nxglib_fillrectangle.c
  *
- *   Copyright (C) 2010-2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2010-2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -96,6 +96,15 @@ void NXGL_FUNCNAME(nxgl_fillrectangle,NXGLIB_SUFFIX)
 
   ncols  = rect->pt2.x - rect->pt1.x + 1;
 
+  /* Let the LCD fill the whole rectangle at once, if it can */
+
+  if (pinfo->fillarea &&
+      pinfo->fillarea(rect->pt1.y, rect->pt1.x, rect->pt2.y - rect->pt1.y + 1,
+                      ncols, (uint32_t)color) == OK)
+    {
+      return;
+    }
+
   /* Fill the run buffer with the selected color */
 
   NXGL_FUNCNAME(nxgl_fillrun,NXGLIB_SUFFIX)((NXGLIB_RUNTYPE*)pinfo->buffer, color, ncols);
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxglib/nxglib_bitblit.h
  *
- *   Copyright (C) 2008-2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -43,6 +43,7 @@
 #include <nuttx/config.h>
 
 #include <stdint.h>
+#include <string.h>
 
 #include <nuttx/nx/nxglib.h>
 
@@ -108,73 +109,40 @@
 #  define NXGL_REMAINDERX(x)       ((x) & NXGL_PIXELMASK)
 #  define NXGL_ALIGNDOWN(x)        ((x) & ~NXGL_PIXELMASK)
 #  define NXGL_ALIGNUP(x)          (((x) + NXGL_PIXELMASK) & ~NXGL_PIXELMASK)
+#endif
 
-#  define NXGL_MEMSET(dest,value,width) \
-   { \
-     FAR uint8_t *_ptr = (FAR uint8_t*)(dest); \
-     int        _nby = NXGL_SCALEX(width); \
-     while (_nby--) \
-       { \
-         *_ptr++ = (value); \
-       } \
-   }
-#  define NXGL_MEMCPY(dest,src,width) \
-   { \
-     FAR uint8_t *_dptr = (FAR uint8_t*)(dest); \
-     FAR uint8_t *_sptr = (FAR uint8_t*)(src); \
-     int        _nby  = NXGL_SCALEX(width); \
-     while (_nby--) \
-       { \
-         *_dptr++ = *_sptr++; \
-       } \
-   }
+/* 64-bit fills require long long support from the toolchain */
+
+#ifndef CONFIG_HAVE_LONG_LONG
+#  undef CONFIG_NX_FILL64BIT
+#endif
+
+/* Raster operations on a single row.  Copies and moves are simply byte
+ * counts handed to the C library (which may be optimized for the
+ * architecture).  Fills at 8-bits per pixel or less are handled by
+ * memset(); wider fills are performed a full word at a time by the inline
+ * functions below.
+ */
 
+#if NXGLIB_BITSPERPIXEL <= 8
+#  define NXGL_MEMSET(dest,value,width) \
+     memset((dest), (uint8_t)(value), NXGL_SCALEX(width))
+#elif NXGLIB_BITSPERPIXEL == 16
+#  define NXGL_MEMSET(dest,value,width) \
+     nxgl_fill16((FAR uint8_t*)(dest), (uint16_t)(value), (width))
 #elif NXGLIB_BITSPERPIXEL == 24
 #  define NXGL_MEMSET(dest,value,width) \
-   { \
-     FAR uint8_t *_ptr  = (FAR uint8_t*)(dest); \
-     nxgl_coord_t _npix = (width); \
-     while (_npix--) \
-       { \
-         *_ptr++ = (value); \
-         *_ptr++ = (value) >> 8; \
-         *_ptr++ = (value) >> 16; \
-       } \
-   }
-#  define NXGL_MEMCPY(dest,src,width) \
-   { \
-     FAR uint8_t *_dptr = (FAR uint8_t*)(dest); \
-     FAR uint8_t *_sptr = (FAR uint8_t*)(src); \
-     nxgl_coord_t _npix = (width); \
-     while (_npix--) \
-       { \
-         *_dptr++ = *_sptr++; \
-         *_dptr++ = *_sptr++; \
-         *_dptr++ = *_sptr++; \
-       } \
-   }
+     nxgl_fill24((FAR uint8_t*)(dest), (uint32_t)(value), (width))
 #else
 #  define NXGL_MEMSET(dest,value,width) \
-   { \
-     FAR NXGL_PIXEL_T *_ptr = (FAR NXGL_PIXEL_T*)(dest); \
-     nxgl_coord_t     _npix = (width); \
-     while (_npix--) \
-       { \
-         *_ptr++ = (value); \
-       } \
-   }
-#  define NXGL_MEMCPY(dest,src,width) \
-   { \
-     FAR NXGL_PIXEL_T *_dptr = (FAR NXGL_PIXEL_T*)(dest); \
-     FAR NXGL_PIXEL_T *_sptr = (FAR NXGL_PIXEL_T*)(src); \
-     nxgl_coord_t      _npix = (width); \
-     while (_npix--) \
-       { \
-         *_dptr++ = *_sptr++; \
-       } \
-   }
+     nxgl_fill32((FAR uint8_t*)(dest), (uint32_t)(value), (width))
 #endif
 
+#define NXGL_MEMCPY(dest,src,width) \
+   memcpy((dest), (src), NXGL_SCALEX(width))
+#define NXGL_MEMMOVE(dest,src,width) \
+   memmove((dest), (src), NXGL_SCALEX(width))
+
 /* Form a function name by concatenating two strings */
 
 #define _NXGL_FUNCNAME(a,b) a ## b
@@ -188,6 +156,221 @@
  * Public Data
  ****************************************************************************/
 
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxgl_fill16
+ *
+ * Description:
+ *   Fill a run of 16-bit pixels.  A leading pixel is written if necessary
+ *   to align the destination; the remainder of the run is then written two
+ *   (or, with CONFIG_NX_FILL64BIT, four) pixels at a time.
+ *
+ ****************************************************************************/
+
+#if NXGLIB_BITSPERPIXEL == 16
+static inline void nxgl_fill16(FAR uint8_t *dest, uint16_t color,
+                               unsigned int npixels)
+{
+  FAR uint32_t *dptr;
+  uint32_t color32;
+
+  if (npixels > 0 && ((uintptr_t)dest & 2) != 0)
+    {
+      *(FAR uint16_t *)dest = color;
+      dest += 2;
+      npixels--;
+    }
+
+  color32 = (uint32_t)color << 16 | color;
+  dptr    = (FAR uint32_t *)dest;
+
+#ifdef CONFIG_NX_FILL64BIT
+  if (npixels >= 2 && ((uintptr_t)dptr & 4) != 0)
+    {
+      *dptr++  = color32;
+      npixels -= 2;
+    }
+
+  if (npixels >= 4)
+    {
+      FAR uint64_t *dptr64 = (FAR uint64_t *)dptr;
+      uint64_t color64 = (uint64_t)color32 << 32 | color32;
+
+      for (; npixels >= 16; npixels -= 16)
+        {
+          dptr64[0] = color64;
+          dptr64[1] = color64;
+          dptr64[2] = color64;
+          dptr64[3] = color64;
+          dptr64   += 4;
+        }
+
+      for (; npixels >= 4; npixels -= 4)
+        {
+          *dptr64++ = color64;
+        }
+
+      dptr = (FAR uint32_t *)dptr64;
+    }
+#else
+  for (; npixels >= 8; npixels -= 8)
+    {
+      dptr[0] = color32;
+      dptr[1] = color32;
+      dptr[2] = color32;
+      dptr[3] = color32;
+      dptr   += 4;
+    }
+#endif
+
+  for (; npixels >= 2; npixels -= 2)
+    {
+      *dptr++ = color32;
+    }
+
+  if (npixels > 0)
+    {
+      *(FAR uint16_t *)dptr = color;
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: nxgl_fill24
+ *
+ * Description:
+ *   Fill a run of packed, 24-bit pixels.  Up to three leading pixels are
+ *   written a byte at a time to word-align the destination.  Four pixels
+ *   then occupy exactly three words so the remainder of the run is written
+ *   by repeating a three word pattern.
+ *
+ ****************************************************************************/
+
+#if NXGLIB_BITSPERPIXEL == 24
+static inline void nxgl_fill24(FAR uint8_t *dest, uint32_t color,
+                               unsigned int npixels)
+{
+  uint8_t pattern[12];
+  uint32_t word0;
+  uint32_t word1;
+  uint32_t word2;
+  FAR uint32_t *dptr;
+  int i;
+
+  /* Write pixels byte-by-byte until the destination is word aligned */
+
+  for (; npixels > 0 && ((uintptr_t)dest & 3) != 0; npixels--)
+    {
+      *dest++ = (uint8_t)color;
+      *dest++ = (uint8_t)(color >> 8);
+      *dest++ = (uint8_t)(color >> 16);
+    }
+
+  if (npixels >= 4)
+    {
+      /* Build the byte pattern of four pixels and load it as three words.
+       * Doing this with memcpy() keeps the pattern independent of the
+       * endian-ness of the CPU.
+       */
+
+      for (i = 0; i < 12; i += 3)
+        {
+          pattern[i]     = (uint8_t)color;
+          pattern[i + 1] = (uint8_t)(color >> 8);
+          pattern[i + 2] = (uint8_t)(color >> 16);
+        }
+
+      memcpy(&word0, &pattern[0], 4);
+      memcpy(&word1, &pattern[4], 4);
+      memcpy(&word2, &pattern[8], 4);
+
+      dptr = (FAR uint32_t *)dest;
+      for (; npixels >= 4; npixels -= 4)
+        {
+          dptr[0] = word0;
+          dptr[1] = word1;
+          dptr[2] = word2;
+          dptr   += 3;
+        }
+
+      dest = (FAR uint8_t *)dptr;
+    }
+
+  /* Then any trailing pixels */
+
+  for (; npixels > 0; npixels--)
+    {
+      *dest++ = (uint8_t)color;
+      *dest++ = (uint8_t)(color >> 8);
+      *dest++ = (uint8_t)(color >> 16);
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: nxgl_fill32
+ *
+ * Description:
+ *   Fill a run of 32-bit pixels (this is also used for the unpacked, 24-bit
+ *   LCD run buffer).
+ *
+ ****************************************************************************/
+
+#if NXGLIB_BITSPERPIXEL >= 24
+static inline void nxgl_fill32(FAR uint8_t *dest, uint32_t color,
+                               unsigned int npixels)
+{
+  FAR uint32_t *dptr = (FAR uint32_t *)dest;
+
+#ifdef CONFIG_NX_FILL64BIT
+  if (npixels > 0 && ((uintptr_t)dptr & 4) != 0)
+    {
+      *dptr++ = color;
+      npixels--;
+    }
+
+  if (npixels >= 2)
+    {
+      FAR uint64_t *dptr64 = (FAR uint64_t *)dptr;
+      uint64_t color64 = (uint64_t)color << 32 | color;
+
+      for (; npixels >= 8; npixels -= 8)
+        {
+          dptr64[0] = color64;
+          dptr64[1] = color64;
+          dptr64[2] = color64;
+          dptr64[3] = color64;
+          dptr64   += 4;
+        }
+
+      for (; npixels >= 2; npixels -= 2)
+        {
+          *dptr64++ = color64;
+        }
+
+      dptr = (FAR uint32_t *)dptr64;
+    }
+#else
+  for (; npixels >= 4; npixels -= 4)
+    {
+      dptr[0] = color;
+      dptr[1] = color;
+      dptr[2] = color;
+      dptr[3] = color;
+      dptr   += 4;
+    }
+#endif
+
+  for (; npixels > 0; npixels--)
+    {
+      *dptr++ = color;
+    }
+}
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 #define EXTERN extern "C"
@@ -0,0 +1,190 @@
+/****************************************************************************
+ * graphics/nxglib/nxglib_blendrun.h
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __GRAPHICS_NXGLIB_NXGLIB_BLENDRUN_H
+#define __GRAPHICS_NXGLIB_NXGLIB_BLENDRUN_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#include <stdint.h>
+
+#include <nuttx/nx/nxglib.h>
+
+#include "nxglib_bitblit.h"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+#if NXGLIB_BITSPERPIXEL < 8
+#  error "Alpha blending is not supported below 8 bits per pixel"
+#endif
+
+/* Access one pixel of a run.  24-bit pixels are packed three bytes per
+ * pixel, least significant byte first, and may not be aligned.
+ */
+
+#if NXGLIB_BITSPERPIXEL == 24
+#  define NXGL_GETPIXEL(p) \
+     ((uint32_t)(p)[0] | ((uint32_t)(p)[1] << 8) | ((uint32_t)(p)[2] << 16))
+#  define NXGL_PUTPIXEL(p,v) \
+     do { \
+       (p)[0] = (uint8_t)(v); \
+       (p)[1] = (uint8_t)((v) >> 8); \
+       (p)[2] = (uint8_t)((v) >> 16); \
+     } while (0)
+#else
+#  define NXGL_GETPIXEL(p)   ((uint32_t)*(FAR const NXGL_PIXEL_T *)(p))
+#  define NXGL_PUTPIXEL(p,v) (*(FAR NXGL_PIXEL_T *)(p) = (NXGL_PIXEL_T)(v))
+#endif
+
+/* At 8bpp there are no color components to blend:  A pixel is either
+ * drawn or not, depending on which side of this threshold its alpha is.
+ */
+
+#define NXGL_ALPHA_THRESHOLD 128
+
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxgl_mulalpha
+ *
+ * Description:
+ *   Return a * b / 255, correctly rounded, for 8-bit alpha values.
+ *
+ ****************************************************************************/
+
+static inline uint8_t nxgl_mulalpha(uint8_t a, uint8_t b)
+{
+  uint32_t t = (uint32_t)a * b + 128;
+  return (uint8_t)((t + (t >> 8)) >> 8);
+}
+
+/****************************************************************************
+ * Name: nxgl_blendpixel
+ *
+ * Description:
+ *   Blend the source pixel spixel over the destination pixel dpixel with
+ *   the alpha value 1 <= alpha <= 254.  The color components are blended
+ *   in parallel:  The 16-bit RGB565 pixel is spread out so that there is
+ *   room for the (rounded) products between the components.  For 24 and 32-bit RGB
+ *   pixels, red and blue are blended together and then green.  The upper
+ *   byte of a 32-bit pixel is not blended and is preserved.
+ *
+ ****************************************************************************/
+
+static inline uint32_t nxgl_blendpixel(uint32_t dpixel, uint32_t spixel,
+                                       uint8_t alpha)
+{
+#if NXGLIB_BITSPERPIXEL == 8
+  return alpha >= NXGL_ALPHA_THRESHOLD ? spixel : dpixel;
+
+#elif NXGLIB_BITSPERPIXEL == 16
+  uint32_t a5 = ((uint32_t)alpha + 4) >> 3;
+
+  dpixel = (dpixel | (dpixel << 16)) & 0x07e0f81f;
+  spixel = (spixel | (spixel << 16)) & 0x07e0f81f;
+  dpixel = ((spixel * a5 + dpixel * (32 - a5) + 0x02008010) >> 5) & 0x07e0f81f;
+  return (dpixel | (dpixel >> 16)) & 0xffff;
+
+#else
+  uint32_t a8 = (uint32_t)alpha + (alpha >> 7);
+  uint32_t rb;
+  uint32_t g;
+
+  rb = (((spixel & 0x00ff00ff) * a8 +
+         (dpixel & 0x00ff00ff) * (256 - a8) + 0x00800080) >> 8) & 0x00ff00ff;
+  g  = (((spixel & 0x0000ff00) * a8 +
+         (dpixel & 0x0000ff00) * (256 - a8) + 0x00008000) >> 8) & 0x0000ff00;
+  return (dpixel & 0xff000000) | rb | g;
+#endif
+}
+
+/****************************************************************************
+ * Name: nxgl_blendrun_*bpp
+ *
+ * Description:
+ *   Blend one run of npixels pixels into the run at dest.  The source
+ *   pixels are taken from src or, if src is NULL, are all the solid color.
+ *   The alpha of each pixel is opacity or, if there is an alpha map, the
+ *   product of opacity and the alpha map value.  Fully transparent pixels
+ *   are skipped and fully opaque pixels are written without reading the
+ *   destination.
+ *
+ ****************************************************************************/
+
+static inline void
+NXGL_FUNCNAME(nxgl_blendrun,NXGLIB_SUFFIX)(FAR uint8_t *dest,
+                                           FAR const uint8_t *src,
+                                           nxgl_mxpixel_t color,
+                                           FAR const uint8_t *alpha,
+                                           uint8_t opacity,
+                                           unsigned int npixels)
+{
+  uint32_t spixel = color;
+  uint8_t  a      = opacity;
+
+  for (; npixels > 0; npixels--)
+    {
+      if (alpha)
+        {
+          a = nxgl_mulalpha(*alpha++, opacity);
+        }
+
+      if (src)
+        {
+          spixel = NXGL_GETPIXEL(src);
+          src   += NXGL_SCALEX(1);
+        }
+
+      if (a == 255)
+        {
+          NXGL_PUTPIXEL(dest, spixel);
+        }
+      else if (a != 0)
+        {
+          NXGL_PUTPIXEL(dest, nxgl_blendpixel(NXGL_GETPIXEL(dest), spixel, a));
+        }
+
+      dest += NXGL_SCALEX(1);
+    }
+}
+
+#endif /* __GRAPHICS_NXGLIB_NXGLIB_BLENDRUN_H */
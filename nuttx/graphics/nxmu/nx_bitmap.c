@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxmu/nx_bitmap.c
  *
- *   Copyright (C) 2008-2009, 2011-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2011-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -88,6 +88,11 @@
  *            may lie outside of the display.
  *   stride - The width of the full source image in pixels.
  *
+ *   Normally, this function does not return until the image has been
+ *   copied.  Between nx_beginbatch() and nx_endbatch(), it returns
+ *   immediately and the source image must remain valid until
+ *   nx_endbatch() returns.
+ *
  * Return:
  *   OK on success; ERROR on failure with errno set appropriately
  *
@@ -126,7 +131,19 @@ int nx_bitmap(NXWINDOW hwnd, FAR const struct nxgl_rect_s *dest,
   outmsg.origin.y   = origin->y;
   nxgl_rectcopy(&outmsg.dest, dest);
 
-  
+#ifdef CONFIG_NX_CMDRING
+  /* In batch mode, the command is added to the command ring and this
+   * function does not wait for it to complete.  The caller must keep the
+   * source image intact until nx_endbatch() returns.
+   */
+
+  if (wnd->conn->batch)
+    {
+      outmsg.sem_done = NULL;
+      return nxmu_sendwindow(wnd, &outmsg, sizeof(struct nxsvrmsg_bitmap_s));
+    }
+#endif
+
   /* Create a semaphore for tracking command completion */
 
   outmsg.sem_done = &sem_done;
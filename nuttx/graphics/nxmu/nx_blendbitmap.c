@@ -0,0 +1,158 @@
+/****************************************************************************
+ * graphics/nxmu/nx_blendbitmap.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/nx/nx.h>
+
+#include "nxbe.h"
+#include "nxfe.h"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+/****************************************************************************
+ * Name: nx_blendbitmap
+ *
+ * Description:
+ *   Alpha-blend a rectangular region of a larger image, or a solid color,
+ *   into the rectangle in the specified window.
+ *
+ * Input Parameters:
+ *   hwnd   - The window that will receive the blended image
+ *   dest   - Describes the rectangular region on the display that will
+ *            receive the blended image.
+ *   blend  - The source image or color, the alpha map, and the opacity.
+ *            This is an array of size CONFIG_NX_NPLANES.
+ *   origin - The origin of the upper, left-most corner of the full image
+ *            and alpha map.  Both dest and origin are in window
+ *            coordinates, however, origin may lie outside of the display.
+ *
+ * Return:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+int nx_blendbitmap(NXWINDOW hwnd, FAR const struct nxgl_rect_s *dest,
+                   FAR const struct nxgl_blend_s blend[CONFIG_NX_NPLANES],
+                   FAR const struct nxgl_point_s *origin)
+{
+  FAR struct nxbe_window_s *wnd = (FAR struct nxbe_window_s *)hwnd;
+  struct nxsvrmsg_blend_s outmsg;
+  int ret;
+  sem_t sem_done;
+
+#ifdef CONFIG_DEBUG
+  if (!wnd || !dest || !blend || !origin)
+    {
+      errno = EINVAL;
+      return ERROR;
+    }
+#endif
+
+  /* Blending is not supported at all color resolutions */
+
+  if (!wnd->be->plane[0].blendrectangle)
+    {
+      errno = ENOSYS;
+      return ERROR;
+    }
+
+  /* Format the blend command.  The blend descriptions are not copied into
+   * the message; they must remain valid until the server is done with them.
+   */
+
+  outmsg.msgid      = NX_SVRMSG_BLEND;
+  outmsg.wnd        = wnd;
+  outmsg.blend      = blend;
+  outmsg.origin.x   = origin->x;
+  outmsg.origin.y   = origin->y;
+  nxgl_rectcopy(&outmsg.dest, dest);
+
+  /* Create a semaphore for tracking command completion */
+
+  outmsg.sem_done = &sem_done;
+  ret = sem_init(&sem_done, 0, 0);
+  if (ret != OK)
+    {
+      gdbg("sem_init failed: %d\n", errno);
+      return ret;
+    }
+
+  /* Forward the blend command to the server */
+
+  ret = nxmu_sendwindow(wnd, &outmsg, sizeof(struct nxsvrmsg_blend_s));
+
+  /* Wait until the command is completed so that the caller can release
+   * the image and the alpha map.
+   */
+
+  if (ret == OK)
+    {
+      ret = sem_wait(&sem_done);
+    }
+
+  /* Destroy the semaphore and return. */
+
+  sem_destroy(&sem_done);
+  return ret;
+}
@@ -96,6 +96,16 @@ static inline void nx_disconnected(FAR struct nxfe_conn_s *conn)
   (void)mq_close(conn->cwrmq);
   (void)mq_close(conn->crdmq);
 
+#ifdef CONFIG_NX_CMDRING
+  /* Free the command ring */
+
+  if (conn->ring)
+    {
+      sem_destroy(&conn->ringsem);
+      kfree(conn->ring);
+    }
+#endif
+
   /* And free the client structure */
 
   kfree(conn);
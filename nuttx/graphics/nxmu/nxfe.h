@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxmu/nxfe.h
  *
- *   Copyright (C) 2008-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -69,6 +69,18 @@
 #  define CONFIG_NX_MXCLIENTMSGS 16 /* Number of pending messages in each client MQ */
 #endif
 
+#ifdef CONFIG_NX_CMDRING
+#  ifndef CONFIG_NX_CMDRING_SIZE
+#    define CONFIG_NX_CMDRING_SIZE 1024 /* Size of each client command ring */
+#  endif
+#  if CONFIG_NX_CMDRING_SIZE < 256 || CONFIG_NX_CMDRING_SIZE > 32768
+#    error "CONFIG_NX_CMDRING_SIZE must be in the range 256-32768"
+#  endif
+#  if (CONFIG_NX_CMDRING_SIZE & 7) != 0
+#    error "CONFIG_NX_CMDRING_SIZE must be a multiple of 8 (see NX_RINGALIGN)"
+#  endif
+#endif
+
 /* Used to create unique client MQ name */
 
 #define NX_CLIENT_MQNAMEFMT  "/dev/nxc%d"
@@ -78,6 +90,12 @@
 #define NX_MXEVENTLEN        (64) /* Maximum size of an event */
 #define NX_MXCLIMSGLEN       (64) /* Maximum size of a server->client message */
 
+/* Command ring records are aligned so that the messages that they hold
+ * are suitably aligned for pointers.
+ */
+
+#define NX_RINGALIGN(n)      (((n) + 7) & ~7)
+
 /* Handy macros */
 
 #define nxmu_semgive(sem)    sem_post(sem) /* To match nxmu_semtake() */
@@ -114,6 +132,20 @@ struct nxfe_conn_s
   /* These are only usable on the server side of the connection */
 
   mqd_t swrmq;            /* MQ to write to the client */
+
+  /* Drawing command ring (see nx_beginbatch()).  The client adds commands
+   * at the head; the server removes them at the tail.
+   */
+
+#ifdef CONFIG_NX_CMDRING
+  FAR uint8_t *ring;      /* CONFIG_NX_CMDRING_SIZE bytes (NULL if not used) */
+  volatile uint16_t head; /* Offset where the client adds the next command */
+  volatile uint16_t tail; /* Offset where the server takes the next command */
+  volatile bool busy;     /* NX_SVRMSG_RUNRING is pending or in progress */
+  volatile bool waiting;  /* The client is waiting for the ring to drain */
+  bool batch;             /* Drawing commands are added to the ring */
+  sem_t ringsem;          /* Posted when the ring drains while waiting */
+#endif
 };
 
 /* Server state structure ***************************************************/
@@ -168,9 +200,13 @@ enum nxmsg_e
   NX_SVRMSG_FILLTRAP,         /* Fill a trapezoidal region in the window with a color */
   NX_SVRMSG_MOVE,             /* Move a rectangular region within the window */
   NX_SVRMSG_BITMAP,           /* Copy a rectangular bitmap into the window */
+  NX_SVRMSG_BLEND,            /* Alpha-blend a rectangular image into the window */
   NX_SVRMSG_SETBGCOLOR,       /* Set the color of the background */
   NX_SVRMSG_MOUSEIN,          /* New mouse report from mouse client */
   NX_SVRMSG_KBDIN,            /* New keyboard report from keyboard client */
+  NX_SVRMSG_RUNRING,          /* Execute the commands in the client's command ring */
+  NX_SVRMSG_BACKINGSTORE,     /* Enable/disable the backing store of a window */
+  NX_SVRMSG_PRESENT,          /* End of frame:  Present the drawing to the display */
 };
 
 /* Message priorities -- they must all be at the same priority to assure
@@ -265,7 +301,8 @@ struct nxclimsg_blocked_s
 
 /* The generic message structure.  All server messages begin with this form.  Also
  * messages that have no additional data fields use this structure.  This includes:
- * NX_SVRMSG_CONNECT and NX_SVRMSG_DISCONNECT.
+ * NX_SVRMSG_CONNECT, NX_SVRMSG_DISCONNECT, NX_SVRMSG_RUNRING, and
+ * NX_SVRMSG_PRESENT.
  */
 
 struct nxsvrmsg_s                 /* Generic server message */
@@ -362,6 +399,17 @@ struct nxsvrmsg_lower_s
   FAR struct nxbe_window_s *wnd;   /* The window to be lowered  */
 };
 
+/* This message enables or disables the backing store of a window */
+
+#ifdef CONFIG_NX_BACKINGSTORE
+struct nxsvrmsg_backingstore_s
+{
+  uint32_t msgid;                  /* NX_SVRMSG_BACKINGSTORE */
+  FAR struct nxbe_window_s *wnd;   /* The window */
+  bool enable;                     /* True: Enable the backing store */
+};
+#endif
+
 /* Set a single pixel in the window with a color */
 
 struct nxsvrmsg_setpixel_s
@@ -429,6 +477,23 @@ struct nxsvrmsg_bitmap_s
   sem_t *sem_done;                /* Semaphore to report when command is done. */
 };
 
+/* Alpha-blend a rectangular image or color into the window.  The blend
+ * descriptions are passed by reference; the client waits on sem_done before
+ * it releases them.
+ */
+
+#ifdef CONFIG_NX_BLEND
+struct nxsvrmsg_blend_s
+{
+  uint32_t msgid;                 /* NX_SVRMSG_BLEND */
+  FAR struct nxbe_window_s *wnd;  /* The window with will receive the image */
+  struct nxgl_rect_s dest;        /* Destination location of the image in the window */
+  FAR const struct nxgl_blend_s *blend; /* Image/color, alpha map, and opacity for each plane */
+  struct nxgl_point_s origin;     /* Offset into the source image and alpha map */
+  sem_t *sem_done;                /* Semaphore to report when command is done. */
+};
+#endif
+
 /* Set the color of the background */
 
 struct nxsvrmsg_setbgcolor_s
@@ -745,6 +810,65 @@ EXTERN int nxmu_mousein(FAR struct nxfe_state_s *fe,
 EXTERN void nxmu_kbdin(FAR struct nxfe_state_s *fe, uint8_t nch, FAR uint8_t *ch);
 #endif
 
+/****************************************************************************
+ * Name: nxmu_ringappend
+ *
+ * Description:
+ *   Add a drawing command to the client's command ring (client side).  If
+ *   there is not enough space in the ring, the commands already in the
+ *   ring are submitted to the server and the client waits for them to be
+ *   executed.
+ *
+ * Input Parameters:
+ *   conn   - A pointer to the client connection structure
+ *   msg    - A pointer to the message to add
+ *   msglen - The length of the message in bytes.
+ *
+ * Return:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_CMDRING
+EXTERN int nxmu_ringappend(FAR struct nxfe_conn_s *conn, FAR const void *msg,
+                           size_t msglen);
+
+/****************************************************************************
+ * Name: nxmu_ringsubmit
+ *
+ * Description:
+ *   Ask the server to execute the commands in the client's command ring
+ *   (client side).  Nothing is sent if the ring is empty or if the server
+ *   has already been asked and has not yet drained the ring.  This must be
+ *   called before any other message is sent to the server so that the
+ *   commands are executed in the order that they were issued.
+ *
+ ****************************************************************************/
+
+EXTERN int nxmu_ringsubmit(FAR struct nxfe_conn_s *conn);
+
+/****************************************************************************
+ * Name: nxmu_ringwait
+ *
+ * Description:
+ *   Submit the commands in the client's command ring and wait until the
+ *   server has executed all of them (client side).
+ *
+ ****************************************************************************/
+
+EXTERN int nxmu_ringwait(FAR struct nxfe_conn_s *conn);
+
+/****************************************************************************
+ * Name: nxmu_runring
+ *
+ * Description:
+ *   Execute all commands in the client's command ring (server side).
+ *
+ ****************************************************************************/
+
+EXTERN void nxmu_runring(FAR struct nxfe_conn_s *conn);
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
@@ -0,0 +1,390 @@
+/****************************************************************************
+ * graphics/nxmu/nxmu_cmdring.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <mqueue.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/nx/nx.h>
+#include "nxfe.h"
+
+#ifdef CONFIG_NX_CMDRING
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/* Space that is always left unused so that a full ring can be distinguished
+ * from an empty ring.
+ */
+
+#define NX_RINGGAP NX_RINGALIGN(1)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Each command in the ring is preceded by this header.  Records that would
+ * wrap around the end of the ring are instead placed at the beginning of
+ * the ring; the unused space at the end is then covered by a 'skip' record.
+ */
+
+struct nxmu_ringhdr_s
+{
+  uint32_t size;                  /* Size of the record, including header */
+  uint32_t skip;                  /* True: No command in this record */
+};
+
+#define NX_RINGHDRSIZE NX_RINGALIGN(sizeof(struct nxmu_ringhdr_s))
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxmu_ringcmd
+ *
+ * Description:
+ *   Execute one drawing command from the ring (server side).
+ *
+ ****************************************************************************/
+
+static inline void nxmu_ringcmd(FAR struct nxsvrmsg_s *msg)
+{
+  switch (msg->msgid)
+    {
+      case NX_SVRMSG_SETPIXEL:
+        {
+          FAR struct nxsvrmsg_setpixel_s *setmsg = (FAR struct nxsvrmsg_setpixel_s *)msg;
+          nxbe_setpixel(setmsg->wnd, &setmsg->pos, setmsg->color);
+        }
+        break;
+
+      case NX_SVRMSG_FILL:
+        {
+          FAR struct nxsvrmsg_fill_s *fillmsg = (FAR struct nxsvrmsg_fill_s *)msg;
+          nxbe_fill(fillmsg->wnd, &fillmsg->rect, fillmsg->color);
+        }
+        break;
+
+      case NX_SVRMSG_FILLTRAP:
+        {
+          FAR struct nxsvrmsg_filltrapezoid_s *trapmsg = (FAR struct nxsvrmsg_filltrapezoid_s *)msg;
+          nxbe_filltrapezoid(trapmsg->wnd, &trapmsg->clip, &trapmsg->trap, trapmsg->color);
+        }
+        break;
+
+      case NX_SVRMSG_MOVE:
+        {
+          FAR struct nxsvrmsg_move_s *movemsg = (FAR struct nxsvrmsg_move_s *)msg;
+          nxbe_move(movemsg->wnd, &movemsg->rect, &movemsg->offset);
+        }
+        break;
+
+      case NX_SVRMSG_BITMAP:
+        {
+          FAR struct nxsvrmsg_bitmap_s *bmpmsg = (FAR struct nxsvrmsg_bitmap_s *)msg;
+          nxbe_bitmap(bmpmsg->wnd, &bmpmsg->dest, bmpmsg->src, &bmpmsg->origin, bmpmsg->stride);
+
+          if (bmpmsg->sem_done)
+            {
+              sem_post(bmpmsg->sem_done);
+            }
+        }
+        break;
+
+      default:
+        gdbg("Unexpected command in ring: %d\n", msg->msgid);
+        break;
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxmu_ringappend
+ *
+ * Description:
+ *   Add a drawing command to the client's command ring (client side).  If
+ *   there is not enough space in the ring, the commands already in the
+ *   ring are submitted to the server and the client waits for them to be
+ *   executed.
+ *
+ * Input Parameters:
+ *   conn   - A pointer to the client connection structure
+ *   msg    - A pointer to the message to add
+ *   msglen - The length of the message in bytes.
+ *
+ * Return:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+int nxmu_ringappend(FAR struct nxfe_conn_s *conn, FAR const void *msg,
+                    size_t msglen)
+{
+  FAR struct nxmu_ringhdr_s *hdr;
+  unsigned int recsize;
+  unsigned int contig;
+  unsigned int avail;
+  unsigned int need;
+  unsigned int head;
+  int ret;
+
+  DEBUGASSERT(conn && conn->ring && msglen <= NX_MXSVRMSGLEN);
+  recsize = NX_RINGHDRSIZE + NX_RINGALIGN(msglen);
+
+  /* Wait until there is space for the command in the ring.  Only the
+   * client modifies the head so it may be sampled once; the tail moves as
+   * the server executes commands.
+   */
+
+  head = conn->head;
+  for (;;)
+    {
+      avail  = (conn->tail + CONFIG_NX_CMDRING_SIZE - head - NX_RINGGAP) %
+               CONFIG_NX_CMDRING_SIZE;
+      contig = CONFIG_NX_CMDRING_SIZE - head;
+      need   = recsize <= contig ? recsize : contig + recsize;
+
+      if (need <= avail)
+        {
+          break;
+        }
+
+      /* Not enough space.  Let the server drain the ring */
+
+      ret = nxmu_ringwait(conn);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  /* If the record would wrap around the end of the ring, skip over the
+   * remainder of the ring and put the record at the beginning.
+   */
+
+  if (recsize > contig)
+    {
+      hdr       = (FAR struct nxmu_ringhdr_s *)&conn->ring[head];
+      hdr->size = contig;
+      hdr->skip = true;
+      head      = 0;
+    }
+
+  hdr       = (FAR struct nxmu_ringhdr_s *)&conn->ring[head];
+  hdr->size = recsize;
+  hdr->skip = false;
+  memcpy(&conn->ring[head + NX_RINGHDRSIZE], msg, msglen);
+
+  /* Then make the command visible to the server */
+
+  conn->head = (head + recsize) % CONFIG_NX_CMDRING_SIZE;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: nxmu_ringsubmit
+ *
+ * Description:
+ *   Ask the server to execute the commands in the client's command ring
+ *   (client side).  Nothing is sent if the ring is empty or if the server
+ *   has already been asked and has not yet drained the ring.  This must be
+ *   called before any other message is sent to the server so that the
+ *   commands are executed in the order that they were issued.
+ *
+ ****************************************************************************/
+
+int nxmu_ringsubmit(FAR struct nxfe_conn_s *conn)
+{
+  struct nxsvrmsg_s outmsg;
+  bool submit = false;
+  int ret;
+
+  if (!conn->ring)
+    {
+      return OK;
+    }
+
+  /* The server clears 'busy' only after it has found the ring empty */
+
+  sched_lock();
+  if (!conn->busy && conn->head != conn->tail)
+    {
+      conn->busy = true;
+      submit     = true;
+    }
+  sched_unlock();
+
+  if (!submit)
+    {
+      return OK;
+    }
+
+  /* Send the message directly (not via nxmu_sendserver() which would try
+   * to submit the ring again).
+   */
+
+  outmsg.msgid = NX_SVRMSG_RUNRING;
+  outmsg.conn  = conn;
+
+  ret = mq_send(conn->cwrmq, &outmsg, sizeof(struct nxsvrmsg_s), NX_SVRMSG_PRIO);
+  if (ret < 0)
+    {
+      gdbg("mq_send failed: %d\n", errno);
+      conn->busy = false;
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: nxmu_ringwait
+ *
+ * Description:
+ *   Submit the commands in the client's command ring and wait until the
+ *   server has executed all of them (client side).
+ *
+ ****************************************************************************/
+
+int nxmu_ringwait(FAR struct nxfe_conn_s *conn)
+{
+  int ret;
+
+  if (!conn->ring)
+    {
+      return OK;
+    }
+
+  for (;;)
+    {
+      /* Is the ring already empty? */
+
+      sched_lock();
+      if (conn->head == conn->tail)
+        {
+          sched_unlock();
+          return OK;
+        }
+
+      /* No.. the server will post ringsem when it finds the ring empty */
+
+      conn->waiting = true;
+      sched_unlock();
+
+      ret = nxmu_ringsubmit(conn);
+      if (ret < 0)
+        {
+          conn->waiting = false;
+          return ret;
+        }
+
+      nxmu_semtake(&conn->ringsem);
+    }
+}
+
+/****************************************************************************
+ * Name: nxmu_runring
+ *
+ * Description:
+ *   Execute all commands in the client's command ring (server side).
+ *
+ ****************************************************************************/
+
+void nxmu_runring(FAR struct nxfe_conn_s *conn)
+{
+  FAR struct nxmu_ringhdr_s *hdr;
+
+  for (;;)
+    {
+      /* Execute every command that the client has added so far */
+
+      while (conn->tail != conn->head)
+        {
+          hdr = (FAR struct nxmu_ringhdr_s *)&conn->ring[conn->tail];
+          if (!hdr->skip)
+            {
+              nxmu_ringcmd((FAR struct nxsvrmsg_s *)&conn->ring[conn->tail + NX_RINGHDRSIZE]);
+            }
+
+          conn->tail = (conn->tail + hdr->size) % CONFIG_NX_CMDRING_SIZE;
+        }
+
+      /* The ring appears empty.  Check again with the scheduler locked:  If
+       * the client added more commands in the meantime, it did not send
+       * another NX_SVRMSG_RUNRING message because 'busy' was still set.
+       */
+
+      sched_lock();
+      if (conn->tail == conn->head)
+        {
+          conn->busy = false;
+          if (conn->waiting)
+            {
+              conn->waiting = false;
+              sem_post(&conn->ringsem);
+            }
+
+          sched_unlock();
+          return;
+        }
+
+      sched_unlock();
+    }
+}
+
+#endif /* CONFIG_NX_CMDRING */
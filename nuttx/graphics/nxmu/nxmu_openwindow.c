@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxmu/nxmu_openwindow.c
  *
- *   Copyright (C) 2008-2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -100,6 +100,7 @@ void nxmu_openwindow(FAR struct nxbe_state_s *be, FAR struct nxbe_window_s *wnd)
 
   be->topwnd->above = wnd;
   be->topwnd        = wnd;
+  NXBE_CLIPCHANGED(be);
 
   /* Report the initial size/position of the window to the client */
 
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxmu/nxmu_sendserver.c
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -100,6 +100,19 @@ int nxmu_sendserver(FAR struct nxfe_conn_s *conn, FAR const void *msg,
     }
 #endif
 
+#ifdef CONFIG_NX_CMDRING
+  /* Any drawing commands that are waiting in the command ring must be
+   * executed before this message.  Messages are processed in FIFO order so
+   * it is sufficient to submit the ring first.
+   */
+
+  ret = nxmu_ringsubmit(conn);
+  if (ret < 0)
+    {
+      return ret;
+    }
+#endif
+
   /* Send the message to the server */
 
   ret = mq_send(conn->cwrmq, msg, msglen, NX_SVRMSG_PRIO);
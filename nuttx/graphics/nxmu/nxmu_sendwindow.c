@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxmu/nxmu_sendserver.c
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -39,6 +39,7 @@
 
 #include <nuttx/config.h>
 
+#include <stdbool.h>
 #include <mqueue.h>
 #include <errno.h>
 #include <debug.h>
@@ -65,6 +66,34 @@
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: nxmu_ringable
+ *
+ * Description:
+ *  Return true if the message is a drawing command that may be placed in
+ *  the command ring.  NX_SVRMSG_BLEND is not:  It refers to a blend
+ *  descriptor that may be on the caller's stack.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_CMDRING
+static inline bool nxmu_ringable(FAR const void *msg)
+{
+  switch (((FAR const struct nxsvrmsg_s *)msg)->msgid)
+    {
+      case NX_SVRMSG_SETPIXEL:
+      case NX_SVRMSG_FILL:
+      case NX_SVRMSG_FILLTRAP:
+      case NX_SVRMSG_MOVE:
+      case NX_SVRMSG_BITMAP:
+        return true;
+
+      default:
+        return false;
+    }
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -105,6 +134,17 @@ int nxmu_sendwindow(FAR struct nxbe_window_s *wnd, FAR const void *msg,
 
   if (!NXBE_ISBLOCKED(wnd))
     {
+#ifdef CONFIG_NX_CMDRING
+      /* In batch mode, drawing commands are added to the command ring
+       * instead of being sent one-at-a-time through the message queue.
+       */
+
+      if (wnd->conn->batch && nxmu_ringable(msg))
+        {
+          return nxmu_ringappend(wnd->conn, msg, msglen);
+        }
+#endif
+
       /* Send the message to the server */
 
       ret = nxmu_sendserver(wnd->conn, msg, msglen);
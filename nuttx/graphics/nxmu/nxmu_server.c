@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxmu/nxmu_server.c
  *
- *   Copyright (C) 2008-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -40,6 +40,7 @@
 #include <nuttx/config.h>
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 #include <semaphore.h>
@@ -48,6 +49,7 @@
 #include <errno.h>
 #include <debug.h>
 
+#include <nuttx/kmalloc.h>
 #include <nuttx/nx/nx.h>
 #include "nxfe.h"
 
@@ -148,6 +150,18 @@ static inline void nxmu_shutdown(FAR struct nxfe_state_s *fe)
     {
        (void)nxmu_disconnect(wnd->conn);
     }
+
+#ifdef CONFIG_NX_CLIPCACHE
+  /* The background window is part of the server state and is never closed.
+   * Free its cached visible region here.
+   */
+
+  if (fe->be.bkgd.vislist)
+    {
+      kfree(fe->be.bkgd.vislist);
+      fe->be.bkgd.vislist = NULL;
+    }
+#endif
 }
 
 /****************************************************************************
@@ -256,6 +270,7 @@ static inline int nxmu_setup(FAR const char *mqname, FAR NX_DRIVERTYPE *dev,
    */
 
   fe->be.topwnd = &fe->be.bkgd;
+  NXBE_CLIPCHANGED(&fe->be);
 
   /* Initialize the mouse position */
 
@@ -296,6 +311,9 @@ int nx_runinstance(FAR const char *mqname, FAR NX_DRIVERTYPE *dev)
   uint8_t                buffer[NX_MXSVRMSGLEN];
   int                    nbytes;
   int                    ret;
+#if defined(CONFIG_FB_FLIP) && !defined(CONFIG_NX_LCDDRIVER)
+  bool                   flip = false;
+#endif
 
   /* Initialization *********************************************************/
 
@@ -320,6 +338,13 @@ int nx_runinstance(FAR const char *mqname, FAR NX_DRIVERTYPE *dev)
   /* Produce the initial, background display */
 
   nxbe_redraw(&fe.be, &fe.be.bkgd, &fe.be.bkgd.bounds);
+  nxbe_flushdamage(&fe.be);
+#if defined(CONFIG_FB_FLIP) && !defined(CONFIG_NX_LCDDRIVER)
+  if (dev->flip != NULL)
+    {
+      (void)dev->flip(dev);
+    }
+#endif
 
   /* Message Loop ***********************************************************/
 
@@ -433,6 +458,15 @@ int nx_runinstance(FAR const char *mqname, FAR NX_DRIVERTYPE *dev)
            }
            break;
 
+#ifdef CONFIG_NX_BACKINGSTORE
+         case NX_SVRMSG_BACKINGSTORE: /* Enable/disable the backing store of a window */
+           {
+             FAR struct nxsvrmsg_backingstore_s *bsmsg = (FAR struct nxsvrmsg_backingstore_s *)buffer;
+             (void)nxbe_backingstore(bsmsg->wnd, bsmsg->enable);
+           }
+           break;
+#endif
+
          case NX_SVRMSG_SETPIXEL: /* Set a single pixel in the window with a color */
            {
              FAR struct nxsvrmsg_setpixel_s *setmsg = (FAR struct nxsvrmsg_setpixel_s *)buffer;
@@ -484,6 +518,20 @@ int nx_runinstance(FAR const char *mqname, FAR NX_DRIVERTYPE *dev)
            }
            break;
 
+#ifdef CONFIG_NX_BLEND
+         case NX_SVRMSG_BLEND: /* Alpha-blend a rectangular image into the window */
+           {
+             FAR struct nxsvrmsg_blend_s *blendmsg = (FAR struct nxsvrmsg_blend_s *)buffer;
+             nxbe_blendbitmap(blendmsg->wnd, &blendmsg->dest, blendmsg->blend, &blendmsg->origin);
+
+             if (blendmsg->sem_done)
+              {
+                sem_post(blendmsg->sem_done);
+              }
+           }
+           break;
+#endif
+
          case NX_SVRMSG_SETBGCOLOR: /* Set the color of the background */
            {
              FAR struct nxsvrmsg_setbgcolor_s *bgcolormsg = (FAR struct nxsvrmsg_setbgcolor_s *)buffer;
@@ -492,6 +540,32 @@ int nx_runinstance(FAR const char *mqname, FAR NX_DRIVERTYPE *dev)
            }
            break;
 
+         case NX_SVRMSG_PRESENT: /* End of frame:  Present the drawing */
+           {
+#if defined(CONFIG_FB_FLIP) && !defined(CONFIG_NX_LCDDRIVER)
+             /* Present the back buffer only if something was drawn since
+              * the last flip.  Each flip copies the whole frame.
+              */
+
+             if (flip && dev->flip != NULL)
+               {
+                 (void)dev->flip(dev);
+               }
+
+             flip = false;
+#endif
+           }
+           break;
+
+#ifdef CONFIG_NX_CMDRING
+         case NX_SVRMSG_RUNRING: /* Execute the commands in the client's command ring */
+           {
+             FAR struct nxsvrmsg_s *ringmsg = (FAR struct nxsvrmsg_s *)buffer;
+             nxmu_runring(ringmsg->conn);
+           }
+           break;
+#endif
+
 #ifdef CONFIG_NX_MOUSE
          case NX_SVRMSG_MOUSEIN: /* New mouse report from mouse client */
            {
@@ -532,6 +606,29 @@ int nx_runinstance(FAR const char *mqname, FAR NX_DRIVERTYPE *dev)
            gdbg("Unrecognized command: %d\n", msg->msgid);
            break;
          }
+
+       /* Send the redraw requests for all regions damaged while processing
+        * the message.  Overlapping regions have been coalesced so that each
+        * client receives at most a few redraw requests per window.
+        */
+
+       nxbe_flushdamage(&fe.be);
+
+#if defined(CONFIG_FB_FLIP) && !defined(CONFIG_NX_LCDDRIVER)
+       /* The framebuffer is double buffered.  Input reports, connection
+        * management, and the present request itself do not change the
+        * display; anything else may have.  The changes become visible when
+        * the client marks the end of the frame with nx_present() (or
+        * nx_endbatch()).
+        */
+
+       if (msg->msgid != NX_SVRMSG_MOUSEIN && msg->msgid != NX_SVRMSG_KBDIN &&
+           msg->msgid != NX_SVRMSG_CONNECT && msg->msgid != NX_SVRMSG_DISCONNECT &&
+           msg->msgid != NX_SVRMSG_PRESENT)
+         {
+           flip = true;
+         }
+#endif
     }
 
 errout:
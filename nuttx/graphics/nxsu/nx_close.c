@@ -88,6 +88,19 @@
 
 void nx_close(NXHANDLE handle)
 {
+#ifdef CONFIG_NX_CLIPCACHE
+  FAR struct nxfe_state_s *fe = (FAR struct nxfe_state_s *)handle;
+
+  /* The background window is never closed.  Free its cached visible
+   * region with the rest of the NX state.
+   */
+
+  if (fe->be.bkgd.vislist)
+    {
+      kfree(fe->be.bkgd.vislist);
+    }
+#endif
+
   kfree(handle);
 }
 
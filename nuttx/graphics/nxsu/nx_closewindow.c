@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxsu/nx_closewindow.c
  *
- *   Copyright (C) 2008-2009 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -86,6 +86,8 @@
 
 int nx_closewindow(NXWINDOW hwnd)
 {
+  FAR struct nxbe_state_s *be;
+
 #ifdef CONFIG_DEBUG
   if (!hwnd)
     {
@@ -94,7 +96,13 @@ int nx_closewindow(NXWINDOW hwnd)
     }
 #endif
 
+  /* Close the window, then ask the windows below to redraw the regions
+   * that it exposed.
+   */
+
+  be = ((FAR struct nxbe_window_s *)hwnd)->be;
   nxbe_closewindow((FAR struct nxbe_window_s *)hwnd);
+  nxbe_flushdamage(be);
   return OK;
 }
 
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxsu/nx_lower.c
  *
- *   Copyright (C) 2008-2009 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -94,6 +94,7 @@ int nx_lower(NXWINDOW hwnd)
 #endif
 
   nxbe_lower((FAR struct nxbe_window_s *)hwnd);
+  nxbe_flushdamage(((FAR struct nxbe_window_s *)hwnd)->be);
   return OK;
 }
 
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxsu/nx_move.c
  *
- *   Copyright (C) 2008-2009 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -97,5 +97,6 @@ int nx_move(NXWINDOW hwnd, FAR const struct nxgl_rect_s *rect,
 #endif
 
   nxbe_move((FAR struct nxbe_window_s *)hwnd, rect, offset);
+  nxbe_flushdamage(((FAR struct nxbe_window_s *)hwnd)->be);
   return OK;
 }
@@ -150,6 +150,7 @@ static inline int nxsu_setup(FAR NX_DRIVERTYPE *dev,
    */
 
   fe->be.topwnd = &fe->be.bkgd;
+  NXBE_CLIPCHANGED(&fe->be);
 
  /* Initialize the mouse position */
 
@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxsu/nx_setposition.c
  *
- *   Copyright (C) 2008-2009, 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -95,5 +95,6 @@ int nx_setposition(NXWINDOW hwnd, FAR const struct nxgl_point_s *pos)
 #endif
 
   nxbe_setposition((FAR struct nxbe_window_s *)hwnd, pos);
+  nxbe_flushdamage(((FAR struct nxbe_window_s *)hwnd)->be);
   return OK;
 }
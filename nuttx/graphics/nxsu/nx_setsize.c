@@ -1,7 +1,7 @@
 /****************************************************************************
  * graphics/nxsu/nx_setsize.c
  *
- *   Copyright (C) 2008-2009 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -95,5 +95,6 @@ int nx_setsize(NXWINDOW hwnd, FAR const struct nxgl_size_s *size)
 #endif
 
   nxbe_setsize((FAR struct nxbe_window_s *)hwnd, size);
+  nxbe_flushdamage(((FAR struct nxbe_window_s *)hwnd)->be);
   return OK;
 }
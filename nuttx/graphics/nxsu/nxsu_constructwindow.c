@@ -136,6 +136,7 @@ int nxfe_constructwindow(NXHANDLE handle, FAR struct nxbe_window_s *wnd,
 
   be->topwnd->above = wnd;
   be->topwnd        = wnd;
+  NXBE_CLIPCHANGED(be);
 
   /* Report the initialize size/position of the window */
 
@@ -0,0 +1,137 @@
+/****************************************************************************
+ * graphics/nxtk/nxtk_blendwindow.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/nx/nxtk.h>
+#include <nuttx/nx/nx.h>
+
+#include "nxtk_internal.h"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxtk_blendwindow
+ *
+ * Description:
+ *   Alpha-blend a rectangular region of a larger image, or a solid color,
+ *   into the rectangle in the specified client sub-window.
+ *
+ * Input Parameters:
+ *   hfwnd  - The client sub-window that will receive the blended image
+ *   dest   - Describes the rectangular region in the client sub-window
+ *            that will receive the blended image.
+ *   blend  - The source image or color, the alpha map, and the opacity.
+ *            This is an array of size CONFIG_NX_NPLANES.
+ *   origin - The origin of the upper, left-most corner of the full image
+ *            and alpha map.  Both dest and origin are in sub-window
+ *            coordinates, however, the origin may lie outside of the
+ *            sub-window display.
+ *
+ * Return:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+int nxtk_blendwindow(NXTKWINDOW hfwnd, FAR const struct nxgl_rect_s *dest,
+                     FAR const struct nxgl_blend_s blend[CONFIG_NX_NPLANES],
+                     FAR const struct nxgl_point_s *origin)
+{
+  FAR struct nxtk_framedwindow_s *fwnd = (FAR struct nxtk_framedwindow_s *)hfwnd;
+  struct nxgl_point_s wndorigin;
+  struct nxgl_rect_s clipdest;
+
+#ifdef CONFIG_DEBUG
+  if (!hfwnd || !dest || !blend || !origin)
+    {
+      errno = EINVAL;
+      return ERROR;
+    }
+#endif
+
+  /* Clip the rectangle so that it lies within the sub-window bounds
+   * then move the rectangle to that it is relative to the containing
+   * window.
+   */
+
+  nxtk_subwindowclip(fwnd, &clipdest, dest, &fwnd->fwrect);
+
+  /* Now, move the image origin so that it is relative to the containing
+   * window, not the sub-window.
+   *
+   * Temporarily, position the origin in absolute screen coordinates
+   */
+
+  nxgl_vectoradd(&wndorigin, origin, &fwnd->fwrect.pt1);
+
+  /* Then move the origin so that is relative to the containing window, not the
+   * client subwindow
+   */
+
+  nxgl_vectsubtract(&wndorigin, &wndorigin, &fwnd->wnd.bounds.pt1);
+
+  /* Then blend the image */
+
+  return nx_blendbitmap((NXWINDOW)hfwnd, &clipdest, blend, &wndorigin);
+}
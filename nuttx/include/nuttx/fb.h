@@ -313,6 +313,15 @@ struct fb_vtable_s
 #ifdef CONFIG_FB_HWCURSOR
   int (*getcursor)(FAR struct fb_vtable_s *vtable, FAR struct fb_cursorattrib_s *attrib);
   int (*setcursor)(FAR struct fb_vtable_s *vtable, FAR struct fb_setcursor_s *settings);
+#endif
+  /* The following is provided only if the video hardware is double buffered.
+   * The memory described by getplaneinfo() is then a back buffer that is not
+   * displayed.  flip() makes the current contents of the back buffer visible
+   * at the next vertical sync.  The back buffer contents are retained.
+   */
+
+#ifdef CONFIG_FB_FLIP
+  int (*flip)(FAR struct fb_vtable_s *vtable);
 #endif
 };
 
@@ -55,6 +55,8 @@
 
 #define __FS_FLAG_EOF   (1 << 0) /* EOF detected by a read operation */
 #define __FS_FLAG_ERROR (1 << 1) /* Error detected by any operation */
+#define __FS_FLAG_LBF   (1 << 2) /* Line buffered: flush when a newline is written */
+#define __FS_FLAG_UBF   (1 << 3) /* Buffer was provided by the user via setvbuf() */
 
 /****************************************************************************
  * Type Definitions
@@ -268,6 +270,10 @@ struct filelist
  *     |                      |                RD: Pointer to last buffered read char+1
  *     +----------------------+
  *                              <- fs_bufend   Points to end end of the buffer+1
+ *
+ * The buffer is normally allocated when the stream is opened, but it may be
+ * replaced with a user-provided buffer or removed altogether (all of the
+ * buffer pointers are then NULL) by setvbuf().
  */
 
 #if CONFIG_NFILE_STREAMS > 0
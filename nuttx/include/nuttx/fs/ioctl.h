@@ -1,7 +1,7 @@
 /****************************************************************************
  * include/nuttx/fs/ioctl.h
  *
- *   Copyright (C) 2008, 2009, 2011-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008, 2009, 2011-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -121,6 +121,20 @@
 #define FIONWRITE       _FIOC(0x0005)     /* IN:  Location to return value (int *)
 * OUT: Bytes writable to this fd
 */
+#define FIOC_PACKSTEP   _FIOC(0x0006)     /* IN:  None
+                                           * OUT: None.  Performs one bounded
+                                           *      step of an incremental
+                                           *      file system packing operation
+                                           */
+#define FIOC_PACKSTATS  _FIOC(0x0007)     /* IN:  Pointer to a writable instance
+                                           *      of struct nxffs_packstats_s
+                                           * OUT: Packing statistics
+                                           */
+#define FIOC_CACHESTATS _FIOC(0x0008)     /* IN:  Pointer to a writable instance
+                                           *      of struct smartfs_cachestats_s
+                                           * OUT: Sector cache and directory
+                                           *      index hit/miss counters
+                                           */
 
 /* NuttX file system ioctl definitions **************************************/
 
@@ -186,6 +200,10 @@
                                            *      buffer address
                                            * OUT: None (ioctl return value provides
                                            *      success/failure indication). */
+#define BIOC_FLUSH      _BIOC(0x000a)     /* Write any cached data to the media
+                                           * IN:  None
+                                           * OUT: None (ioctl return value provides
+                                           *      success/failure indication). */
 
 /* NuttX MTD driver ioctl definitions ***************************************/
 
@@ -1,7 +1,7 @@
 /****************************************************************************
  * include/nuttx/fs/nxffs.h
  *
- *   Copyright (C) 2011-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2011-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -41,6 +41,11 @@
  ****************************************************************************/
 
 #include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+
 #include <nuttx/fs/fs.h>
 
 /****************************************************************************
@@ -85,6 +90,46 @@
 #  define CONFIG_NXFFS_TAILTHRESHOLD (8*1024)
 #endif
 
+/* If CONFIG_NXFFS_INDEX is selected, then a RAM-resident index that maps
+ * inode names to the FLASH offset of the inode header is maintained.  This
+ * is the number of hash buckets in that index.
+ */
+
+/* The maximum number of erase blocks that will be re-written in one step
+ * of an incremental packing operation (FIOC_PACKSTEP or background packing).
+ */
+
+#ifndef CONFIG_NXFFS_PACKSTEP
+#  define CONFIG_NXFFS_PACKSTEP 4
+#endif
+
+#if CONFIG_NXFFS_PACKSTEP < 1
+#  error "CONFIG_NXFFS_PACKSTEP must be at least one"
+#endif
+
+/* Background packing is performed on the low priority work queue (if there
+ * is one) after the volume has been idle for CONFIG_NXFFS_BGPACK_DELAY
+ * milliseconds.
+ */
+
+#if defined(CONFIG_NXFFS_BGPACK) && !defined(CONFIG_SCHED_WORKQUEUE)
+#  warning "Background packing requires CONFIG_SCHED_WORKQUEUE"
+#  undef CONFIG_NXFFS_BGPACK
+#endif
+
+#ifndef CONFIG_NXFFS_BGPACK_DELAY
+#  define CONFIG_NXFFS_BGPACK_DELAY 1000
+#endif
+
+#ifdef CONFIG_NXFFS_INDEX
+#  ifndef CONFIG_NXFFS_NINDEX
+#    define CONFIG_NXFFS_NINDEX 16
+#  endif
+#  if CONFIG_NXFFS_NINDEX < 1
+#    error "CONFIG_NXFFS_NINDEX must be at least one"
+#  endif
+#endif
+
 /* At present, only a single pre-allocated NXFFS volume is supported.  This
  * is because here can be only a single NXFFS volume mounted at any time.
  * This has to do with the fact that we bind to an MTD driver (instead of a
@@ -94,6 +139,27 @@
 #undef CONFIG_NXFSS_PREALLOCATED
 #define CONFIG_NXFSS_PREALLOCATED 1
 
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* This structure is returned by the FIOC_PACKSTATS ioctl command.  It
+ * describes the packing state of an NXFFS volume.  Sizes are approximate:
+ * block and data headers are not accounted for.
+ */
+
+struct nxffs_packstats_s
+{
+  off_t    size;        /* Total size of the FLASH in bytes */
+  off_t    used;        /* Bytes used by valid inodes (headers, names, data) */
+  off_t    reclaimable; /* Bytes used by deleted inodes that packing would free */
+  off_t    available;   /* Bytes of free FLASH at the end of the volume */
+  uint32_t npacks;      /* Number of completed packing operations */
+  uint32_t nsteps;      /* Number of incremental packing steps */
+  uint32_t nerased;     /* Number of erase blocks re-written by packing */
+  bool     pending;     /* True: An incremental packing operation is suspended */
+};
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -1,7 +1,7 @@
 /****************************************************************************
  * include/nuttx/lcd/lcd.h
  *
- *   Copyright (C) 2010-2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2010-2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -94,6 +94,35 @@ struct lcd_planeinfo_s
   int (*getrun)(fb_coord_t row, fb_coord_t col, FAR uint8_t *buffer,
                 size_t npixels);
 
+  /* The following methods are optional and may be NULL.  They transfer a
+   * whole rectangle in one operation so that controllers with an address
+   * window need to be addressed only once rather than once per row.  If a
+   * method is NULL or returns a negated errno value, the rectangle is
+   * transferred with putrun() instead.
+   *
+   * This method can be used to write a rectangular area to the LCD:
+   *
+   *  row     - Starting row to write to (range: 0 <= row < yres)
+   *  col     - Starting column to write to (range: 0 <= col < xres)
+   *  nrows   - The number of rows to write (range: 0 < nrows <= yres-row)
+   *  ncols   - The number of pixels in each row
+   *            (range: 0 < ncols <= xres-col)
+   *  buffer  - The buffer containing the first row of the area.  Rows
+   *            begin on byte boundaries.
+   *  stride  - The distance in bytes from one row in buffer to the next
+   */
+
+  int (*putarea)(fb_coord_t row, fb_coord_t col, fb_coord_t nrows,
+                 fb_coord_t ncols, FAR const uint8_t *buffer, size_t stride);
+
+  /* This method can be used to fill a rectangular area of the LCD with a
+   * single color (row, col, nrows, ncols as for putarea()).  color is in
+   * the pixel format of the plane.
+   */
+
+  int (*fillarea)(fb_coord_t row, fb_coord_t col, fb_coord_t nrows,
+                  fb_coord_t ncols, uint32_t color);
+
   /* Plane color characteristics ********************************************/
 
   /* This is working memory allocated by the LCD driver for each LCD device
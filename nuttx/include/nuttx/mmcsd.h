@@ -1,7 +1,7 @@
 /****************************************************************************
  * include/nuttx/mmcsd.h
  *
- *   Copyright (C) 2008-2009 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2009, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -41,6 +41,7 @@
  ****************************************************************************/
 
 #include <nuttx/config.h>
+#include <stdint.h>
 
 /****************************************************************************
  * Pre-Processor Definitions
@@ -99,6 +100,30 @@ EXTERN int mmcsd_slotinitialize(int minor, FAR struct sdio_dev_s *dev);
 struct spi_dev_s; /* See nuttx/spi.h */
 EXTERN int mmcsd_spislotinitialize(int minor, int slotno, FAR struct spi_dev_s *spi);
 
+/****************************************************************************
+ * Name: mmcsd_spisiminitialize
+ *
+ * Description:
+ *   Create a simulated SD card, backed by a RAM buffer, that is accessed
+ *   through the returned SPI interface.  The interface may be passed to
+ *   mmcsd_spislotinitialize() in order to test the SPI MMC/SD driver
+ *   without hardware.
+ *
+ * Input Parameters:
+ *   buffer - The card media.  It must hold nsectors 512-byte sectors.
+ *   nsectors - The number of sectors.  This is rounded down to a multiple
+ *     of 1024 (512KiB).
+ *
+ * Returned Value:
+ *   The SPI interface of the card on success; NULL on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MMCSD_SPISIM
+EXTERN FAR struct spi_dev_s *mmcsd_spisiminitialize(FAR uint8_t *buffer,
+                                                    uint32_t nsectors);
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
@@ -59,6 +59,15 @@
 #define MTD_WRITE(d,s,n,b) ((d)->write   ? (d)->write(d,s,n,b)  : (-ENOSYS))
 #define MTD_IOCTL(d,c,a)   ((d)->ioctl   ? (d)->ioctl(d,c,a)    : (-ENOSYS))
 
+/* Asynchronous request operations (see struct mtd_req_s) */
+
+#ifdef CONFIG_MTD_ASYNC
+#  define MTDREQ_ERASE     0  /* Erase erase blocks */
+#  define MTDREQ_BREAD     1  /* Read R/W blocks */
+#  define MTDREQ_BWRITE    2  /* Write R/W blocks */
+#  define MTDREQ_READ      3  /* Read bytes */
+#endif
+
 /* If any of the low-level device drivers declare they want sub-sector erase
  * support, then define MTD_SUBSECTOR_ERASE.
  */
@@ -96,6 +105,35 @@ struct mtd_byte_write_s
   const uint8_t *buffer;  /* Pointer to the data to write */
 };
 
+/* This structure describes one asynchronous MTD request.  Requests are
+ * passed to mtd_submit() as a list linked through the flink field and are
+ * performed in list order.  When a request completes, its result field is
+ * set to the value that the corresponding synchronous method would have
+ * returned and the callback, if any, is called.  The callback may run on
+ * a worker thread; it may re-use or re-submit the request.  The driver may
+ * modify the flink field of a request until that request completes.
+ *
+ * An erase request may be queued ahead of the writes that will need the
+ * erased blocks so that the erasure overlaps with the caller's work.
+ */
+
+#ifdef CONFIG_MTD_ASYNC
+struct mtd_req_s;
+typedef CODE void (*mtd_callback_t)(FAR struct mtd_req_s *req);
+
+struct mtd_req_s
+{
+  FAR struct mtd_req_s *flink; /* Next request in the list */
+  mtd_callback_t callback;     /* Called on completion (may be NULL) */
+  FAR void *arg;               /* Argument for use by the caller */
+  FAR uint8_t *buffer;         /* Data buffer (not used for erase) */
+  off_t start;                 /* First erase block, R/W block, or byte */
+  size_t count;                /* Number of erase blocks, blocks, or bytes */
+  ssize_t result;              /* Result of the operation */
+  uint8_t op;                  /* See MTDREQ_* definitions */
+};
+#endif
+
 /* This structure defines the interface to a simple memory technology device.
  * It will likely need to be extended in the future to support more complex
  * devices.
@@ -142,6 +180,16 @@ struct mtd_dev_s
    */
 
   int (*ioctl)(FAR struct mtd_dev_s *dev, int cmd, unsigned long arg);
+
+#ifdef CONFIG_MTD_ASYNC
+  /* Queue a list of asynchronous requests (optional).  Requests to devices
+   * that do not support this method are performed synchronously by
+   * mtd_submit().  This is the last member so that drivers that initialize
+   * the structure by position are not affected.
+   */
+
+  int (*submit)(FAR struct mtd_dev_s *dev, FAR struct mtd_req_s *req);
+#endif
 };
 
 /****************************************************************************
@@ -183,6 +231,29 @@ extern "C"
 FAR struct mtd_dev_s *mtd_partition(FAR struct mtd_dev_s *mtd,
                                     off_t firstblock, off_t nblocks);
 
+/****************************************************************************
+ * Name: mtd_submit
+ *
+ * Description:
+ *   Submit a list of asynchronous requests to an MTD device.  If the MTD
+ *   driver does not support asynchronous requests, each request is
+ *   performed synchronously and its callback is called before mtd_submit()
+ *   returns.
+ *
+ * Input Parameters:
+ *   dev - The MTD device.
+ *   req - The first request in a list of requests linked through flink.
+ *
+ * Returned Value:
+ *   OK if the requests were accepted; a negated errno value otherwise.  The
+ *   result of each request is returned in its result field.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_ASYNC
+int mtd_submit(FAR struct mtd_dev_s *dev, FAR struct mtd_req_s *req);
+#endif
+
 /****************************************************************************
  * Name: ftl_initialize
  *
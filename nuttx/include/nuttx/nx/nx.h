@@ -1,7 +1,7 @@
 /****************************************************************************
  * include/nuttx/nx/nx.h
  *
- *   Copyright (C) 2008-2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -428,6 +428,88 @@ EXTERN int nx_eventnotify(NXHANDLE handle, int signo);
 #  define nx_eventnotify(handle, signo) (OK)
 #endif
 
+/****************************************************************************
+ * Name: nx_beginbatch
+ *
+ * Description:
+ *   Begin a batch of drawing operations.  Until nx_endbatch() is called,
+ *   nx_setpixel, nx_fill, nx_filltrapezoid, nx_move, and nx_bitmap requests
+ *   (and the nxtk_ equivalents) are not sent to the server one message at
+ *   a time.  Instead, they are added to a command ring that is shared with
+ *   the server and the server is notified only once for each group of
+ *   commands.  The commands are still executed in the order that they were
+ *   issued, relative to all other requests from the same client.
+ *
+ *   nx_bitmap() does not wait for the copy to complete in batch mode:  The
+ *   source image must remain valid until nx_endbatch() returns.
+ *
+ *   Multi-user mode with CONFIG_NX_CMDRING only!
+ *
+ * Input Parameters:
+ *   handle - the handle returned by nx_connect
+ *
+ * Return:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_NX_MULTIUSER) && defined(CONFIG_NX_CMDRING)
+EXTERN int nx_beginbatch(NXHANDLE handle);
+#else
+#  define nx_beginbatch(handle) (OK)
+#endif
+
+/****************************************************************************
+ * Name: nx_endbatch
+ *
+ * Description:
+ *   End a batch of drawing operations started by nx_beginbatch().  This
+ *   function does not return until the server has executed all of the
+ *   commands in the batch.
+ *
+ *   Multi-user mode with CONFIG_NX_CMDRING only!
+ *
+ * Input Parameters:
+ *   handle - the handle returned by nx_connect
+ *
+ * Return:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_NX_MULTIUSER) && defined(CONFIG_NX_CMDRING)
+EXTERN int nx_endbatch(NXHANDLE handle);
+#else
+#  define nx_endbatch(handle) (OK)
+#endif
+
+/****************************************************************************
+ * Name: nx_present
+ *
+ * Description:
+ *   Mark the end of a frame.  All drawing requested by the client so far is
+ *   complete and may be made visible.  If the framebuffer is double
+ *   buffered (CONFIG_FB_FLIP), the server presents the back buffer only
+ *   when a client calls nx_present() (or nx_endbatch()) so that partially
+ *   drawn frames are never shown.  Clients of such displays must call
+ *   nx_present() after each update.  Otherwise, it does nothing.
+ *
+ *   Multi-user mode only!
+ *
+ * Input Parameters:
+ *   handle - the handle returned by nx_connect
+ *
+ * Return:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_MULTIUSER
+EXTERN int nx_present(NXHANDLE handle);
+#else
+#  define nx_present(handle) (OK)
+#endif
+
 /****************************************************************************
  * Name: nx_openwindow
  *
@@ -645,6 +727,35 @@ EXTERN int nx_raise(NXWINDOW hwnd);
 
 EXTERN int nx_lower(NXWINDOW hwnd);
 
+/****************************************************************************
+ * Name: nx_backingstore
+ *
+ * Description:
+ *   Enable or disable the backing store of a window.  While enabled, all
+ *   drawing in the window is also rendered into an off-screen copy of the
+ *   entire window.  When parts of the window are exposed (for example when
+ *   a window above it is moved or closed), they are restored from that
+ *   copy and the client receives no redraw callback.  When the backing
+ *   store is first enabled, the client is asked to redraw the whole window
+ *   in order to fill it in.
+ *
+ *   Framebuffer drivers only (not CONFIG_NX_LCDDRIVER).
+ *
+ * Input parameters:
+ *   hwnd   - The window
+ *   enable - True: Enable the backing store; false: disable it
+ *
+ * Returned value:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_BACKINGSTORE
+EXTERN int nx_backingstore(NXWINDOW hwnd, bool enable);
+#else
+#  define nx_backingstore(hwnd, enable) (OK)
+#endif
+
 /****************************************************************************
  * Name: nx_setpixel
  *
@@ -866,6 +977,38 @@ EXTERN int nx_bitmap(NXWINDOW hwnd, FAR const struct nxgl_rect_s *dest,
                      FAR const struct nxgl_point_s *origin,
                      unsigned int stride);
 
+/****************************************************************************
+ * Name: nx_blendbitmap
+ *
+ * Description:
+ *   Alpha-blend a rectangular region of a larger image, or a solid color,
+ *   into the rectangle in the specified window in one pass.  Each pixel is
+ *   weighted by the constant opacity and, optionally, by an 8-bit per pixel
+ *   alpha map so that, for example, anti-aliased text and icons can be
+ *   drawn over an existing background without first reading it back.
+ *
+ * Input Parameters:
+ *   hwnd   - The window that will receive the blended image
+ *   dest   - Describes the rectangular region on the display that will
+ *            receive the blended image.
+ *   blend  - The source image or color, the alpha map, and the opacity.
+ *            This is an array of size CONFIG_NX_NPLANES.
+ *   origin - The origin of the upper, left-most corner of the full image
+ *            and alpha map.  Both dest and origin are in window
+ *            coordinates, however, origin may lie outside of the display.
+ *
+ * Return:
+ *   OK on success; ERROR on failure with errno set appropriately.  ENOSYS
+ *   is reported if blending is not supported at the display color depth.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_BLEND
+EXTERN int nx_blendbitmap(NXWINDOW hwnd, FAR const struct nxgl_rect_s *dest,
+                          FAR const struct nxgl_blend_s blend[CONFIG_NX_NPLANES],
+                          FAR const struct nxgl_point_s *origin);
+#endif
+
 /****************************************************************************
  * Name: nx_kbdin
  *
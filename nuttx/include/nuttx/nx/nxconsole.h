@@ -1,7 +1,7 @@
 /****************************************************************************
  * include/nuttx/nx/nxconsole.h
  *
- *   Copyright (C) 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -94,6 +94,12 @@
  *   By default, lines will wrap when the test reaches the right hand side
  *   of the window. This setting can be defining to change this behavior so
  *   that the text is simply truncated until a new line is  encountered.
+ * CONFIG_NXCONSOLE_NORUNS
+ *   By default, adjacent characters on the same line are composed into a
+ *   buffer that is as wide as the window and one line tall and are then
+ *   sent to the window with a single bitmap operation.  This setting
+ *   disables that buffer so that characters are drawn one at a time.  Run
+ *   rendering is always disabled if CONFIG_NXCONSOLE_BPP is less than 8.
  *
  * Input options:
  *
@@ -1,7 +1,7 @@
 /****************************************************************************
  * include/nuttx/nx/nxfonts.h
  *
- *   Copyright (C) 2008, 2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008, 2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -74,6 +74,11 @@
 #elif defined(CONFIG_NXFONT_SANS39X48)
 # define NXFONT_DEFAULT FONTID_SANS39X48
 
+/* Anti-aliased sans serif fonts */
+
+#elif defined(CONFIG_NXFONT_SANS20X24AA)
+# define NXFONT_DEFAULT FONTID_SANS20X24AA
+
 /* Sans serif bold fonts */
 
 #elif defined(CONFIG_NXFONT_SANS17X23B)
@@ -120,6 +125,15 @@
 
 #endif
 
+/* Glyphs of anti-aliased fonts (metric.aa == 1) are 4 bits per pixel:  Each
+ * pixel is a coverage value in the range 0 (background) through 15 (fully
+ * covered), the left-most pixel in the most significant nibble.  The rows
+ * of such glyphs are too wide to be described by the 3-bit stride field so
+ * the width of one glyph row in bytes is derived from the glyph width.
+ */
+
+#define NXFONT_STRIDE(m)    ((m).aa ? (((m).width + 1) >> 1) : (m).stride)
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -162,6 +176,12 @@ enum nx_fontid_e
   , FONTID_SANS39X48 = 4         /* The 39x48 sans serif font */
 #endif
 
+/* Anti-aliased sans serif fonts */
+
+#ifdef CONFIG_NXFONT_SANS20X24AA
+  , FONTID_SANS20X24AA = 19      /* The 20x24 anti-aliased sans serif font */
+#endif
+
 /* Sans Serif bold fonts */
 
 #ifdef CONFIG_NXFONT_SANS17X23B
@@ -222,7 +242,8 @@ struct nx_fontmetric_s
   uint32_t height   : 6;      /* Height of the font in rows */
   uint32_t xoffset  : 6;      /* Top, left-hand corner X-offset in pixels */
   uint32_t yoffset  : 6;      /* Top, left-hand corner y-offset in pixels */
-  uint32_t unused   : 5;
+  uint32_t aa       : 1;      /* 1: 4-bit anti-aliased glyph (see NXFONT_STRIDE) */
+  uint32_t unused   : 4;
 };
 
 /* This structure binds the glyph metrics to the glyph bitmap */
@@ -267,6 +288,25 @@ struct nx_fontpackage_s
 #endif
 };
 
+/* A font cache holds glyphs that have already been rendered with one font,
+ * one pair of foreground and background colors, and one pixel depth.  This
+ * structure describes one rendered glyph in the cache.
+ */
+
+struct nxfonts_glyph_s
+{
+  FAR struct nxfonts_glyph_s *flink;     /* Next glyph in the cache (LRU order) */
+  FAR uint8_t *bitmap;                   /* Rendered glyph, stride * height bytes */
+  uint16_t code;                         /* Character code */
+  uint16_t stride;                       /* Width of one glyph row in bytes */
+  uint8_t height;                        /* Height of the glyph in rows */
+  uint8_t width;                         /* Width of the glyph in pixels */
+};
+
+/* The opaque handle returned by nxf_cache_connect() */
+
+typedef FAR void *FCACHE;
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -332,7 +372,8 @@ EXTERN FAR const struct nx_fontbitmap_s *
  * Name: nxf_convert_*bpp
  *
  * Description:
- *   Convert the 1BPP font to a new pixel depth
+ *   Convert the 1BPP font to a new pixel depth.  Pixels of anti-aliased
+ *   glyphs are drawn if they are at least half covered.
  *
  * Input Parameters:
  *   dest   - The destination buffer provided by the caller.
@@ -378,6 +419,101 @@ EXTERN int nxf_convert_32bpp(FAR uint32_t *dest, uint16_t height,
                              FAR const struct nx_fontbitmap_s *bm,
                              nxgl_mxpixel_t color);
 
+/****************************************************************************
+ * Name: nxf_convertalpha
+ *
+ * Description:
+ *   Convert a glyph to an 8-bit per pixel alpha map for use with
+ *   nx_blendbitmap():  Set bits of 1-bit glyphs become 255; the 4-bit
+ *   coverage values of anti-aliased glyphs are scaled to 0-255.  The
+ *   glyph is merged into the alpha map (keeping the larger alpha value) so
+ *   the caller should first clear the alpha map to zero (transparent).
+ *
+ * Input Parameters:
+ *   dest   - The destination alpha map provided by the caller.
+ *   height - The max height of the returned char in rows
+ *   width  - The max width of the returned char in pixels
+ *   stride - The width of the destination alpha map in bytes
+ *   bm     - Describes the character glyph to convert
+ *
+ * Returned Value:
+ *  OK on Success, ERROR: on failure with errno set appropriately.
+ *  (never fails)
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_BLEND
+EXTERN int nxf_convertalpha(FAR uint8_t *dest, uint16_t height,
+                            uint16_t width, uint16_t stride,
+                            FAR const struct nx_fontbitmap_s *bm);
+#endif
+
+/****************************************************************************
+ * Name: nxf_cache_connect
+ *
+ * Description:
+ *   Create a cache of rendered glyphs.  Glyphs are rendered with the
+ *   foreground color on an opaque background color at the selected pixel
+ *   depth.  Each glyph is as wide as the character (including its x-offset)
+ *   and as tall as the font (mxheight).  The cache holds at most maxglyphs
+ *   glyphs; when it is full, the least recently used glyph is replaced.
+ *
+ *   A cache must only be used by one thread at a time.  A glyph returned
+ *   by nxf_cache_getglyph() remains valid until maxglyphs other glyphs have
+ *   been requested from the same cache.
+ *
+ * Input Parameters:
+ *   hfont     - A font handle previously returned by nxf_getfonthandle()
+ *   fgcolor   - The color of the set pixels of the glyphs
+ *   bgcolor   - The color of the background of the glyphs
+ *   bpp       - Bits per pixel {1, 2, 4, 8, 16, or 32}
+ *   maxglyphs - The maximum number of glyphs to retain (at least 1)
+ *
+ * Returned Value:
+ *   On success, a non-NULL handle is returned that may be used with the
+ *   other nxf_cache_*() interfaces.  NULL is returned on failure with errno
+ *   set appropriately.
+ *
+ ****************************************************************************/
+
+EXTERN FCACHE nxf_cache_connect(NXHANDLE hfont, nxgl_mxpixel_t fgcolor,
+                                nxgl_mxpixel_t bgcolor, int bpp,
+                                int maxglyphs);
+
+/****************************************************************************
+ * Name: nxf_cache_disconnect
+ *
+ * Description:
+ *   Free a font cache and all of the glyphs that it holds.
+ *
+ * Input Parameters:
+ *   fhandle - A font cache handle previously returned by nxf_cache_connect()
+ *
+ ****************************************************************************/
+
+EXTERN void nxf_cache_disconnect(FCACHE fhandle);
+
+/****************************************************************************
+ * Name: nxf_cache_getglyph
+ *
+ * Description:
+ *   Return the rendered glyph of a character, rendering it and adding it to
+ *   the cache if it is not already there.
+ *
+ * Input Parameters:
+ *   fhandle - A font cache handle previously returned by nxf_cache_connect()
+ *   ch      - The character code
+ *
+ * Returned Value:
+ *   The rendered glyph.  NULL is returned if the font has no glyph for the
+ *   character (it should be drawn as a space) or if memory could not be
+ *   allocated.
+ *
+ ****************************************************************************/
+
+EXTERN FAR const struct nxfonts_glyph_s *
+  nxf_cache_getglyph(FCACHE fhandle, uint16_t ch);
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
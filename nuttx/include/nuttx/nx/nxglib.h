@@ -1,7 +1,7 @@
 /****************************************************************************
  * include/nuttx/nx/nxglib.h
  *
- *   Copyright (C) 2008-2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -176,6 +176,26 @@ struct nxgl_trapezoid_s
   struct nxgl_run_s bot;  /* bottom run */
 };
 
+/* Describes the source of an alpha-blended rectangle operation.  The source
+ * is either an image in the device pixel format or, if image is NULL, a
+ * solid color.  Each source pixel is weighted by opacity and, if alpha is
+ * not NULL, also by the corresponding 8-bit value of the alpha map
+ * (0=transparent, 255=opaque).  The image and the alpha map are positioned
+ * by the same origin.
+ */
+
+#ifdef CONFIG_NX_BLEND
+struct nxgl_blend_s
+{
+  FAR const void *image;     /* Source image in device format (NULL: color) */
+  unsigned int stride;       /* Width of one row of the image in bytes */
+  FAR const uint8_t *alpha;  /* Alpha map, one byte per pixel (may be NULL) */
+  unsigned int astride;      /* Width of one row of the alpha map in bytes */
+  nxgl_mxpixel_t color;      /* Solid color used if there is no image */
+  uint8_t opacity;           /* Constant alpha applied to every pixel */
+};
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -428,6 +448,38 @@ EXTERN void nxgl_copyrectangle_32bpp(FAR NX_PLANEINFOTYPE *pinfo,
                                      FAR const struct nxgl_point_s *origin,
                                      unsigned int srcstride);
 
+/****************************************************************************
+ * Name: nxgl_blendrectangle_*bpp
+ *
+ * Description:
+ *   Alpha-blend a rectangular image or a solid color onto the rectangular
+ *   region of display memory described by dest.  The origin of the source
+ *   image and alpha map is at the position origin.  Blending is only
+ *   supported at 8 bits per pixel and above; at 8bpp, where there is no
+ *   RGB color to blend, each pixel is either drawn (alpha >= 128) or left
+ *   unchanged.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_BLEND
+EXTERN void nxgl_blendrectangle_8bpp(FAR NX_PLANEINFOTYPE *pinfo,
+                                     FAR const struct nxgl_rect_s *dest,
+                                     FAR const struct nxgl_blend_s *blend,
+                                     FAR const struct nxgl_point_s *origin);
+EXTERN void nxgl_blendrectangle_16bpp(FAR NX_PLANEINFOTYPE *pinfo,
+                                      FAR const struct nxgl_rect_s *dest,
+                                      FAR const struct nxgl_blend_s *blend,
+                                      FAR const struct nxgl_point_s *origin);
+EXTERN void nxgl_blendrectangle_24bpp(FAR NX_PLANEINFOTYPE *pinfo,
+                                      FAR const struct nxgl_rect_s *dest,
+                                      FAR const struct nxgl_blend_s *blend,
+                                      FAR const struct nxgl_point_s *origin);
+EXTERN void nxgl_blendrectangle_32bpp(FAR NX_PLANEINFOTYPE *pinfo,
+                                      FAR const struct nxgl_rect_s *dest,
+                                      FAR const struct nxgl_blend_s *blend,
+                                      FAR const struct nxgl_point_s *origin);
+#endif
+
 /****************************************************************************
  * Name: nxgl_rectcopy
  *
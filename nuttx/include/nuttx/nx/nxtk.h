@@ -1,7 +1,7 @@
 /****************************************************************************
  * include/nuttx/nx/nxtk.h
  *
- *   Copyright (C) 2008-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -277,6 +277,30 @@ EXTERN int nxtk_raise(NXTKWINDOW hfwnd);
 
 EXTERN int nxtk_lower(NXTKWINDOW hfwnd);
 
+/****************************************************************************
+ * Name: nxtk_backingstore
+ *
+ * Description:
+ *   Enable or disable the backing store of a framed window.  The backing
+ *   store holds the entire framed window:  The client sub-window, the
+ *   toolbar, and the frame.  See nx_backingstore().
+ *
+ * Input parameters:
+ *   hfwnd  - The window.  This must have been previously created by
+ *            nxtk_openwindow().
+ *   enable - True: Enable the backing store; false: disable it
+ *
+ * Returned value:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_BACKINGSTORE
+EXTERN int nxtk_backingstore(NXTKWINDOW hfwnd, bool enable);
+#else
+#  define nxtk_backingstore(hfwnd, enable) (OK)
+#endif
+
 /****************************************************************************
  * Name: nxtk_fillwindow
  *
@@ -461,6 +485,36 @@ EXTERN int nxtk_bitmapwindow(NXTKWINDOW hfwnd,
                              FAR const struct nxgl_point_s *origin,
                              unsigned int stride);
 
+/****************************************************************************
+ * Name: nxtk_blendwindow
+ *
+ * Description:
+ *   Alpha-blend a rectangular region of a larger image, or a solid color,
+ *   into the rectangle in the specified client sub-window.
+ *
+ * Input Parameters:
+ *   hfwnd  - The client sub-window that will receive the blended image
+ *   dest   - Describes the rectangular region in the client sub-window
+ *            that will receive the blended image.
+ *   blend  - The source image or color, the alpha map, and the opacity.
+ *            This is an array of size CONFIG_NX_NPLANES.
+ *   origin - The origin of the upper, left-most corner of the full image
+ *            and alpha map.  Both dest and origin are in sub-window
+ *            coordinates, however, the origin may lie outside of the
+ *            sub-window display.
+ *
+ * Return:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_BLEND
+EXTERN int nxtk_blendwindow(NXTKWINDOW hfwnd,
+                            FAR const struct nxgl_rect_s *dest,
+                            FAR const struct nxgl_blend_s blend[CONFIG_NX_NPLANES],
+                            FAR const struct nxgl_point_s *origin);
+#endif
+
 /****************************************************************************
  * Name: nxtk_opentoolbar
  *
@@ -705,6 +759,36 @@ EXTERN int nxtk_bitmaptoolbar(NXTKWINDOW hfwnd,
                               FAR const struct nxgl_point_s *origin,
                               unsigned int stride);
 
+/****************************************************************************
+ * Name: nxtk_blendtoolbar
+ *
+ * Description:
+ *   Alpha-blend a rectangular region of a larger image, or a solid color,
+ *   into the rectangle in the specified toolbar sub-window.
+ *
+ * Input Parameters:
+ *   hfwnd  - The sub-window whose toolbar that will receive the blended image
+ *   dest   - Describes the rectangular region in the toolbar sub-window
+ *            that will receive the blended image.
+ *   blend  - The source image or color, the alpha map, and the opacity.
+ *            This is an array of size CONFIG_NX_NPLANES.
+ *   origin - The origin of the upper, left-most corner of the full image
+ *            and alpha map.  Both dest and origin are in sub-window
+ *            coordinates, however, the origin may lie outside of the
+ *            sub-window display.
+ *
+ * Return:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_BLEND
+EXTERN int nxtk_blendtoolbar(NXTKWINDOW hfwnd,
+                             FAR const struct nxgl_rect_s *dest,
+                             FAR const struct nxgl_blend_s blend[CONFIG_NX_NPLANES],
+                             FAR const struct nxgl_point_s *origin);
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
@@ -1,7 +1,7 @@
 /****************************************************************************
  * include/nuttx/rwbuffer.h
  *
- *   Copyright (C) 2009 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2009, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -57,6 +57,22 @@
  * Pre-processor Definitions
  **********************************************************************/
 
+/* Configuration ******************************************************/
+/* CONFIG_FS_NWRBUFFERS - The number of write-behind buffers.  Each
+ *   buffer holds up to wrmaxblocks blocks.  While one buffer is being
+ *   written to the media on the worker thread, new write data can be
+ *   accepted into another.
+ */
+
+#ifdef CONFIG_FS_WRITEBUFFER
+#  ifndef CONFIG_FS_NWRBUFFERS
+#    define CONFIG_FS_NWRBUFFERS 2
+#  endif
+#  if CONFIG_FS_NWRBUFFERS < 1 || CONFIG_FS_NWRBUFFERS > 32
+#    error "CONFIG_FS_NWRBUFFERS must be in the range 1-32"
+#  endif
+#endif
+
 /**********************************************************************
  * Public Types
  **********************************************************************/
@@ -71,6 +87,20 @@ typedef ssize_t (*rwbreload_t)(FAR void *dev, FAR uint8_t *buffer,
 typedef ssize_t (*rwbflush_t)(FAR void *dev, FAR const uint8_t *buffer,
                               off_t startblock, size_t nblocks);
 
+/* This structure holds the state of one write-behind buffer.  Each
+ * buffer holds a run of up to wrmaxblocks contiguous blocks.
+ */
+
+#ifdef CONFIG_FS_WRITEBUFFER
+struct rwb_wrbuffer_s
+{
+  FAR uint8_t  *buffer;          /* Memory for wrmaxblocks blocks */
+  off_t         blockstart;      /* First block in the buffer */
+  uint16_t      nblocks;         /* Number of blocks in the buffer */
+  uint8_t       state;           /* Buffer state.  See rwbuffer.c */
+};
+#endif
+
 /* This structure holds the state of the buffers.  In typical usage,
  * an instance of this structure is declared within each block driver
  * status structure like:
@@ -115,7 +145,7 @@ struct rwbuffer_s
    */
 
 #ifdef CONFIG_FS_WRITEBUFFER
-  uint16_t      wrmaxblocks;     /* The number of blocks to buffer in memory */
+  uint16_t      wrmaxblocks;     /* The number of blocks in each write buffer */
   rwbflush_t    wrflush;         /* Callout to flush the write buffer */
 #endif
 
@@ -125,31 +155,35 @@ struct rwbuffer_s
    */
 
 #ifdef CONFIG_FS_READAHEAD
-  uint16_t      rhmaxblocks;     /* The number of blocks to buffer in memory */
+  uint16_t      rhmaxblocks;     /* Maximum size of the read-ahead window */
   rwbreload_t   rhreload;        /* Callout to reload the read-ahead buffer */
 #endif
 
   /********************************************************************/
   /* The user should never modify any of the remaing fields */
 
-  /* This is the state of the write buffer */
+  /* This is the state of the write buffers */
 
 #ifdef CONFIG_FS_WRITEBUFFER
-  sem_t         wrsem;           /* Enforces exclusive access to the write buffer */
-  struct work_s work;            /* Delayed work to flush buffer after adelay with no activity */
-  uint8_t      *wrbuffer;        /* Allocated write buffer */
-  uint16_t      wrnblocks;       /* Number of blocks in write buffer */
-  off_t         wrblockstart;    /* First block in write buffer */
-  off_t         wrexpectedblock; /* Next block expected */
+  sem_t         wrsem;           /* Enforces exclusive access to the write buffers */
+  sem_t         wrdone;          /* Posted when buffers have been flushed */
+  sem_t         devsem;          /* Serializes the driver callouts */
+  uint8_t       wrwaiters;       /* Number of threads waiting on wrdone */
+  struct work_s work;            /* Work to flush the buffers in the background */
+  uint8_t      *wrbuffer;        /* Allocated memory for all write buffers */
+  uint32_t      wrlastwrite;     /* System time of the last buffered write */
+  struct rwb_wrbuffer_s wrbuf[CONFIG_FS_NWRBUFFERS];
 #endif
 
   /* This is the state of the read-ahead buffer */
 
 #ifdef CONFIG_FS_READAHEAD
-  sem_t         rhsem;           /* Enforces exclusive access to the write buffer */
+  sem_t         rhsem;           /* Enforces exclusive access to the read-ahead buffer */
   uint8_t      *rhbuffer;        /* Allocated read-ahead buffer */
   uint16_t      rhnblocks;       /* Number of blocks in read-ahead buffer */
+  uint16_t      rhwindow;        /* Number of blocks to read on the next reload */
   off_t         rhblockstart;    /* First block in read-ahead buffer */
+  off_t         rhexpected;      /* Next block if access is sequential */
 #endif
 };
 
@@ -176,11 +210,16 @@ EXTERN void rwb_uninitialize(FAR struct rwbuffer_s *rwb);
 
 /* Buffer transfers */
 
+#ifdef CONFIG_FS_READAHEAD
 EXTERN ssize_t rwb_read(FAR struct rwbuffer_s *rwb, off_t startblock,
                         size_t blockcount, FAR uint8_t *rdbuffer);
+#endif
+#ifdef CONFIG_FS_WRITEBUFFER
 EXTERN ssize_t rwb_write(FAR struct rwbuffer_s *rwb,
                          off_t startblock, size_t blockcount,
                          FAR const uint8_t *wrbuffer);
+EXTERN int rwb_flush(FAR struct rwbuffer_s *rwb);
+#endif
 EXTERN int rwb_mediaremoved(FAR struct rwbuffer_s *rwb);
 
 #undef EXTERN
@@ -89,6 +89,18 @@ struct smart_read_write_s
   const uint8_t *buffer;        /* Pointer to the data to write */
 };
 
+/* Sector cache and directory index statistics.  These are returned by the
+ * FIOC_CACHESTATS ioctl on any open SMARTFS file.
+ */
+
+struct smartfs_cachestats_s
+{
+  uint32_t hits;          /* Sector reads satisfied from the sector cache */
+  uint32_t misses;        /* Sector reads passed to the block driver */
+  uint32_t ixhits;        /* Path segments resolved by the directory index */
+  uint32_t ixmisses;      /* Path segments resolved by scanning the directory */
+};
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
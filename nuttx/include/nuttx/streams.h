@@ -58,6 +58,8 @@ struct lib_outstream_s;
 
 typedef int  (*lib_getc_t)(FAR struct lib_instream_s *this);
 typedef void (*lib_putc_t)(FAR struct lib_outstream_s *this, int ch);
+typedef int  (*lib_puts_t)(FAR struct lib_outstream_s *this,
+                           FAR const char *buffer, int len);
 typedef int  (*lib_flush_t)(FAR struct lib_outstream_s *this);
 
 struct lib_instream_s
@@ -70,6 +72,8 @@ struct lib_instream_s
 struct lib_outstream_s
 {
   lib_putc_t  put;                /* Pointer to function to put one character */
+  lib_puts_t  puts;               /* Pointer to function to put a run of characters
+                                   * (optional, may be NULL) */
 #ifdef CONFIG_STDIO_LINEBUFFER
   lib_flush_t flush;              /* Pointer to function flush buffered characters */
 #endif
@@ -138,6 +142,28 @@ extern "C"
  * Public Function Prototypes
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: lib_stream_puts
+ *
+ * Description:
+ *   Send a run of characters to an output stream.  If the stream provides
+ *   a puts method, the entire run is transferred in one call; otherwise
+ *   the characters are transferred one at a time using the put method.
+ *   Defined in lib/lib_streamputs.c
+ *
+ * Input parameters:
+ *   stream - An initialized output stream
+ *   buffer - The characters to be sent
+ *   len    - The number of characters in buffer
+ *
+ * Returned Value:
+ *   The number of characters sent.
+ *
+ ****************************************************************************/
+
+EXTERN int lib_stream_puts(FAR struct lib_outstream_s *stream,
+                           FAR const char *buffer, int len);
+
 /****************************************************************************
  * Name: lib_meminstream, lib_memoutstream
  *
@@ -271,6 +271,12 @@
 #define USBMSC_CLASSSTATE_CMDFINISHCMDSTATUS         0x000d
 #define USBMSC_CLASSSTATE_CMDSTATUSIDLE              0x000e
 
+/* Other USB storage events */
+
+#define USBMSC_CLASSSTATE_READAHEAD                  0x000f /* Prefetched sectors (value=count) */
+#define USBMSC_CLASSSTATE_READAHEADHIT               0x0010 /* Read used prefetched sectors */
+#define USBMSC_CLASSSTATE_CMDLATENCY                 0x0011 /* CBW to CSW time (value=ticks) */
+
 /* Values of the class error ID used by the USB storage driver */
 
 #define USBMSC_TRACEERR_ALLOCCTRLREQ                 0x0001
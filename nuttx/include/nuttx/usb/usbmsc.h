@@ -1,7 +1,7 @@
 /************************************************************************************
  * include/nuttx/usb/usbmsc.h
  *
- *   Copyright (C) 2008-2010, 2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2008-2010, 2012-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * NOTE:  This interface was inspired by the Linux gadget interface by
@@ -60,6 +60,33 @@
  * Public Types
  ************************************************************************************/
 
+#ifdef CONFIG_USBMSC_STATS
+/* Statistics for one class of SCSI commands.  Latencies are measured in system
+ * timer ticks from the receipt of the CBW until the CSW is queued for transfer.
+ */
+
+struct usbmsc_cmdstats_s
+{
+  uint32_t ncmds;              /* Number of commands processed */
+  uint32_t nsectors;           /* Number of sectors transferred */
+  uint32_t totalticks;         /* Sum of all command latencies */
+  uint32_t maxticks;           /* Worst case command latency */
+};
+
+/* Statistics returned by usbmsc_getstats() */
+
+struct usbmsc_stats_s
+{
+  struct usbmsc_cmdstats_s read;  /* READ6/10/12 commands */
+  struct usbmsc_cmdstats_s write; /* WRITE6/10/12 commands */
+  struct usbmsc_cmdstats_s other; /* All other commands */
+  uint32_t ioread;             /* Number of block driver read calls */
+  uint32_t iowrite;            /* Number of block driver write calls */
+  uint32_t prefetched;         /* Number of sectors read into the second buffer */
+  uint32_t prefetchhits;       /* Number of prefetched sectors sent to the host */
+};
+#endif
+
  /************************************************************************************
  * Public Data
  ************************************************************************************/
@@ -251,6 +278,29 @@ EXTERN int usbmsc_classobject(FAR void *handle, FAR struct usbdevclass_driver_s
 
 EXTERN void usbmsc_uninitialize(FAR void *handle);
 
+/************************************************************************************
+ * Name: usbmsc_getstats
+ *
+ * Description:
+ *   Return the command statistics collected by the USB storage class driver
+ *   (CONFIG_USBMSC_STATS).
+ *
+ * Input Parameters:
+ *   handle - The handle returned by a previous call to usbmsc_configure()
+ *     (or usbmsc_classobject()).
+ *   stats - The location to return the statistics.
+ *   reset - True: Reset the statistics after they are sampled.
+ *
+ * Returned Value:
+ *   0 on success; a negated errno on failure
+ *
+ ***********************************************************************************/
+
+#ifdef CONFIG_USBMSC_STATS
+EXTERN int usbmsc_getstats(FAR void *handle, FAR struct usbmsc_stats_s *stats,
+                           bool reset);
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
@@ -60,6 +60,20 @@
 
 #define EOF        (-1)
 
+/* Buffering modes for setvbuf() */
+
+#define _IOFBF     0  /* Fully buffered */
+#define _IOLBF     1  /* Line buffered */
+#define _IONBF     2  /* Unbuffered */
+
+/* Default size of the stream buffer used by setbuf() */
+
+#if defined(CONFIG_STDIO_BUFFER_SIZE) && CONFIG_STDIO_BUFFER_SIZE > 0
+#  define BUFSIZ   CONFIG_STDIO_BUFFER_SIZE
+#else
+#  define BUFSIZ   64
+#endif
+
 /* The first three _iob entries are reserved for standard I/O */
 
 #define stdin  (&sched_getstreams()->sl_streams[0])
@@ -121,6 +135,8 @@ int    fputs(FAR const char *s, FAR FILE *stream);
 size_t fread(FAR void *ptr, size_t size, size_t n_items, FAR FILE *stream);
 int    fseek(FAR FILE *stream, long int offset, int whence);
 int    fsetpos(FAR FILE *stream, FAR fpos_t *pos);
+void   setbuf(FAR FILE *stream, FAR char *buf);
+int    setvbuf(FAR FILE *stream, FAR char *buffer, int mode, size_t size);
 long   ftell(FAR FILE *stream);
 size_t fwrite(FAR const void *ptr, size_t size, size_t n_items, FAR FILE *stream);
 FAR char *gets(FAR char *s);
@@ -183,10 +183,17 @@ long int labs(long int j);
 long long int llabs(long long int j);
 #endif
 
-/* Sorting */
+/* Sorting and searching */
 
 void     qsort(void *base, size_t nmemb, size_t size,
                int(*compar)(const void *, const void *));
+void     qselect(void *base, size_t nmemb, size_t size, size_t nth,
+                 int(*compar)(const void *, const void *));
+void     qsort_partial(void *base, size_t nmemb, size_t size,
+                       size_t nsorted,
+                       int(*compar)(const void *, const void *));
+void    *bsearch(const void *key, const void *base, size_t nel,
+                 size_t width, int(*compar)(const void *, const void *));
 
 #ifdef CONFIG_CAN_PASS_STRUCTS
 struct mallinfo mallinfo(void);
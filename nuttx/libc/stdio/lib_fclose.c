@@ -1,7 +1,7 @@
 /****************************************************************************
  * libc/stdio/lib_fclose.c
  *
- *   Copyright (C) 2007-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2007-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -112,9 +112,10 @@ int fclose(FAR FILE *stream)
 
       sem_destroy(&stream->fs_sem);
 
-      /* Release the buffer */
+      /* Release the buffer (unless it was provided by the user) */
 
-      if (stream->fs_bufstart)
+      if (stream->fs_bufstart &&
+          (stream->fs_flags & __FS_FLAG_UBF) == 0)
         {
           lib_free(stream->fs_bufstart);
         }
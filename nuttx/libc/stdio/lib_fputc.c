@@ -1,7 +1,7 @@
 /****************************************************************************
  * libc/stdio/lib_fputc.c
  *
- *   Copyright (C) 2007, 2008, 2011-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2007, 2008, 2011-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -92,18 +92,10 @@ int fputc(int c, FAR FILE *stream)
   ret = lib_fwrite(&buf, 1, stream);
   if (ret > 0)
     {
-      /* Flush the buffer if a newline is output */
-
-#ifdef CONFIG_STDIO_LINEBUFFER
-      if (c == '\n')
-        {
-          ret = lib_fflush(stream, true);
-          if (ret < 0)
-            {
-              return EOF;
-            }
-        }
-#endif
+      /* lib_fwrite() will flush the buffer if a newline was output to a
+       * line buffered stream.
+       */
+
       return c;
     }
   else
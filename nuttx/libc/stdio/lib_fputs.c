@@ -1,7 +1,7 @@
 /****************************************************************************
  * libc/stdio/lib_fputs.c
  *
- *   Copyright (C) 2007, 2008, 2011-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2007, 2008, 2011-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -123,62 +123,6 @@ int fputs(FAR const char *s, FAR FILE *stream)
         {
           return EOF;
         }
-
-      /* Flush the buffer if a newline was written to the buffer */
-
-#ifdef CONFIG_STDIO_LINEBUFFER
-      if (ch == '\n')
-        {
-          ret = lib_fflush(stream, true);
-          if (ret < 0)
-            {
-              return EOF;
-            }
-        }
-#endif
-    }
-
-  return nput;
-}
-
-#elif defined(CONFIG_STDIO_LINEBUFFER)
-int fputs(FAR const char *s, FAR FILE *stream)
-{
-  int nput;
-  int ret;
-
-  /* Make sure that a string was provided. */
-
-#ifdef CONFIG_DEBUG /* Most parameter checking is disabled if DEBUG is off */
-  if (!s)
-    {
-      set_errno(EINVAL);
-      return EOF;
-    }
-#endif
-
-  /* Write the string.  Loop until the null terminator is encountered */
-
-  for (nput = 0; *s; nput++, s++)
-    {
-      /* Write the next character to the stream buffer */
-
-      ret = lib_fwrite(s, 1, stream);
-      if (ret <= 0)
-        {
-          return EOF;
-        }
-
-      /* Flush the buffer if a newline was written to the buffer */
-
-      if (*s == '\n')
-        {
-          ret = lib_fflush(stream, true);
-          if (ret < 0)
-            {
-              return EOF;
-            }
-        }
     }
 
   return nput;
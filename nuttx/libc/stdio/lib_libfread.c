@@ -143,12 +143,20 @@ ssize_t lib_fread(FAR void *ptr, size_t count, FAR FILE *stream)
         {
           /* Is there readable data in the buffer? */
 
-          while ((count > 0) && (stream->fs_bufpos < stream->fs_bufread))
+          if (stream->fs_bufpos < stream->fs_bufread)
             {
-              /* Yes, copy a byte into the user buffer */
+              /* Yes, copy as much as we need into the user buffer */
 
-              *dest++ = *stream->fs_bufpos++;
-              count--;
+              size_t gulp_size = stream->fs_bufread - stream->fs_bufpos;
+              if (gulp_size > count)
+                {
+                  gulp_size = count;
+                }
+
+              memcpy(dest, stream->fs_bufpos, gulp_size);
+              stream->fs_bufpos += gulp_size;
+              dest              += gulp_size;
+              count             -= gulp_size;
             }
 
           /* The buffer is empty OR we have already supplied the number of
@@ -172,8 +180,8 @@ ssize_t lib_fread(FAR void *ptr, size_t count, FAR FILE *stream)
 
               /* Will the number of bytes that we need to read fit into
                * the buffer space that is available? If the read size is
-               * larger than the buffer, then read some of the data
-               * directly into the user's buffer.
+               * larger than the buffer (or if the stream is unbuffered),
+               * then read the data directly into the user's buffer.
                */
 
               if (count > buffer_available)
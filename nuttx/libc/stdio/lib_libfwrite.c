@@ -1,7 +1,7 @@
 /****************************************************************************
  * libc/stdio/lib_libfwrite.c
  *
- *   Copyright (C) 2007-2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2007-2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -42,6 +42,7 @@
 #include <sys/types.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
@@ -90,7 +91,7 @@ ssize_t lib_fwrite(FAR const void *ptr, size_t count, FAR FILE *stream)
   FAR const unsigned char *start = ptr;
   FAR const unsigned char *src   = ptr;
   ssize_t ret = ERROR;
-  unsigned char *dest;
+  size_t bufsize;
 
   /* Make sure that writing to this stream is allowed */
 
@@ -114,6 +115,43 @@ ssize_t lib_fwrite(FAR const void *ptr, size_t count, FAR FILE *stream)
       goto errout_with_semaphore;
     }
 
+  /* If the stream is unbuffered or if the write is at least as large as the
+   * whole buffer, then there is nothing to be gained by copying the data
+   * through the buffer.  Flush any data already buffered (to preserve
+   * ordering) and write the user data directly.
+   */
+
+  bufsize = stream->fs_bufend - stream->fs_bufstart;
+  if (count >= bufsize)
+    {
+      if (lib_fflush(stream, true) < 0)
+        {
+          goto errout_with_semaphore;
+        }
+
+      while (count > 0)
+        {
+          ssize_t nwritten = write(stream->fs_filedes, src, count);
+          if (nwritten < 0)
+            {
+              /* Report the error only if nothing was written */
+
+              if (src == start)
+                {
+                  goto errout_with_semaphore;
+                }
+
+              break;
+            }
+
+          src   += nwritten;
+          count -= nwritten;
+        }
+
+      ret = src - start;
+      goto errout_with_semaphore;
+    }
+
   /* Loop until all of the bytes have been buffered */
 
   while (count > 0)
@@ -133,23 +171,16 @@ ssize_t lib_fwrite(FAR const void *ptr, size_t count, FAR FILE *stream)
           gulp_size = count;
         }
 
-      /* Adjust the number of bytes remaining to be transferred
-       * on the next pass through the loop (might be zero).
-       */
-
-      count -= gulp_size;
-
       /* Transfer the data into the buffer */
 
-      for (dest = stream->fs_bufpos; gulp_size > 0; gulp_size--)
-        {
-          *dest++ = *src++;
-        }
-      stream->fs_bufpos = dest;
+      memcpy(stream->fs_bufpos, src, gulp_size);
+      stream->fs_bufpos += gulp_size;
+      src               += gulp_size;
+      count             -= gulp_size;
 
       /* Is the buffer full? */
 
-      if (dest >= stream->fs_bufend)
+      if (stream->fs_bufpos >= stream->fs_bufend)
         {
           /* Flush the buffered data to the IO stream */
 
@@ -161,6 +192,19 @@ ssize_t lib_fwrite(FAR const void *ptr, size_t count, FAR FILE *stream)
         }
     }
 
+  /* If the stream is line buffered, then flush the buffer if a newline
+   * was written.
+   */
+
+  if ((stream->fs_flags & __FS_FLAG_LBF) != 0 &&
+      memchr(start, '\n', src - start) != NULL)
+    {
+      if (lib_fflush(stream, true) < 0)
+        {
+          goto errout_with_semaphore;
+        }
+    }
+
   /* Return the number of bytes written */
 
   ret = src - start;
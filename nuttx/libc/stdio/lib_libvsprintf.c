@@ -1,7 +1,7 @@
 /****************************************************************************
  * libc/stdio/lib_libvsprintf.c
  *
- *   Copyright (C) 2007-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2007-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -40,6 +40,7 @@
 #include <nuttx/compiler.h>
 
 #include <stdint.h>
+#include <limits.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
@@ -99,6 +100,21 @@
 #define IS_NEGATE(f)             (((f) & FLAG_NEGATE) != 0)
 #define IS_SIGNED(f)             (((f) & (FLAG_SHOWPLUS|FLAG_NEGATE)) != 0)
 
+/* Integer conversions are performed into a scratch buffer on the stack and
+ * then sent to the output stream as a single run.  The buffer must be large
+ * enough to hold the binary representation of the largest integer type.
+ */
+
+#ifdef CONFIG_HAVE_LONG_LONG
+#  define CONVBUFSIZE  (8 * sizeof(unsigned long long))
+#else
+#  define CONVBUFSIZE  (8 * sizeof(unsigned long))
+#endif
+
+/* Field padding is sent to the output stream in chunks of this size */
+
+#define PADCHUNKSIZE   16
+
 /* If CONFIG_ARCH_ROMGETC is defined, then it is assumed that the format
  * string data cannot be accessed by simply de-referencing the format string
  * pointer.  This might be in the case in Harvard architectures where string
@@ -153,6 +169,7 @@ static int  getsizesize(uint8_t fmt, uint8_t flags, FAR void *p)
 
 /* Unsigned int to ASCII conversion */
 
+static FAR char *utodigits(FAR char *ptr, unsigned int n);
 static void utodec(FAR struct lib_outstream_s *obj, unsigned int n);
 static void utohex(FAR struct lib_outstream_s *obj, unsigned int n, uint8_t a);
 static void utooct(FAR struct lib_outstream_s *obj, unsigned int n);
@@ -196,6 +213,8 @@ static int  getllusize(uint8_t fmt, FAR uint8_t flags, FAR unsigned long long ll
 #endif
 
 #ifndef CONFIG_NOPRINTF_FIELDWIDTH
+static void padfield(FAR struct lib_outstream_s *obj, FAR const char *fill,
+                     int npad);
 static void prejustify(FAR struct lib_outstream_s *obj, uint8_t fmt,
                        uint8_t flags, int fieldwidth, int valwidth);
 static void postjustify(FAR struct lib_outstream_s *obj, uint8_t fmt,
@@ -216,6 +235,27 @@ static void postjustify(FAR struct lib_outstream_s *obj, uint8_t fmt,
 
 static const char g_nullstring[] = "(null)";
 
+/* Decimal digit pairs "00" through "99".  Decimal conversions produce two
+ * digits per division using this table.
+ */
+
+static const char g_digitpairs[201] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+#ifndef CONFIG_NOPRINTF_FIELDWIDTH
+static const char g_spaces[PADCHUNKSIZE + 1] = "                ";
+static const char g_zeroes[PADCHUNKSIZE + 1] = "0000000000000000";
+#endif
+
 /****************************************************************************
  * Private Variables
  ****************************************************************************/
@@ -289,20 +329,52 @@ static int getpsize(uint8_t flags, FAR void *p)
 #endif /* CONFIG_PTR_IS_NOT_INT */
 
 /****************************************************************************
- * Name: utodec
+ * Name: utodigits
+ *
+ * Description:
+ *   Convert an unsigned integer to decimal digits, working backward from
+ *   ptr.  Two digits are produced per division.  Returns a pointer to the
+ *   most significant digit.
+ *
  ****************************************************************************/
 
-static void utodec(FAR struct lib_outstream_s *obj, unsigned int n)
+static FAR char *utodigits(FAR char *ptr, unsigned int n)
 {
-  unsigned int remainder = n % 10;
-  unsigned int dividend  = n / 10;
+  unsigned int pair;
 
-  if (dividend)
+  while (n >= 100)
     {
-      utodec(obj, dividend);
+      pair   = (n % 100) << 1;
+      n     /= 100;
+      *--ptr = g_digitpairs[pair + 1];
+      *--ptr = g_digitpairs[pair];
     }
 
-  obj->put(obj, (remainder + (unsigned int)'0'));
+  if (n >= 10)
+    {
+      pair   = n << 1;
+      *--ptr = g_digitpairs[pair + 1];
+      *--ptr = g_digitpairs[pair];
+    }
+  else
+    {
+      *--ptr = (char)n + '0';
+    }
+
+  return ptr;
+}
+
+/****************************************************************************
+ * Name: utodec
+ ****************************************************************************/
+
+static void utodec(FAR struct lib_outstream_s *obj, unsigned int n)
+{
+  char buffer[CONVBUFSIZE];
+  FAR char *end = &buffer[CONVBUFSIZE];
+  FAR char *ptr = utodigits(end, n);
+
+  (void)lib_stream_puts(obj, ptr, end - ptr);
 }
 
 /****************************************************************************
@@ -311,31 +383,20 @@ static void utodec(FAR struct lib_outstream_s *obj, unsigned int n)
 
 static void utohex(FAR struct lib_outstream_s *obj, unsigned int n, uint8_t a)
 {
-  bool    nonzero = false;
-  uint8_t bits;
+  char buffer[CONVBUFSIZE];
+  FAR char *end = &buffer[CONVBUFSIZE];
+  FAR char *ptr = end;
+  uint8_t nibble;
 
-  for (bits = 8*sizeof(unsigned int); bits > 0; bits -= 4)
+  do
     {
-      uint8_t nibble = (uint8_t)((n >> (bits - 4)) & 0xf);
-      if (nibble || nonzero)
-        {
-          nonzero = true;
-
-          if (nibble < 10)
-            {
-              obj->put(obj, nibble + '0');
-            }
-          else
-            {
-              obj->put(obj, nibble + a - 10);
-            }
-        }
+      nibble = (uint8_t)(n & 0xf);
+      *--ptr = nibble < 10 ? nibble + '0' : nibble + a - 10;
+      n    >>= 4;
     }
+  while (n);
 
-  if (!nonzero)
-    {
-      obj->put(obj, '0');
-    }
+  (void)lib_stream_puts(obj, ptr, end - ptr);
 }
 
 /****************************************************************************
@@ -344,15 +405,18 @@ static void utohex(FAR struct lib_outstream_s *obj, unsigned int n, uint8_t a)
 
 static void utooct(FAR struct lib_outstream_s *obj, unsigned int n)
 {
-  unsigned int remainder = n & 0x7;
-  unsigned int dividend = n >> 3;
+  char buffer[CONVBUFSIZE];
+  FAR char *end = &buffer[CONVBUFSIZE];
+  FAR char *ptr = end;
 
-  if (dividend)
+  do
     {
-      utooct(obj, dividend);
+      *--ptr = (char)(n & 0x7) + '0';
+      n    >>= 3;
     }
+  while (n);
 
-  obj->put(obj, (remainder + (unsigned int)'0'));
+  (void)lib_stream_puts(obj, ptr, end - ptr);
 }
 
 /****************************************************************************
@@ -361,15 +425,18 @@ static void utooct(FAR struct lib_outstream_s *obj, unsigned int n)
 
 static void utobin(FAR struct lib_outstream_s *obj, unsigned int n)
 {
-  unsigned int remainder = n & 1;
-  unsigned int dividend = n >> 1;
+  char buffer[CONVBUFSIZE];
+  FAR char *end = &buffer[CONVBUFSIZE];
+  FAR char *ptr = end;
 
-  if (dividend)
+  do
     {
-      utobin(obj, dividend);
+      *--ptr = (char)(n & 1) + '0';
+      n    >>= 1;
     }
+  while (n);
 
-  obj->put(obj, (remainder + (unsigned int)'0'));
+  (void)lib_stream_puts(obj, ptr, end - ptr);
 }
 
 /****************************************************************************
@@ -562,15 +629,25 @@ static int getdblsize(uint8_t fmt, int trunc, uint8_t flags, double n)
 
 static void lutodec(FAR struct lib_outstream_s *obj, unsigned long n)
 {
-  unsigned int  remainder = n % 10;
-  unsigned long dividend  = n / 10;
+  char buffer[CONVBUFSIZE];
+  FAR char *end = &buffer[CONVBUFSIZE];
+  FAR char *ptr = end;
+  unsigned int pair;
 
-  if (dividend)
+  /* Produce digit pairs with (slower) long arithmetic only until the
+   * remaining value fits in an unsigned int.
+   */
+
+  while (n > UINT_MAX)
     {
-      lutodec(obj, dividend);
+      pair   = (unsigned int)(n % 100) << 1;
+      n     /= 100;
+      *--ptr = g_digitpairs[pair + 1];
+      *--ptr = g_digitpairs[pair];
     }
 
-  obj->put(obj, (remainder + (unsigned int)'0'));
+  ptr = utodigits(ptr, (unsigned int)n);
+  (void)lib_stream_puts(obj, ptr, end - ptr);
 }
 
 /****************************************************************************
@@ -579,31 +656,20 @@ static void lutodec(FAR struct lib_outstream_s *obj, unsigned long n)
 
 static void lutohex(FAR struct lib_outstream_s *obj, unsigned long n, uint8_t a)
 {
-  bool    nonzero = false;
-  uint8_t bits;
+  char buffer[CONVBUFSIZE];
+  FAR char *end = &buffer[CONVBUFSIZE];
+  FAR char *ptr = end;
+  uint8_t nibble;
 
-  for (bits = 8*sizeof(unsigned long); bits > 0; bits -= 4)
+  do
     {
-      uint8_t nibble = (uint8_t)((n >> (bits - 4)) & 0xf);
-      if (nibble || nonzero)
-        {
-          nonzero = true;
-
-          if (nibble < 10)
-            {
-              obj->put(obj, nibble + '0');
-            }
-          else
-            {
-              obj->put(obj, nibble + a - 10);
-            }
-        }
+      nibble = (uint8_t)(n & 0xf);
+      *--ptr = nibble < 10 ? nibble + '0' : nibble + a - 10;
+      n    >>= 4;
     }
+  while (n);
 
-  if (!nonzero)
-    {
-      obj->put(obj, '0');
-    }
+  (void)lib_stream_puts(obj, ptr, end - ptr);
 }
 
 /****************************************************************************
@@ -612,15 +678,18 @@ static void lutohex(FAR struct lib_outstream_s *obj, unsigned long n, uint8_t a)
 
 static void lutooct(FAR struct lib_outstream_s *obj, unsigned long n)
 {
-  unsigned int  remainder = n & 0x7;
-  unsigned long dividend  = n >> 3;
+  char buffer[CONVBUFSIZE];
+  FAR char *end = &buffer[CONVBUFSIZE];
+  FAR char *ptr = end;
 
-  if (dividend)
+  do
     {
-      lutooct(obj, dividend);
+      *--ptr = (char)(n & 0x7) + '0';
+      n    >>= 3;
     }
+  while (n);
 
-  obj->put(obj, (remainder + (unsigned int)'0'));
+  (void)lib_stream_puts(obj, ptr, end - ptr);
 }
 
 /****************************************************************************
@@ -629,15 +698,18 @@ static void lutooct(FAR struct lib_outstream_s *obj, unsigned long n)
 
 static void lutobin(FAR struct lib_outstream_s *obj, unsigned long n)
 {
-  unsigned int  remainder = n & 1;
-  unsigned long dividend  = n >> 1;
+  char buffer[CONVBUFSIZE];
+  FAR char *end = &buffer[CONVBUFSIZE];
+  FAR char *ptr = end;
 
-  if (dividend)
+  do
     {
-      lutobin(obj, dividend);
+      *--ptr = (char)(n & 1) + '0';
+      n    >>= 1;
     }
+  while (n);
 
-  obj->put(obj, (remainder + (unsigned int)'0'));
+  (void)lib_stream_puts(obj, ptr, end - ptr);
 }
 
 /****************************************************************************
@@ -812,15 +884,25 @@ static int getlusize(uint8_t fmt, uint8_t flags, unsigned long ln)
 
 static void llutodec(FAR struct lib_outstream_s *obj, unsigned long long n)
 {
-  unsigned int remainder = n % 10;
-  unsigned long long dividend = n / 10;
+  char buffer[CONVBUFSIZE];
+  FAR char *end = &buffer[CONVBUFSIZE];
+  FAR char *ptr = end;
+  unsigned int pair;
 
-  if (dividend)
+  /* Produce digit pairs with (slower) long long arithmetic only until the
+   * remaining value fits in an unsigned int.
+   */
+
+  while (n > UINT_MAX)
     {
-      llutodec(obj, dividend);
+      pair   = (unsigned int)(n % 100) << 1;
+      n     /= 100;
+      *--ptr = g_digitpairs[pair + 1];
+      *--ptr = g_digitpairs[pair];
     }
 
-  obj->put(obj, (remainder + (unsigned int)'0'));
+  ptr = utodigits(ptr, (unsigned int)n);
+  (void)lib_stream_puts(obj, ptr, end - ptr);
 }
 
 /****************************************************************************
@@ -829,31 +911,20 @@ static void llutodec(FAR struct lib_outstream_s *obj, unsigned long long n)
 
 static void llutohex(FAR struct lib_outstream_s *obj, unsigned long long n, uint8_t a)
 {
-  bool    nonzero = false;
-  uint8_t bits;
+  char buffer[CONVBUFSIZE];
+  FAR char *end = &buffer[CONVBUFSIZE];
+  FAR char *ptr = end;
+  uint8_t nibble;
 
-  for (bits = 8*sizeof(unsigned long long); bits > 0; bits -= 4)
+  do
     {
-      uint8_t nibble = (uint8_t)((n >> (bits - 4)) & 0xf);
-      if (nibble || nonzero)
-        {
-          nonzero = true;
-
-          if (nibble < 10)
-            {
-              obj->put(obj, (nibble + '0'));
-            }
-          else
-            {
-              obj->put(obj, (nibble + a - 10));
-            }
-        }
+      nibble = (uint8_t)(n & 0xf);
+      *--ptr = nibble < 10 ? nibble + '0' : nibble + a - 10;
+      n    >>= 4;
     }
+  while (n);
 
-  if (!nonzero)
-    {
-      obj->put(obj, '0');
-    }
+  (void)lib_stream_puts(obj, ptr, end - ptr);
 }
 
 /****************************************************************************
@@ -862,15 +933,18 @@ static void llutohex(FAR struct lib_outstream_s *obj, unsigned long long n, uint
 
 static void llutooct(FAR struct lib_outstream_s *obj, unsigned long long n)
 {
-  unsigned int remainder = n & 0x7;
-  unsigned long long dividend = n >> 3;
+  char buffer[CONVBUFSIZE];
+  FAR char *end = &buffer[CONVBUFSIZE];
+  FAR char *ptr = end;
 
-  if (dividend)
+  do
     {
-      llutooct(obj, dividend);
+      *--ptr = (char)(n & 0x7) + '0';
+      n    >>= 3;
     }
+  while (n);
 
-  obj->put(obj, (remainder + (unsigned int)'0'));
+  (void)lib_stream_puts(obj, ptr, end - ptr);
 }
 
 /****************************************************************************
@@ -879,15 +953,18 @@ static void llutooct(FAR struct lib_outstream_s *obj, unsigned long long n)
 
 static void llutobin(FAR struct lib_outstream_s *obj, unsigned long long n)
 {
-  unsigned int remainder = n & 1;
-  unsigned long long dividend = n >> 1;
+  char buffer[CONVBUFSIZE];
+  FAR char *end = &buffer[CONVBUFSIZE];
+  FAR char *ptr = end;
 
-  if (dividend)
+  do
     {
-      llutobin(obj, dividend);
+      *--ptr = (char)(n & 1) + '0';
+      n    >>= 1;
     }
+  while (n);
 
-  obj->put(obj, (remainder + (unsigned int)'0'));
+  (void)lib_stream_puts(obj, ptr, end - ptr);
 }
 
 /****************************************************************************
@@ -1056,6 +1133,25 @@ static int getllusize(uint8_t fmt, uint8_t flags, unsigned long long lln)
 #endif /* CONFIG_NOPRINTF_FIELDWIDTH */
 #endif /* CONFIG_HAVE_LONG_LONG */
 
+/****************************************************************************
+ * Name: padfield
+ ****************************************************************************/
+
+#ifndef CONFIG_NOPRINTF_FIELDWIDTH
+static void padfield(FAR struct lib_outstream_s *obj, FAR const char *fill,
+                     int npad)
+{
+  int nchunk;
+
+  while (npad > 0)
+    {
+      nchunk = npad > PADCHUNKSIZE ? PADCHUNKSIZE : npad;
+      (void)lib_stream_puts(obj, fill, nchunk);
+      npad  -= nchunk;
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: prejustify
  ****************************************************************************/
@@ -1064,8 +1160,6 @@ static int getllusize(uint8_t fmt, uint8_t flags, unsigned long long lln)
 static void prejustify(FAR struct lib_outstream_s *obj, uint8_t fmt,
                        uint8_t flags, int fieldwidth, int valwidth)
 {
-  int i;
-
   switch (fmt)
     {
       default:
@@ -1075,10 +1169,7 @@ static void prejustify(FAR struct lib_outstream_s *obj, uint8_t fmt,
             valwidth++;
           }
 
-        for (i = fieldwidth - valwidth; i > 0; i--)
-          {
-            obj->put(obj, ' ');
-          }
+        padfield(obj, g_spaces, fieldwidth - valwidth);
 
         if (IS_NEGATE(flags))
           {
@@ -1102,10 +1193,7 @@ static void prejustify(FAR struct lib_outstream_s *obj, uint8_t fmt,
             valwidth++;
           }
 
-        for (i = fieldwidth - valwidth; i > 0; i--)
-          {
-            obj->put(obj, '0');
-          }
+        padfield(obj, g_zeroes, fieldwidth - valwidth);
         break;
 
       case FMT_LJUST:
@@ -1130,8 +1218,6 @@ static void prejustify(FAR struct lib_outstream_s *obj, uint8_t fmt,
 static void postjustify(FAR struct lib_outstream_s *obj, uint8_t fmt,
                         uint8_t flags, int fieldwidth, int valwidth)
 {
-  int i;
-
   /* Apply field justification to the integer value. */
 
   switch (fmt)
@@ -1147,10 +1233,7 @@ static void postjustify(FAR struct lib_outstream_s *obj, uint8_t fmt,
             valwidth++;
           }
 
-        for (i = fieldwidth - valwidth; i > 0; i--)
-          {
-            obj->put(obj, ' ');
-          }
+        padfield(obj, g_spaces, fieldwidth - valwidth);
         break;
     }
 }
@@ -1185,9 +1268,31 @@ int lib_vsprintf(FAR struct lib_outstream_s *obj, FAR const char *src, va_list a
 
       if (FMT_CHAR != '%')
         {
+#ifdef CONFIG_ARCH_ROMGETC
            /* Output the character */
 
            obj->put(obj, FMT_CHAR);
+#else
+           /* Output the entire run of regular characters up to the next
+            * format specifier in one operation.  When line buffering, the
+            * run also ends with a newline so that the flush below occurs
+            * at the correct point.  src is left pointing at the last
+            * character of the run.
+            */
+
+           FAR const char *run = src;
+
+           while (src[1] != '\0' && src[1] != '%'
+#ifdef CONFIG_STDIO_LINEBUFFER
+                  && *src != '\n'
+#endif
+                 )
+             {
+               src++;
+             }
+
+           (void)lib_stream_puts(obj, run, src - run + 1);
+#endif
 
            /* Flush the buffer if a newline is encountered */
 
@@ -1358,9 +1463,8 @@ int lib_vsprintf(FAR struct lib_outstream_s *obj, FAR const char *src, va_list a
 
       if (FMT_CHAR == 's')
         {
-#ifndef CONFIG_NOPRINTF_FIELDWIDTH
           int swidth;
-#endif
+
           /* Get the string to output */
 
           ptmp = va_arg(ap, char *);
@@ -1373,17 +1477,13 @@ int lib_vsprintf(FAR struct lib_outstream_s *obj, FAR const char *src, va_list a
            * operations.
            */
 
-#ifndef CONFIG_NOPRINTF_FIELDWIDTH
           swidth = strlen(ptmp);
+#ifndef CONFIG_NOPRINTF_FIELDWIDTH
           prejustify(obj, fmt, 0, width, swidth);
 #endif
           /* Concatenate the string into the output */
 
-          while (*ptmp)
-            {
-              obj->put(obj, *ptmp);
-              ptmp++;
-            }
+          (void)lib_stream_puts(obj, ptmp, swidth);
 
           /* Perform left-justification operations. */
 
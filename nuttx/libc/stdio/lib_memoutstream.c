@@ -37,6 +37,7 @@
  * Included Files
  ****************************************************************************/
 
+#include <string.h>
 #include <assert.h>
 
 #include "lib_internal.h"
@@ -68,6 +69,38 @@ static void memoutstream_putc(FAR struct lib_outstream_s *this, int ch)
     }
 }
 
+/****************************************************************************
+ * Name: memoutstream_puts
+ ****************************************************************************/
+
+static int memoutstream_puts(FAR struct lib_outstream_s *this,
+                             FAR const char *buffer, int len)
+{
+  FAR struct lib_memoutstream_s *mthis = (FAR struct lib_memoutstream_s *)this;
+  int ncopy;
+
+  DEBUGASSERT(this && buffer);
+
+  /* Copy as much of the run as will fit into the buffer.  Characters that
+   * would overrun the buffer are silently discarded, just as with putc.
+   */
+
+  ncopy = mthis->buflen - this->nput;
+  if (ncopy > len)
+    {
+      ncopy = len;
+    }
+
+  if (ncopy > 0)
+    {
+      memcpy(&mthis->buffer[this->nput], buffer, ncopy);
+      this->nput += ncopy;
+      mthis->buffer[this->nput] = '\0';
+    }
+
+  return len;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -93,6 +126,7 @@ void lib_memoutstream(FAR struct lib_memoutstream_s *memoutstream,
                       FAR char *bufstart, int buflen)
 {
   memoutstream->public.put   = memoutstream_putc;
+  memoutstream->public.puts  = memoutstream_puts;
 #ifdef CONFIG_STDIO_LINEBUFFER
   memoutstream->public.flush = lib_noflush;
 #endif
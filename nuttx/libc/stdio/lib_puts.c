@@ -1,7 +1,7 @@
 /****************************************************************************
  * libc/stdio/lib_puts.c
  *
- *   Copyright (C) 2007, 2008, 2011-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2007, 2008, 2011-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -112,15 +112,9 @@ int puts(FAR const char *s)
         {
           nput = nwritten + 1;
 
-          /* Flush the buffer after the newline is output. */
-
-#ifdef CONFIG_STDIO_LINEBUFFER
-          ret = lib_fflush(stream, true);
-          if (ret < 0)
-            {
-              nput = EOF;
-            }
-#endif
+          /* lib_fwrite() flushes the buffer after the newline is output
+           * if stdout is line buffered.
+           */
         }
     }
 
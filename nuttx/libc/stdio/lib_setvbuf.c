@@ -0,0 +1,214 @@
+/****************************************************************************
+ * libc/stdio/lib_setvbuf.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#include "lib_internal.h"
+
+/****************************************************************************
+ * Global Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: setvbuf
+ *
+ * Description:
+ *   The setvbuf() function may be used after the stream pointed to by
+ *   stream is associated with an open file but before any other operation
+ *   is performed on the stream.  The argument mode determines how stream
+ *   will be buffered:
+ *
+ *     _IOFBF - Causes input/output to be fully buffered.
+ *     _IOLBF - Causes input/output to be line buffered.
+ *     _IONBF - Causes input/output to be unbuffered.
+ *
+ *   If buffer is not a null pointer, the array it points to (of size bytes)
+ *   will be used instead of a buffer allocated by setvbuf().  The array
+ *   must remain valid until the stream is closed.  If buffer is a null
+ *   pointer, then a buffer of size bytes (or CONFIG_STDIO_BUFFER_SIZE bytes
+ *   if size is zero) is allocated.
+ *
+ *   As an extension, setvbuf() may also be called after I/O has been
+ *   performed on the stream:  Any buffered write data is flushed and any
+ *   read-ahead data is discarded before the buffer is replaced.
+ *
+ * Input Parameters:
+ *   stream - The stream to be modified
+ *   buffer - Caller provided buffer or NULL
+ *   mode   - One of _IOFBF, _IOLBF, or _IONBF
+ *   size   - The size of the buffer in bytes
+ *
+ * Returned Value:
+ *   Zero on success; a non-zero value if an invalid value is given for mode
+ *   or if the request cannot be honored (with errno set appropriately).
+ *
+ ****************************************************************************/
+
+int setvbuf(FAR FILE *stream, FAR char *buffer, int mode, size_t size)
+{
+#if CONFIG_STDIO_BUFFER_SIZE > 0
+  FAR unsigned char *newbuf;
+  uint8_t flags;
+  int errcode;
+  int ret;
+
+  /* Verify the arguments */
+
+  if (!stream || (mode != _IOFBF && mode != _IOLBF && mode != _IONBF))
+    {
+      errcode = EINVAL;
+      goto errout;
+    }
+
+  /* Get exclusive access to the stream */
+
+  lib_take_semaphore(stream);
+
+  /* Flush any buffered write data and discard any read-ahead data.  The
+   * contents of the current buffer must not be lost when it is replaced.
+   */
+
+  ret = lib_wrflush(stream);
+  if (ret >= 0)
+    {
+      ret = lib_rdflush(stream);
+    }
+
+  if (ret < 0)
+    {
+      errcode = -ret;
+      goto errout_with_semaphore;
+    }
+
+  /* Select the new buffer */
+
+  flags = (mode == _IOLBF) ? __FS_FLAG_LBF : 0;
+
+  if (mode == _IONBF)
+    {
+      /* No buffer at all.  All I/O goes directly to the file descriptor. */
+
+      newbuf = NULL;
+      size   = 0;
+    }
+  else if (buffer != NULL)
+    {
+      /* Use the caller's buffer */
+
+      if (size == 0)
+        {
+          errcode = EINVAL;
+          goto errout_with_semaphore;
+        }
+
+      newbuf = (FAR unsigned char *)buffer;
+      flags |= __FS_FLAG_UBF;
+    }
+  else
+    {
+      /* Allocate a new buffer of the requested size.  The current buffer
+       * can be re-used if we allocated it and it is of the correct size.
+       */
+
+      if (size == 0)
+        {
+          size = CONFIG_STDIO_BUFFER_SIZE;
+        }
+
+      if (stream->fs_bufstart != NULL &&
+          (stream->fs_flags & __FS_FLAG_UBF) == 0 &&
+          (size_t)(stream->fs_bufend - stream->fs_bufstart) == size)
+        {
+          newbuf = stream->fs_bufstart;
+        }
+      else
+        {
+          newbuf = (FAR unsigned char *)lib_malloc(size);
+          if (newbuf == NULL)
+            {
+              errcode = ENOMEM;
+              goto errout_with_semaphore;
+            }
+        }
+    }
+
+  /* Release the old buffer if we allocated it and it is no longer used */
+
+  if (stream->fs_bufstart != NULL && stream->fs_bufstart != newbuf &&
+      (stream->fs_flags & __FS_FLAG_UBF) == 0)
+    {
+      lib_free(stream->fs_bufstart);
+    }
+
+  /* Install the new buffer and buffering mode */
+
+  stream->fs_bufstart = newbuf;
+  stream->fs_bufend   = newbuf + size;
+  stream->fs_bufpos   = newbuf;
+  stream->fs_bufread  = newbuf;
+  stream->fs_flags    = (stream->fs_flags & ~(__FS_FLAG_LBF | __FS_FLAG_UBF)) |
+                        flags;
+
+  lib_give_semaphore(stream);
+  return OK;
+
+errout_with_semaphore:
+  lib_give_semaphore(stream);
+
+errout:
+  set_errno(errcode);
+  return ERROR;
+#else
+  /* Streams are always unbuffered in this configuration.  Only unbuffered
+   * operation can be honored.
+   */
+
+  if (!stream || mode != _IONBF)
+    {
+      set_errno(EINVAL);
+      return ERROR;
+    }
+
+  return OK;
+#endif
+}
@@ -1,7 +1,7 @@
 /****************************************************************************
  * libc/stdio/lib_stdoutstream.c
  *
- *   Copyright (C) 2007-2009, 2011-2012 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2007-2009, 2011-2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Redistribution and use in source and binary forms, with or without
@@ -79,16 +79,44 @@ static void stdoutstream_putc(FAR struct lib_outstream_s *this, int ch)
 }
 
 /****************************************************************************
- * Name: stdoutstream_flush
+ * Name: stdoutstream_puts
  ****************************************************************************/
 
-#if defined(CONFIG_STDIO_LINEBUFFER) && CONFIG_STDIO_BUFFER_SIZE > 0
-int stdoutstream_flush(FAR struct lib_outstream_s *this)
+static int stdoutstream_puts(FAR struct lib_outstream_s *this,
+                             FAR const char *buffer, int len)
 {
   FAR struct lib_stdoutstream_s *sthis = (FAR struct lib_stdoutstream_s *)this;
-  return lib_fflush(sthis->stream, true);
+  int remaining = len;
+  int nwritten;
+
+  DEBUGASSERT(this && sthis->stream);
+
+  /* Loop until the entire run is transferred or an irrecoverable error
+   * occurs.
+   */
+
+  while (remaining > 0)
+    {
+      nwritten = lib_fwrite(buffer, remaining, sthis->stream);
+      if (nwritten > 0)
+        {
+          this->nput += nwritten;
+          buffer     += nwritten;
+          remaining  -= nwritten;
+        }
+
+      /* EINTR (meaning that the write was interrupted by a signal) is the
+       * only recoverable error.
+       */
+
+      else if (nwritten == 0 || get_errno() != EINTR)
+        {
+          break;
+        }
+    }
+
+  return len - remaining;
 }
-#endif
 
 /****************************************************************************
  * Public Functions
@@ -117,25 +145,16 @@ void lib_stdoutstream(FAR struct lib_stdoutstream_s *stdoutstream,
   /* Select the put operation */
 
   stdoutstream->public.put   = stdoutstream_putc;
+  stdoutstream->public.puts  = stdoutstream_puts;
 
-  /* Select the correct flush operation.  This flush is only called when
-   * a newline is encountered in the output stream.  However, we do not
-   * want to support this line buffering behavior if the stream was
-   * opened in binary mode.  In binary mode, the newline has no special
-   * meaning.
+  /* Select the flush operation.  This flush is only called when a newline
+   * is encountered in the output stream.  There is nothing to do here:
+   * lib_fwrite() already flushes line buffered streams when a newline is
+   * written (and binary streams are not line buffered).
    */
 
 #ifdef CONFIG_STDIO_LINEBUFFER
-#if CONFIG_STDIO_BUFFER_SIZE > 0
-  if ((stream->fs_oflags & O_BINARY) == 0)
-    {
-      stdoutstream->public.flush = stdoutstream_flush;
-    }
-  else
-#endif
-    {
-      stdoutstream->public.flush = lib_noflush;
-    }
+  stdoutstream->public.flush = lib_noflush;
 #endif
 
   /* Set the number of bytes put to zero and remember the stream */
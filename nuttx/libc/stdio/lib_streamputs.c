@@ -0,0 +1,93 @@
+/****************************************************************************
+ * libc/stdio/lib_streamputs.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <assert.h>
+
+#include "lib_internal.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: lib_stream_puts
+ *
+ * Description:
+ *   Send a run of characters to an output stream.  If the stream provides
+ *   a puts method, the entire run is transferred in one call; otherwise
+ *   the characters are transferred one at a time using the put method.
+ *
+ * Input parameters:
+ *   stream - An initialized output stream
+ *   buffer - The characters to be sent
+ *   len    - The number of characters in buffer
+ *
+ * Returned Value:
+ *   The number of characters sent.
+ *
+ ****************************************************************************/
+
+int lib_stream_puts(FAR struct lib_outstream_s *stream,
+                    FAR const char *buffer, int len)
+{
+  int i;
+
+  DEBUGASSERT(stream && buffer);
+
+  if (len <= 0)
+    {
+      return 0;
+    }
+
+  /* Use the batched output method if the stream supports it */
+
+  if (stream->puts)
+    {
+      return stream->puts(stream, buffer, len);
+    }
+
+  /* Otherwise, fall back to one character at a time */
+
+  for (i = 0; i < len; i++)
+    {
+      stream->put(stream, buffer[i]);
+    }
+
+  return len;
+}
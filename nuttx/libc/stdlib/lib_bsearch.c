@@ -0,0 +1,97 @@
+/****************************************************************************
+ * libc/stdlib/lib_bsearch.c
+ *
+ *   Copyright (C) 2013 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdlib.h>
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: bsearch
+ *
+ * Description:
+ *   Search a sorted array of nel objects, the initial element of which is
+ *   pointed to by base, for an element that matches the object pointed to
+ *   by key.  The size of each element in the array is specified by width.
+ *   The array must be sorted in increasing order according to the
+ *   comparison function.
+ *
+ * Returned Value:
+ *   A pointer to a matching member of the array, or NULL if no match is
+ *   found.  If two or more members compare equal, which member is
+ *   returned is unspecified.
+ *
+ ****************************************************************************/
+
+FAR void *bsearch(FAR const void *key, FAR const void *base, size_t nel,
+                  size_t width, int (*compar)(FAR const void *,
+                                              FAR const void *))
+{
+  FAR const char *pivot;
+  size_t low  = 0;
+  size_t high = nel;
+  size_t mid;
+  int result;
+
+  while (low < high)
+    {
+      mid    = low + ((high - low) >> 1);
+      pivot  = (FAR const char *)base + mid * width;
+      result = compar(key, pivot);
+
+      if (result < 0)
+        {
+          high = mid;
+        }
+      else if (result > 0)
+        {
+          low = mid + 1;
+        }
+      else
+        {
+          return (FAR void *)pivot;
+        }
+    }
+
+  return NULL;
+}
@@ -1,7 +1,7 @@
 /****************************************************************************
  * libc/stdlib/lib_qsort.c
  *
- *   Copyright (C) 2007, 2009, 2011 Gregory Nutt. All rights reserved.
+ *   Copyright (C) 2007, 2009, 2011, 2013 Gregory Nutt. All rights reserved.
  *   Author: Gregory Nutt <gnutt@nuttx.org>
  *
  * Leveraged from:
@@ -47,70 +47,200 @@
 #include <nuttx/config.h>
 
 #include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
 #include <stdlib.h>
 
 /****************************************************************************
  * Preprocessor Definitions
  ****************************************************************************/
 
-#define min(a, b)  (a) < (b) ? a : b
+/* Partitions with fewer than this number of elements are finished with an
+ * insertion sort.  Insertion sort does fewer comparisons than partitioning
+ * on very small arrays and has much lower overhead.
+ */
 
-#define swapcode(TYPE, parmi, parmj, n) \
-  { \
-    long i = (n) / sizeof (TYPE); \
-    register TYPE *pi = (TYPE *) (parmi); \
-    register TYPE *pj = (TYPE *) (parmj); \
-    do { \
-      register TYPE  t = *pi; \
-      *pi++ = *pj; \
-      *pj++ = t; \
-    } while (--i > 0); \
-  }
+#define INSERTION_THRESHOLD 12
 
-#define SWAPINIT(a, size) \
-  swaptype = ((char *)a - (char *)0) % sizeof(long) || \
-  size % sizeof(long) ? 2 : size == sizeof(long)? 0 : 1;
+/* Partitions with more than this number of elements use the "ninther" (the
+ * median of three medians) as the pivot rather than the median of three.
+ */
 
-#define swap(a, b) \
-  if (swaptype == 0) \
-    { \
-      long t = *(long *)(a); \
-      *(long *)(a) = *(long *)(b); \
-      *(long *)(b) = t; \
-    } \
-  else \
-    { \
-      swapfunc(a, b, size, swaptype); \
-    }
+#define NINTHER_THRESHOLD   40
+
+/* When partitioning moves no elements, the input was probably already
+ * (nearly) sorted.  An insertion sort of each partition is then attempted,
+ * but abandoned once it has moved this many elements.
+ */
+
+#define PARTIAL_INSERTION_LIMIT 8
+
+#define min(a, b)  ((a) < (b) ? (a) : (b))
 
-#define vecswap(a, b, n) if ((n) > 0) swapfunc(a, b, n, swaptype)
+/* Swap strategies, selected once per sort from the element size and the
+ * alignment of the array.
+ */
+
+#define SWAP_LONG           0  /* Element is exactly one aligned long */
+#define SWAP_INT            1  /* Element is exactly one aligned int */
+#define SWAP_LONGS          2  /* Element is a multiple of aligned longs */
+#define SWAP_BYTES          3  /* Anything else */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+typedef int (*compar_t)(FAR const void *, FAR const void *);
+
+/* This structure describes the array being sorted */
+
+struct qsort_s
+{
+  size_t   size;        /* Size of one element in bytes */
+  compar_t compar;      /* Element comparison function */
+  int      swaptype;    /* See SWAP_* definitions */
+};
 
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
 
-static inline void swapfunc(char *a, char *b, int n, int swaptype);
-static inline char *med3(char *a, char *b, char *c,
-                         int (*compar)(const void *, const void *));
+static int swapinit(FAR const void *base, size_t size);
+static void swapfunc(FAR char *a, FAR char *b, size_t n, int swaptype);
+static inline void swapelem(FAR const struct qsort_s *q, FAR char *a,
+                            FAR char *b);
+static inline FAR char *med3(FAR char *a, FAR char *b, FAR char *c,
+                             compar_t compar);
+static void insertion_sort(FAR const struct qsort_s *q, FAR char *base,
+                           size_t nmemb);
+static bool partial_insertion_sort(FAR const struct qsort_s *q,
+                                   FAR char *base, size_t nmemb);
+static void siftdown(FAR const struct qsort_s *q, FAR char *base,
+                     size_t root, size_t nmemb);
+static void heap_sort(FAR const struct qsort_s *q, FAR char *base,
+                      size_t nmemb);
+static bool partition(FAR const struct qsort_s *q, FAR char *base,
+                      size_t nmemb, FAR size_t *nless,
+                      FAR size_t *ngreater);
+static int depthlimit(size_t nmemb);
+static void introsort(FAR const struct qsort_s *q, FAR char *base,
+                      size_t nmemb, int depth);
 
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
-static inline void swapfunc(char *a, char *b, int n, int swaptype)
+/****************************************************************************
+ * Name: swapinit
+ *
+ * Description:
+ *   Select the fastest way to exchange two elements of the array.
+ *
+ ****************************************************************************/
+
+static int swapinit(FAR const void *base, size_t size)
 {
-  if(swaptype <= 1)
+  uintptr_t addr = (uintptr_t)base;
+
+  if ((addr % sizeof(long)) == 0 && (size % sizeof(long)) == 0)
     {
-      swapcode(long, a, b, n)
+      return size == sizeof(long) ? SWAP_LONG : SWAP_LONGS;
+    }
+
+  if (size == sizeof(int) && (addr % sizeof(int)) == 0)
+    {
+      return SWAP_INT;
+    }
+
+  return SWAP_BYTES;
+}
+
+/****************************************************************************
+ * Name: swapfunc
+ *
+ * Description:
+ *   Exchange two regions of n bytes.  n must be a multiple of the element
+ *   size.
+ *
+ ****************************************************************************/
+
+static void swapfunc(FAR char *a, FAR char *b, size_t n, int swaptype)
+{
+  if (swaptype == SWAP_LONG || swaptype == SWAP_LONGS)
+    {
+      FAR long *pa = (FAR long *)a;
+      FAR long *pb = (FAR long *)b;
+      long tmp;
+
+      for (n /= sizeof(long); n > 0; n--)
+        {
+          tmp   = *pa;
+          *pa++ = *pb;
+          *pb++ = tmp;
+        }
+    }
+  else if (swaptype == SWAP_INT)
+    {
+      FAR int *pa = (FAR int *)a;
+      FAR int *pb = (FAR int *)b;
+      int tmp;
+
+      for (n /= sizeof(int); n > 0; n--)
+        {
+          tmp   = *pa;
+          *pa++ = *pb;
+          *pb++ = tmp;
+        }
     }
   else
     {
-      swapcode(char, a, b, n)
+      char tmp;
+
+      for (; n > 0; n--)
+        {
+          tmp  = *a;
+          *a++ = *b;
+          *b++ = tmp;
+        }
     }
 }
 
-static inline char *med3(char *a, char *b, char *c,
-                         int (*compar)(const void *, const void *))
+/****************************************************************************
+ * Name: swapelem
+ *
+ * Description:
+ *   Exchange two elements.  The common single word cases are handled
+ *   inline.
+ *
+ ****************************************************************************/
+
+static inline void swapelem(FAR const struct qsort_s *q, FAR char *a,
+                            FAR char *b)
+{
+  if (q->swaptype == SWAP_LONG)
+    {
+      long tmp       = *(FAR long *)a;
+      *(FAR long *)a = *(FAR long *)b;
+      *(FAR long *)b = tmp;
+    }
+  else if (q->swaptype == SWAP_INT)
+    {
+      int tmp       = *(FAR int *)a;
+      *(FAR int *)a = *(FAR int *)b;
+      *(FAR int *)b = tmp;
+    }
+  else
+    {
+      swapfunc(a, b, q->size, q->swaptype);
+    }
+}
+
+/****************************************************************************
+ * Name: med3
+ ****************************************************************************/
+
+static inline FAR char *med3(FAR char *a, FAR char *b, FAR char *c,
+                             compar_t compar)
 {
   return compar(a, b) < 0 ?
          (compar(b, c) < 0 ? b : (compar(a, c) < 0 ? c : a ))
@@ -118,76 +248,202 @@ static inline char *med3(char *a, char *b, char *c,
 }
 
 /****************************************************************************
- * Public Function
+ * Name: insertion_sort
  ****************************************************************************/
 
+static void insertion_sort(FAR const struct qsort_s *q, FAR char *base,
+                           size_t nmemb)
+{
+  FAR char *end = base + nmemb * q->size;
+  FAR char *pm;
+  FAR char *pl;
+
+  for (pm = base + q->size; pm < end; pm += q->size)
+    {
+      for (pl = pm; pl > base && q->compar(pl - q->size, pl) > 0;
+           pl -= q->size)
+        {
+          swapelem(q, pl, pl - q->size);
+        }
+    }
+}
+
 /****************************************************************************
- * Name: qsort
+ * Name: partial_insertion_sort
  *
  * Description:
- *   Qsort routine from Bentley & McIlroy's "Engineering a Sort Function".
+ *   Attempt an insertion sort, giving up if more than
+ *   PARTIAL_INSERTION_LIMIT element moves are needed.  Returns true if the
+ *   range is now sorted.  This makes sorting of already sorted (or nearly
+ *   sorted) data run in linear time.
  *
  ****************************************************************************/
 
-void qsort(void *base, size_t nmemb, size_t size,
-           int(*compar)(const void *, const void *))
+static bool partial_insertion_sort(FAR const struct qsort_s *q,
+                                   FAR char *base, size_t nmemb)
 {
-  char *pa, *pb, *pc, *pd, *pl, *pm, *pn;
-  int d, r, swaptype, swap_cnt;
+  FAR char *end = base + nmemb * q->size;
+  FAR char *pm;
+  FAR char *pl;
+  int nmoves = 0;
 
-loop:
-  SWAPINIT(base, size);
-  swap_cnt = 0;
-  if (nmemb < 7)
+  for (pm = base + q->size; pm < end; pm += q->size)
     {
-      for (pm = (char *) base + size; pm < (char *) base + nmemb * size; pm += size)
+      for (pl = pm; pl > base && q->compar(pl - q->size, pl) > 0;
+           pl -= q->size)
         {
-          for (pl = pm; pl > (char *) base && compar(pl - size, pl) > 0; pl -= size)
+          if (++nmoves > PARTIAL_INSERTION_LIMIT)
             {
-              swap(pl, pl - size);
+              return false;
             }
+
+          swapelem(q, pl, pl - q->size);
         }
-      return;
-  }
+    }
+
+  return true;
+}
+
+/****************************************************************************
+ * Name: siftdown
+ *
+ * Description:
+ *   Restore the max-heap property of the subtree rooted at element 'root'
+ *   of a heap containing nmemb elements.
+ *
+ ****************************************************************************/
 
-  pm = (char *) base + (nmemb / 2) * size;
-  if (nmemb > 7)
+static void siftdown(FAR const struct qsort_s *q, FAR char *base,
+                     size_t root, size_t nmemb)
+{
+  FAR char *pr;
+  FAR char *pc;
+  size_t child;
+
+  while ((child = 2 * root + 1) < nmemb)
     {
-      pl = base;
-      pn = (char *) base + (nmemb - 1) * size;
-      if (nmemb > 40)
+      pc = base + child * q->size;
+      if (child + 1 < nmemb && q->compar(pc, pc + q->size) < 0)
+        {
+          child++;
+          pc += q->size;
+        }
+
+      pr = base + root * q->size;
+      if (q->compar(pr, pc) >= 0)
         {
-          d = (nmemb / 8) * size;
-          pl = med3(pl, pl + d, pl + 2 * d, compar);
-          pm = med3(pm - d, pm, pm + d, compar);
-          pn = med3(pn - 2 * d, pn - d, pn, compar);
+          return;
         }
-      pm = med3(pl, pm, pn, compar);
+
+      swapelem(q, pr, pc);
+      root = child;
+    }
+}
+
+/****************************************************************************
+ * Name: heap_sort
+ *
+ * Description:
+ *   Heapsort is used when quicksort partitioning degenerates.  It is
+ *   slower on average but guarantees O(n log n) behavior and uses no
+ *   additional stack.
+ *
+ ****************************************************************************/
+
+static void heap_sort(FAR const struct qsort_s *q, FAR char *base,
+                      size_t nmemb)
+{
+  size_t i;
+
+  if (nmemb < 2)
+    {
+      return;
     }
-  swap(base, pm);
-  pa = pb = (char *) base + size;
 
-  pc = pd = (char *) base + (nmemb - 1) * size;
+  for (i = nmemb / 2; i > 0; i--)
+    {
+      siftdown(q, base, i - 1, nmemb);
+    }
+
+  for (i = nmemb - 1; i > 0; i--)
+    {
+      swapelem(q, base, base + i * q->size);
+      siftdown(q, base, 0, i);
+    }
+}
+
+/****************************************************************************
+ * Name: partition
+ *
+ * Description:
+ *   Three-way partitioning from Bentley & McIlroy's "Engineering a Sort
+ *   Function".  On return, the first *nless elements compare less than the
+ *   pivot, the last *ngreater elements compare greater than the pivot, and
+ *   the elements in between are equal to the pivot.
+ *
+ *   Returns true if any elements had to be exchanged across the pivot.
+ *
+ ****************************************************************************/
+
+static bool partition(FAR const struct qsort_s *q, FAR char *base,
+                      size_t nmemb, FAR size_t *nless, FAR size_t *ngreater)
+{
+  bool swapped = false;
+  size_t size = q->size;
+  FAR char *pa;
+  FAR char *pb;
+  FAR char *pc;
+  FAR char *pd;
+  FAR char *pl;
+  FAR char *pm;
+  FAR char *pn;
+  size_t d;
+  size_t r;
+  int cmp;
+
+  /* Select the pivot and move it to the beginning of the array */
+
+  pl = base;
+  pm = base + (nmemb / 2) * size;
+  pn = base + (nmemb - 1) * size;
+
+  if (nmemb > NINTHER_THRESHOLD)
+    {
+      d  = (nmemb / 8) * size;
+      pl = med3(pl, pl + d, pl + 2 * d, q->compar);
+      pm = med3(pm - d, pm, pm + d, q->compar);
+      pn = med3(pn - 2 * d, pn - d, pn, q->compar);
+    }
+
+  pm = med3(pl, pm, pn, q->compar);
+  swapelem(q, base, pm);
+
+  /* Partition, collecting elements equal to the pivot at both ends */
+
+  pa = pb = base + size;
+  pc = pd = base + (nmemb - 1) * size;
+
   for (;;)
     {
-      while (pb <= pc && (r = compar(pb, base)) <= 0)
+      while (pb <= pc && (cmp = q->compar(pb, base)) <= 0)
         {
-          if (r == 0)
+          if (cmp == 0)
             {
-              swap_cnt = 1;
-              swap(pa, pb);
+              swapelem(q, pa, pb);
               pa += size;
             }
+
           pb += size;
         }
-      while (pb <= pc && (r = compar(pc, base)) >= 0)
+
+      while (pb <= pc && (cmp = q->compar(pc, base)) >= 0)
         {
-          if (r == 0)
+          if (cmp == 0)
             {
-              swap_cnt = 1;
-              swap(pc, pd);
+              swapelem(q, pc, pd);
               pd -= size;
             }
+
           pc -= size;
         }
 
@@ -196,43 +452,253 @@ loop:
           break;
         }
 
-      swap(pb, pc);
-      swap_cnt = 1;
+      swapelem(q, pb, pc);
+      swapped = true;
       pb += size;
       pc -= size;
     }
 
-  if (swap_cnt == 0)
+  /* Move the equal elements from the ends to the middle */
+
+  pn = base + nmemb * size;
+
+  r = min((size_t)(pa - base), (size_t)(pb - pa));
+  if (r > 0)
+    {
+      swapfunc(base, pb - r, r, q->swaptype);
+    }
+
+  r = min((size_t)(pd - pc), (size_t)(pn - pd) - size);
+  if (r > 0)
+    {
+      swapfunc(pb, pn - r, r, q->swaptype);
+    }
+
+  *nless    = (size_t)(pb - pa) / size;
+  *ngreater = (size_t)(pd - pc) / size;
+  return swapped;
+}
+
+/****************************************************************************
+ * Name: depthlimit
+ *
+ * Description:
+ *   Return the partitioning depth after which introsort gives up on
+ *   quicksort and switches to heapsort:  2 * floor(log2(nmemb)).
+ *
+ ****************************************************************************/
+
+static int depthlimit(size_t nmemb)
+{
+  int depth = 0;
+
+  while (nmemb > 1)
+    {
+      nmemb >>= 1;
+      depth  += 2;
+    }
+
+  return depth;
+}
+
+/****************************************************************************
+ * Name: introsort
+ *
+ * Description:
+ *   Quicksort with a recursion depth limit.  The smaller partition is
+ *   sorted recursively and the larger one iteratively so that stack usage
+ *   is bounded by O(log n).  If the depth limit is exceeded (which can only
+ *   happen with adversarial inputs), the partition is finished with
+ *   heapsort.  Small partitions are finished with insertion sort.
+ *
+ ****************************************************************************/
+
+static void introsort(FAR const struct qsort_s *q, FAR char *base,
+                      size_t nmemb, int depth)
+{
+  size_t nless;
+  size_t ngreater;
+  FAR char *upper;
+  bool swapped;
+  bool lsorted;
+  bool usorted;
+
+  while (nmemb > INSERTION_THRESHOLD)
     {
-      /* Switch to insertion sort */
+      if (depth-- <= 0)
+        {
+          heap_sort(q, base, nmemb);
+          return;
+        }
 
-      for (pm = (char *) base + size; pm < (char *) base + nmemb * size; pm += size)
+      swapped = partition(q, base, nmemb, &nless, &ngreater);
+      upper   = base + (nmemb - ngreater) * q->size;
+
+      if (!swapped)
         {
-          for (pl = pm; pl > (char *) base && compar(pl - size, pl) > 0; pl -= size)
+          /* Nothing moved:  The data may already be in order */
+
+          lsorted = partial_insertion_sort(q, base, nless);
+          usorted = partial_insertion_sort(q, upper, ngreater);
+
+          if (lsorted && usorted)
+            {
+              return;
+            }
+          else if (lsorted)
             {
-              swap(pl, pl - size);
+              base  = upper;
+              nmemb = ngreater;
+              continue;
             }
+          else if (usorted)
+            {
+              nmemb = nless;
+              continue;
+            }
+        }
+
+      if (nless < ngreater)
+        {
+          introsort(q, base, nless, depth);
+          base  = upper;
+          nmemb = ngreater;
+        }
+      else
+        {
+          introsort(q, upper, ngreater, depth);
+          nmemb = nless;
         }
+    }
+
+  insertion_sort(q, base, nmemb);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: qsort
+ *
+ * Description:
+ *   Sort an array of nmemb elements.  This is an introsort:  Bentley &
+ *   McIlroy three-way partitioning quicksort with a heapsort fallback that
+ *   bounds the worst case to O(n log n), and insertion sort for small
+ *   partitions.
+ *
+ ****************************************************************************/
+
+void qsort(FAR void *base, size_t nmemb, size_t size,
+           int(*compar)(FAR const void *, FAR const void *))
+{
+  struct qsort_s q;
+
+  if (nmemb < 2 || size == 0)
+    {
       return;
     }
 
-  pn = (char *) base + nmemb * size;
-  r = min(pa - (char *)base, pb - pa);
-  vecswap(base, pb - r, r);
-  r = min(pd - pc, pn - pd - size);
-  vecswap(pb, pn - r, r);
+  q.size     = size;
+  q.compar   = compar;
+  q.swaptype = swapinit(base, size);
+
+  introsort(&q, (FAR char *)base, nmemb, depthlimit(nmemb));
+}
+
+/****************************************************************************
+ * Name: qselect
+ *
+ * Description:
+ *   Partially sort an array (like C++ std::nth_element) so that the element
+ *   at index nth is the element that would be there if the whole array
+ *   were sorted.  No element before nth compares greater than it and no
+ *   element after nth compares less than it.  Runs in O(n) time on
+ *   average and O(n log n) in the worst case.
+ *
+ ****************************************************************************/
+
+void qselect(FAR void *base, size_t nmemb, size_t size, size_t nth,
+             int(*compar)(FAR const void *, FAR const void *))
+{
+  FAR char *start = (FAR char *)base;
+  struct qsort_s q;
+  size_t nless;
+  size_t ngreater;
+  size_t nupper;
+  int depth;
 
-  if ((r = pb - pa) > size)
+  if (nth >= nmemb || size == 0)
     {
-      qsort(base, r / size, size, compar);
+      return;
     }
 
-  if ((r = pd - pc) > size)
+  q.size     = size;
+  q.compar   = compar;
+  q.swaptype = swapinit(base, size);
+
+  depth = depthlimit(nmemb);
+  while (nmemb > INSERTION_THRESHOLD)
     {
-      /* Iterate rather than recurse to save stack space */
-      base = pn - r;
-      nmemb = r / size;
-      goto loop;
+      if (depth-- <= 0)
+        {
+          heap_sort(&q, start, nmemb);
+          return;
+        }
+
+      /* Continue only in the partition that contains nth */
+
+      partition(&q, start, nmemb, &nless, &ngreater);
+      nupper = nmemb - ngreater;
+
+      if (nth < nless)
+        {
+          nmemb = nless;
+        }
+      else if (nth >= nupper)
+        {
+          start += nupper * size;
+          nth   -= nupper;
+          nmemb  = ngreater;
+        }
+      else
+        {
+          /* nth is among the elements equal to the pivot */
+
+          return;
+        }
     }
+
+  insertion_sort(&q, start, nmemb);
 }
 
+/****************************************************************************
+ * Name: qsort_partial
+ *
+ * Description:
+ *   Partially sort an array (like C++ std::partial_sort) so that the first
+ *   nsorted elements are the smallest elements of the array, in sorted
+ *   order.  The order of the remaining elements is unspecified.
+ *
+ ****************************************************************************/
+
+void qsort_partial(FAR void *base, size_t nmemb, size_t size, size_t nsorted,
+                   int(*compar)(FAR const void *, FAR const void *))
+{
+  if (nsorted == 0)
+    {
+      return;
+    }
+
+  if (nsorted < nmemb)
+    {
+      /* Move the nsorted smallest elements to the front.  The last of these
+       * is then already in its final position.
+       */
+
+      qselect(base, nmemb, size, nsorted - 1, compar);
+      nmemb = nsorted - 1;
+    }
+
+  qsort(base, nmemb, size, compar);
+}
@@ -108,7 +108,8 @@ typedef struct nx_fontmetric_s
   uint32_t height   : 6;    /* Height of the font in rows */
   uint32_t xoffset  : 6;    /* Top, left-hand corner X-offset in pixels */
   uint32_t yoffset  : 6;    /* Top, left-hand corner y-offset in pixels */
-  uint32_t unused   : 5;
+  uint32_t aa       : 1;    /* 1: 4-bit anti-aliased glyph */
+  uint32_t unused   : 4;
 } nx_fontmetric_t;
 
 /****************************************************************************
@@ -469,6 +470,119 @@ static void bdf_printoutput(FILE *out,
 
 }
 
+/****************************************************************************
+ * Name: bdf_printaaoutput
+ *
+ * Description:
+ *   Prints to the output stream the information of an individual glyph in
+ *   the NuttX anti-aliased font format.  The BDF glyph is treated as a
+ *   master drawn at twice the output resolution:  Each output pixel holds
+ *   the coverage (0-15) of the corresponding 2x2 block of master pixels,
+ *   two pixels per byte with the left-most pixel in the MS nibble.
+ *
+ * Input Parameters:
+ *   out       - The output stream.
+ *   ginfo     - A glyphinfo_t struct with the glyph's information.
+ *   nxmetric  - A nx_fontmetric_t struct with the master glyph's metrics.
+ *
+ ****************************************************************************/
+static void bdf_printaaoutput(FILE *out,
+                              glyphinfo_t *ginfo,
+                              nx_fontmetric_t *nxmetric)
+{
+  int xoffset;
+  int yoffset;
+  int width;
+  int height;
+  int stride;
+  int x, y, dx, dy;
+  int mx, my;
+  int count;
+  int n;
+
+  /* Only interested in the 7 and 8 bit ranges */
+
+  if (!((ginfo->encoding >= NXFONT_MIN7BIT  &&
+         ginfo->encoding <= NXFONT_MAX7BIT) ||
+        (ginfo->encoding >= NXFONT_MIN8BIT  &&
+         ginfo->encoding <= NXFONT_MAX8BIT)))
+    {
+      return;
+    }
+
+  /* Metrics of the glyph at half of the master resolution.  The glyph box
+   * is grown so that it covers every master pixel.
+   */
+
+  xoffset = nxmetric->xoffset / 2;
+  yoffset = nxmetric->yoffset / 2;
+  width   = (nxmetric->xoffset + nxmetric->width + 1) / 2 - xoffset;
+  height  = (nxmetric->yoffset + nxmetric->height + 1) / 2 - yoffset;
+  stride  = (width + 1) / 2;
+
+  /* Glyph general info */
+
+  fprintf(out, "/* %s (%d) */\n", ginfo->name, ginfo->encoding);
+
+  /* Glyph metrics.  The stride of an anti-aliased glyph is implied by its
+   * width.
+   */
+
+  fprintf(out,
+          "#define NXFONT_METRICS_%d {0, %d, %d, %d, %d, 1}\n",
+          ginfo->encoding, width, height, xoffset, yoffset);
+
+  /* Glyph bitmap */
+
+  fprintf(out, "#define NXFONT_BITMAP_%d {", ginfo->encoding);
+  for (y = 0, n = 0; y < height; y++)
+    {
+      uint8_t nxbyte = 0;
+
+      for (x = 0; x < 2 * stride; x++)
+        {
+          /* Count the master pixels that are set in the 2x2 block */
+
+          count = 0;
+          for (dy = 0; dy < 2; dy++)
+            {
+              my = 2 * (yoffset + y) + dy - nxmetric->yoffset;
+              for (dx = 0; dx < 2 && x < width; dx++)
+                {
+                  mx = 2 * (xoffset + x) + dx - nxmetric->xoffset;
+                  if (my >= 0 && my < nxmetric->height &&
+                      mx >= 0 && mx < nxmetric->width &&
+                      ((ginfo->bitmap[my] >>
+                        (nxmetric->stride * 8 - 1 - mx)) & 1) != 0)
+                    {
+                      count++;
+                    }
+                }
+            }
+
+          /* Scale the count (0-4) to a coverage value (0-15) */
+
+          nxbyte = (nxbyte << 4) | ((count * 15 + 2) / 4);
+          if ((x & 1) != 0)
+            {
+              n++;
+              if (y == height - 1 && x == 2 * stride - 1)
+                {
+                  fprintf(out, "0x%x}\n", nxbyte);
+                }
+              else
+                {
+                  fprintf(out, "0x%x, ", nxbyte);
+                }
+
+              nxbyte = 0;
+            }
+        }
+    }
+
+  fprintf(out, "\n");
+}
+
 /****************************************************************************
  * Main
  ****************************************************************************/
@@ -487,14 +601,27 @@ int main(int argc, char **argv)
   int fbb_y     = 0;
   int fbb_x_off = 0;
   int fbb_y_off = 0;
+
+  /* -a: Generate an anti-aliased font from a BDF master that is drawn at
+   * twice the resolution of the output font
+   */
+
+  bool aa = false;
+  int argn = 1;
+
+  if (argc > 1 && strcmp(argv[1], "-a") == 0)
+    {
+      aa = true;
+      argn++;
+    }
   
   /* Input BDF file */
   
-  input = argv[1];
+  input = argv[argn];
   
   if (input == NULL)
     {
-      printf("%s: no input file\n", argv[0]);
+      printf("usage: %s [-a] <bdf-file> [<header-file>]\n", argv[0]);
       exit(0);
     }
     
@@ -513,9 +640,9 @@ int main(int argc, char **argv)
     }
   
   /* Output file */
-  if (argv[2])
+  if (input != NULL && argv[argn + 1])
     {
-      output = argv[2];
+      output = argv[argn + 1];
     }
   else
     {
@@ -566,8 +693,10 @@ int main(int argc, char **argv)
                   
                   fprintf(out, "/* Maximum height and width of any");
                   fprintf(out, " glyph in the set */\n\n");
-                  fprintf(out, "#define NXFONT_MAXHEIGHT  %d\n", fbb_y);
-                  fprintf(out, "#define NXFONT_MAXWIDTH   %d\n\n", fbb_x);
+                  fprintf(out, "#define NXFONT_MAXHEIGHT  %d\n",
+                          aa ? (fbb_y + 1) / 2 : fbb_y);
+                  fprintf(out, "#define NXFONT_MAXWIDTH   %d\n\n",
+                          aa ? (fbb_x + 1) / 2 : fbb_x);
                 }
                 
               /* STARTCHAR - Individual glyph information */
@@ -646,7 +775,12 @@ int main(int argc, char **argv)
                   if (ginfo.encoding == 32)
                     {
                       fprintf(out, "/* The width of a space */\n\n");
-                      fprintf(out, "#define NXFONT_SPACEWIDTH %d\n\n", ginfo.dw_x0);
+                      fprintf(out, "#define NXFONT_SPACEWIDTH %d\n\n",
+                              aa ? (ginfo.dw_x0 + 1) / 2 : ginfo.dw_x0);
+                    }
+                  else if (aa)
+                    {
+                      bdf_printaaoutput(out, &ginfo, &nxmetric);
                     }
                   else
                     {